@@ -29,6 +29,11 @@
   transmit clocks).  Although the SSC does support independent transmit and 
   receive rates if needed (e.g. separate input and output sample rates).
   
+  The peripheral specific code lives behind the HiFiTransport interface
+  (HiFiSscTransport.cpp for the SSC), so HiFiClass itself only forwards the
+  configuration and runs the user callbacks.  Additional HiFiClass objects
+  can be created on other transports.
+
   To use this library, place the files in a folder called 'HiFi' under the 
   libraries directory in your sketches folder.
 
@@ -47,164 +52,72 @@
   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 
+#include <stdlib.h>
+#include <string.h>
 #include "HiFi.h"
+#include "HiFiSscTransport.h"
+
+#if !defined(ARDUINO_ARCH_SAM)
+#include <time.h>
+#endif
+
+#if defined(ARDUINO_ARCH_SAM)
+static HiFiSscTransport sscTransport;
 
-// Make sure that data is first pin in the list.
-const PinDescription SSCTXPins[]=
+HiFiClass::HiFiClass() : HiFiClass(sscTransport)
 {
-  { PIOA, PIO_PA16B_TD,  ID_PIOA, PIO_PERIPH_B, PIO_DEFAULT, PIN_ATTR_DIGITAL,  NO_ADC, NO_ADC, NOT_ON_PWM,  NOT_ON_TIMER },  // A0
-  { PIOA, PIO_PA15B_TF,  ID_PIOA, PIO_PERIPH_B, PIO_DEFAULT, PIN_ATTR_DIGITAL,  NO_ADC, NO_ADC, NOT_ON_PWM,  NOT_ON_TIMER },  // PIN 24
-  { PIOA, PIO_PA14B_TK,  ID_PIOA, PIO_PERIPH_B, PIO_DEFAULT, PIN_ATTR_DIGITAL,  NO_ADC, NO_ADC, NOT_ON_PWM,  NOT_ON_TIMER },  // PIN 23
-};  
+}
+#endif
 
-// Make sure that data is first pin in the list.
-const PinDescription SSCRXPins[]=
+HiFiClass::HiFiClass(HiFiTransport &transport) :
+  _transport(&transport),
+  _dataOutAddr(NULL),
+  _dataInAddr(NULL),
+  _txChannels(2),
+  _rxChannels(2),
+  _txRing(NULL),
+  _rxRing(NULL),
+  _ringMask(0),
+  _txHead(0),
+  _txTail(0),
+  _rxHead(0),
+  _rxTail(0),
+  _rxFill(0),
+  _txFrameValid(false),
+  _rxFrameValid(false),
+  _underruns(0),
+  _overruns(0),
+  _frameCount(0),
+  _frameOnTx(false),
+  _hookCount(0),
+  onTxReadyCallback(NULL),
+  onRxReadyCallback(NULL)
 {
-  { PIOB, PIO_PB18A_RD,  ID_PIOB, PIO_PERIPH_A, PIO_DEFAULT, PIN_ATTR_DIGITAL,  NO_ADC, NO_ADC, NOT_ON_PWM,  NOT_ON_TIMER },  // A9
-  { PIOB, PIO_PB17A_RF,  ID_PIOB, PIO_PERIPH_A, PIO_DEFAULT, PIN_ATTR_DIGITAL,  NO_ADC, NO_ADC, NOT_ON_PWM,  NOT_ON_TIMER },  // A8
-  { PIOB, PIO_PB19A_RK,  ID_PIOB, PIO_PERIPH_A, PIO_DEFAULT, PIN_ATTR_DIGITAL,  NO_ADC, NO_ADC, NOT_ON_PWM,  NOT_ON_TIMER },  // A10
-};
+}
 
 void HiFiClass::begin(void)
 {
-  // Enable module
-  pmc_enable_periph_clk(ID_SSC);
-  ssc_reset(SSC);
-  
-  _dataOutAddr = (uint32_t *)ssc_get_tx_access(SSC);
-  _dataInAddr = (uint32_t *)ssc_get_rx_access(SSC);
-  
-  // Enable SSC interrupt line from the core
-  NVIC_DisableIRQ(SSC_IRQn);
-  NVIC_ClearPendingIRQ(SSC_IRQn);
-  NVIC_SetPriority(SSC_IRQn, 0);  // most arduino interrupts are set to priority 0.
-  NVIC_EnableIRQ(SSC_IRQn);
+  _transport->attach(this);
+  _transport->begin();
+
+  _dataOutAddr = _transport->getTxDataRegister();
+  _dataInAddr = _transport->getRxDataRegister();
+  _frameCount = 0;
 }
 
 void HiFiClass::configureTx( HiFiAudioMode_t audioMode,
                 HiFiClockMode_t clkMode,
                 uint8_t bitsPerChannel )
 {
-  clock_opt_t tx_clk_option;
-  data_frame_opt_t tx_data_frame_option;
-  
-  memset((uint8_t *)&tx_clk_option, 0, sizeof(clock_opt_t));
-  memset((uint8_t *)&tx_data_frame_option, 0, sizeof(data_frame_opt_t));
-  
-  ///////////////////////////////////////////////////////////////////////////
-  /// Transmitter IO Pin configuration
-  ///////////////////////////////////////////////////////////////////////////
-  uint8_t endpin = sizeof(SSCTXPins)/sizeof(SSCTXPins[0]);
-  if (clkMode == HIFI_CLK_MODE_USE_TK_RK_CLK)
-  {
-    endpin = 1;
-  }
-  
-  for (int i=0; i < endpin; i++)
-  {
-    PIO_Configure(SSCTXPins[i].pPort,
-      SSCTXPins[i].ulPinType,
-      SSCTXPins[i].ulPin,
-      SSCTXPins[i].ulPinConfiguration);
-  }
-  
-  // Note: there is a function in the Atmel ssc driver for configuration of
-  // the peripheral in I2S mode, but it is incomplete and buggy.  This library
-  // will configure the SSC directly which will also shed some light on the
-  // various configuration parameters should a user need something slightly
-  // different.
-
-  ///////////////////////////////////////////////////////////////////////////
-  /// Transmitter clock mode configuration
-  ///////////////////////////////////////////////////////////////////////////
-  switch (clkMode)
-  {      
-    case HIFI_CLK_MODE_USE_EXT_CLKS:
-      // Use clocks on the TK/TF pins
-      // Despite what this looks like, it actually means use the TK clock
-      // pin.  There is both an error in the documentation and the macro
-      // definition supplied by Atmel in the ssc.h file.  The document author
-      // just cut and paste and the Atmel engineer decided to keep the
-      // macro consistent with the data sheet (or didn't pay attention...).
-      // I imagine that this will get fixed at some point, so this may need
-      // to be revisited.
-      tx_clk_option.ul_cks = SSC_TCMR_CKS_RK;
-      
-      if (audioMode == HIFI_AUDIO_MODE_MONO_RIGHT)
-      {
-        // high level on the frame clock is right channel in
-        // I2S.  If we're only using the right channel, then
-        // we can set start condition for right-only
-        tx_clk_option.ul_start_sel = SSC_TCMR_START_RF_RISING;  
-      }
-      else
-      {
-        // stereo or mono-left will start in the left channel slot
-        tx_clk_option.ul_start_sel = SSC_TCMR_START_RF_FALLING;
-      }
-      break;
-    
-    case HIFI_CLK_MODE_USE_TK_RK_CLK:
-      // Despite what this looks like, it actually means use the RK clock
-      // pin.  There is both an error in the documentation and the macro
-      // definition supplied by Atmel in the ssc.h file.  The document author
-      // just cut and paste and the Atmel engineer decided to keep the
-      // macro consistent with the data sheet (or didn't pay attention...).
-      // I imagine that this will get fixed at some point, so this may need
-      // to be revisited. See the external clock case above.
-      tx_clk_option.ul_cks = SSC_TCMR_CKS_TK;
-    
-      // Use the receiver's configuration as the start trigger for
-      // transmit.  The receiver must be configured and running in
-      // order for this to work.
-      tx_clk_option.ul_start_sel = SSC_TCMR_START_RECEIVE;
-      break;
-  }
-  
-  // No output clocks
-  tx_clk_option.ul_ckg = SSC_TCMR_CKG_NONE;
-  tx_clk_option.ul_period = 0;  // we're not master -- set to 0
-  tx_clk_option.ul_cko = SSC_TCMR_CKO_NONE;
-  tx_clk_option.ul_cki = 0;
-  // I2S has a one bit delay on the data.
-  tx_clk_option.ul_sttdly = 1;
-  
-  ///////////////////////////////////////////////////////////////////////////
-  /// Transmitter frame mode configuration.
-  ///////////////////////////////////////////////////////////////////////////
-  tx_data_frame_option.ul_datlen = bitsPerChannel - 1;
-  tx_data_frame_option.ul_msbf = SSC_TFMR_MSBF;
-
-  // number of channels
-  if (audioMode == HIFI_AUDIO_MODE_STEREO) 
-  {
-    tx_data_frame_option.ul_datnb = 1;
-  } 
-  else 
-  {
-    tx_data_frame_option.ul_datnb = 0;
-  }
-
-  // No frame clock output
-  tx_data_frame_option.ul_fsos = SSC_TFMR_FSOS_NONE;
-  
-  ///////////////////////////////////////////////////////////////////////////
-  /// Load configuration and enable TX interrupt
-  ///////////////////////////////////////////////////////////////////////////
-  ssc_set_transmitter(SSC, &tx_clk_option, &tx_data_frame_option);
-  ssc_enable_interrupt(SSC, SSC_IER_TXRDY);  
+  _txChannels = (audioMode == HIFI_AUDIO_MODE_STEREO) ? 2 : 1;
+  _transport->configureTx(audioMode, clkMode, bitsPerChannel);
 }
 
 void HiFiClass::enableTx(bool enable)
 {
-  if (enable)
-  {
-    ssc_enable_tx(SSC);
-  }
-  else
-  {
-    ssc_disable_tx(SSC);
-  }
+  // Frames are counted on the transmitter whenever it runs.
+  _frameOnTx = enable;
+  _transport->enableTx(enable);
 }
 
 void HiFiClass::onTxReady(void(*function)(HiFiChannelID_t)) {
@@ -215,182 +128,309 @@ void HiFiClass::configureRx( HiFiAudioMode_t audioMode,
                 HiFiClockMode_t clkMode,
                 uint8_t bitsPerChannel )
 {
-  clock_opt_t rx_clk_option;
-  data_frame_opt_t rx_data_frame_option;
-  
-  memset((uint8_t *)&rx_clk_option, 0, sizeof(clock_opt_t));
-  memset((uint8_t *)&rx_data_frame_option, 0, sizeof(data_frame_opt_t));
-  
-  ///////////////////////////////////////////////////////////////////////////
-  /// Receiver IO Pin configuration
-  ///////////////////////////////////////////////////////////////////////////
-  uint8_t endpin = sizeof(SSCRXPins)/sizeof(SSCRXPins[0]);
-  if (clkMode == HIFI_CLK_MODE_USE_TK_RK_CLK)
-  {
-    endpin = 1;
-  }
-  
-  for (int i=0; i < (sizeof(SSCRXPins)/sizeof(SSCRXPins[0])); i++)
+  _rxChannels = (audioMode == HIFI_AUDIO_MODE_STEREO) ? 2 : 1;
+  _transport->configureRx(audioMode, clkMode, bitsPerChannel);
+}
+
+void HiFiClass::enableRx(bool enable)
+{
+  _transport->enableRx(enable);
+}
+
+void HiFiClass::onRxReady(void(*function)(HiFiChannelID_t)) {
+  onRxReadyCallback = function;
+}
+
+void HiFiClass::onService(void)
+{
+  _transport->service();
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Frame hooks
+///////////////////////////////////////////////////////////////////////////
+bool HiFiClass::addFrameHook(void (*hook)(uint32_t frame, void *context),
+                             void *context)
+{
+  if (_hookCount == HIFI_MAX_FRAME_HOOKS)
   {
-    PIO_Configure(SSCRXPins[i].pPort,
-            SSCRXPins[i].ulPinType,
-            SSCRXPins[i].ulPin,
-            SSCRXPins[i].ulPinConfiguration);
+    return false;
   }
-  
-  // Note: there is a function in the Atmel ssc driver for configuration of
-  // the peripheral in I2S mode, but it is incomplete and buggy.  This library
-  // will configure the SSC directly which will also shed some light on the
-  // various configuration parameters should a user need something slightly
-  // different.
-
-  ///////////////////////////////////////////////////////////////////////////
-  /// Receiver clock mode configuration
-  ///////////////////////////////////////////////////////////////////////////
-  switch (clkMode)
+
+  // Fill the slot before counting it, the interrupt may be running.  The
+  // barrier keeps the compiler from moving the (non-volatile) slot stores
+  // past the count; the interrupt runs on the same core, so nothing more
+  // is needed.
+  _hooks[_hookCount].hook = hook;
+  _hooks[_hookCount].context = context;
+  asm volatile("" ::: "memory");
+  _hookCount++;
+  return true;
+}
+
+void HiFiClass::removeFrameHook(void (*hook)(uint32_t frame, void *context),
+                                void *context)
+{
+  for (uint8_t i = 0; i < _hookCount; i++)
   {
-    case HIFI_CLK_MODE_USE_EXT_CLKS:
-      // Use clocks on the RK/RF pins
-      rx_clk_option.ul_cks = SSC_RCMR_CKS_RK;
-  
-      if (audioMode == HIFI_AUDIO_MODE_MONO_RIGHT)
-      {
-        // high level on the frame clock is right channel in
-        // I2S.  If we're only using the right channel, then
-        // we can set start condition for right-only
-        rx_clk_option.ul_start_sel = SSC_RCMR_START_RF_RISING;
-      }
-      else
+    if (_hooks[i].hook == hook && _hooks[i].context == context)
+    {
+      // Hide the hooks from here on while the list closes up, so the
+      // interrupt never runs a half copied entry.  They miss any frame
+      // that starts in the meantime.
+      uint8_t count = _hookCount;
+
+      _hookCount = i;
+      asm volatile("" ::: "memory");
+      for (uint8_t j = i; j + 1 < count; j++)
       {
-        // stereo or mono-left will start in the left channel slot
-        rx_clk_option.ul_start_sel = SSC_RCMR_START_RF_FALLING;
+        _hooks[j] = _hooks[j + 1];
       }
-      break;
-  
-    case HIFI_CLK_MODE_USE_TK_RK_CLK:
-      // Use the clock selected by the transmitter config 
-      // (i.e. sync receiver to transmitter).
-      rx_clk_option.ul_cks = SSC_RCMR_CKS_TK;
-  
-      // Use the transmitter's configuration as the start trigger
-      // The transmitter must be configured and running in
-      // order for this to work.
-      rx_clk_option.ul_start_sel = SSC_RCMR_START_TRANSMIT;
-      break;
+      asm volatile("" ::: "memory");
+      _hookCount = count - 1;
+      return;
+    }
   }
+}
 
-  // No output clocks
-  rx_clk_option.ul_ckg = SSC_RCMR_CKG_NONE;
-  rx_clk_option.ul_period = 0;  // we're not master -- set to 0
-  rx_clk_option.ul_cko = SSC_RCMR_CKO_NONE;
-  // I2S latches data on the rising edge of the clock.
-  rx_clk_option.ul_cki = SSC_RCMR_CKI;
-  // I2S has a one bit delay on the data.
-  rx_clk_option.ul_sttdly = 1;
-  
-  ///////////////////////////////////////////////////////////////////////////
-  /// Receiver frame mode configuration.
-  ///////////////////////////////////////////////////////////////////////////
-  rx_data_frame_option.ul_datlen = bitsPerChannel - 1;
-  rx_data_frame_option.ul_msbf = SSC_RFMR_MSBF;
-
-  // number of channels
-  if (audioMode == HIFI_AUDIO_MODE_STEREO) 
+///////////////////////////////////////////////////////////////////////////
+/// Bulk frame transfers
+///////////////////////////////////////////////////////////////////////////
+bool HiFiClass::beginFrames(uint32_t ringFrames)
+{
+  endFrames();
+
+  // Room for ringFrames stereo frames, so mono gets twice as many.
+  uint32_t words = 2;
+  while (words < 2 * ringFrames)
   {
-    rx_data_frame_option.ul_datnb = 1;
-  } 
-  else 
+    words <<= 1;
+  }
+
+  int32_t *txRing = (int32_t *)malloc(sizeof(int32_t) * words);
+  int32_t *rxRing = (int32_t *)malloc(sizeof(int32_t) * words);
+  if (!txRing || !rxRing)
   {
-    rx_data_frame_option.ul_datnb = 0;
+    free(txRing);
+    free(rxRing);
+    return false;
   }
 
-  // No frame clock output
-  rx_data_frame_option.ul_fsos = SSC_TFMR_FSOS_NONE;
-  
-  ///////////////////////////////////////////////////////////////////////////
-  /// Load configuration and enable RX interrupt
-  ///////////////////////////////////////////////////////////////////////////
-  ssc_set_receiver(SSC, &rx_clk_option, &rx_data_frame_option);
-  ssc_enable_interrupt(SSC, SSC_IER_RXRDY);
-}  
+  _ringMask = words - 1;
+  _txHead = 0;
+  _txTail = 0;
+  _rxHead = 0;
+  _rxTail = 0;
+  _rxFill = 0;
+  _txFrameValid = false;
+  _rxFrameValid = false;
+  _underruns = 0;
+  _overruns = 0;
 
-void HiFiClass::enableRx(bool enable)
+  // Last, so the interrupt never sees a ring that isn't set up.
+  _txRing = txRing;
+  _rxRing = rxRing;
+  return true;
+}
+
+void HiFiClass::endFrames()
 {
-  if (enable)
-  {
-    ssc_enable_rx(SSC);
-  }
-  else
+  int32_t *txRing = _txRing;
+  int32_t *rxRing = _rxRing;
+
+  // Hand the interrupt back to the callbacks before letting go of the
+  // memory.
+  _txRing = NULL;
+  _rxRing = NULL;
+  free(txRing);
+  free(rxRing);
+}
+
+uint32_t HiFiClass::getWritableFrames() const
+{
+  if (!_txRing)
   {
-    ssc_disable_rx(SSC);
+    return 0;
   }
+  return ((_ringMask + 1) - (_txHead - _txTail)) / _txChannels;
 }
 
-void HiFiClass::onRxReady(void(*function)(HiFiChannelID_t)) {
-  onRxReadyCallback = function;
+uint32_t HiFiClass::getReadableFrames() const
+{
+  if (!_rxRing)
+  {
+    return 0;
+  }
+  return (_rxHead - _rxTail) / _rxChannels;
 }
 
-void HiFiClass::onService(void)
+uint32_t HiFiClass::writeFrames(const int32_t *buf, uint32_t frames,
+                                uint32_t timeoutMs)
 {
-  HiFiChannelID_t channel;
-  
-  // read and save status -- some bits are cleared on a read 
-  uint32_t status = ssc_get_status(SSC);
+  uint32_t start = elapsedMs(0);
+  uint32_t done = 0;
 
-  if (ssc_is_tx_ready(SSC) == SSC_RC_YES)
+  if (!_txRing)
   {
-    if (HiFi.onTxReadyCallback)
+    return 0;
+  }
+
+  while (done < frames)
+  {
+    uint32_t n = getWritableFrames();
+
+    if (n)
     {
-      // The TXSYN event is triggered based on what the start 
-      // condition was set to during configuration.  This
-      // is usually the left channel, except in the case of the 
-      // mono right setup, in which case it's the right.  This
-      // may need to change if support for other formats 
-      // (e.g. TDM) is added. 
-      if (status & SSC_IER_TXSYN)
+      if (n > frames - done)
       {
-        channel = HIFI_CHANNEL_ID_1;
+        n = frames - done;
       }
-      else
+
+      // Copy in at most two pieces around the end of the ring.
+      uint32_t head = _txHead;
+      uint32_t words = n * _txChannels;
+      uint32_t offset = head & _ringMask;
+      uint32_t first = _ringMask + 1 - offset;
+      if (first > words)
       {
-        channel = HIFI_CHANNEL_ID_2;
+        first = words;
       }
-      HiFi.onTxReadyCallback(channel);
+      memcpy(_txRing + offset, buf, sizeof(int32_t) * first);
+      memcpy(_txRing, buf + first, sizeof(int32_t) * (words - first));
+
+      _txHead = head + words;
+      buf += words;
+      done += n;
+    }
+    else if (elapsedMs(start) >= timeoutMs)
+    {
+      break;
+    }
+    else
+    {
+      _transport->idle();
     }
   }
-  
-  if (ssc_is_rx_ready(SSC) == SSC_RC_YES)
+  return done;
+}
+
+uint32_t HiFiClass::readFrames(int32_t *buf, uint32_t frames,
+                               uint32_t timeoutMs)
+{
+  uint32_t start = elapsedMs(0);
+  uint32_t done = 0;
+
+  if (!_rxRing)
+  {
+    return 0;
+  }
+
+  while (done < frames)
   {
-    if (HiFi.onRxReadyCallback)
+    uint32_t n = getReadableFrames();
+
+    if (n)
     {
-      // The RXSYN event is triggered based on what the start
-      // condition was set to during configuration.  This
-      // is usually the left channel, except in the case of the
-      // mono right setup, in which case it's the right.  This
-      // may need to change if support for other formats
-      // (e.g. TDM) is added.
-      if (status & SSC_IER_RXSYN)
+      if (n > frames - done)
       {
-        channel = HIFI_CHANNEL_ID_1;
+        n = frames - done;
       }
-      else
+
+      uint32_t tail = _rxTail;
+      uint32_t words = n * _rxChannels;
+      uint32_t offset = tail & _ringMask;
+      uint32_t first = _ringMask + 1 - offset;
+      if (first > words)
       {
-        channel = HIFI_CHANNEL_ID_2;
+        first = words;
       }
-      HiFi.onRxReadyCallback(channel);
+      memcpy(buf, _rxRing + offset, sizeof(int32_t) * first);
+      memcpy(buf + first, _rxRing, sizeof(int32_t) * (words - first));
+
+      _rxTail = tail + words;
+      buf += words;
+      done += n;
+    }
+    else if (elapsedMs(start) >= timeoutMs)
+    {
+      break;
+    }
+    else
+    {
+      _transport->idle();
     }
   }
+  return done;
 }
 
-/**
- * \brief Synchronous Serial Controller Handler.
- *
- */
-void SSC_Handler(void)
+// Milliseconds since 'start' (or the current time for start == 0).
+uint32_t HiFiClass::elapsedMs(uint32_t start) const
 {
-  HiFi.onService();
+#if defined(ARDUINO_ARCH_SAM)
+  uint32_t now = millis();
+#else
+  uint32_t now = (uint32_t)((uint64_t)clock() * 1000 / CLOCKS_PER_SEC);
+#endif
+  return now - start;
 }
 
+// Transmit side of the rings, one word per call.  Whether a frame is sent
+// is decided on its first slot: if a whole frame isn't queued by then, the
+// frame goes out as silence and the ring is left alone until the next one.
+HIFI_RAMFUNC void HiFiClass::txRingReady(HiFiChannelID_t channel)
+{
+  uint32_t tail = _txTail;
+
+  if (channel == HIFI_CHANNEL_ID_1)
+  {
+    _txFrameValid = (_txHead - tail) >= _txChannels;
+    if (!_txFrameValid)
+    {
+      _underruns++;
+    }
+  }
+
+  if (_txFrameValid)
+  {
+    *(_dataOutAddr) = _txRing[tail & _ringMask];
+    _txTail = tail + 1;
+  }
+  else
+  {
+    *(_dataOutAddr) = 0;
+  }
+}
+
+// Receive side.  Words of a frame are stored as they arrive but only made
+// visible to readFrames() once the frame is complete.
+HIFI_RAMFUNC void HiFiClass::rxRingReady(HiFiChannelID_t channel)
+{
+  // Always read, it's what clears the ready flag.
+  int32_t value = (int32_t)*(_dataInAddr);
+
+  if (channel == HIFI_CHANNEL_ID_1)
+  {
+    _rxFill = _rxHead;
+    _rxFrameValid = ((_ringMask + 1) - (_rxFill - _rxTail)) >= _rxChannels;
+    if (!_rxFrameValid)
+    {
+      _overruns++;
+    }
+  }
+
+  if (_rxFrameValid)
+  {
+    _rxRing[_rxFill & _ringMask] = value;
+    _rxFill++;
+    if (_rxFill - _rxHead == _rxChannels)
+    {
+      _rxHead = _rxFill;
+      _rxFrameValid = false;
+    }
+  }
+}
+
+#if defined(ARDUINO_ARCH_SAM)
 // Create our object
 HiFiClass HiFi = HiFiClass();
-
+#endif
@@ -36,33 +36,25 @@
 #ifndef HIFI_H
 #define HIFI_H
 
+#if defined(ARDUINO_ARCH_SAM)
 #include "Arduino.h"
-#include "ssc.h"
-
-typedef enum
-{
-  HIFI_AUDIO_MODE_MONO_LEFT,
-  HIFI_AUDIO_MODE_MONO_RIGHT,
-  HIFI_AUDIO_MODE_STEREO
-} HiFiAudioMode_t;
-
-typedef enum
-{
-  HIFI_CLK_MODE_USE_EXT_CLKS,
-  HIFI_CLK_MODE_USE_TK_RK_CLK
-} HiFiClockMode_t;
-
-typedef enum
-{
-  // in MONO modes, channel 1 will be the only one used.  
-  // In STEREO modes, channel 1 is left, channel 2 is right
-  HIFI_CHANNEL_ID_1,
-  HIFI_CHANNEL_ID_2
-} HiFiChannelID_t;
+#endif
+#include "HiFiTransport.h"
+
+// Timeout for readFrames()/writeFrames() that never gives up.
+#define HIFI_WAIT_FOREVER   0xFFFFFFFFUL
+
+#define HIFI_MAX_FRAME_HOOKS  4
 
 class HiFiClass {
 public:
-  HiFiClass() { };  
+#if defined(ARDUINO_ARCH_SAM)
+  // Runs on the SSC
+  HiFiClass();
+#endif
+  // Runs on any other engine.  Each instance has its own callbacks, so
+  // several engines can be active at once.
+  HiFiClass(HiFiTransport &transport);
   void begin();
     
   void configureTx(HiFiAudioMode_t busMode,
@@ -87,18 +79,142 @@ public:
     return *(_dataInAddr);
   }
   
+  // Bulk transfers from loop().  beginFrames() sets up a ring of
+  // 'ringFrames' frames (rounded up to a power of 2) for each direction,
+  // and from then on the interrupt moves words between the rings and the
+  // data registers instead of calling onTxReady()/onRxReady().
+  //
+  // readFrames()/writeFrames() copy interleaved frames (one word per
+  // channel, as configured with configureRx()/configureTx()) and wait,
+  // sleeping between interrupts, until all of them have been moved or
+  // 'timeoutMs' has passed.  They return the number of frames moved, so
+  // a timeout of 0 never blocks.
+  bool beginFrames(uint32_t ringFrames = 1024);
+  void endFrames();
+  uint32_t writeFrames(const int32_t *buf, uint32_t frames,
+                       uint32_t timeoutMs = HIFI_WAIT_FOREVER);
+  uint32_t readFrames(int32_t *buf, uint32_t frames,
+                      uint32_t timeoutMs = HIFI_WAIT_FOREVER);
+
+  // Frames that can be written / read right now without waiting.
+  uint32_t getWritableFrames() const;
+  uint32_t getReadableFrames() const;
+
+  // Transmit frames sent as silence because the ring was empty, and
+  // received frames dropped because it was full.
+  uint32_t getUnderruns() const { return _underruns; }
+  uint32_t getOverruns() const { return _overruns; }
+  
+  // Frames started since begin(), counted on the first slot of each
+  // frame of the transmitter (or the receiver when only it is enabled).
+  // Use it to line other events up with the audio: a callback running
+  // for channel 1 of frame n sees n + 1.
+  uint32_t getFrameCount() const { return _frameCount; }
+
+  // Functions run from the audio interrupt at the start of every frame,
+  // before that frame's callbacks, with the frame's number.  Keep them
+  // short.  Returns false if all HIFI_MAX_FRAME_HOOKS are in use.
+  bool addFrameHook(void (*hook)(uint32_t frame, void *context),
+                    void *context);
+  void removeFrameHook(void (*hook)(uint32_t frame, void *context),
+                       void *context);
+  
   // Interrupt handler function
   void onService(void);
 
+  // Called by the transport when a data register is ready.
+  void txReady(HiFiChannelID_t channel)
+  {
+    if (channel == HIFI_CHANNEL_ID_1 && _frameOnTx)
+    {
+      frameStart();
+    }
+
+    if (_txRing)
+    {
+      txRingReady(channel);
+    }
+    else if (onTxReadyCallback)
+    {
+      onTxReadyCallback(channel);
+    }
+  }
+
+  void rxReady(HiFiChannelID_t channel)
+  {
+    if (channel == HIFI_CHANNEL_ID_1 && !_frameOnTx)
+    {
+      frameStart();
+    }
+
+    if (_rxRing)
+    {
+      rxRingReady(channel);
+    }
+    else if (onRxReadyCallback)
+    {
+      onRxReadyCallback(channel);
+    }
+  }
+
+  HiFiTransport &getTransport() { return *_transport; }
+
 private:
+  void frameStart()
+  {
+    uint32_t frame = _frameCount++;
+
+    for (uint8_t i = 0; i < _hookCount; i++)
+    {
+      _hooks[i].hook(frame, _hooks[i].context);
+    }
+  }
+
+  void txRingReady(HiFiChannelID_t channel);
+  void rxRingReady(HiFiChannelID_t channel);
+  uint32_t elapsedMs(uint32_t start) const;
+
+  HiFiTransport *_transport;
   uint32_t *_dataOutAddr;
   uint32_t *_dataInAddr;
+  uint8_t _txChannels;
+  uint8_t _rxChannels;
+
+  // Rings of words, indices count words and run freely.  Only whole
+  // frames are published, so the two sides always agree on which word is
+  // channel 1.
+  int32_t *_txRing;
+  int32_t *_rxRing;
+  uint32_t _ringMask;
+  volatile uint32_t _txHead;
+  volatile uint32_t _txTail;
+  volatile uint32_t _rxHead;
+  volatile uint32_t _rxTail;
+  uint32_t _rxFill;
+  bool _txFrameValid;
+  bool _rxFrameValid;
+  volatile uint32_t _underruns;
+  volatile uint32_t _overruns;
+
+  volatile uint32_t _frameCount;
+  bool _frameOnTx;
+
+  struct FrameHook
+  {
+    void (*hook)(uint32_t frame, void *context);
+    void *context;
+  };
+
+  FrameHook _hooks[HIFI_MAX_FRAME_HOOKS];
+  volatile uint8_t _hookCount;
   
   // Callback user functions
   void (*onTxReadyCallback)(HiFiChannelID_t channel);
   void (*onRxReadyCallback)(HiFiChannelID_t channel);
 };
 
+#if defined(ARDUINO_ARCH_SAM)
 extern HiFiClass HiFi;
+#endif
 
 #endif
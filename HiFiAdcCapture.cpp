@@ -0,0 +1,290 @@
+/*
+  HiFiAdcCapture.cpp
+
+  Frame locked ADC capture.  See HiFiAdcCapture.h.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#if defined(ARDUINO_ARCH_SAM)
+
+#include <stdlib.h>
+#include "HiFiAdcCapture.h"
+
+HiFiAdcCapture *HiFiAdcCapture::_active = NULL;
+
+static void adcFrameHook(uint32_t frame, void *context)
+{
+  ((HiFiAdcCapture *)context)->onFrame(frame);
+}
+
+HiFiAdcCapture::HiFiAdcCapture() :
+  _hifi(NULL),
+  _trigger(HIFI_ADC_TRIGGER_FRAME),
+  _channels(0),
+  _channelMask(0),
+  _scans(0),
+  _framesPerScan(1),
+  _buffers(NULL),
+  _filled(0),
+  _read(0),
+  _dropped(0),
+  _starting(false),
+  _running(false),
+  _firstFrame(0),
+  _phase(0)
+{
+}
+
+bool HiFiAdcCapture::begin(HiFiClass &hifi, const uint8_t *pins,
+                           uint8_t count, uint16_t scansPerBuffer,
+                           uint16_t framesPerScan, HiFiAdcTrigger_t trigger)
+{
+  end();
+
+  // A buffer is one PDC transfer, whose counter is 16 bits.
+  if (count == 0 || count > HIFI_ADC_MAX_CHANNELS || scansPerBuffer == 0 ||
+      (uint32_t)scansPerBuffer * count > 0xFFFF || framesPerScan == 0 ||
+      (trigger == HIFI_ADC_TRIGGER_TCLK && framesPerScan < 2))
+  {
+    return false;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Pins to ADC channels.  The ADC converts in channel order, so keep the
+  /// pins sorted the same way.
+  ///////////////////////////////////////////////////////////////////////////
+  uint8_t adcChannel[HIFI_ADC_MAX_CHANNELS];
+
+  _channelMask = 0;
+  _channels = 0;
+  for (uint8_t i = 0; i < count; i++)
+  {
+    uint8_t pin = pins[i];
+    uint8_t ch = g_APinDescription[pin].ulADCChannelNumber;
+
+    if (ch == NO_ADC || (_channelMask & (1 << ch)))
+    {
+      return false;
+    }
+    _channelMask |= 1 << ch;
+
+    uint8_t j = _channels++;
+    while (j > 0 && adcChannel[j - 1] > ch)
+    {
+      adcChannel[j] = adcChannel[j - 1];
+      _pins[j] = _pins[j - 1];
+      j--;
+    }
+    adcChannel[j] = ch;
+    _pins[j] = pin;
+  }
+
+  _scans = scansPerBuffer;
+  _framesPerScan = framesPerScan;
+  _trigger = trigger;
+
+  _buffers = (uint16_t *)malloc(sizeof(uint16_t) * HIFI_ADC_BUFFERS *
+                                _scans * _channels);
+  if (!_buffers)
+  {
+    return false;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// ADC: 14MHz clock, hardware trigger from TIOA0 in TCLK mode.
+  ///////////////////////////////////////////////////////////////////////////
+  pmc_enable_periph_clk(ID_ADC);
+  ADC->ADC_CR = ADC_CR_SWRST;
+  ADC->ADC_PTCR = ADC_PTCR_RXTDIS;
+  ADC->ADC_MR = ADC_MR_PRESCAL(2) | ADC_MR_STARTUP_SUT64 |
+                ADC_MR_TRACKTIM(15) | ADC_MR_SETTLING_AST3 |
+                ((trigger == HIFI_ADC_TRIGGER_TCLK) ?
+                  (ADC_MR_TRGEN_EN | ADC_MR_TRGSEL_ADC_TRIG1) : 0);
+  ADC->ADC_CHDR = 0xFFFF;
+  ADC->ADC_CHER = _channelMask;
+  ADC->ADC_IDR = 0xFFFFFFFF;
+  ADC->ADC_IER = ADC_IER_ENDRX;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// TC0 channel 0 counts LRCLK on TCLK0 and sets TIOA0 every
+  /// framesPerScan frames (cleared half way).
+  ///////////////////////////////////////////////////////////////////////////
+  if (trigger == HIFI_ADC_TRIGGER_TCLK)
+  {
+    pmc_enable_periph_clk(ID_TC0);
+    PIO_Configure(PIOB, PIO_PERIPH_B, PIO_PB26B_TCLK0, PIO_DEFAULT);
+
+    TC0->TC_BMR = (TC0->TC_BMR & ~TC_BMR_TC0XC0S_Msk) | TC_BMR_TC0XC0S_TCLK0;
+    TC_Configure(TC0, 0, TC_CMR_TCCLKS_XC0 | TC_CMR_WAVE |
+                 TC_CMR_WAVSEL_UP_RC | TC_CMR_ACPA_CLEAR | TC_CMR_ACPC_SET);
+    TC_SetRA(TC0, 0, framesPerScan / 2);
+    TC_SetRC(TC0, 0, framesPerScan);
+    TC0->TC_CHANNEL[0].TC_CCR = TC_CCR_CLKDIS;
+  }
+
+  _hifi = &hifi;
+  if (!_hifi->addFrameHook(adcFrameHook, this))
+  {
+    end();
+    return false;
+  }
+
+  _active = this;
+  NVIC_DisableIRQ(ADC_IRQn);
+  NVIC_ClearPendingIRQ(ADC_IRQn);
+  NVIC_SetPriority(ADC_IRQn, 1);
+  NVIC_EnableIRQ(ADC_IRQn);
+  return true;
+}
+
+void HiFiAdcCapture::end()
+{
+  if (_hifi)
+  {
+    stop();
+    _hifi->removeFrameHook(adcFrameHook, this);
+    _hifi = NULL;
+  }
+  if (_active == this)
+  {
+    NVIC_DisableIRQ(ADC_IRQn);
+    _active = NULL;
+  }
+  free(_buffers);
+  _buffers = NULL;
+}
+
+void HiFiAdcCapture::start()
+{
+  if (!_buffers)
+  {
+    return;
+  }
+
+  stop();
+
+  uint16_t words = _scans * _channels;
+
+  _filled = 0;
+  _read = 0;
+  ADC->ADC_RPR = (uint32_t)buffer(0);
+  ADC->ADC_RCR = words;
+  ADC->ADC_RNPR = (uint32_t)buffer(1);
+  ADC->ADC_RNCR = words;
+  ADC->ADC_PTCR = ADC_PTCR_RXTEN;
+
+  // The frame hook does the rest, on a frame boundary.
+  _starting = true;
+}
+
+void HiFiAdcCapture::stop()
+{
+  _starting = false;
+  _running = false;
+  if (_trigger == HIFI_ADC_TRIGGER_TCLK)
+  {
+    TC0->TC_CHANNEL[0].TC_CCR = TC_CCR_CLKDIS;
+  }
+  ADC->ADC_PTCR = ADC_PTCR_RXTDIS;
+}
+
+uint32_t HiFiAdcCapture::getAvailable() const
+{
+  uint32_t available = _filled - _read;
+
+  return (available > HIFI_ADC_BUFFERS - 2) ? HIFI_ADC_BUFFERS - 2 : available;
+}
+
+const uint16_t *HiFiAdcCapture::read(uint32_t &frame)
+{
+  uint32_t filled = _filled;
+
+  if (filled == _read)
+  {
+    return NULL;
+  }
+
+  // The DMA owns the buffer it is filling and the one after it, which is
+  // where the oldest unread buffers go once the reader falls behind.
+  if (filled - _read > HIFI_ADC_BUFFERS - 2)
+  {
+    _dropped += filled - _read - (HIFI_ADC_BUFFERS - 2);
+    _read = filled - (HIFI_ADC_BUFFERS - 2);
+  }
+
+  frame = _firstFrame + _read * _scans * _framesPerScan;
+  return buffer(_read++);
+}
+
+// Runs at the start of every audio frame.
+void HiFiAdcCapture::onFrame(uint32_t frame)
+{
+  if (_starting)
+  {
+    _starting = false;
+    _phase = 0;
+    if (_trigger == HIFI_ADC_TRIGGER_TCLK)
+    {
+      // Counting from this frame, the first scan is framesPerScan LRCLK
+      // edges away.
+      _firstFrame = frame + _framesPerScan;
+      TC0->TC_CHANNEL[0].TC_CCR = TC_CCR_CLKEN | TC_CCR_SWTRG;
+    }
+    else
+    {
+      _firstFrame = frame;
+    }
+    _running = true;
+  }
+
+  if (_running && _trigger == HIFI_ADC_TRIGGER_FRAME)
+  {
+    if (_phase == 0)
+    {
+      ADC->ADC_CR = ADC_CR_START;
+    }
+    if (++_phase == _framesPerScan)
+    {
+      _phase = 0;
+    }
+  }
+}
+
+// A buffer is full: the DMA has moved on to the next one, so queue the
+// one after that.
+void HiFiAdcCapture::onService(void)
+{
+  uint32_t status = ADC->ADC_ISR;
+
+  if (status & ADC_ISR_ENDRX)
+  {
+    uint32_t filled = _filled + 1;
+
+    _filled = filled;
+    ADC->ADC_RNPR = (uint32_t)buffer(filled + 1);
+    ADC->ADC_RNCR = _scans * _channels;
+  }
+}
+
+void ADC_Handler(void)
+{
+  if (HiFiAdcCapture::_active)
+  {
+    HiFiAdcCapture::_active->onService();
+  }
+}
+
+#endif
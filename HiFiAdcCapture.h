@@ -0,0 +1,127 @@
+/*
+  HiFiAdcCapture.h
+
+  On-chip ADC capture locked to the audio frames, for lining up sensor
+  readings (vibration, current, ...) with the codec audio.
+
+  A scan converts every selected analog pin once.  Scans are started
+  every 'framesPerScan' audio frames, either:
+
+    - HIFI_ADC_TRIGGER_FRAME: from a HiFi frame hook, i.e. by the audio
+      interrupt at the start of the frame.  Nothing to wire up; the scan
+      starts within the interrupt latency of the frame.
+    - HIFI_ADC_TRIGGER_TCLK: by timer TC0 counting LRCLK, which has to be
+      wired to TCLK0 (pin 22) as well as to the codec.  The timer's TIOA0
+      output starts the ADC directly, so there is no software in the
+      timing at all.  framesPerScan must be at least 2.
+
+  The peripheral DMA moves the results into a set of buffers of
+  'scansPerBuffer' scans, and each finished buffer is stamped with the
+  HiFi frame number (HiFiClass::getFrameCount()) of its first scan.
+  Capture starts at a frame boundary, so the stamps are exact to within
+  one frame.
+
+  Samples are 12 bit, ordered by ADC channel within a scan, which on the
+  Due is the reverse of the A0..A11 numbering; getPin() says which pin
+  each slot is.  Don't use analogRead() while capturing.
+
+  Only available on the Due.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_ADC_CAPTURE_H
+#define HIFI_ADC_CAPTURE_H
+
+#if defined(ARDUINO_ARCH_SAM)
+
+#include "HiFi.h"
+
+#define HIFI_ADC_MAX_CHANNELS   8
+
+// Buffers in the rotation; two are always owned by the DMA.
+#define HIFI_ADC_BUFFERS        4
+
+typedef enum
+{
+  HIFI_ADC_TRIGGER_FRAME,
+  HIFI_ADC_TRIGGER_TCLK
+} HiFiAdcTrigger_t;
+
+class HiFiAdcCapture {
+public:
+  HiFiAdcCapture();
+
+  // 'pins' are Arduino analog pins (A0 ...).  Call after hifi.begin().
+  // scansPerBuffer * count can be at most 65535 samples.
+  bool begin(HiFiClass &hifi, const uint8_t *pins, uint8_t count,
+             uint16_t scansPerBuffer, uint16_t framesPerScan = 1,
+             HiFiAdcTrigger_t trigger = HIFI_ADC_TRIGGER_FRAME);
+  void end();
+
+  // Capture starts at the next frame boundary.
+  void start();
+  void stop();
+
+  // Oldest finished buffer, or NULL if there isn't one yet.  'frame' is
+  // set to the frame number of its first scan.  The buffer stays valid
+  // for at least one buffer period, until the next read().  Buffers not
+  // read in time are dropped, oldest first.
+  const uint16_t *read(uint32_t &frame);
+  uint32_t getAvailable() const;
+
+  uint8_t getChannelCount() const { return _channels; }
+  uint8_t getPin(uint8_t slot) const { return _pins[slot]; }
+  uint16_t getScansPerBuffer() const { return _scans; }
+  uint16_t getFramesPerScan() const { return _framesPerScan; }
+  uint32_t getDroppedBuffers() const { return _dropped; }
+
+  // Interrupt handler functions
+  void onFrame(uint32_t frame);
+  void onService(void);
+
+private:
+  friend void ::ADC_Handler(void);
+
+  // The instance ADC_Handler() dispatches to.
+  static HiFiAdcCapture *_active;
+
+  uint16_t *buffer(uint32_t index) const
+  {
+    return _buffers + (index % HIFI_ADC_BUFFERS) * _scans * _channels;
+  }
+
+  HiFiClass *_hifi;
+  HiFiAdcTrigger_t _trigger;
+  uint8_t _channels;
+  uint8_t _pins[HIFI_ADC_MAX_CHANNELS];
+  uint32_t _channelMask;
+  uint16_t _scans;
+  uint16_t _framesPerScan;
+
+  uint16_t *_buffers;
+  volatile uint32_t _filled;
+  uint32_t _read;
+  uint32_t _dropped;
+
+  volatile bool _starting;
+  volatile bool _running;
+  volatile uint32_t _firstFrame;
+  uint16_t _phase;
+};
+
+#endif
+
+#endif
@@ -0,0 +1,64 @@
+/*
+  HiFiConfig.h
+
+  Build options for the HiFi library.  The Arduino IDE doesn't pass a
+  sketch's #defines on to the libraries it uses, so these are set here
+  (or with -D in compiler.cpp.extra_flags / compiler.c.extra_flags in a
+  platform.local.txt).
+
+  HIFI_RUN_FROM_RAM
+    Copies the interrupt path (SSC_Handler and the transport/ring code it
+    runs), the larger DSP kernels and the FFT sine table into SRAM at
+    start-up.  The flash on the SAM3X needs 4 wait states at 84MHz; the
+    prefetch buffer hides most of them for straight-line code, but not
+    for branches or scattered table reads, which is most of what an
+    interrupt handler and an FFT do.  Costs the size of that code in
+    SRAM plus 4K bytes for the sine table.  See the RamBenchmark example
+    for the difference it makes.
+
+  HIFI_RAM_VECTORS
+    With HIFI_RUN_FROM_RAM, also copies the vector table to SRAM when the
+    SSC is started, so taking the interrupt doesn't wait on the flash.
+
+  HIFI_RAMFUNC / HIFI_RAMDATA can be used on a sketch's own callbacks
+  and tables in the same way.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_CONFIG_H
+#define HIFI_CONFIG_H
+
+#ifndef HIFI_RUN_FROM_RAM
+#define HIFI_RUN_FROM_RAM   0
+#endif
+
+#ifndef HIFI_RAM_VECTORS
+#define HIFI_RAM_VECTORS    1
+#endif
+
+// The Due's linker script copies .ramfunc and .data* into SRAM along with
+// the initialised variables.  Calls between flash and SRAM are out of
+// range of a BL; the linker adds a veneer for them.  noinline keeps a RAM
+// function from being inlined back into a flash caller.
+#if HIFI_RUN_FROM_RAM && defined(ARDUINO_ARCH_SAM)
+#define HIFI_RAMFUNC        __attribute__((section(".ramfunc"), noinline))
+#define HIFI_RAMDATA        __attribute__((section(".data.hifi_ramdata")))
+#else
+#define HIFI_RAMFUNC
+#define HIFI_RAMDATA
+#endif
+
+#endif
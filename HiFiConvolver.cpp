@@ -0,0 +1,286 @@
+/*
+  HiFiConvolver.cpp
+
+  Uniformly partitioned convolution.  See HiFiConvolver.h for an overview.
+
+  Scaling, for a 2B point transform:
+    - input blocks are transformed with the scaled FFT, giving X/2B,
+    - partitions of the impulse response are stored at full scale (H) in
+      Q15, divided by 2^headroom (headroom is negative for quiet responses,
+      which are boosted to keep their resolution),
+    - the products are summed in the frequency domain and the unscaled
+      inverse gives back the (linear) convolution divided by 2^headroom.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "HiFiConvolver.h"
+
+HiFiConvolver::HiFiConvolver() :
+  _blockSize(0),
+  _fftSize(0),
+  _maxPartitions(0),
+  _partitions(0),
+  _head(0),
+  _headroom(0),
+  _filters(NULL),
+  _fdl(NULL),
+  _overlap(NULL),
+  _work(NULL)
+{
+}
+
+bool HiFiConvolver::begin(uint8_t log2Partition, uint16_t maxTaps)
+{
+  end();
+
+  if (!_fft.begin(log2Partition + 1))
+  {
+    return false;
+  }
+
+  _blockSize = 1 << log2Partition;
+  _fftSize = _blockSize * 2;
+  _maxPartitions = (maxTaps + _blockSize - 1) / _blockSize;
+  if (_maxPartitions == 0)
+  {
+    _maxPartitions = 1;
+  }
+
+  _filters = (int16_t *)malloc(sizeof(int16_t) * _fftSize * _maxPartitions);
+  _fdl = (int32_t *)malloc(sizeof(int32_t) * _fftSize * _maxPartitions);
+  _overlap = (int32_t *)malloc(sizeof(int32_t) * _blockSize);
+  _work = (int32_t *)malloc(sizeof(int32_t) * _fftSize * 2);
+
+  if (!_filters || !_fdl || !_overlap || !_work)
+  {
+    end();
+    return false;
+  }
+
+  // Start out as a unit impulse so an unconfigured engine passes audio.
+  int16_t unit = 32767;
+  setImpulseResponse(&unit, 1);
+
+  hifi_cycle_counter_enable();
+  return true;
+}
+
+void HiFiConvolver::end()
+{
+  free(_filters);
+  free(_fdl);
+  free(_overlap);
+  free(_work);
+  _filters = NULL;
+  _fdl = NULL;
+  _overlap = NULL;
+  _work = NULL;
+  _partitions = 0;
+}
+
+// Transform partition 'p' of the response into _work at full scale (Q31).
+void HiFiConvolver::loadPartition(const int16_t *ir, uint16_t taps, uint16_t p)
+{
+  uint16_t start = p * _blockSize;
+
+  for (uint16_t i = 0; i < _fftSize; i++)
+  {
+    uint32_t n = start + i;
+    _work[i] = (i < _blockSize && n < taps) ? (ir[n] * 65536) : 0;
+  }
+
+  // Scaled so it can't overflow; setImpulseResponse() brings it back up to
+  // full scale as it converts to Q15.
+  _fft.forwardReal(_work, true);
+}
+
+bool HiFiConvolver::setImpulseResponse(const int16_t *ir, uint16_t taps)
+{
+  if (!_filters)
+  {
+    return false;
+  }
+
+  uint16_t partitions = (taps + _blockSize - 1) / _blockSize;
+  if (partitions > _maxPartitions || partitions == 0)
+  {
+    return false;
+  }
+
+  // log2 of the transform size; _work holds H / 2^log2Size.
+  uint8_t log2Size = 0;
+  while ((1U << log2Size) < _fftSize)
+  {
+    log2Size++;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Pass 1: bound the gain of the whole response.  Each bin of the sum in
+  /// process() is at most the input's peak times the sum over partitions
+  /// of that bin's |H|, and |re| + |im| is a cheap upper bound on |H|.  The
+  /// sums are kept in the second half of _work (the accumulator in
+  /// process()), with the Nyquist bin's on its own.
+  ///////////////////////////////////////////////////////////////////////////
+  uint16_t bins = _fftSize / 2;
+  uint64_t *sums = (uint64_t *)(_work + _fftSize);
+  uint64_t nyquist = 0;
+
+  memset(sums, 0, sizeof(uint64_t) * bins);
+  for (uint16_t p = 0; p < partitions; p++)
+  {
+    loadPartition(ir, taps, p);
+
+    // DC and Nyquist are both real and share the first slot.
+    sums[0] += hifi_abs32(_work[0]);
+    nyquist += hifi_abs32(_work[1]);
+    for (uint16_t k = 1; k < bins; k++)
+    {
+      sums[k] += (uint64_t)hifi_abs32(_work[2 * k]) +
+                 hifi_abs32(_work[2 * k + 1]);
+    }
+  }
+  uint64_t bound = nyquist;
+
+  for (uint16_t k = 0; k < bins; k++)
+  {
+    if (sums[k] > bound)
+    {
+      bound = sums[k];
+    }
+  }
+
+  // 'bound' is in Q31 / 2^log2Size; unity is 2^(31 - log2Size).  A quiet
+  // response is scaled up instead so it keeps the full Q15 resolution.
+  int8_t headroom = 0;
+  uint64_t unity = 1ULL << (31 - log2Size);
+
+  if (bound > unity)
+  {
+    while ((bound >> headroom) > unity)
+    {
+      headroom++;
+    }
+  }
+  else
+  {
+    while (bound && headroom > -8 && (bound << (1 - headroom)) <= unity)
+    {
+      headroom--;
+    }
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Pass 2: store the spectra as Q15 at full scale, less the headroom.
+  ///////////////////////////////////////////////////////////////////////////
+  for (uint16_t p = 0; p < partitions; p++)
+  {
+    int16_t *h = _filters + p * _fftSize;
+
+    loadPartition(ir, taps, p);
+    for (uint16_t i = 0; i < _fftSize; i++)
+    {
+      int8_t shift = 16 - log2Size + headroom;
+      int32_t v = (shift >= 0) ? (_work[i] >> shift) :
+        hifi_sat32((int64_t)_work[i] * (1 << -shift));
+      h[i] = (v > 32767) ? 32767 : ((v < -32768) ? -32768 : (int16_t)v);
+    }
+  }
+
+  memset(_fdl, 0, sizeof(int32_t) * _fftSize * _maxPartitions);
+  memset(_overlap, 0, sizeof(int32_t) * _blockSize);
+  _partitions = partitions;
+  _headroom = headroom;
+  _head = 0;
+
+  return true;
+}
+
+HIFI_RAMFUNC void HiFiConvolver::process(int32_t *buf, uint8_t stride)
+{
+  int32_t *x;
+  int32_t *acc = _work + _fftSize;
+
+  if (!_partitions)
+  {
+    return;
+  }
+
+  _meter.start();
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Transform [previous block, this block] into the newest FDL slot.
+  ///////////////////////////////////////////////////////////////////////////
+  _head = (_head == 0) ? _partitions - 1 : _head - 1;
+  x = _fdl + _head * _fftSize;
+
+  memcpy(x, _overlap, sizeof(int32_t) * _blockSize);
+  for (uint16_t i = 0; i < _blockSize; i++)
+  {
+    int32_t s = buf[i * stride];
+    x[_blockSize + i] = s;
+    _overlap[i] = s;
+  }
+  _fft.forwardReal(x, true);
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Multiply-accumulate every partition against the matching input block.
+  ///////////////////////////////////////////////////////////////////////////
+  memset(acc, 0, sizeof(int32_t) * _fftSize);
+
+  uint16_t slot = _head;
+  for (uint16_t p = 0; p < _partitions; p++)
+  {
+    const int16_t *h = _filters + p * _fftSize;
+
+    x = _fdl + slot * _fftSize;
+
+    // DC and Nyquist are both real and share the first slot.
+    acc[0] += (int32_t)(((int64_t)x[0] * h[0]) >> 15);
+    acc[1] += (int32_t)(((int64_t)x[1] * h[1]) >> 15);
+
+    for (uint16_t i = 2; i < _fftSize; i += 2)
+    {
+      int32_t xr = x[i];
+      int32_t xi = x[i + 1];
+      int32_t hr = h[i];
+      int32_t hi = h[i + 1];
+
+      acc[i] += (int32_t)(((int64_t)xr * hr - (int64_t)xi * hi) >> 15);
+      acc[i + 1] += (int32_t)(((int64_t)xr * hi + (int64_t)xi * hr) >> 15);
+    }
+
+    if (++slot == _partitions)
+    {
+      slot = 0;
+    }
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Back to the time domain; the second half is the valid output.
+  ///////////////////////////////////////////////////////////////////////////
+  _fft.inverseReal(acc, false);
+
+  for (uint16_t i = 0; i < _blockSize; i++)
+  {
+    int64_t y = acc[_blockSize + i];
+    buf[i * stride] = hifi_sat32((_headroom >= 0) ? (y * (1 << _headroom)) :
+                                 (y >> -_headroom));
+  }
+
+  _meter.stop();
+}
@@ -0,0 +1,95 @@
+/*
+  HiFiConvolver.h
+
+  Uniformly partitioned FFT convolution for the HiFi library.
+
+  Direct (time domain) FIR filtering costs one multiply per tap per sample,
+  which limits cabinet simulation and room correction filters to a few
+  hundred taps at 48kHz.  This engine splits the impulse response into
+  equal partitions the size of the audio block and filters in the frequency
+  domain (overlap-save with a frequency domain delay line), so the cost per
+  sample grows with the number of partitions rather than the number of taps.
+
+  The latency is one partition: process() takes a block of exactly
+  getPartitionSize() samples and returns the filtered block straight away.
+
+  Memory is allocated in begin().  For B sample partitions and P partitions
+  the engine needs roughly 12 * B * P bytes, e.g. 128 sample partitions
+  and a 4096 tap response use about 50K, so on the Due one instance with a
+  few thousand taps is realistic.  See the ConvolutionBenchmark example for
+  measured costs.
+
+  The impulse response is given as Q15 and its spectrum is stored as Q15
+  too.  The spectra are scaled together so that no bin of their sum can
+  overflow, which costs resolution as the response gets longer: with the
+  output at -20dBFS, extras/convolver/convolver_check.cpp measures the
+  error at about -100dBFS RMS for a single partition and -83dBFS for 16.
+  If the response has gain above unity the engine works at a reduced
+  internal level and restores it at the output, so a hot response clips at
+  the output rather than wrapping internally.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_CONVOLVER_H
+#define HIFI_CONVOLVER_H
+
+#include "HiFiDsp.h"
+#include "HiFiFft.h"
+
+class HiFiConvolver {
+public:
+  HiFiConvolver();
+
+  // Partition (and block) size is 2^log2Partition samples; maxTaps sets
+  // how much memory is reserved for the impulse response.  Returns false if
+  // the memory isn't available.
+  bool begin(uint8_t log2Partition, uint16_t maxTaps);
+  void end();
+
+  // Load (or replace) the impulse response.  Not for use from the audio
+  // path: it runs a forward FFT per partition.
+  bool setImpulseResponse(const int16_t *ir, uint16_t taps);
+
+  // Filter one partition's worth of samples in place.  'stride' picks one
+  // channel out of an interleaved block (e.g. 2 for stereo).
+  void process(int32_t *buf, uint8_t stride = 1);
+
+  uint16_t getPartitionSize() const { return _blockSize; }
+  uint16_t getPartitions() const { return _partitions; }
+  uint16_t getLatency() const { return _blockSize; }
+
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  void loadPartition(const int16_t *ir, uint16_t taps, uint16_t p);
+
+  HiFiFft _fft;
+  uint16_t _blockSize;
+  uint16_t _fftSize;
+  uint16_t _maxPartitions;
+  uint16_t _partitions;
+  uint16_t _head;
+  int8_t _headroom;
+
+  int16_t *_filters;        // spectra of the partitions, packed, Q15
+  int32_t *_fdl;            // spectra of the last P input blocks, packed
+  int32_t *_overlap;        // previous input block
+  int32_t *_work;           // FFT scratch
+
+  HiFiCycleMeter _meter;
+};
+
+#endif
@@ -0,0 +1,265 @@
+/*
+  HiFiDma.cpp
+
+  Memory to memory DMA.  See HiFiDma.h.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <string.h>
+#include "HiFiDma.h"
+
+#if defined(ARDUINO_ARCH_SAM)
+#include "Arduino.h"
+#endif
+
+#define HIFI_DMA_MASK       (HIFI_DMA_QUEUE - 1)
+
+// Largest single DMA transfer in units (BTSIZE is 12 bits)
+#define HIFI_DMA_MAX_UNITS  4095
+
+HiFiDmaClass::HiFiDmaClass() :
+  _head(0),
+  _tail(0),
+  _active(false),
+  _begun(false),
+#if !defined(ARDUINO_ARCH_SAM)
+  _deferred(false),
+#endif
+  _queued(0),
+  _completed(0)
+{
+}
+
+void HiFiDmaClass::begin()
+{
+  if (_begun)
+  {
+    return;
+  }
+  _begun = true;
+
+#if defined(ARDUINO_ARCH_SAM)
+  // The controller may already be running for HiFiSpiSram or SD, so only
+  // set it up if it isn't.
+  pmc_enable_periph_clk(ID_DMAC);
+  if (!(DMAC->DMAC_EN & DMAC_EN_ENABLE))
+  {
+    DMAC->DMAC_GCFG = DMAC_GCFG_ARB_CFG_FIXED;
+    DMAC->DMAC_EN = DMAC_EN_ENABLE;
+  }
+
+  DMAC->DMAC_CHDR = DMAC_CHDR_DIS0 << HIFI_DMA_CHANNEL;
+  DMAC->DMAC_EBCIER = DMAC_EBCIER_BTC0 << HIFI_DMA_CHANNEL;
+
+  NVIC_DisableIRQ(DMAC_IRQn);
+  NVIC_ClearPendingIRQ(DMAC_IRQn);
+  NVIC_SetPriority(DMAC_IRQn, 1);
+  NVIC_EnableIRQ(DMAC_IRQn);
+#endif
+}
+
+bool HiFiDmaClass::copy(void *dst, const void *src, uint32_t bytes,
+                        void (*done)(void *), void *context)
+{
+  return queue(dst, src, bytes, false, 0, done, context);
+}
+
+bool HiFiDmaClass::fill(void *dst, uint8_t value, uint32_t bytes,
+                        void (*done)(void *), void *context)
+{
+  return queue(dst, NULL, bytes, true, value, done, context);
+}
+
+bool HiFiDmaClass::queue(void *dst, const void *src, uint32_t bytes,
+                         bool fill, uint8_t value, void (*done)(void *),
+                         void *context)
+{
+  if (((_head + 1) & HIFI_DMA_MASK) == _tail)
+  {
+    return false;
+  }
+
+  begin();
+  _queued++;
+
+  Request &r = _requests[_head];
+
+  r.dst = (uint8_t *)dst;
+  r.src = (const uint8_t *)src;
+  r.bytes = bytes;
+  r.pattern = value * 0x01010101UL;
+  r.fill = fill;
+  r.done = done;
+  r.context = context;
+
+  // The interrupt also starts requests, so keep it out while deciding
+  // whether this one has to be started here.
+#if defined(ARDUINO_ARCH_SAM)
+  NVIC_DisableIRQ(DMAC_IRQn);
+#endif
+  _head = (_head + 1) & HIFI_DMA_MASK;
+  if (!_active)
+  {
+    _active = true;
+    startPiece();
+  }
+#if defined(ARDUINO_ARCH_SAM)
+  NVIC_EnableIRQ(DMAC_IRQn);
+#else
+  // With no controller every piece is done as soon as it starts, so run
+  // the whole queue now unless the caller is standing in for the
+  // interrupt.
+  while (_active && !_deferred)
+  {
+    onService();
+  }
+#endif
+  return true;
+}
+
+void HiFiDmaClass::wait(uint32_t ticket)
+{
+  while (!isComplete(ticket))
+  {
+#if defined(ARDUINO_ARCH_SAM)
+    __WFI();
+#else
+    onService();
+#endif
+  }
+}
+
+// Start the next piece of the request at the tail of the queue, or
+// finish it if there is nothing left.
+void HiFiDmaClass::startPiece()
+{
+  while (true)
+  {
+    Request &r = _requests[_tail];
+
+    if (r.bytes)
+    {
+      uint32_t align = (uint32_t)(uintptr_t)r.dst | r.bytes |
+                       (r.fill ? 0 : (uint32_t)(uintptr_t)r.src);
+      uint8_t shift;
+
+      if ((align & 3) == 0)
+      {
+        shift = 2;
+      }
+      else if ((align & 1) == 0)
+      {
+        shift = 1;
+      }
+      else
+      {
+        shift = 0;
+      }
+
+      uint32_t units = r.bytes >> shift;
+      if (units > HIFI_DMA_MAX_UNITS)
+      {
+        units = HIFI_DMA_MAX_UNITS;
+      }
+      uint32_t length = units << shift;
+
+#if defined(ARDUINO_ARCH_SAM)
+      uint32_t width =
+        (shift == 2) ? (DMAC_CTRLA_SRC_WIDTH_WORD | DMAC_CTRLA_DST_WIDTH_WORD) :
+        (shift == 1) ? (DMAC_CTRLA_SRC_WIDTH_HALF_WORD |
+                        DMAC_CTRLA_DST_WIDTH_HALF_WORD) :
+                       (DMAC_CTRLA_SRC_WIDTH_BYTE | DMAC_CTRLA_DST_WIDTH_BYTE);
+      DmacCh_num *ch = &DMAC->DMAC_CH_NUM[HIFI_DMA_CHANNEL];
+
+      (void)DMAC->DMAC_EBCISR;
+      ch->DMAC_SADDR = r.fill ? (uint32_t)&r.pattern : (uint32_t)r.src;
+      ch->DMAC_DADDR = (uint32_t)r.dst;
+      ch->DMAC_DSCR = 0;
+      ch->DMAC_CTRLA = units | width;
+      ch->DMAC_CTRLB = DMAC_CTRLB_SRC_DSCR | DMAC_CTRLB_DST_DSCR |
+                       DMAC_CTRLB_FC_MEM2MEM_DMA_FC |
+                       (r.fill ? DMAC_CTRLB_SRC_INCR_FIXED :
+                                 DMAC_CTRLB_SRC_INCR_INCREMENTING) |
+                       DMAC_CTRLB_DST_INCR_INCREMENTING;
+      ch->DMAC_CFG = DMAC_CFG_SOD | DMAC_CFG_FIFOCFG_ALAP_CFG;
+      DMAC->DMAC_CHER = DMAC_CHER_ENA0 << HIFI_DMA_CHANNEL;
+#else
+      // The piece completes at the next onService(), as it would at the
+      // next interrupt.
+      if (r.fill)
+      {
+        memset(r.dst, (uint8_t)r.pattern, length);
+      }
+      else
+      {
+        memcpy(r.dst, r.src, length);
+      }
+#endif
+
+      r.dst += length;
+      if (!r.fill)
+      {
+        r.src += length;
+      }
+      r.bytes -= length;
+      return;
+    }
+
+    // Request finished
+    _tail = (_tail + 1) & HIFI_DMA_MASK;
+    _completed++;
+    if (r.done)
+    {
+      r.done(r.context);
+    }
+
+    if (_tail == _head)
+    {
+      _active = false;
+      return;
+    }
+  }
+}
+
+void HiFiDmaClass::onService(void)
+{
+#if defined(ARDUINO_ARCH_SAM)
+  // Reading the status clears it.  HiFiSpiSram reads it too, so go by
+  // whether the channel is still enabled rather than by the flag.
+  (void)DMAC->DMAC_EBCISR;
+
+  if (!_active || (DMAC->DMAC_CHSR & (DMAC_CHSR_ENA0 << HIFI_DMA_CHANNEL)))
+  {
+    return;
+  }
+#else
+  if (!_active)
+  {
+    return;
+  }
+#endif
+  startPiece();
+}
+
+#if defined(ARDUINO_ARCH_SAM)
+void DMAC_Handler(void)
+{
+  HiFiDma.onService();
+}
+#endif
+
+// Create our object
+HiFiDmaClass HiFiDma = HiFiDmaClass();
@@ -0,0 +1,129 @@
+/*
+  HiFiDma.h
+
+  Memory to memory copies and fills on a spare channel of the DMA
+  controller, so large buffer moves can run while the CPU gets on with
+  signal processing.
+
+  Copies are queued and run one after another in the order they were
+  queued.  Each gets a ticket (as with HiFiExtMemory) and can have a
+  function called when it finishes; that function runs in the DMA
+  interrupt.  Transfers use words when the addresses and length allow,
+  otherwise half words or bytes, and are split into pieces of at most
+  4095 units.
+
+  Queue from one context only (normally loop()).  The buffers must stay
+  valid until the ticket has completed.
+
+  It pays off for large moves the CPU doesn't have to wait for.  The
+  library's own block copies (the frame rings, HiFiExtRing staging) are a
+  few hundred bytes that have to be finished before the call returns, so
+  they stay with memcpy(), which is quicker than setting up a transfer
+  and waiting for its interrupt.  HiFiRamMemory uses it to make
+  on-chip RAM behave like a slow background memory.
+
+  Everywhere other than the Due the copies are done with memcpy()/
+  memset() as they are queued, so code using HiFiDma runs unchanged on a
+  PC.  setHostDeferred() instead leaves each piece pending until
+  onService() is called, so a test can play the part of the interrupt
+  (see extras/dma/dma_check.cpp).
+
+  Uses DMA channel HIFI_DMA_CHANNEL.  HiFiSpiSram uses channels 2 and 3.
+  The stock SD library doesn't use the DMA controller; SdFat built with
+  its SAM3X DMA option takes channels 0 and 1.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_DMA_H
+#define HIFI_DMA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define HIFI_DMA_CHANNEL    4
+
+// Pending transfers, must be a power of two
+#define HIFI_DMA_QUEUE      8
+
+class HiFiDmaClass {
+public:
+  HiFiDmaClass();
+
+  // Called by the first copy() or fill(); only needed to set up the
+  // controller ahead of time.
+  void begin();
+
+  // Queue a copy of 'bytes' from 'src' to 'dst', or a fill of 'bytes' at
+  // 'dst' with 'value'.  'done' is called with 'context' when it has
+  // finished.  Returns false if the queue is full (nothing is queued).
+  bool copy(void *dst, const void *src, uint32_t bytes,
+            void (*done)(void *) = NULL, void *context = NULL);
+  bool fill(void *dst, uint8_t value, uint32_t bytes,
+            void (*done)(void *) = NULL, void *context = NULL);
+
+  uint32_t getLastTicket() const { return _queued; }
+  bool isComplete(uint32_t ticket) const
+  {
+    return (int32_t)(_completed - ticket) >= 0;
+  }
+  bool isIdle() const { return _completed == _queued; }
+
+  // Wait for a ticket / everything queued so far.
+  void wait(uint32_t ticket);
+  void flush() { wait(_queued); }
+
+  // Interrupt handler function
+  void onService(void);
+
+#if !defined(ARDUINO_ARCH_SAM)
+  // Leave transfers to be finished by onService(), a piece per call.
+  void setHostDeferred(bool deferred) { _deferred = deferred; }
+#endif
+
+private:
+  // extras/dma/dma_check.cpp starts the tickets near wraparound.
+  friend class HiFiDmaCheck;
+
+  bool queue(void *dst, const void *src, uint32_t bytes, bool fill,
+             uint8_t value, void (*done)(void *), void *context);
+  void startPiece();
+
+  struct Request
+  {
+    uint8_t *dst;
+    const uint8_t *src;
+    uint32_t bytes;             // still to be started
+    uint32_t pattern;           // fill value, repeated
+    bool fill;
+    void (*done)(void *);
+    void *context;
+  };
+
+  Request _requests[HIFI_DMA_QUEUE];
+  volatile uint8_t _head;
+  volatile uint8_t _tail;
+  volatile bool _active;
+  bool _begun;
+#if !defined(ARDUINO_ARCH_SAM)
+  bool _deferred;
+#endif
+  volatile uint32_t _queued;
+  volatile uint32_t _completed;
+};
+
+extern HiFiDmaClass HiFiDma;
+
+#endif
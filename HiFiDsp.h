@@ -0,0 +1,218 @@
+/*
+  HiFiDsp.h
+
+  Small fixed-point helpers shared by the HiFi signal processing blocks.
+
+  Samples travel through the library the same way they come out of the SSC:
+  as 32 bit words with the audio data left justified (i.e. Q31).  Blocks are
+  interleaved frames, so a stereo block of N frames holds 2*N words with the
+  left channel first.  Everything here is written with the Cortex-M3 in mind
+  (single cycle 32x32->64 multiply, no FPU), but none of it depends on the
+  hardware except the cycle meter.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_DSP_H
+#define HIFI_DSP_H
+
+#include <math.h>
+#include <stdint.h>
+#include "HiFiConfig.h"
+
+#if defined(ARDUINO_ARCH_SAM)
+#include "Arduino.h"
+#endif
+
+#define HIFI_Q31_ONE    0x7FFFFFFF
+
+// Clamp a 64 bit intermediate back into a 32 bit sample.
+static inline int32_t hifi_sat32(int64_t x)
+{
+  if (x > (int64_t)0x7FFFFFFF)
+  {
+    return 0x7FFFFFFF;
+  }
+  if (x < -(int64_t)0x80000000)
+  {
+    return (int32_t)0x80000000;
+  }
+  return (int32_t)x;
+}
+
+// Q31 x Q31 -> Q31 (truncating).  Compiles down to a single SMULL on the M3.
+static inline int32_t hifi_mul_q31(int32_t a, int32_t b)
+{
+  return (int32_t)(((int64_t)a * b) >> 31);
+}
+
+// Float in -1 .. 1 to Q31.  Anything from 1.0 up gives HIFI_Q31_ONE:
+// 1.0f * 2147483647.0f rounds to 2^31, which doesn't fit.
+static inline int32_t hifi_float_to_q31(float x)
+{
+  if (x >= 1.0f)
+  {
+    return HIFI_Q31_ONE;
+  }
+  if (x <= -1.0f)
+  {
+    return (int32_t)0x80000000;
+  }
+  return (int32_t)(x * 2147483648.0f);
+}
+
+// Q31 coefficient for one pole smoothing evaluated once per block of
+// 'blockFrames':
+//   coef = 1 - exp(-blockTime / timeConstant)
+// A time constant of zero or less means no smoothing (HIFI_Q31_ONE).
+static inline int32_t hifi_one_pole_coef(float timeMs, uint16_t blockFrames,
+                                         uint32_t sampleRate)
+{
+  if (timeMs <= 0.0f)
+  {
+    return HIFI_Q31_ONE;
+  }
+
+  float blockMs = (1000.0f * blockFrames) / (float)sampleRate;
+  return hifi_float_to_q31(1.0f - expf(-blockMs / timeMs));
+}
+
+// Absolute value that doesn't overflow on the most negative sample.
+static inline uint32_t hifi_abs32(int32_t x)
+{
+  return (x < 0) ? (uint32_t)(-(int64_t)x) : (uint32_t)x;
+}
+
+// Largest absolute sample value in a block.  'stride' lets a single channel
+// be picked out of an interleaved block.
+static inline uint32_t hifi_block_peak(const int32_t *buf, uint32_t count,
+                                       uint32_t stride)
+{
+  uint32_t peak = 0;
+
+  for (uint32_t i = 0; i < count; i += stride)
+  {
+    uint32_t mag = hifi_abs32(buf[i]);
+    if (mag > peak)
+    {
+      peak = mag;
+    }
+  }
+  return peak;
+}
+
+// log2(x) as Q16.16 for x > 0.  The mantissa correction is a single
+// quadratic term, good to about 0.008 (0.025dB), which is plenty for
+// metering and display.  Returns 0 for x == 0.
+static inline int32_t hifi_log2_q16(uint32_t x)
+{
+  if (x == 0)
+  {
+    return 0;
+  }
+
+  int32_t e = 31 - __builtin_clz(x);
+  uint32_t m = (e >= 16) ? (x >> (e - 16)) : (x << (16 - e));
+  uint32_t f = m - 0x10000;
+
+  // log2(1 + f) ~= f + 0.3466 * f * (1 - f)
+  return (e << 16) + f + (((f * (0x10000 - f)) >> 16) * 22713 >> 16);
+}
+
+static inline int32_t hifi_log2_q16_u64(uint64_t x)
+{
+  uint32_t hi = (uint32_t)(x >> 32);
+
+  if (hi)
+  {
+    // Keep 32 significant bits and account for the ones dropped.
+    uint8_t shift = 32 - __builtin_clz(hi);
+    return hifi_log2_q16((uint32_t)(x >> shift)) + ((int32_t)shift << 16);
+  }
+  return hifi_log2_q16((uint32_t)x);
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Cycle meter
+///
+/// Uses the DWT cycle counter to time a block of processing.  Each of the
+/// processing blocks keeps one of these so that the CPU cost of every
+/// instance can be read back from a sketch.  On anything other than the
+/// Due the counter reads as zero.
+///////////////////////////////////////////////////////////////////////////
+static inline void hifi_cycle_counter_enable(void)
+{
+#if defined(ARDUINO_ARCH_SAM)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+static inline uint32_t hifi_cycle_count(void)
+{
+#if defined(ARDUINO_ARCH_SAM)
+  return DWT->CYCCNT;
+#else
+  return 0;
+#endif
+}
+
+class HiFiCycleMeter {
+public:
+  HiFiCycleMeter() : _start(0), _last(0), _peak(0) { };
+
+  void start()
+  {
+    _start = hifi_cycle_count();
+  }
+
+  void stop()
+  {
+    _last = hifi_cycle_count() - _start;
+    if (_last > _peak)
+    {
+      _peak = _last;
+    }
+  }
+
+  void reset()
+  {
+    _last = 0;
+    _peak = 0;
+  }
+
+  // Cycles spent in the most recent / most expensive measured call
+  uint32_t getCycles() const { return _last; }
+  uint32_t getPeakCycles() const { return _peak; }
+
+  // Percentage of the CPU used by the last call, given how many frames it
+  // processed and the frame rate.  Intended for reporting, not the audio path.
+  float getLoad(uint32_t frames, uint32_t sampleRate,
+                uint32_t cpuHz = 84000000UL) const
+  {
+    if (frames == 0)
+    {
+      return 0.0f;
+    }
+    return (100.0f * _last * sampleRate) / ((float)frames * cpuHz);
+  }
+
+private:
+  uint32_t _start;
+  uint32_t _last;
+  uint32_t _peak;
+};
+
+#endif
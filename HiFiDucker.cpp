@@ -0,0 +1,150 @@
+/*
+  HiFiDucker.cpp
+
+  Sidechain ducking.  See HiFiDucker.h.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <math.h>
+#include "HiFiDucker.h"
+
+HiFiDucker::HiFiDucker() :
+  _sampleRate(48000),
+  _blockFrames(64),
+  _attackMs(20.0f),
+  _holdMs(500.0f),
+  _releaseMs(800.0f),
+  _threshold(0),
+  _depth(0),
+  _attackCoef(HIFI_Q31_ONE),
+  _releaseCoef(HIFI_Q31_ONE),
+  _holdBlocks(0),
+  _holdLeft(0),
+  _lastGain(HIFI_Q31_ONE),
+  _gain(HIFI_Q31_ONE)
+{
+  // Defaults, so that settings made before begin() are kept.
+  configure(-40.0f, -15.0f, _attackMs, _holdMs, _releaseMs);
+}
+
+void HiFiDucker::begin(uint32_t sampleRate, uint16_t blockFrames)
+{
+  _sampleRate = sampleRate;
+  _blockFrames = blockFrames ? blockFrames : 1;
+  _holdLeft = 0;
+  _lastGain = HIFI_Q31_ONE;
+  _gain = HIFI_Q31_ONE;
+
+  updateCoefficients();
+  hifi_cycle_counter_enable();
+}
+
+void HiFiDucker::configure(float thresholdDbfs,
+                           float depthDb,
+                           float attackMs,
+                           float holdMs,
+                           float releaseMs)
+{
+  float threshold = powf(10.0f, thresholdDbfs / 20.0f);
+  float depth = powf(10.0f, depthDb / 20.0f);
+
+  if (threshold > 1.0f)
+  {
+    threshold = 1.0f;
+  }
+  if (depth > 1.0f)
+  {
+    depth = 1.0f;
+  }
+
+  _threshold = (uint32_t)hifi_float_to_q31(threshold);
+  _depth = hifi_float_to_q31(depth);
+  _attackMs = attackMs;
+  _holdMs = holdMs;
+  _releaseMs = releaseMs;
+
+  updateCoefficients();
+}
+
+void HiFiDucker::updateCoefficients()
+{
+  // One pole smoothing of the gain.
+  float blockMs = (1000.0f * _blockFrames) / (float)_sampleRate;
+
+  _attackCoef = hifi_one_pole_coef(_attackMs, _blockFrames, _sampleRate);
+  _releaseCoef = hifi_one_pole_coef(_releaseMs, _blockFrames, _sampleRate);
+
+  // At least the block that triggered it
+  _holdBlocks = (uint16_t)(_holdMs / blockMs + 0.5f) + 1;
+}
+
+float HiFiDucker::getGainDb() const
+{
+  return 20.0f * log10f((float)_gain / HIFI_Q31_ONE);
+}
+
+HIFI_RAMFUNC void HiFiDucker::detect(const int32_t *sidechain, uint16_t frames,
+                                     uint8_t stride)
+{
+  if (hifi_block_peak(sidechain, (uint32_t)frames * stride, stride) >
+      _threshold)
+  {
+    _holdLeft = _holdBlocks;
+  }
+  else if (_holdLeft)
+  {
+    _holdLeft--;
+  }
+
+  int32_t target = _holdLeft ? _depth : HIFI_Q31_ONE;
+  int32_t coef = (target < _gain) ? _attackCoef : _releaseCoef;
+
+  _lastGain = _gain;
+  _gain += hifi_mul_q31(target - _gain, coef);
+
+  // Land on unity exactly, so apply() can go back to doing nothing.
+  if (target == HIFI_Q31_ONE && HIFI_Q31_ONE - _gain < 0x10000)
+  {
+    _gain = HIFI_Q31_ONE;
+  }
+}
+
+HIFI_RAMFUNC void HiFiDucker::apply(int32_t *buf, uint16_t frames,
+                                    uint8_t channels)
+{
+  _meter.start();
+
+  if (_gain == HIFI_Q31_ONE && _lastGain == HIFI_Q31_ONE)
+  {
+    _meter.stop();
+    return;
+  }
+
+  int32_t step = (_gain - _lastGain) / (int32_t)frames;
+  int32_t gain = _lastGain;
+
+  for (uint16_t i = 0; i < frames; i++)
+  {
+    gain += step;
+    for (uint8_t ch = 0; ch < channels; ch++)
+    {
+      *buf = hifi_mul_q31(*buf, gain);
+      buf++;
+    }
+  }
+
+  _meter.stop();
+}
@@ -0,0 +1,100 @@
+/*
+  HiFiDucker.h
+
+  Automatic ducking: turns one or more sources (background music) down
+  while another (announcements, or the microphone) is active, and back up
+  once it has been quiet for a while.
+
+  Once per block, detect() compares the peak of the sidechain block with
+  a threshold.  While it is above, the gain heads for the duck depth with
+  the attack time constant; once it drops below, the gain holds for the
+  hold time and then returns to unity with the release time constant.
+  apply() ramps each ducked block from the last block's gain to the new
+  one, so there is no zipper noise, and can be called for as many
+  sources as share the duck.
+
+  The cost per sample is one multiply and an add for the ramp, and
+  nothing at all while the gain is sitting at unity.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_DUCKER_H
+#define HIFI_DUCKER_H
+
+#include "HiFiDsp.h"
+
+class HiFiDucker {
+public:
+  HiFiDucker();
+
+  // The frame rate and the number of frames per block (the time
+  // constants are worked out per block).  configure() can be called
+  // before or after begin().
+  void begin(uint32_t sampleRate, uint16_t blockFrames);
+
+  void configure(float thresholdDbfs,
+                 float depthDb,
+                 float attackMs,
+                 float holdMs,
+                 float releaseMs);
+
+  // Once per block: look at the sidechain and work out the new gain.
+  // 'stride' picks one channel out of an interleaved block.
+  void detect(const int32_t *sidechain, uint16_t frames, uint8_t stride = 1);
+
+  // Duck a block of 'channels' interleaved channels with the gain from
+  // the last detect().
+  void apply(int32_t *buf, uint16_t frames, uint8_t channels = 1);
+
+  // Both of the above for a single ducked source.
+  void process(int32_t *buf, uint16_t frames, uint8_t channels,
+               const int32_t *sidechain, uint8_t sidechainStride = 1)
+  {
+    detect(sidechain, frames, sidechainStride);
+    apply(buf, frames, channels);
+  }
+
+  // Gain state.  The gain is Q31 (HIFI_Q31_ONE is unity).
+  int32_t getGain() const { return _gain; }
+  float getGainDb() const;
+  bool isTriggered() const { return _holdLeft > 0; }
+
+  // Cycles for the last apply()
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  void updateCoefficients();
+
+  uint32_t _sampleRate;
+  uint16_t _blockFrames;
+
+  float _attackMs;
+  float _holdMs;
+  float _releaseMs;
+  uint32_t _threshold;      // Q31 peak
+  int32_t _depth;           // Q31 gain
+  int32_t _attackCoef;      // Q31, per block
+  int32_t _releaseCoef;     // Q31, per block
+  uint16_t _holdBlocks;
+
+  uint16_t _holdLeft;       // blocks
+  int32_t _lastGain;        // at the start of the block
+  int32_t _gain;            // at the end of the block
+
+  HiFiCycleMeter _meter;
+};
+
+#endif
@@ -0,0 +1,435 @@
+/*
+  HiFiExtBuffers.cpp
+
+  Prefetching delay lines and FIFOs in external memory.  See
+  HiFiExtBuffers.h.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "HiFiExtBuffers.h"
+
+static inline int16_t sat16(int32_t x)
+{
+  if (x > 32767)
+  {
+    return 32767;
+  }
+  if (x < -32768)
+  {
+    return -32768;
+  }
+  return (int16_t)x;
+}
+
+static inline int32_t toQ15(float x)
+{
+  if (x > 1.0f)
+  {
+    x = 1.0f;
+  }
+  if (x < -1.0f)
+  {
+    x = -1.0f;
+  }
+  return (int32_t)(x * 32767.0f);
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// HiFiExtDelay
+///////////////////////////////////////////////////////////////////////////
+HiFiExtDelay::HiFiExtDelay() :
+  _memory(NULL),
+  _address(0),
+  _length(0),
+  _channels(1),
+  _blockFrames(0),
+  _writePos(0),
+  _delay(0),
+  _current(0),
+  _feedback(0),
+  _wetGain(0),
+  _dryGain(0),
+  _stalls(0)
+{
+  _fetched[0] = _fetched[1] = NULL;
+  _staged[0] = _staged[1] = NULL;
+  _fetchTicket[0] = _fetchTicket[1] = 0;
+  _stageTicket[0] = _stageTicket[1] = 0;
+}
+
+bool HiFiExtDelay::begin(HiFiExtMemory &memory, uint32_t address,
+                         uint32_t maxDelay, uint8_t channels,
+                         uint16_t blockFrames)
+{
+  end();
+
+  if (channels == 0 || channels > 2 || blockFrames == 0)
+  {
+    return false;
+  }
+
+  // Whole blocks, so block writes never wrap.
+  uint32_t length = ((maxDelay + blockFrames - 1) / blockFrames) * blockFrames;
+  if (length < blockFrames)
+  {
+    length = blockFrames;
+  }
+  if (address + length * channels * sizeof(int16_t) > memory.getSize())
+  {
+    return false;
+  }
+
+  uint32_t blockSamples = (uint32_t)blockFrames * channels;
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    _fetched[i] = (int16_t *)malloc(sizeof(int16_t) * blockSamples);
+    _staged[i] = (int16_t *)malloc(sizeof(int16_t) * blockSamples);
+    if (!_fetched[i] || !_staged[i])
+    {
+      end();
+      return false;
+    }
+    memset(_fetched[i], 0, sizeof(int16_t) * blockSamples);
+    memset(_staged[i], 0, sizeof(int16_t) * blockSamples);
+  }
+
+  _memory = &memory;
+  _address = address;
+  _length = length;
+  _channels = channels;
+  _blockFrames = blockFrames;
+  _writePos = 0;
+  _delay = length;
+  _current = 0;
+  _stalls = 0;
+
+  // Clear the line, a block at a time from the zeroed staging buffer.
+  for (uint32_t pos = 0; pos < length; pos += blockFrames)
+  {
+    while (!_memory->queueWrite(_address + pos * channels * sizeof(int16_t),
+                                _staged[0], blockSamples * sizeof(int16_t)))
+    {
+      _memory->poll();
+    }
+  }
+  _memory->flush();
+  _stageTicket[0] = _stageTicket[1] = _memory->getLastTicket();
+
+  setFeedback(0.0f);
+  setMix(0.5f);
+
+  queueFetch();
+  hifi_cycle_counter_enable();
+  return true;
+}
+
+void HiFiExtDelay::end()
+{
+  if (_memory)
+  {
+    // Don't free buffers the memory is still reading or writing.
+    _memory->flush();
+    _memory = NULL;
+  }
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    free(_fetched[i]);
+    free(_staged[i]);
+    _fetched[i] = NULL;
+    _staged[i] = NULL;
+  }
+}
+
+uint32_t HiFiExtDelay::getBytes() const
+{
+  return _length * _channels * sizeof(int16_t);
+}
+
+void HiFiExtDelay::setDelay(uint32_t frames)
+{
+  if (frames < _blockFrames)
+  {
+    frames = _blockFrames;
+  }
+  if (frames > _length)
+  {
+    frames = _length;
+  }
+  _delay = frames;
+}
+
+void HiFiExtDelay::setFeedback(float feedback)
+{
+  if (feedback > 0.97f)
+  {
+    feedback = 0.97f;
+  }
+  if (feedback < 0.0f)
+  {
+    feedback = 0.0f;
+  }
+  _feedback = toQ15(feedback);
+}
+
+void HiFiExtDelay::setMix(float mix)
+{
+  _wetGain = toQ15(mix);
+  _dryGain = toQ15(1.0f - mix);
+}
+
+void HiFiExtDelay::wait(uint32_t ticket)
+{
+  if (!_memory->isComplete(ticket))
+  {
+    _stalls++;
+    while (!_memory->isComplete(ticket))
+    {
+      _memory->poll();
+    }
+  }
+}
+
+// Queue the read of the block that will be played after the one being
+// processed now (the write position has already moved on to it).
+void HiFiExtDelay::queueFetch()
+{
+  uint8_t next = _current ^ 1;
+  uint32_t frameBytes = _channels * sizeof(int16_t);
+  uint32_t start = (_writePos + _length - _delay) % _length;
+  uint32_t first = _length - start;
+  uint8_t *dest = (uint8_t *)_fetched[next];
+
+  if (first > _blockFrames)
+  {
+    first = _blockFrames;
+  }
+
+  // Two pieces if the block wraps round the end of the line
+  while (!_memory->queueRead(_address + start * frameBytes, dest,
+                             first * frameBytes))
+  {
+    _memory->poll();
+  }
+  if (first < _blockFrames)
+  {
+    while (!_memory->queueRead(_address, dest + first * frameBytes,
+                               (_blockFrames - first) * frameBytes))
+    {
+      _memory->poll();
+    }
+  }
+  _fetchTicket[next] = _memory->getLastTicket();
+}
+
+void HiFiExtDelay::process(int32_t *buf)
+{
+  if (!_memory)
+  {
+    return;
+  }
+
+  _meter.start();
+  _memory->poll();
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// This block's delayed audio was fetched during the last call, and the
+  /// staging buffer is free once the write from two calls ago is done.
+  ///////////////////////////////////////////////////////////////////////////
+  _current ^= 1;
+  wait(_fetchTicket[_current]);
+  wait(_stageTicket[_current]);
+
+  const int16_t *delayed = _fetched[_current];
+  int16_t *staged = _staged[_current];
+  uint32_t samples = (uint32_t)_blockFrames * _channels;
+
+  for (uint32_t i = 0; i < samples; i++)
+  {
+    int32_t x = buf[i];
+    int32_t wet = delayed[i];
+
+    staged[i] = sat16((x >> 16) + ((wet * _feedback) >> 15));
+    buf[i] = hifi_sat32((((int64_t)x * _dryGain) >> 15) +
+                        (int64_t)wet * _wetGain * 2);
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Queue the write of this block and the fetch of the next one.
+  ///////////////////////////////////////////////////////////////////////////
+  uint32_t frameBytes = _channels * sizeof(int16_t);
+
+  while (!_memory->queueWrite(_address + _writePos * frameBytes, staged,
+                              samples * sizeof(int16_t)))
+  {
+    _memory->poll();
+  }
+  _stageTicket[_current] = _memory->getLastTicket();
+
+  _writePos += _blockFrames;
+  if (_writePos == _length)
+  {
+    _writePos = 0;
+  }
+  queueFetch();
+
+  _meter.stop();
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// HiFiExtRing
+///////////////////////////////////////////////////////////////////////////
+HiFiExtRing::HiFiExtRing() :
+  _memory(NULL),
+  _address(0),
+  _blocks(0),
+  _blockBytes(0),
+  _written(0),
+  _read(0),
+  _fetched(NULL),
+  _fetchTicket(0),
+  _fetchQueued(false),
+  _stalls(0)
+{
+  _staged[0] = _staged[1] = NULL;
+  _stageTicket[0] = _stageTicket[1] = 0;
+}
+
+bool HiFiExtRing::begin(HiFiExtMemory &memory, uint32_t address,
+                        uint32_t blocks, uint16_t blockBytes)
+{
+  end();
+
+  if (blocks == 0 || blockBytes == 0 ||
+      address + blocks * blockBytes > memory.getSize())
+  {
+    return false;
+  }
+
+  _staged[0] = (uint8_t *)malloc(blockBytes);
+  _staged[1] = (uint8_t *)malloc(blockBytes);
+  _fetched = (uint8_t *)malloc(blockBytes);
+  if (!_staged[0] || !_staged[1] || !_fetched)
+  {
+    end();
+    return false;
+  }
+
+  _memory = &memory;
+  _address = address;
+  _blocks = blocks;
+  _blockBytes = blockBytes;
+  _written = 0;
+  _read = 0;
+  _fetchQueued = false;
+  _stalls = 0;
+  _stageTicket[0] = _stageTicket[1] = _memory->getLastTicket();
+
+  return true;
+}
+
+void HiFiExtRing::end()
+{
+  if (_memory)
+  {
+    _memory->flush();
+    _memory = NULL;
+  }
+  free(_staged[0]);
+  free(_staged[1]);
+  free(_fetched);
+  _staged[0] = _staged[1] = NULL;
+  _fetched = NULL;
+}
+
+void HiFiExtRing::wait(uint32_t ticket)
+{
+  if (!_memory->isComplete(ticket))
+  {
+    _stalls++;
+    while (!_memory->isComplete(ticket))
+    {
+      _memory->poll();
+    }
+  }
+}
+
+void HiFiExtRing::queueFetch()
+{
+  uint32_t offset = (_read % _blocks) * _blockBytes;
+
+  while (!_memory->queueRead(_address + offset, _fetched, _blockBytes))
+  {
+    _memory->poll();
+  }
+  _fetchTicket = _memory->getLastTicket();
+  _fetchQueued = true;
+}
+
+bool HiFiExtRing::write(const void *block)
+{
+  if (!_memory || getSpace() == 0)
+  {
+    return false;
+  }
+
+  uint8_t s = _written & 1;
+  uint32_t offset = (_written % _blocks) * _blockBytes;
+
+  _memory->poll();
+  wait(_stageTicket[s]);
+  memcpy(_staged[s], block, _blockBytes);
+
+  while (!_memory->queueWrite(_address + offset, _staged[s], _blockBytes))
+  {
+    _memory->poll();
+  }
+  _stageTicket[s] = _memory->getLastTicket();
+  _written++;
+
+  // The queue runs in order, so the fetch can go in straight behind the
+  // write it depends on.
+  if (!_fetchQueued)
+  {
+    queueFetch();
+  }
+  return true;
+}
+
+bool HiFiExtRing::read(void *block)
+{
+  if (!_memory || getAvailable() == 0)
+  {
+    return false;
+  }
+
+  _memory->poll();
+  if (!_fetchQueued)
+  {
+    queueFetch();
+  }
+  wait(_fetchTicket);
+  memcpy(block, _fetched, _blockBytes);
+  _read++;
+  _fetchQueued = false;
+
+  if (getAvailable())
+  {
+    queueFetch();
+  }
+  return true;
+}
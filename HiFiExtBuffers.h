@@ -0,0 +1,144 @@
+/*
+  HiFiExtBuffers.h
+
+  Delay lines and block FIFOs kept in external memory (see
+  HiFiExtMemory.h), with block level prefetch so the audio path only
+  ever touches on-chip buffers.
+
+  HiFiExtDelay is a long fixed delay (echo, pre-delay, latency matching)
+  for one or two interleaved channels stored as 16 bit samples.  Each
+  process() call handles one block: it plays out the delayed block that
+  was prefetched during the previous call, queues the new block to be
+  written to the line and queues the read of the next delayed block.
+  Both transfers run while the rest of the sketch works, so they have a
+  whole block period to finish.  The delay can't be shorter than one
+  block.  One 23LC1024 holds 1.36s of mono or 0.68s of stereo at 48kHz.
+
+  HiFiExtRing is a FIFO of fixed size blocks (e.g. a long jitter buffer
+  or a pre-roll store).  write() copies a block into a staging buffer and
+  queues it out; read() hands back the block that was prefetched after
+  the previous read.
+
+  If a transfer hasn't finished when its block is needed the call waits
+  for it and counts a stall; getStalls() going up means the memory can't
+  keep up with the block rate (or poll() isn't being called often
+  enough).
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_EXT_BUFFERS_H
+#define HIFI_EXT_BUFFERS_H
+
+#include "HiFiDsp.h"
+#include "HiFiExtMemory.h"
+
+class HiFiExtDelay {
+public:
+  HiFiExtDelay();
+  ~HiFiExtDelay() { end(); }
+
+  // The line starts at 'address' in the memory and holds at least
+  // maxDelay frames; getBytes() tells how much it actually uses.  Every
+  // process() call is one block of blockFrames.  The line is cleared, so
+  // begin() takes as long as writing it out.
+  bool begin(HiFiExtMemory &memory, uint32_t address, uint32_t maxDelay,
+             uint8_t channels, uint16_t blockFrames);
+  void end();
+
+  uint32_t getBytes() const;
+
+  // Delay in frames, from one block up to maxDelay.  Takes effect from
+  // the block after next, as the next one has already been fetched.
+  void setDelay(uint32_t frames);
+  uint32_t getDelay() const { return _delay; }
+
+  // 0.0 to 0.97 (repeats), and 0.0 (dry) to 1.0 (delayed only).
+  void setFeedback(float feedback);
+  void setMix(float mix);
+
+  void process(int32_t *buf);
+
+  uint32_t getStalls() const { return _stalls; }
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  void queueFetch();
+  void wait(uint32_t ticket);
+
+  HiFiExtMemory *_memory;
+  uint32_t _address;
+  uint32_t _length;             // frames, a multiple of the block size
+  uint8_t _channels;
+  uint16_t _blockFrames;
+
+  uint32_t _writePos;
+  uint32_t _delay;
+
+  int16_t *_fetched[2];
+  int16_t *_staged[2];
+  uint32_t _fetchTicket[2];
+  uint32_t _stageTicket[2];
+  uint8_t _current;
+
+  int32_t _feedback;            // Q15
+  int32_t _wetGain;             // Q15
+  int32_t _dryGain;             // Q15
+
+  uint32_t _stalls;
+  HiFiCycleMeter _meter;
+};
+
+class HiFiExtRing {
+public:
+  HiFiExtRing();
+  ~HiFiExtRing() { end(); }
+
+  bool begin(HiFiExtMemory &memory, uint32_t address, uint32_t blocks,
+             uint16_t blockBytes);
+  void end();
+
+  // Copy one block in / out.  write() returns false when the ring is
+  // full and read() when it is empty.
+  bool write(const void *block);
+  bool read(void *block);
+
+  uint32_t getAvailable() const { return _written - _read; }
+  uint32_t getSpace() const { return _blocks - (_written - _read); }
+
+  uint32_t getStalls() const { return _stalls; }
+
+private:
+  void queueFetch();
+  void wait(uint32_t ticket);
+
+  HiFiExtMemory *_memory;
+  uint32_t _address;
+  uint32_t _blocks;
+  uint16_t _blockBytes;
+
+  uint32_t _written;
+  uint32_t _read;
+
+  uint8_t *_staged[2];
+  uint32_t _stageTicket[2];
+  uint8_t *_fetched;
+  uint32_t _fetchTicket;
+  bool _fetchQueued;
+
+  uint32_t _stalls;
+};
+
+#endif
@@ -0,0 +1,230 @@
+/*
+  HiFiExtMemory.cpp
+
+  Transfer queue for external memories, and the RAM backed stand-in.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "HiFiExtMemory.h"
+#include "HiFiDma.h"
+
+#define HIFI_EXT_MEMORY_MASK    (HIFI_EXT_MEMORY_QUEUE - 1)
+
+HiFiExtMemory::HiFiExtMemory() :
+  _boundary(0),
+  _maxTransfer(0xFFFF),
+  _head(0),
+  _tail(0),
+  _active(false),
+  _queued(0),
+  _completed(0)
+{
+}
+
+bool HiFiExtMemory::queueRead(uint32_t address, void *data, uint32_t bytes)
+{
+  return queue(false, address, (uint8_t *)data, bytes);
+}
+
+bool HiFiExtMemory::queueWrite(uint32_t address, const void *data,
+                               uint32_t bytes)
+{
+  return queue(true, address, (uint8_t *)data, bytes);
+}
+
+bool HiFiExtMemory::queue(bool write, uint32_t address, uint8_t *data,
+                          uint32_t bytes)
+{
+  if (bytes == 0 || address + bytes > getSize())
+  {
+    return false;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Work out the pieces first so that a transfer is queued whole or not
+  /// at all.  Counting stops once they can't fit, so a long transfer in
+  /// small pieces can't wrap the count round.
+  ///////////////////////////////////////////////////////////////////////////
+  uint32_t pieces = 0;
+  uint32_t a = address;
+  uint32_t left = bytes;
+
+  while (left && pieces < HIFI_EXT_MEMORY_QUEUE)
+  {
+    uint32_t length = (left > _maxTransfer) ? _maxTransfer : left;
+    if (_boundary && (a / _boundary) != ((a + length - 1) / _boundary))
+    {
+      length = _boundary - (a % _boundary);
+    }
+    a += length;
+    left -= length;
+    pieces++;
+  }
+
+  uint32_t used = (uint8_t)(_head - _tail) & HIFI_EXT_MEMORY_MASK;
+  if (used + pieces > HIFI_EXT_MEMORY_MASK)
+  {
+    return false;
+  }
+
+  while (bytes)
+  {
+    Request &r = _requests[_head];
+    uint32_t length = (bytes > _maxTransfer) ? _maxTransfer : bytes;
+    if (_boundary && (address / _boundary) != ((address + length - 1) / _boundary))
+    {
+      length = _boundary - (address % _boundary);
+    }
+
+    r.address = address;
+    r.data = data;
+    r.bytes = length;
+    r.write = write;
+    r.last = (length == bytes);
+
+    address += length;
+    data += length;
+    bytes -= length;
+    _head = (_head + 1) & HIFI_EXT_MEMORY_MASK;
+  }
+  _queued++;
+
+  poll();
+  return true;
+}
+
+void HiFiExtMemory::poll()
+{
+  if (_active)
+  {
+    if (!isTransferDone())
+    {
+      return;
+    }
+
+    _active = false;
+    if (_requests[_tail].last)
+    {
+      _completed++;
+    }
+    _tail = (_tail + 1) & HIFI_EXT_MEMORY_MASK;
+  }
+
+  if (_tail != _head)
+  {
+    Request &r = _requests[_tail];
+
+    _active = true;
+    startTransfer(r.write, r.address, r.data, r.bytes);
+  }
+}
+
+void HiFiExtMemory::flush()
+{
+  while (!isIdle())
+  {
+    poll();
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// RAM stand-in
+///////////////////////////////////////////////////////////////////////////
+HiFiRamMemory::HiFiRamMemory() :
+  _memory(NULL),
+  _size(0),
+  _latency(0),
+  _countdown(0),
+  _write(false),
+  _address(0),
+  _data(NULL),
+  _bytes(0),
+  _started(false),
+  _ticket(0)
+{
+}
+
+HiFiRamMemory::~HiFiRamMemory()
+{
+  end();
+}
+
+bool HiFiRamMemory::begin(uint32_t bytes, uint16_t maxTransfer,
+                          uint32_t boundary)
+{
+  end();
+
+  _memory = (uint8_t *)malloc(bytes);
+  if (!_memory)
+  {
+    return false;
+  }
+  memset(_memory, 0, bytes);
+
+  _size = bytes;
+  _maxTransfer = maxTransfer ? maxTransfer : 1;
+  _boundary = boundary;
+  return true;
+}
+
+void HiFiRamMemory::end()
+{
+  if (_started)
+  {
+    HiFiDma.wait(_ticket);
+    _started = false;
+  }
+  free(_memory);
+  _memory = NULL;
+  _size = 0;
+}
+
+void HiFiRamMemory::startTransfer(bool write, uint32_t address,
+                                  uint8_t *data, uint16_t bytes)
+{
+  _write = write;
+  _address = address;
+  _data = data;
+  _bytes = bytes;
+  _countdown = _latency;
+  _started = false;
+}
+
+bool HiFiRamMemory::isTransferDone()
+{
+  if (_countdown)
+  {
+    _countdown--;
+    return false;
+  }
+
+  // The data starts moving once the latency is up, so anyone reading a
+  // buffer early sees stale contents just as they would with a device.
+  if (!_started)
+  {
+    bool queued = _write ? HiFiDma.copy(_memory + _address, _data, _bytes) :
+                           HiFiDma.copy(_data, _memory + _address, _bytes);
+    if (!queued)
+    {
+      return false;
+    }
+    _ticket = HiFiDma.getLastTicket();
+    _started = true;
+  }
+  return HiFiDma.isComplete(_ticket);
+}
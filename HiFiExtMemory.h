@@ -0,0 +1,148 @@
+/*
+  HiFiExtMemory.h
+
+  External memory for long delay lines and buffers.
+
+  HiFiExtMemory is the interface the buffering classes (see
+  HiFiExtBuffers.h) use to reach memory that isn't directly addressable,
+  like the 23LC1024 SPI SRAM driven by HiFiSpiSram.  Transfers are
+  asynchronous: they are queued, run one at a time (by DMA on the Due) and
+  completed by poll().  Every queued transfer gets a ticket number, so a
+  user can tell when the one it cares about has finished without waiting
+  on the rest.
+
+  Requests are split as needed so no single transfer crosses a device
+  boundary (e.g. between two SRAM chips) or is longer than the device's
+  largest transfer.
+
+  HiFiRamMemory is a stand-in that keeps the "external" memory in an
+  ordinary heap buffer and takes a configurable number of poll() calls to
+  finish each transfer.  It runs anywhere, so code built on
+  HiFiExtMemory can be exercised on a PC, including what happens when a
+  transfer is late.  The data is moved with HiFiDma, so on the Due a
+  large block in on-chip RAM can also be used as a slow, background
+  "far" memory.
+
+  Queueing and polling are not interrupt safe: use a memory from one
+  context only (normally loop(), with blocks processed there too).
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_EXT_MEMORY_H
+#define HIFI_EXT_MEMORY_H
+
+#include <stdint.h>
+
+// Pending transfers per memory, must be a power of two
+#define HIFI_EXT_MEMORY_QUEUE   16
+
+class HiFiExtMemory {
+public:
+  HiFiExtMemory();
+  virtual ~HiFiExtMemory() { };
+
+  virtual uint32_t getSize() const = 0;
+
+  // Queue a transfer.  The buffer must stay valid until the transfer's
+  // ticket has completed.  Returns false if there isn't room in the queue
+  // (nothing is queued in that case).
+  bool queueRead(uint32_t address, void *data, uint32_t bytes);
+  bool queueWrite(uint32_t address, const void *data, uint32_t bytes);
+
+  // Ticket of the most recently queued transfer, and the number of
+  // transfers completed so far.  Ticket t is done once
+  // isComplete(t) is true.
+  uint32_t getLastTicket() const { return _queued; }
+  bool isComplete(uint32_t ticket) const
+  {
+    return (int32_t)(_completed - ticket) >= 0;
+  }
+
+  // Finish the current transfer if it is done and start the next one.
+  // Call often.
+  void poll();
+
+  // Wait for everything queued so far.
+  void flush();
+  bool isIdle() const { return _completed == _queued; }
+
+protected:
+  // Device hooks.  startTransfer() begins one transfer (which will never
+  // cross a boundary or exceed the maximum), isTransferDone() is polled
+  // until it returns true and should tidy up the device when it does.
+  virtual void startTransfer(bool write, uint32_t address, uint8_t *data,
+                             uint16_t bytes) = 0;
+  virtual bool isTransferDone() = 0;
+
+  // Set by the device: transfers are split at multiples of 'boundary'
+  // (0 for none) and into pieces of no more than 'maxTransfer' bytes.
+  uint32_t _boundary;
+  uint16_t _maxTransfer;
+
+private:
+  bool queue(bool write, uint32_t address, uint8_t *data, uint32_t bytes);
+
+  struct Request
+  {
+    uint32_t address;
+    uint8_t *data;
+    uint16_t bytes;
+    bool write;
+    bool last;          // final piece of a queued transfer
+  };
+
+  Request _requests[HIFI_EXT_MEMORY_QUEUE];
+  uint8_t _head;
+  uint8_t _tail;
+  bool _active;
+  uint32_t _queued;
+  uint32_t _completed;
+};
+
+class HiFiRamMemory : public HiFiExtMemory {
+public:
+  HiFiRamMemory();
+  ~HiFiRamMemory();
+
+  bool begin(uint32_t bytes, uint16_t maxTransfer = 4095,
+             uint32_t boundary = 0);
+  void end();
+
+  // Number of poll() calls each transfer takes to complete.
+  void setLatency(uint8_t polls) { _latency = polls; }
+
+  uint32_t getSize() const { return _size; }
+
+protected:
+  void startTransfer(bool write, uint32_t address, uint8_t *data,
+                     uint16_t bytes);
+  bool isTransferDone();
+
+private:
+  uint8_t *_memory;
+  uint32_t _size;
+  uint8_t _latency;
+  uint8_t _countdown;
+
+  bool _write;
+  uint32_t _address;
+  uint8_t *_data;
+  uint16_t _bytes;
+  bool _started;
+  uint32_t _ticket;
+};
+
+#endif
@@ -0,0 +1,233 @@
+/*
+  HiFiFft.cpp
+
+  Fixed-point radix-2 FFT.  See HiFiFft.h for the data layout.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "HiFiFft.h"
+
+extern "C" const int32_t hifi_fft_sine_q31[];
+
+#define HIFI_FFT_QUARTER    (HIFI_FFT_MAX_SIZE / 4)
+
+// sin(2*pi*j/HIFI_FFT_MAX_SIZE) from the quarter wave table.
+static inline int32_t tableSine(uint32_t j)
+{
+  uint32_t r;
+
+  j &= HIFI_FFT_MAX_SIZE - 1;
+  r = j & (HIFI_FFT_QUARTER - 1);
+
+  switch (j / HIFI_FFT_QUARTER)
+  {
+    case 0:
+      return hifi_fft_sine_q31[r];
+    case 1:
+      return hifi_fft_sine_q31[HIFI_FFT_QUARTER - r];
+    case 2:
+      return -hifi_fft_sine_q31[r];
+    default:
+      return -hifi_fft_sine_q31[HIFI_FFT_QUARTER - r];
+  }
+}
+
+int32_t HiFiFft::sine(uint32_t k, uint32_t size)
+{
+  return tableSine(k * (HIFI_FFT_MAX_SIZE / size));
+}
+
+int32_t HiFiFft::cosine(uint32_t k, uint32_t size)
+{
+  return tableSine(k * (HIFI_FFT_MAX_SIZE / size) + HIFI_FFT_QUARTER);
+}
+
+bool HiFiFft::begin(uint8_t log2Size)
+{
+  if (log2Size < 2 || log2Size > HIFI_FFT_MAX_LOG2)
+  {
+    return false;
+  }
+  _log2Size = log2Size;
+  _size = 1 << log2Size;
+  return true;
+}
+
+HIFI_RAMFUNC void HiFiFft::complexTransform(int32_t *data, uint16_t points, bool inverse, bool scale)
+{
+  ///////////////////////////////////////////////////////////////////////////
+  /// Bit reversed reordering
+  ///////////////////////////////////////////////////////////////////////////
+  uint16_t j = 0;
+
+  for (uint16_t i = 0; i < points; i++)
+  {
+    if (i < j)
+    {
+      int32_t t;
+      t = data[2 * i];     data[2 * i] = data[2 * j];         data[2 * j] = t;
+      t = data[2 * i + 1]; data[2 * i + 1] = data[2 * j + 1]; data[2 * j + 1] = t;
+    }
+
+    uint16_t m = points >> 1;
+    while (m >= 1 && j >= m)
+    {
+      j -= m;
+      m >>= 1;
+    }
+    j += m;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Butterflies.  The twiddle factor only changes with k, so it is looked
+  /// up once and applied to every group at that offset.
+  ///////////////////////////////////////////////////////////////////////////
+  for (uint16_t len = 2; len <= points; len <<= 1)
+  {
+    uint16_t half = len >> 1;
+    uint32_t step = HIFI_FFT_MAX_SIZE / len;
+
+    for (uint16_t k = 0; k < half; k++)
+    {
+      int32_t c = tableSine(k * step + HIFI_FFT_QUARTER);
+      int32_t s = tableSine(k * step);
+
+      // Forward uses exp(-j*theta), inverse exp(+j*theta)
+      if (!inverse)
+      {
+        s = -s;
+      }
+
+      for (uint16_t i = k; i < points; i += len)
+      {
+        int32_t *a = data + 2 * i;
+        int32_t *b = data + 2 * (i + half);
+        int64_t tr = ((int64_t)b[0] * c - (int64_t)b[1] * s) >> 31;
+        int64_t ti = ((int64_t)b[0] * s + (int64_t)b[1] * c) >> 31;
+
+        if (scale)
+        {
+          b[0] = (int32_t)((a[0] - tr) >> 1);
+          b[1] = (int32_t)((a[1] - ti) >> 1);
+          a[0] = (int32_t)((a[0] + tr) >> 1);
+          a[1] = (int32_t)((a[1] + ti) >> 1);
+        }
+        else
+        {
+          b[0] = hifi_sat32(a[0] - tr);
+          b[1] = hifi_sat32(a[1] - ti);
+          a[0] = hifi_sat32(a[0] + tr);
+          a[1] = hifi_sat32(a[1] + ti);
+        }
+      }
+    }
+  }
+}
+
+HIFI_RAMFUNC void HiFiFft::forwardReal(int32_t *data, bool scale)
+{
+  uint16_t half = _size >> 1;
+  uint8_t shift = scale ? 2 : 1;
+
+  // Even samples in the real parts, odd samples in the imaginary parts.
+  complexTransform(data, half, false, scale);
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Split the N/2 point result into the spectrum of the real input.
+  ///   E[k] = (Z[k] + conj(Z[N/2-k])) / 2
+  ///   O[k] = -j * (Z[k] - conj(Z[N/2-k])) / 2
+  ///   X[k] = E[k] + W^k * O[k],  X[N/2-k] = conj(E[k] - W^k * O[k])
+  /// Everything below is kept doubled (2E, 2O) to avoid losing a bit.
+  ///////////////////////////////////////////////////////////////////////////
+  int64_t zr = data[0];
+  int64_t zi = data[1];
+
+  data[0] = hifi_sat32((zr + zi) >> (shift - 1));
+  data[1] = hifi_sat32((zr - zi) >> (shift - 1));
+
+  for (uint16_t k = 1; k <= (half >> 1); k++)
+  {
+    uint16_t mk = half - k;
+    int64_t ar = data[2 * k];
+    int64_t ai = data[2 * k + 1];
+    int64_t br = data[2 * mk];
+    int64_t bi = data[2 * mk + 1];
+
+    int64_t er = ar + br;
+    int64_t ei = ai - bi;
+    int64_t orr = ai + bi;
+    int64_t oi = br - ar;
+
+    int64_t c = cosine(k, _size);
+    int64_t s = sine(k, _size);
+
+    // W^k * O with W = exp(-j*2*pi/N)
+    int64_t tr = (orr * c + oi * s) >> 31;
+    int64_t ti = (oi * c - orr * s) >> 31;
+
+    data[2 * k] = hifi_sat32((er + tr) >> shift);
+    data[2 * k + 1] = hifi_sat32((ei + ti) >> shift);
+    data[2 * mk] = hifi_sat32((er - tr) >> shift);
+    data[2 * mk + 1] = hifi_sat32((ti - ei) >> shift);
+  }
+}
+
+HIFI_RAMFUNC void HiFiFft::inverseReal(int32_t *data, bool scale)
+{
+  uint16_t half = _size >> 1;
+  uint8_t shift = scale ? 1 : 0;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Undo the split, then run the N/2 point inverse.  Unscaled, 2*Z is
+  /// built so the complex inverse comes out as N * x; scaled, Z is built so
+  /// the (1/(N/2)) complex inverse comes out as x.
+  ///////////////////////////////////////////////////////////////////////////
+  int64_t x0 = data[0];
+  int64_t xm = data[1];
+
+  data[0] = hifi_sat32((x0 + xm) >> shift);
+  data[1] = hifi_sat32((x0 - xm) >> shift);
+
+  for (uint16_t k = 1; k <= (half >> 1); k++)
+  {
+    uint16_t mk = half - k;
+    int64_t ar = data[2 * k];
+    int64_t ai = data[2 * k + 1];
+    int64_t br = data[2 * mk];
+    int64_t bi = data[2 * mk + 1];
+
+    // 2E and 2W^k*O
+    int64_t er = ar + br;
+    int64_t ei = ai - bi;
+    int64_t pr = ar - br;
+    int64_t pi = ai + bi;
+
+    int64_t c = cosine(k, _size);
+    int64_t s = sine(k, _size);
+
+    // 2O = conj(W^k) * 2W^k*O
+    int64_t orr = (pr * c - pi * s) >> 31;
+    int64_t oi = (pr * s + pi * c) >> 31;
+
+    // Z[k] = E + jO, Z[N/2-k] = conj(E) + j*conj(O)
+    data[2 * k] = hifi_sat32((er - oi) >> shift);
+    data[2 * k + 1] = hifi_sat32((ei + orr) >> shift);
+    data[2 * mk] = hifi_sat32((er + oi) >> shift);
+    data[2 * mk + 1] = hifi_sat32((orr - ei) >> shift);
+  }
+
+  complexTransform(data, half, true, scale);
+}
@@ -0,0 +1,72 @@
+/*
+  HiFiFft.h
+
+  Fixed-point FFT for the HiFi library.
+
+  This is a plain in-place radix-2 transform on 32 bit data with Q31
+  twiddle factors taken from a shared table in flash, so an instance costs
+  a couple of bytes of RAM no matter what size it is.  Transform sizes are
+  powers of two up to HIFI_FFT_MAX_SIZE.
+
+  Real signals are transformed with the usual trick of packing the even and
+  odd samples into an N/2 point complex transform, which halves the work.
+  The real spectrum is stored packed in the same N words:
+
+    data[0]          X[0]    (real, DC)
+    data[1]          X[N/2]  (real, Nyquist)
+    data[2k], [2k+1] X[k]    (real, imaginary) for k = 1 .. N/2-1
+
+  When 'scale' is set each stage halves its output so nothing can overflow
+  and the result is divided by N.  Unscaled transforms are only safe if the
+  caller knows the data has enough headroom.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_FFT_H
+#define HIFI_FFT_H
+
+#include "HiFiDsp.h"
+
+#define HIFI_FFT_MAX_LOG2   12
+#define HIFI_FFT_MAX_SIZE   (1 << HIFI_FFT_MAX_LOG2)
+
+class HiFiFft {
+public:
+  HiFiFft() : _log2Size(0), _size(0) { };
+
+  // Size of the real transform, N = 2^log2Size (2 .. 12).
+  bool begin(uint8_t log2Size);
+  uint16_t getSize() const { return _size; }
+
+  // Real transforms on N words (see the packing above).
+  void forwardReal(int32_t *data, bool scale);
+  void inverseReal(int32_t *data, bool scale);
+
+  // Complex transform on 'points' interleaved (real, imaginary) pairs.
+  // 'points' must be a power of two no larger than N/2.
+  void complexTransform(int32_t *data, uint16_t points, bool inverse, bool scale);
+
+  // Twiddle factors for a transform of 'size' points: cos and sin of
+  // 2*pi*k/size in Q31.
+  static int32_t cosine(uint32_t k, uint32_t size);
+  static int32_t sine(uint32_t k, uint32_t size);
+
+private:
+  uint8_t _log2Size;
+  uint16_t _size;
+};
+
+#endif
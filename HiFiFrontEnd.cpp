@@ -0,0 +1,260 @@
+/*
+  HiFiFrontEnd.cpp
+
+  DC blocker and AGC for the capture path.  See HiFiFrontEnd.h for an
+  overview.
+
+  All of the per-sample work is integer only.  Floating point is only used
+  when the filter cutoff and AGC time constants are (re)configured, which
+  happens from setup() or loop() and never from the audio path.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <math.h>
+#include <string.h>
+#include "HiFiFrontEnd.h"
+
+#define HIFI_DC_DEFAULT_CUTOFF_HZ       10.0f
+#define HIFI_AGC_DEFAULT_TARGET_DBFS    -12.0f
+#define HIFI_AGC_DEFAULT_MAX_GAIN_DB    30.0f
+
+HiFiFrontEnd::HiFiFrontEnd() :
+  _channels(1),
+  _sampleRate(48000),
+  _blockFrames(64),
+  _bypass(false),
+  _dcEnabled(false),
+  _dcCutoffHz(HIFI_DC_DEFAULT_CUTOFF_HZ),
+  _dcPole(0),
+  _agcEnabled(false),
+  _attackMs(10.0f),
+  _releaseMs(500.0f),
+  _target(0),
+  _maxGain(HIFI_AGC_UNITY_GAIN),
+  _attackCoef(0),
+  _releaseCoef(0),
+  _envelope(0),
+  _gain(HIFI_AGC_UNITY_GAIN)
+{
+  memset(_dcX1, 0, sizeof(_dcX1));
+  memset(_dcY1, 0, sizeof(_dcY1));
+  memset(_dcErr, 0, sizeof(_dcErr));
+
+  // Defaults, so that settings made before begin() are kept.
+  setDcBlockCutoff(_dcCutoffHz);
+  configureAgc(HIFI_AGC_DEFAULT_TARGET_DBFS, HIFI_AGC_DEFAULT_MAX_GAIN_DB,
+               _attackMs, _releaseMs);
+}
+
+void HiFiFrontEnd::begin(uint8_t channels, uint32_t sampleRate,
+                         uint16_t blockFrames)
+{
+  if (channels > HIFI_FRONT_END_MAX_CHANNELS)
+  {
+    channels = HIFI_FRONT_END_MAX_CHANNELS;
+  }
+  _channels = channels ? channels : 1;
+  _sampleRate = sampleRate;
+  _blockFrames = blockFrames ? blockFrames : 1;
+
+  memset(_dcX1, 0, sizeof(_dcX1));
+  memset(_dcY1, 0, sizeof(_dcY1));
+  memset(_dcErr, 0, sizeof(_dcErr));
+  _envelope = 0;
+  _gain = HIFI_AGC_UNITY_GAIN;
+
+  // Both depend on the rate and block size.
+  setDcBlockCutoff(_dcCutoffHz);
+  updateAgcCoefficients();
+
+  hifi_cycle_counter_enable();
+}
+
+void HiFiFrontEnd::enableDcBlock(bool enable)
+{
+  _dcEnabled = enable;
+}
+
+void HiFiFrontEnd::setDcBlockCutoff(float cutoffHz)
+{
+  // For cutoffs well below the sample rate the pole sits at roughly
+  // 1 - 2*pi*fc/fs.
+  float pole = 1.0f - (2.0f * (float)M_PI * cutoffHz) / (float)_sampleRate;
+
+  if (pole < 0.5f)
+  {
+    pole = 0.5f;
+  }
+  _dcCutoffHz = cutoffHz;
+  _dcPole = hifi_float_to_q31(pole);
+}
+
+void HiFiFrontEnd::configureAgc(float targetDbfs,
+                                float maxGainDb,
+                                float attackMs,
+                                float releaseMs)
+{
+  float target = powf(10.0f, targetDbfs / 20.0f);
+  float maxGain = powf(10.0f, maxGainDb / 20.0f);
+
+  if (target > 1.0f)
+  {
+    target = 1.0f;
+  }
+  // Keep the gain representable in Q16.16.
+  if (maxGain > 32767.0f)
+  {
+    maxGain = 32767.0f;
+  }
+  if (maxGain < 1.0f)
+  {
+    maxGain = 1.0f;
+  }
+
+  _target = (uint32_t)hifi_float_to_q31(target);
+  _maxGain = (uint32_t)(maxGain * HIFI_AGC_UNITY_GAIN);
+  _attackMs = attackMs;
+  _releaseMs = releaseMs;
+
+  updateAgcCoefficients();
+
+  if (_gain > _maxGain)
+  {
+    _gain = _maxGain;
+  }
+}
+
+void HiFiFrontEnd::updateAgcCoefficients()
+{
+  // One pole smoothing of the block peak.
+  _attackCoef = hifi_one_pole_coef(_attackMs, _blockFrames, _sampleRate);
+  _releaseCoef = hifi_one_pole_coef(_releaseMs, _blockFrames, _sampleRate);
+}
+
+void HiFiFrontEnd::enableAgc(bool enable)
+{
+  _agcEnabled = enable;
+}
+
+float HiFiFrontEnd::getGainDb() const
+{
+  return 20.0f * log10f((float)_gain / HIFI_AGC_UNITY_GAIN);
+}
+
+void HiFiFrontEnd::process(int32_t *buf, uint16_t frames)
+{
+  if (_bypass || (!_dcEnabled && !_agcEnabled) || frames == 0)
+  {
+    return;
+  }
+
+  _meter.start();
+
+  if (_dcEnabled)
+  {
+    dcBlock(buf, frames);
+  }
+
+  if (_agcEnabled)
+  {
+    agc(buf, frames);
+  }
+
+  _meter.stop();
+}
+
+HIFI_RAMFUNC void HiFiFrontEnd::dcBlock(int32_t *buf, uint16_t frames)
+{
+  for (uint8_t ch = 0; ch < _channels; ch++)
+  {
+    int32_t x1 = _dcX1[ch];
+    int32_t y1 = _dcY1[ch];
+    uint32_t err = _dcErr[ch];
+    int32_t *p = buf + ch;
+
+    for (uint16_t i = 0; i < frames; i++)
+    {
+      int32_t x = *p;
+      int64_t acc = (int64_t)_dcPole * y1 + err;
+
+      // Keep the bits that the shift throws away for the next sample.
+      err = (uint32_t)(acc & 0x7FFFFFFF);
+      y1 = hifi_sat32((int64_t)x - x1 + (acc >> 31));
+      x1 = x;
+
+      *p = y1;
+      p += _channels;
+    }
+
+    _dcX1[ch] = x1;
+    _dcY1[ch] = y1;
+    _dcErr[ch] = err;
+  }
+}
+
+HIFI_RAMFUNC void HiFiFrontEnd::agc(int32_t *buf, uint16_t frames)
+{
+  uint32_t count = (uint32_t)frames * _channels;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Level detection.  The channels are linked (one gain for all of them)
+  /// so that a stereo image doesn't wander as the gain changes.
+  ///////////////////////////////////////////////////////////////////////////
+  uint32_t peak = hifi_block_peak(buf, count, 1);
+
+  if (peak > _envelope)
+  {
+    _envelope += (uint32_t)(((uint64_t)(peak - _envelope) * _attackCoef) >> 31);
+  }
+  else
+  {
+    _envelope -= (uint32_t)(((uint64_t)(_envelope - peak) * _releaseCoef) >> 31);
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Gain computer
+  ///////////////////////////////////////////////////////////////////////////
+  uint32_t newGain = _maxGain;
+
+  if (_envelope)
+  {
+    uint64_t g = ((uint64_t)_target << 16) / _envelope;
+    if (g < newGain)
+    {
+      newGain = (uint32_t)g;
+    }
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Apply, ramping from the last block's gain to the new one.  The step
+  /// is truncated, so the last frame takes the new gain exactly rather
+  /// than leaving the remainder as a jump into the next block.
+  ///////////////////////////////////////////////////////////////////////////
+  int32_t step = ((int32_t)newGain - (int32_t)_gain) / (int32_t)frames;
+  int32_t gain = (int32_t)_gain;
+
+  for (uint16_t i = 0; i < frames; i++)
+  {
+    gain = (i + 1 == frames) ? (int32_t)newGain : gain + step;
+    for (uint8_t ch = 0; ch < _channels; ch++)
+    {
+      *buf = hifi_sat32(((int64_t)*buf * gain) >> 16);
+      buf++;
+    }
+  }
+
+  _gain = newGain;
+}
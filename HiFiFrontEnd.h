@@ -0,0 +1,112 @@
+/*
+  HiFiFrontEnd.h
+
+  Capture front-end for the HiFi library.  This conditions blocks of
+  received audio before they are handed to the rest of a sketch:
+
+    - a DC blocking high-pass filter to remove the offset that a lot of
+      microphone preamps add, and
+    - an automatic gain control (AGC) that slowly pulls the signal level
+      towards a target, with separate attack and release times and an
+      upper limit on the gain it will apply.
+
+  Processing is done a block at a time on interleaved Q31 frames (see
+  HiFiDsp.h).  The gain is computed once per block from the block peak and
+  ramped across the block so there is no zipper noise.  When the front-end
+  is bypassed (or both stages are off) process() returns immediately.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_FRONT_END_H
+#define HIFI_FRONT_END_H
+
+#include "HiFiDsp.h"
+
+#define HIFI_FRONT_END_MAX_CHANNELS   2
+
+// Unity gain in the Q16.16 format used for the AGC gain.
+#define HIFI_AGC_UNITY_GAIN           0x00010000UL
+
+class HiFiFrontEnd {
+public:
+  HiFiFrontEnd();
+
+  // Number of interleaved channels, the frame rate and the number of frames
+  // that will usually be passed to process() (the AGC time constants are
+  // worked out per block).  The cutoff and AGC settings are kept, so they
+  // can be set before or after begin().
+  void begin(uint8_t channels, uint32_t sampleRate, uint16_t blockFrames);
+
+  void enableDcBlock(bool enable);
+  void setDcBlockCutoff(float cutoffHz);
+
+  void configureAgc(float targetDbfs,
+          float maxGainDb,
+          float attackMs,
+          float releaseMs);
+  void enableAgc(bool enable);
+
+  // Skip all processing.  Filter and AGC state is kept so that turning the
+  // bypass off again doesn't cause a jump.
+  void setBypass(bool bypass) { _bypass = bypass; }
+  bool isBypassed() const { return _bypass; }
+
+  void process(int32_t *buf, uint16_t frames);
+
+  // Gain state.  The gain is Q16.16 (0x10000 is unity), the level is the
+  // AGC's envelope of the (DC blocked) input as a Q31 peak value.
+  uint32_t getGain() const { return _gain; }
+  float getGainDb() const;
+  uint32_t getLevel() const { return _envelope; }
+  bool isAtMaxGain() const { return _gain >= _maxGain; }
+
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  void dcBlock(int32_t *buf, uint16_t frames);
+  void agc(int32_t *buf, uint16_t frames);
+  void updateAgcCoefficients();
+
+  uint8_t _channels;
+  uint32_t _sampleRate;
+  uint16_t _blockFrames;
+  bool _bypass;
+
+  // DC blocker: y[n] = x[n] - x[n-1] + R * y[n-1], R in Q31.  The fraction
+  // lost when truncating R * y[n-1] is fed back in on the next sample which
+  // keeps the filter from sitting on a small offset of its own.
+  bool _dcEnabled;
+  float _dcCutoffHz;
+  int32_t _dcPole;
+  int32_t _dcX1[HIFI_FRONT_END_MAX_CHANNELS];
+  int32_t _dcY1[HIFI_FRONT_END_MAX_CHANNELS];
+  uint32_t _dcErr[HIFI_FRONT_END_MAX_CHANNELS];
+
+  // AGC
+  bool _agcEnabled;
+  float _attackMs;
+  float _releaseMs;
+  uint32_t _target;         // Q31 peak
+  uint32_t _maxGain;        // Q16.16
+  int32_t _attackCoef;      // Q31, per block
+  int32_t _releaseCoef;     // Q31, per block
+  uint32_t _envelope;       // Q31 peak
+  uint32_t _gain;           // Q16.16
+
+  HiFiCycleMeter _meter;
+};
+
+#endif
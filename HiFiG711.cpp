@@ -0,0 +1,63 @@
+/*
+  HiFiG711.cpp
+
+  Block G.711 encode and decode.  See HiFiG711.h.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "HiFiG711.h"
+
+HIFI_RAMFUNC void HiFiG711::encode(const int32_t *buf, uint8_t *codes,
+                                   uint16_t samples, uint8_t stride)
+{
+  _encodeMeter.start();
+
+  if (_law == HIFI_G711_ULAW)
+  {
+    for (uint16_t i = 0; i < samples; i++)
+    {
+      codes[i] = hifi_ulaw_compress((int16_t)(*buf >> 16));
+      buf += stride;
+    }
+  }
+  else
+  {
+    for (uint16_t i = 0; i < samples; i++)
+    {
+      codes[i] = hifi_alaw_compress((int16_t)(*buf >> 16));
+      buf += stride;
+    }
+  }
+
+  _encodeMeter.stop();
+}
+
+HIFI_RAMFUNC void HiFiG711::decode(const uint8_t *codes, int32_t *buf,
+                                   uint16_t samples, uint8_t stride)
+{
+  const int16_t *expand = (_law == HIFI_G711_ULAW) ? hifi_ulaw_expand :
+                                                      hifi_alaw_expand;
+
+  _decodeMeter.start();
+
+  for (uint16_t i = 0; i < samples; i++)
+  {
+    *buf = (int32_t)expand[codes[i]] * 65536;
+    buf += stride;
+  }
+
+  _decodeMeter.stop();
+}
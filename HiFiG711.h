@@ -0,0 +1,127 @@
+/*
+  HiFiG711.h
+
+  G.711 mu-law and A-law companding, for carrying 8kHz narrowband voice
+  in 8 bits per sample (64K bit/s mono, a quarter of 16 bit stereo PCM at
+  the same rate).
+
+  Expansion is a 256 entry table lookup.  Compression finds the segment
+  with a 256 byte table instead of a search, so both directions take a
+  fixed, small number of cycles per sample.  The output matches the Sun
+  g711.c reference bit for bit (extras/telephony has the table generator
+  and a host check against it).
+
+  Blocks are Q31 like the rest of the library; only the top 16 bits are
+  used.  'stride' picks one channel out of an interleaved block.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_G711_H
+#define HIFI_G711_H
+
+#include "HiFiDsp.h"
+
+extern "C" const int16_t hifi_ulaw_expand[256];
+extern "C" const int16_t hifi_alaw_expand[256];
+extern "C" const uint8_t hifi_g711_segment[256];
+
+typedef enum
+{
+  HIFI_G711_ULAW,
+  HIFI_G711_ALAW
+} HiFiG711Law_t;
+
+static inline uint8_t hifi_ulaw_compress(int16_t pcm)
+{
+  // 14 bit magnitude, biased so the segments start at powers of two
+  int32_t v = pcm >> 2;
+  uint8_t mask = 0xFF;
+
+  if (v < 0)
+  {
+    v = -v;
+    mask = 0x7F;
+  }
+  if (v > 8159)
+  {
+    v = 8159;
+  }
+  v += 0x21;
+
+  uint8_t seg = hifi_g711_segment[v >> 6];
+  if (seg >= 8)
+  {
+    return 0x7F ^ mask;
+  }
+  return ((seg << 4) | ((v >> (seg + 1)) & 0x0F)) ^ mask;
+}
+
+static inline uint8_t hifi_alaw_compress(int16_t pcm)
+{
+  // 13 bit magnitude
+  int32_t v = pcm >> 3;
+  uint8_t mask = 0xD5;
+
+  if (v < 0)
+  {
+    v = -v - 1;
+    mask = 0x55;
+  }
+
+  uint8_t seg = hifi_g711_segment[v >> 5];
+  uint8_t code = seg << 4;
+
+  code |= (v >> ((seg < 2) ? 1 : seg)) & 0x0F;
+  return code ^ mask;
+}
+
+static inline int16_t hifi_ulaw_expand_sample(uint8_t code)
+{
+  return hifi_ulaw_expand[code];
+}
+
+static inline int16_t hifi_alaw_expand_sample(uint8_t code)
+{
+  return hifi_alaw_expand[code];
+}
+
+class HiFiG711 {
+public:
+  HiFiG711(HiFiG711Law_t law = HIFI_G711_ULAW) : _law(law)
+  {
+    hifi_cycle_counter_enable();
+  };
+
+  void setLaw(HiFiG711Law_t law) { _law = law; }
+  HiFiG711Law_t getLaw() const { return _law; }
+
+  // One code byte per sample.
+  void encode(const int32_t *buf, uint8_t *codes, uint16_t samples,
+              uint8_t stride = 1);
+  void decode(const uint8_t *codes, int32_t *buf, uint16_t samples,
+              uint8_t stride = 1);
+
+  // Cycles for the last encode() and decode()
+  const HiFiCycleMeter &getEncodeMeter() const { return _encodeMeter; }
+  const HiFiCycleMeter &getDecodeMeter() const { return _decodeMeter; }
+
+private:
+  HiFiG711Law_t _law;
+  HiFiCycleMeter _encodeMeter;
+  HiFiCycleMeter _decodeMeter;
+};
+
+#endif
@@ -0,0 +1,355 @@
+/*
+  HiFiG722.cpp
+
+  G.722 sub-band ADPCM.  See HiFiG722.h.
+
+  The block numbers in the comments (1L, 4, ...) are the ones the ITU
+  recommendation uses for each step, to make checking against it easier.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <string.h>
+#include "HiFiG722.h"
+
+///////////////////////////////////////////////////////////////////////////
+/// Tables
+///////////////////////////////////////////////////////////////////////////
+static const int16_t qmfCoeffs[12] =
+{
+  3, -11, 12, 32, -210, 951, 3876, -805, 362, -156, 53, -11
+};
+
+// Lower band quantiser decision levels and codes (QUANTL)
+static const int16_t q6[32] =
+{
+  0, 35, 72, 110, 150, 190, 233, 276, 323, 370, 422, 473, 530, 587, 650,
+  714, 786, 858, 940, 1023, 1121, 1219, 1339, 1458, 1612, 1765, 1980, 2195,
+  2557, 2919, 0, 0
+};
+static const uint8_t iln[32] =
+{
+  0, 63, 62, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+  16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 0
+};
+static const uint8_t ilp[32] =
+{
+  0, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45,
+  44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 0
+};
+
+// Inverse quantisers: 6 bit (decoder output), 4 bit (predictor), upper band
+static const int16_t qm6[64] =
+{
+  -136, -136, -136, -136, -24808, -21904, -19008, -16704, -14984, -13512,
+  -12280, -11192, -10232, -9360, -8576, -7856, -7192, -6576, -6000, -5456,
+  -4944, -4464, -4008, -3576, -3168, -2776, -2400, -2032, -1688, -1360,
+  -1040, -728, 24808, 21904, 19008, 16704, 14984, 13512, 12280, 11192,
+  10232, 9360, 8576, 7856, 7192, 6576, 6000, 5456, 4944, 4464, 4008, 3576,
+  3168, 2776, 2400, 2032, 1688, 1360, 1040, 728, 432, 136, -432, -136
+};
+static const int16_t qm4[16] =
+{
+  0, -20456, -12896, -8968, -6288, -4240, -2584, -1200, 20456, 12896, 8968,
+  6288, 4240, 2584, 1200, 0
+};
+static const int16_t qm2[4] = { -7408, -1616, 7408, 1616 };
+
+// Scale factor adaptation (LOGSCL, LOGSCH, SCALEL, SCALEH)
+static const int16_t wl[8] = { -60, -30, 58, 172, 334, 538, 1198, 3042 };
+static const uint8_t rl42[16] =
+{
+  0, 7, 6, 5, 4, 3, 2, 1, 7, 6, 5, 4, 3, 2, 1, 0
+};
+static const int16_t wh[3] = { 0, -214, 798 };
+static const uint8_t rh2[4] = { 2, 1, 2, 1 };
+static const int16_t ilb[32] =
+{
+  2048, 2093, 2139, 2186, 2233, 2282, 2332, 2383, 2435, 2489, 2543, 2599,
+  2656, 2714, 2774, 2834, 2896, 2960, 3025, 3091, 3158, 3228, 3298, 3371,
+  3444, 3520, 3597, 3676, 3756, 3838, 3922, 4008
+};
+
+// Upper band quantiser codes (QUANTH)
+static const uint8_t ihn[3] = { 0, 1, 0 };
+static const uint8_t ihp[3] = { 0, 3, 2 };
+
+static inline int32_t sat16(int32_t x)
+{
+  return (x > 32767) ? 32767 : ((x < -32768) ? -32768 : x);
+}
+
+static void resetBands(HiFiG722Band_t *band, int32_t *x)
+{
+  memset(band, 0, 2 * sizeof(HiFiG722Band_t));
+  memset(x, 0, 24 * sizeof(int32_t));
+  band[0].det = 32;
+  band[1].det = 8;
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Block 3: scale factor adaptation, shared by encoder and decoder.
+///////////////////////////////////////////////////////////////////////////
+static inline void scaleLow(HiFiG722Band_t &band, uint8_t ilow)
+{
+  int32_t nb = ((band.nb * 127) >> 7) + wl[rl42[ilow >> 2]];
+
+  nb = (nb < 0) ? 0 : ((nb > 18432) ? 18432 : nb);
+  band.nb = nb;
+
+  int32_t shift = 8 - (nb >> 11);
+  int32_t v = ilb[(nb >> 6) & 31];
+  band.det = ((shift < 0) ? (v << -shift) : (v >> shift)) << 2;
+}
+
+static inline void scaleHigh(HiFiG722Band_t &band, uint8_t ihigh)
+{
+  int32_t nb = ((band.nb * 127) >> 7) + wh[rh2[ihigh]];
+
+  nb = (nb < 0) ? 0 : ((nb > 22528) ? 22528 : nb);
+  band.nb = nb;
+
+  int32_t shift = 10 - (nb >> 11);
+  int32_t v = ilb[(nb >> 6) & 31];
+  band.det = ((shift < 0) ? (v << -shift) : (v >> shift)) << 2;
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Block 4: reconstruction and predictor adaptation, shared by encoder and
+/// decoder and both bands.
+///////////////////////////////////////////////////////////////////////////
+HIFI_RAMFUNC static void block4(HiFiG722Band_t &band, int32_t d)
+{
+  int32_t wd1;
+  int32_t wd2;
+  int32_t wd3;
+
+  // RECONS, PARREC
+  band.d[0] = d;
+  band.r[0] = sat16(band.s + d);
+  band.p[0] = sat16(band.sz + d);
+
+  // UPPOL2
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    band.sg[i] = band.p[i] >> 15;
+  }
+  wd1 = sat16(band.a[1] * 4);
+  wd2 = (band.sg[0] == band.sg[1]) ? -wd1 : wd1;
+  if (wd2 > 32767)
+  {
+    wd2 = 32767;
+  }
+  wd3 = (wd2 >> 7) + ((band.sg[0] == band.sg[2]) ? 128 : -128);
+  wd3 += (band.a[2] * 32512) >> 15;
+  wd3 = (wd3 > 12288) ? 12288 : ((wd3 < -12288) ? -12288 : wd3);
+  band.ap[2] = wd3;
+
+  // UPPOL1
+  wd1 = (band.sg[0] == band.sg[1]) ? 192 : -192;
+  wd2 = (band.a[1] * 32640) >> 15;
+  band.ap[1] = sat16(wd1 + wd2);
+  wd3 = sat16(15360 - band.ap[2]);
+  if (band.ap[1] > wd3)
+  {
+    band.ap[1] = wd3;
+  }
+  else if (band.ap[1] < -wd3)
+  {
+    band.ap[1] = -wd3;
+  }
+
+  // UPZERO
+  wd1 = (d == 0) ? 0 : 128;
+  band.sg[0] = d >> 15;
+  for (uint8_t i = 1; i < 7; i++)
+  {
+    band.sg[i] = band.d[i] >> 15;
+    wd2 = (band.sg[i] == band.sg[0]) ? wd1 : -wd1;
+    wd3 = (band.b[i] * 32640) >> 15;
+    band.bp[i] = sat16(wd2 + wd3);
+  }
+
+  // DELAYA
+  for (uint8_t i = 6; i > 0; i--)
+  {
+    band.d[i] = band.d[i - 1];
+    band.b[i] = band.bp[i];
+  }
+  for (uint8_t i = 2; i > 0; i--)
+  {
+    band.r[i] = band.r[i - 1];
+    band.p[i] = band.p[i - 1];
+    band.a[i] = band.ap[i];
+  }
+
+  // FILTEP
+  wd1 = (band.a[1] * sat16(band.r[1] + band.r[1])) >> 15;
+  wd2 = (band.a[2] * sat16(band.r[2] + band.r[2])) >> 15;
+  band.sp = sat16(wd1 + wd2);
+
+  // FILTEZ
+  int32_t sz = 0;
+  for (uint8_t i = 6; i > 0; i--)
+  {
+    sz += (band.b[i] * sat16(band.d[i] + band.d[i])) >> 15;
+  }
+  band.sz = sat16(sz);
+
+  // PREDIC
+  band.s = sat16(band.sp + band.sz);
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Encoder
+///////////////////////////////////////////////////////////////////////////
+void HiFiG722Encoder::reset()
+{
+  resetBands(_band, _x);
+  hifi_cycle_counter_enable();
+}
+
+HIFI_RAMFUNC void HiFiG722Encoder::encode(const int32_t *buf, uint8_t *codes,
+                                          uint16_t samples, uint8_t stride)
+{
+  _meter.start();
+
+  for (uint16_t n = 0; n < samples / 2; n++)
+  {
+    ///////////////////////////////////////////////////////////////////////
+    /// Transmit QMF, keeping every other output
+    ///////////////////////////////////////////////////////////////////////
+    memmove(_x, _x + 2, 22 * sizeof(int32_t));
+    _x[22] = (int16_t)(buf[0] >> 16);
+    _x[23] = (int16_t)(buf[stride] >> 16);
+    buf += 2 * stride;
+
+    int32_t sumOdd = 0;
+    int32_t sumEven = 0;
+    for (uint8_t i = 0; i < 12; i++)
+    {
+      sumOdd += _x[2 * i] * qmfCoeffs[i];
+      sumEven += _x[2 * i + 1] * qmfCoeffs[11 - i];
+    }
+    int32_t xlow = (sumEven + sumOdd) >> 14;
+    int32_t xhigh = (sumEven - sumOdd) >> 14;
+
+    ///////////////////////////////////////////////////////////////////////
+    /// Lower band: SUBTRA, QUANTL, INVQAL, then adapt
+    ///////////////////////////////////////////////////////////////////////
+    HiFiG722Band_t &low = _band[0];
+    int32_t el = sat16(xlow - low.s);
+    int32_t wd = (el >= 0) ? el : -(el + 1);
+    uint8_t i;
+
+    for (i = 1; i < 30; i++)
+    {
+      if (wd < ((q6[i] * low.det) >> 12))
+      {
+        break;
+      }
+    }
+    uint8_t ilow = (el < 0) ? iln[i] : ilp[i];
+    int32_t dlow = (low.det * qm4[ilow >> 2]) >> 15;
+
+    scaleLow(low, ilow);
+    block4(low, dlow);
+
+    ///////////////////////////////////////////////////////////////////////
+    /// Upper band: SUBTRA, QUANTH, INVQAH, then adapt
+    ///////////////////////////////////////////////////////////////////////
+    HiFiG722Band_t &high = _band[1];
+    int32_t eh = sat16(xhigh - high.s);
+
+    wd = (eh >= 0) ? eh : -(eh + 1);
+    uint8_t mih = (wd >= ((564 * high.det) >> 12)) ? 2 : 1;
+    uint8_t ihigh = (eh < 0) ? ihn[mih] : ihp[mih];
+    int32_t dhigh = (high.det * qm2[ihigh]) >> 15;
+
+    scaleHigh(high, ihigh);
+    block4(high, dhigh);
+
+    codes[n] = (ihigh << 6) | ilow;
+  }
+
+  _meter.stop();
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Decoder
+///////////////////////////////////////////////////////////////////////////
+void HiFiG722Decoder::reset()
+{
+  resetBands(_band, _x);
+  hifi_cycle_counter_enable();
+}
+
+HIFI_RAMFUNC void HiFiG722Decoder::decode(const uint8_t *codes, int32_t *buf,
+                                          uint16_t bytes, uint8_t stride)
+{
+  _meter.start();
+
+  for (uint16_t n = 0; n < bytes; n++)
+  {
+    uint8_t ilow = codes[n] & 0x3F;
+    uint8_t ihigh = codes[n] >> 6;
+
+    ///////////////////////////////////////////////////////////////////////
+    /// Lower band: the output uses all 6 bits, the predictor only the 4
+    /// that every rate carries.
+    ///////////////////////////////////////////////////////////////////////
+    HiFiG722Band_t &low = _band[0];
+    int32_t rlow = sat16(low.s + ((low.det * qm6[ilow]) >> 15));
+
+    rlow = (rlow > 16383) ? 16383 : ((rlow < -16384) ? -16384 : rlow);
+
+    int32_t dlow = (low.det * qm4[ilow >> 2]) >> 15;
+    scaleLow(low, ilow);
+    block4(low, dlow);
+
+    ///////////////////////////////////////////////////////////////////////
+    /// Upper band
+    ///////////////////////////////////////////////////////////////////////
+    HiFiG722Band_t &high = _band[1];
+    int32_t dhigh = (high.det * qm2[ihigh]) >> 15;
+    int32_t rhigh = sat16(dhigh + high.s);
+
+    rhigh = (rhigh > 16383) ? 16383 : ((rhigh < -16384) ? -16384 : rhigh);
+
+    scaleHigh(high, ihigh);
+    block4(high, dhigh);
+
+    ///////////////////////////////////////////////////////////////////////
+    /// Receive QMF, two output samples per byte
+    ///////////////////////////////////////////////////////////////////////
+    memmove(_x, _x + 2, 22 * sizeof(int32_t));
+    _x[22] = rlow + rhigh;
+    _x[23] = rlow - rhigh;
+
+    int32_t out1 = 0;
+    int32_t out2 = 0;
+    for (uint8_t i = 0; i < 12; i++)
+    {
+      out2 += _x[2 * i] * qmfCoeffs[i];
+      out1 += _x[2 * i + 1] * qmfCoeffs[11 - i];
+    }
+
+    buf[0] = sat16(out1 >> 11) * 65536;
+    buf[stride] = sat16(out2 >> 11) * 65536;
+    buf += 2 * stride;
+  }
+
+  _meter.stop();
+}
@@ -0,0 +1,95 @@
+/*
+  HiFiG722.h
+
+  G.722 wideband speech codec (64K bit/s mode): 16kHz audio, 50Hz-7kHz,
+  in one byte per pair of samples, a quarter of 16 bit mono PCM.
+
+  A 24 tap QMF splits the input into two 8kHz sub-bands.  The lower band
+  is coded with 6 bit ADPCM and the upper band with 2 bit ADPCM, each with
+  its own adaptive pole/zero predictor, and the receive QMF puts them back
+  together.  Everything is 16/32 bit integer arithmetic following the ITU
+  reference algorithm, so encoder and decoder state evolve identically on
+  both ends of a link.
+
+  The encoder and decoder are separate objects, since an intercom needs
+  one of each and they share no state.  Blocks are Q31 at 16kHz; only the
+  top 16 bits are used.  Sample counts must be even.
+
+  The 56K and 48K modes (dropping the lowest one or two bits of each
+  byte) are not supported.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_G722_H
+#define HIFI_G722_H
+
+#include "HiFiDsp.h"
+
+// State of one sub-band's ADPCM coder
+typedef struct
+{
+  int32_t s;        // signal estimate
+  int32_t sp;       // pole section of the estimate
+  int32_t sz;       // zero section of the estimate
+  int32_t r[3];     // reconstructed signal
+  int32_t a[3];     // pole coefficients
+  int32_t ap[3];
+  int32_t p[3];     // partial reconstructed signal
+  int32_t d[7];     // quantised differences
+  int32_t b[7];     // zero coefficients
+  int32_t bp[7];
+  int32_t sg[7];
+  int32_t nb;       // log scale factor
+  int32_t det;      // scale factor
+} HiFiG722Band_t;
+
+class HiFiG722Encoder {
+public:
+  HiFiG722Encoder() { reset(); }
+
+  void reset();
+
+  // 'samples' (even) samples in, samples / 2 bytes out.
+  void encode(const int32_t *buf, uint8_t *codes, uint16_t samples,
+              uint8_t stride = 1);
+
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  HiFiG722Band_t _band[2];
+  int32_t _x[24];
+  HiFiCycleMeter _meter;
+};
+
+class HiFiG722Decoder {
+public:
+  HiFiG722Decoder() { reset(); }
+
+  void reset();
+
+  // 'bytes' bytes in, 2 * bytes samples out.
+  void decode(const uint8_t *codes, int32_t *buf, uint16_t bytes,
+              uint8_t stride = 1);
+
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  HiFiG722Band_t _band[2];
+  int32_t _x[24];
+  HiFiCycleMeter _meter;
+};
+
+#endif
@@ -0,0 +1,266 @@
+/*
+  HiFiGpioScheduler.cpp
+
+  Frame synchronous pin changes.  See HiFiGpioScheduler.h.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#if defined(ARDUINO_ARCH_SAM)
+
+#include <string.h>
+#include "HiFiGpioScheduler.h"
+
+// TC8 is channel 2 of TC2, clocked at MCK/2 (42MHz)
+#define GPIO_JITTER_TC          TC2
+#define GPIO_JITTER_CHANNEL     2
+#define GPIO_JITTER_TICK_HZ     (VARIANT_MCK / 2)
+
+static Pio * const gpioPorts[4] = { PIOA, PIOB, PIOC, PIOD };
+
+static void gpioFrameHook(uint32_t frame, void *context)
+{
+  ((HiFiGpioScheduler *)context)->onFrame(frame);
+}
+
+static uint32_t ticksToNs(uint32_t ticks)
+{
+  return (uint32_t)(((uint64_t)ticks * 1000000000ULL) / GPIO_JITTER_TICK_HZ);
+}
+
+HiFiGpioScheduler::HiFiGpioScheduler() :
+  _hifi(NULL),
+  _late(0),
+  _armed(false),
+  _measuring(false),
+  _minTicks(0xFFFFFFFF),
+  _maxTicks(0),
+  _sumTicks(0),
+  _measured(0)
+{
+  memset(_events, 0, sizeof(_events));
+  memset(_set, 0, sizeof(_set));
+  memset(_clear, 0, sizeof(_clear));
+  memset(_toggle, 0, sizeof(_toggle));
+}
+
+bool HiFiGpioScheduler::begin(HiFiClass &hifi)
+{
+  end();
+
+  for (uint8_t i = 0; i < HIFI_GPIO_QUEUE; i++)
+  {
+    _events[i].pending = false;
+  }
+  _late = 0;
+  _armed = false;
+
+  if (!hifi.addFrameHook(gpioFrameHook, this))
+  {
+    return false;
+  }
+  _hifi = &hifi;
+  return true;
+}
+
+void HiFiGpioScheduler::end()
+{
+  if (_hifi)
+  {
+    enableJitterMeasurement(false);
+    _hifi->removeFrameHook(gpioFrameHook, this);
+    _hifi = NULL;
+  }
+}
+
+bool HiFiGpioScheduler::schedule(uint8_t pin, HiFiGpioAction_t action,
+                                 uint32_t frame)
+{
+  for (uint8_t i = 0; i < HIFI_GPIO_QUEUE; i++)
+  {
+    Event &e = _events[i];
+
+    if (!e.pending)
+    {
+      e.frame = frame;
+      e.port = g_APinDescription[pin].pPort;
+      e.mask = g_APinDescription[pin].ulPin;
+      e.action = action;
+
+      // Last, and only once the rest is in memory: the interrupt only
+      // looks at pending events.
+      __DMB();
+      e.pending = true;
+      return true;
+    }
+  }
+  return false;
+}
+
+uint8_t HiFiGpioScheduler::getPending() const
+{
+  uint8_t pending = 0;
+
+  for (uint8_t i = 0; i < HIFI_GPIO_QUEUE; i++)
+  {
+    if (_events[i].pending)
+    {
+      pending++;
+    }
+  }
+  return pending;
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Jitter measurement: TC8 free runs at MCK/2 and latches its count into
+/// RA on every falling LRCLK edge (the start of an I2S frame).  RA only
+/// loads again once RB has, so RB takes the rising edge to re-arm it.
+///////////////////////////////////////////////////////////////////////////
+void HiFiGpioScheduler::enableJitterMeasurement(bool enable)
+{
+  TcChannel *tc = &GPIO_JITTER_TC->TC_CHANNEL[GPIO_JITTER_CHANNEL];
+
+  if (enable)
+  {
+    pmc_enable_periph_clk(ID_TC8);
+    PIO_Configure(PIOD, PIO_PERIPH_B, PIO_PD7B_TIOA8, PIO_DEFAULT);
+    TC_Configure(GPIO_JITTER_TC, GPIO_JITTER_CHANNEL,
+                 TC_CMR_TCCLKS_TIMER_CLOCK1 | TC_CMR_LDRA_FALLING |
+                 TC_CMR_LDRB_RISING);
+    tc->TC_CCR = TC_CCR_CLKEN | TC_CCR_SWTRG;
+    resetJitter();
+    _measuring = true;
+  }
+  else if (_measuring)
+  {
+    _measuring = false;
+    tc->TC_CCR = TC_CCR_CLKDIS;
+  }
+}
+
+void HiFiGpioScheduler::resetJitter()
+{
+  // Called from loop() while the interrupt may be updating them; a
+  // reading straddling the reset is harmless.
+  _measured = 0;
+  _sumTicks = 0;
+  _maxTicks = 0;
+  _minTicks = 0xFFFFFFFF;
+}
+
+uint32_t HiFiGpioScheduler::getMinLatency() const
+{
+  return _measured ? ticksToNs(_minTicks) : 0;
+}
+
+uint32_t HiFiGpioScheduler::getMaxLatency() const
+{
+  return _measured ? ticksToNs(_maxTicks) : 0;
+}
+
+uint32_t HiFiGpioScheduler::getMeanLatency() const
+{
+  return _measured ? ticksToNs((uint32_t)(_sumTicks / _measured)) : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Frame hook
+///////////////////////////////////////////////////////////////////////////
+void HiFiGpioScheduler::onFrame(uint32_t frame)
+{
+  // Pins first, at a fixed point after the frame started.
+  if (_armed)
+  {
+    for (uint8_t p = 0; p < 4; p++)
+    {
+      Pio *port = gpioPorts[p];
+      uint32_t toggle = _toggle[p];
+      uint32_t state = port->PIO_ODSR;
+
+      port->PIO_SODR = _set[p] | (toggle & ~state);
+      port->PIO_CODR = _clear[p] | (toggle & state);
+    }
+  }
+
+  if (_measuring)
+  {
+    TcChannel *tc = &GPIO_JITTER_TC->TC_CHANNEL[GPIO_JITTER_CHANNEL];
+
+    // Only measure from an edge captured since the last frame; reading
+    // TC_SR clears LDRAS.
+    if (tc->TC_SR & TC_SR_LDRAS)
+    {
+      uint32_t edge = tc->TC_RA;
+      uint32_t ticks = tc->TC_CV - edge;
+
+      if (ticks < _minTicks)
+      {
+        _minTicks = ticks;
+      }
+      if (ticks > _maxTicks)
+      {
+        _maxTicks = ticks;
+      }
+      _sumTicks += ticks;
+      _measured++;
+    }
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Work out the writes for the next frame.  Anything due before then is
+  /// late and goes out with it.
+  ///////////////////////////////////////////////////////////////////////////
+  uint32_t next = frame + 1;
+
+  memset(_set, 0, sizeof(_set));
+  memset(_clear, 0, sizeof(_clear));
+  memset(_toggle, 0, sizeof(_toggle));
+  _armed = false;
+
+  for (uint8_t i = 0; i < HIFI_GPIO_QUEUE; i++)
+  {
+    Event &e = _events[i];
+
+    if (!e.pending || (int32_t)(e.frame - next) > 0)
+    {
+      continue;
+    }
+    if (e.frame != next)
+    {
+      _late++;
+    }
+
+    uint8_t p = (e.port == PIOA) ? 0 : (e.port == PIOB) ? 1 :
+                (e.port == PIOC) ? 2 : 3;
+    switch (e.action)
+    {
+      case HIFI_GPIO_LOW:
+        _clear[p] |= e.mask;
+        break;
+
+      case HIFI_GPIO_HIGH:
+        _set[p] |= e.mask;
+        break;
+
+      case HIFI_GPIO_TOGGLE:
+        _toggle[p] ^= e.mask;
+        break;
+    }
+    _armed = true;
+    e.pending = false;
+  }
+}
+
+#endif
@@ -0,0 +1,112 @@
+/*
+  HiFiGpioScheduler.h
+
+  Pin changes at an exact audio frame, e.g. to strobe a camera or a
+  scope trigger when a tone starts.
+
+  Events are queued from loop() with the number of the frame they belong
+  to (see HiFiClass::getFrameCount()) and carried out by a HiFi frame
+  hook at the start of that frame.  The hook writes the pins first thing,
+  from masks worked out during the previous frame, so the delay between
+  the frame starting and the pins changing doesn't depend on how many
+  events are queued.  Events therefore have to be queued at least two
+  frames ahead; ones that arrive later go out at the next frame and are
+  counted as late.
+
+  How close the pin change is to the LRCLK edge depends on how quickly
+  the audio interrupt gets to run.  With LRCLK also wired to pin 11,
+  enableJitterMeasurement() times every frame's pin write from the edge
+  that started the frame (to 24ns), and the spread of those times is the
+  jitter the outputs see.
+
+  Only available on the Due.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_GPIO_SCHEDULER_H
+#define HIFI_GPIO_SCHEDULER_H
+
+#if defined(ARDUINO_ARCH_SAM)
+
+#include "HiFi.h"
+
+// Events that can be pending at once
+#define HIFI_GPIO_QUEUE     16
+
+typedef enum
+{
+  HIFI_GPIO_LOW,
+  HIFI_GPIO_HIGH,
+  HIFI_GPIO_TOGGLE
+} HiFiGpioAction_t;
+
+class HiFiGpioScheduler {
+public:
+  HiFiGpioScheduler();
+
+  bool begin(HiFiClass &hifi);
+  void end();
+
+  // Queue 'action' on 'pin' (already an OUTPUT) at the start of 'frame'.
+  // Returns false if the queue is full.
+  bool schedule(uint8_t pin, HiFiGpioAction_t action, uint32_t frame);
+  uint8_t getPending() const;
+  uint32_t getLateEvents() const { return _late; }
+
+  // Needs LRCLK wired to pin 11 (TIOA8).  Uses timer TC8.
+  void enableJitterMeasurement(bool enable);
+  void resetJitter();
+
+  // Time from the LRCLK edge to the pin write, over the frames measured
+  // since the last reset, in ns.
+  uint32_t getMinLatency() const;
+  uint32_t getMaxLatency() const;
+  uint32_t getMeanLatency() const;
+  uint32_t getJitter() const { return getMaxLatency() - getMinLatency(); }
+
+  // Interrupt handler function
+  void onFrame(uint32_t frame);
+
+private:
+  struct Event
+  {
+    uint32_t frame;
+    Pio *port;
+    uint32_t mask;
+    HiFiGpioAction_t action;
+    volatile bool pending;
+  };
+
+  HiFiClass *_hifi;
+  Event _events[HIFI_GPIO_QUEUE];
+  uint32_t _late;
+
+  // Pin writes for the coming frame, per port (PIOA .. PIOD)
+  uint32_t _set[4];
+  uint32_t _clear[4];
+  uint32_t _toggle[4];
+  bool _armed;
+
+  bool _measuring;
+  uint32_t _minTicks;
+  uint32_t _maxTicks;
+  uint64_t _sumTicks;
+  uint32_t _measured;
+};
+
+#endif
+
+#endif
@@ -0,0 +1,270 @@
+/*
+  HiFiLatencyProbe.cpp
+
+  SSC interrupt latency measurement.  See HiFiLatencyProbe.h.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#if defined(ARDUINO_ARCH_SAM)
+
+#include "HiFiLatencyProbe.h"
+#include "HiFiSscTransport.h"
+#include "HiFiDsp.h"
+
+// TC6 (TC2 channel 0) captures the edges, TC7 (TC2 channel 1) is the load.
+// Both count MCK/2.
+#define PROBE_TC              TC2
+#define PROBE_CHANNEL         0
+#define LOAD_CHANNEL          1
+#define PROBE_TICK_HZ         (VARIANT_MCK / 2)
+
+HiFiLatencyProbe *HiFiLatencyProbe::_active = NULL;
+
+static volatile uint32_t loadBusyCycles = 0;
+
+static uint32_t ticksToNs(uint32_t ticks)
+{
+  return (uint32_t)(((uint64_t)ticks * 1000000000ULL) / PROBE_TICK_HZ);
+}
+
+HIFI_RAMFUNC void HiFiLatencyProbe::entry()
+{
+  _active->onEntry();
+}
+
+HiFiLatencyProbe::HiFiLatencyProbe() :
+  _binTicks(1),
+  _frames(0),
+  _missed(0),
+  _minTicks(0xFFFFFFFF),
+  _maxTicks(0),
+  _sumTicks(0),
+  _lastEdge(0),
+  _periodTicks(0)
+{
+  reset();
+}
+
+bool HiFiLatencyProbe::begin(uint16_t binNs)
+{
+  end();
+
+  _binTicks = (uint16_t)(((uint32_t)binNs * (PROBE_TICK_HZ / 1000000)) / 1000);
+  if (_binTicks == 0)
+  {
+    _binTicks = 1;
+  }
+  reset();
+
+  // Free running capture; RA takes the count at each falling edge of TIOA6.
+  // RA only loads again once RB has, so RB takes the rising edge in
+  // between to re-arm it every frame.
+  pmc_enable_periph_clk(ID_TC6);
+  PIO_Configure(PIOC, PIO_PERIPH_B, PIO_PC25B_TIOA6, PIO_DEFAULT);
+  TC_Configure(PROBE_TC, PROBE_CHANNEL, TC_CMR_TCCLKS_TIMER_CLOCK1 |
+               TC_CMR_LDRA_FALLING | TC_CMR_LDRB_RISING);
+  PROBE_TC->TC_CHANNEL[PROBE_CHANNEL].TC_CCR = TC_CCR_CLKEN | TC_CCR_SWTRG;
+
+  // Drop the edge that may have been latched already.
+  (void)PROBE_TC->TC_CHANNEL[PROBE_CHANNEL].TC_SR;
+
+  _active = this;
+  HiFiSscTransport::setEntryProbe(entry);
+  return true;
+}
+
+void HiFiLatencyProbe::end()
+{
+  if (_active != this)
+  {
+    return;
+  }
+
+  HiFiSscTransport::setEntryProbe(NULL);
+  _active = NULL;
+  setTimerLoad(0, 0, 0);
+  PROBE_TC->TC_CHANNEL[PROBE_CHANNEL].TC_CCR = TC_CCR_CLKDIS;
+}
+
+void HiFiLatencyProbe::reset()
+{
+  // From loop() while the interrupt may be adding to them; a frame
+  // straddling the reset is harmless.
+  for (uint8_t i = 0; i < HIFI_LATENCY_BINS; i++)
+  {
+    _histogram[i] = 0;
+  }
+  _frames = 0;
+  _missed = 0;
+  _minTicks = 0xFFFFFFFF;
+  _maxTicks = 0;
+  _sumTicks = 0;
+}
+
+uint32_t HiFiLatencyProbe::getMinLatency() const
+{
+  return _frames ? ticksToNs(_minTicks) : 0;
+}
+
+uint32_t HiFiLatencyProbe::getMaxLatency() const
+{
+  return _frames ? ticksToNs(_maxTicks) : 0;
+}
+
+uint32_t HiFiLatencyProbe::getMeanLatency() const
+{
+  return _frames ? ticksToNs((uint32_t)(_sumTicks / _frames)) : 0;
+}
+
+uint32_t HiFiLatencyProbe::getFramePeriod() const
+{
+  return ticksToNs(_periodTicks);
+}
+
+uint32_t HiFiLatencyProbe::getBinWidth() const
+{
+  return ticksToNs(_binTicks);
+}
+
+uint32_t HiFiLatencyProbe::getPercentile(float percent) const
+{
+  uint32_t total = 0;
+
+  for (uint8_t i = 0; i < HIFI_LATENCY_BINS; i++)
+  {
+    total += _histogram[i];
+  }
+  if (total == 0)
+  {
+    return 0;
+  }
+
+  uint32_t target = (uint32_t)(total * percent / 100.0f);
+  uint32_t seen = 0;
+
+  for (uint8_t i = 0; i < HIFI_LATENCY_BINS; i++)
+  {
+    seen += _histogram[i];
+    if (seen >= target)
+    {
+      return ticksToNs((uint32_t)(i + 1) * _binTicks);
+    }
+  }
+  return getMaxLatency();
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Background load
+///////////////////////////////////////////////////////////////////////////
+void HiFiLatencyProbe::setTimerLoad(uint32_t rateHz, uint16_t busyUs,
+                                    uint8_t priority)
+{
+  TcChannel *tc = &PROBE_TC->TC_CHANNEL[LOAD_CHANNEL];
+
+  NVIC_DisableIRQ(TC7_IRQn);
+  tc->TC_CCR = TC_CCR_CLKDIS;
+
+  if (rateHz == 0)
+  {
+    return;
+  }
+
+  hifi_cycle_counter_enable();
+  loadBusyCycles = (uint32_t)busyUs * (VARIANT_MCK / 1000000);
+
+  pmc_enable_periph_clk(ID_TC7);
+  TC_Configure(PROBE_TC, LOAD_CHANNEL, TC_CMR_TCCLKS_TIMER_CLOCK1 |
+               TC_CMR_WAVE | TC_CMR_WAVSEL_UP_RC);
+  TC_SetRC(PROBE_TC, LOAD_CHANNEL, PROBE_TICK_HZ / rateHz);
+  tc->TC_IER = TC_IER_CPCS;
+  (void)tc->TC_SR;
+
+  NVIC_ClearPendingIRQ(TC7_IRQn);
+  NVIC_SetPriority(TC7_IRQn, priority);
+  NVIC_EnableIRQ(TC7_IRQn);
+  tc->TC_CCR = TC_CCR_CLKEN | TC_CCR_SWTRG;
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Interrupt path
+///////////////////////////////////////////////////////////////////////////
+HIFI_RAMFUNC void HiFiLatencyProbe::onEntry()
+{
+  TcChannel *tc = &PROBE_TC->TC_CHANNEL[PROBE_CHANNEL];
+
+  // Status first, then the capture, then the count: reading TC_SR clears
+  // LDRAS, so an edge that lands after it stays latched for the next
+  // entry, and the count is never older than the edge it is measured
+  // from.
+  uint32_t status = tc->TC_SR;
+
+  // Only the first entry after an edge counts.
+  if (!(status & TC_SR_LDRAS))
+  {
+    return;
+  }
+
+  // RB is read only so that it counts as read: LOVRS then means RA or RB
+  // was loaded twice since the last entry, which is a missed frame.
+  uint32_t edge = tc->TC_RA;
+  (void)tc->TC_RB;
+  uint32_t now = tc->TC_CV;
+  uint32_t ticks = now - edge;
+
+  if (status & TC_SR_LOVRS)
+  {
+    // More than one edge since the last entry: a whole frame late.
+    _missed++;
+  }
+  else
+  {
+    if (_frames)
+    {
+      _periodTicks = edge - _lastEdge;
+    }
+
+    uint32_t bin = ticks / _binTicks;
+    if (bin >= HIFI_LATENCY_BINS)
+    {
+      bin = HIFI_LATENCY_BINS - 1;
+    }
+    _histogram[bin]++;
+
+    if (ticks < _minTicks)
+    {
+      _minTicks = ticks;
+    }
+    if (ticks > _maxTicks)
+    {
+      _maxTicks = ticks;
+    }
+    _sumTicks += ticks;
+    _frames++;
+  }
+  _lastEdge = edge;
+}
+
+void TC7_Handler(void)
+{
+  uint32_t start = hifi_cycle_count();
+
+  (void)PROBE_TC->TC_CHANNEL[LOAD_CHANNEL].TC_SR;
+  while (hifi_cycle_count() - start < loadBusyCycles)
+  {
+  }
+}
+
+#endif
@@ -0,0 +1,98 @@
+/*
+  HiFiLatencyProbe.h
+
+  Measures how long the SSC interrupt takes to start after the frame sync
+  edge, to find out how much of each frame other interrupts (USB, SysTick,
+  Serial, a sketch's timers) take away from the audio path.
+
+  The sync signal (TF, or the codec's LRCLK) has to be wired to pin 5 as
+  well, where timer TC6 latches its 42MHz count on every falling edge.
+  The first SSC interrupt after each edge reads the timer again on entry,
+  and the difference goes into a histogram along with the min, max and
+  mean.  An interrupt that starts a whole frame late is counted as a
+  missed edge.
+
+  setTimerLoad() runs a busy interrupt on TC7 at a given rate, length and
+  priority, so the histogram can be taken under a known background load
+  as well as the sketch's own (see the LatencyProbe example).
+
+  Only available on the Due.  Uses TC6 and TC7 (and defines TC7_Handler).
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_LATENCY_PROBE_H
+#define HIFI_LATENCY_PROBE_H
+
+#if defined(ARDUINO_ARCH_SAM)
+
+#include "Arduino.h"
+
+#define HIFI_LATENCY_BINS   64
+
+class HiFiLatencyProbe {
+public:
+  HiFiLatencyProbe();
+
+  // Call after HiFi.begin().  Latencies past the last bin are counted in
+  // it.
+  bool begin(uint16_t binNs = 250);
+  void end();
+  void reset();
+
+  uint32_t getFrames() const { return _frames; }
+  uint32_t getMissedEdges() const { return _missed; }
+
+  // In ns
+  uint32_t getMinLatency() const;
+  uint32_t getMaxLatency() const;
+  uint32_t getMeanLatency() const;
+  uint32_t getFramePeriod() const;
+
+  // Latency that 'percent' of the frames stayed within (to the bin), ns.
+  uint32_t getPercentile(float percent) const;
+
+  const volatile uint32_t *getHistogram() const { return _histogram; }
+  uint8_t getBinCount() const { return HIFI_LATENCY_BINS; }
+  uint32_t getBinWidth() const;
+
+  // Busy interrupt 'rateHz' times a second for 'busyUs' at NVIC
+  // 'priority' (0 is highest, the SSC runs at 0 unless changed).
+  // A rate of 0 stops it.
+  void setTimerLoad(uint32_t rateHz, uint16_t busyUs, uint8_t priority);
+
+  // Interrupt handler function
+  void onEntry();
+
+private:
+  // The SSC entry probe; calls onEntry() on the instance begun last.
+  static void entry();
+
+  static HiFiLatencyProbe *_active;
+
+  uint16_t _binTicks;
+  volatile uint32_t _histogram[HIFI_LATENCY_BINS];
+  volatile uint32_t _frames;
+  volatile uint32_t _missed;
+  volatile uint32_t _minTicks;
+  volatile uint32_t _maxTicks;
+  volatile uint64_t _sumTicks;
+  uint32_t _lastEdge;
+  volatile uint32_t _periodTicks;
+};
+
+#endif
+
+#endif
@@ -0,0 +1,583 @@
+/*
+  HiFiLooper.cpp
+
+  SD backed loop recorder.  See HiFiLooper.h for an overview.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "HiFiLooper.h"
+
+#define HIFI_LOOPER_BYTES_PER_FRAME   4
+
+// Unity feedback in Q15
+#define HIFI_LOOPER_UNITY             32768
+
+HiFiLooper::HiFiLooper() :
+  _maxFrames(0),
+  _playRing(NULL),
+  _recordRing(NULL),
+  _ringMask(0),
+  _playHead(0),
+  _playTail(0),
+  _recordHead(0),
+  _recordTail(0),
+  _readPos(0),
+  _writePos(0),
+  _state(HIFI_LOOPER_IDLE),
+  _overdubPending(false),
+  _loopFrames(0),
+  _recorded(0),
+  _playPos(0),
+  _underruns(0),
+  _feedback(HIFI_LOOPER_UNITY),
+  _monitor(true)
+{
+}
+
+bool HiFiLooper::begin(const char *path, uint32_t maxSeconds,
+                       uint32_t sampleRate, uint8_t chunks)
+{
+  end();
+
+  if (chunks == 0 || (chunks & (chunks - 1)))
+  {
+    return false;
+  }
+
+  uint32_t ringFrames = (uint32_t)chunks * HIFI_LOOPER_CHUNK_FRAMES;
+
+  _playRing = (uint32_t *)malloc(sizeof(uint32_t) * ringFrames);
+  _recordRing = (uint32_t *)malloc(sizeof(uint32_t) * ringFrames);
+  if (!_playRing || !_recordRing)
+  {
+    end();
+    return false;
+  }
+  _ringMask = ringFrames - 1;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Pre-allocate the file by writing it out in full once.  After that
+  /// every transfer overwrites existing clusters and the FAT is never
+  /// touched while the loop is running.
+  ///////////////////////////////////////////////////////////////////////////
+  _maxFrames = maxSeconds * sampleRate;
+  uint32_t bytes = _maxFrames * HIFI_LOOPER_BYTES_PER_FRAME;
+
+  // Not FILE_WRITE: that adds O_APPEND, which sends every write to the
+  // end of the file whatever the seek before it.
+  _writer = SD.open(path, O_READ | O_WRITE | O_CREAT);
+  if (!_writer)
+  {
+    end();
+    return false;
+  }
+
+  if (_writer.size() < bytes)
+  {
+    uint8_t zeros[512];
+    uint32_t size = _writer.size();
+
+    memset(zeros, 0, sizeof(zeros));
+    _writer.seek(size);
+    while (size < bytes)
+    {
+      // Keep the writes sector aligned
+      uint16_t length = sizeof(zeros) - (size % sizeof(zeros));
+      if (_writer.write(zeros, length) != length)
+      {
+        end();
+        return false;
+      }
+      size += length;
+    }
+    _writer.flush();
+  }
+
+  _reader = SD.open(path, FILE_READ);
+  if (!_reader)
+  {
+    end();
+    return false;
+  }
+
+  clear();
+  hifi_cycle_counter_enable();
+  return true;
+}
+
+void HiFiLooper::end()
+{
+  clear();
+
+  if (_writer)
+  {
+    _writer.close();
+  }
+  if (_reader)
+  {
+    _reader.close();
+  }
+  free(_playRing);
+  free(_recordRing);
+  _playRing = NULL;
+  _recordRing = NULL;
+  _maxFrames = 0;
+}
+
+void HiFiLooper::setFeedback(float feedback)
+{
+  if (feedback < 0.0f)
+  {
+    feedback = 0.0f;
+  }
+  if (feedback > 1.0f)
+  {
+    feedback = 1.0f;
+  }
+  _feedback = (int32_t)(feedback * HIFI_LOOPER_UNITY);
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Transport
+///
+/// The audio path never changes the rings' sizes or positions except
+/// through its own head/tail, so the only transitions that touch shared
+/// state are done with interrupts off, and only the ones that reset the
+/// rings happen while the audio path is leaving them alone (idle or
+/// stopped).
+///////////////////////////////////////////////////////////////////////////
+bool HiFiLooper::record()
+{
+  if (!_playRing ||
+      (_state != HIFI_LOOPER_IDLE && _state != HIFI_LOOPER_STOPPED))
+  {
+    return false;
+  }
+
+  // Let the last overdub reach the card before starting again.
+  while (_recordHead != _recordTail)
+  {
+    service();
+  }
+
+  _playHead = 0;
+  _playTail = 0;
+  _recordHead = 0;
+  _recordTail = 0;
+  _readPos = 0;
+  _writePos = 0;
+  _loopFrames = 0;
+  _recorded = 0;
+  _playPos = 0;
+  _overdubPending = false;
+  _state = HIFI_LOOPER_RECORDING;
+
+  return true;
+}
+
+bool HiFiLooper::play()
+{
+  bool ok = true;
+
+  switch (_state)
+  {
+  case HIFI_LOOPER_RECORDING:
+    // The read-ahead ring has been filling from the start of the file
+    // while recording, so playback picks up without a gap.
+    noInterrupts();
+    if (_recorded < getMinFrames())
+    {
+      ok = false;
+    }
+    else
+    {
+      _loopFrames = _recorded;
+      _playPos = 0;
+      _state = HIFI_LOOPER_PLAYING;
+    }
+    interrupts();
+    break;
+
+  case HIFI_LOOPER_OVERDUBBING:
+  case HIFI_LOOPER_PLAYING:
+    _overdubPending = false;
+    _state = HIFI_LOOPER_PLAYING;
+    break;
+
+  case HIFI_LOOPER_STOPPED:
+    while (_recordHead != _recordTail)
+    {
+      service();
+    }
+    _playHead = 0;
+    _playTail = 0;
+    _readPos = 0;
+    _playPos = 0;
+    _state = HIFI_LOOPER_PLAYING;
+    break;
+
+  default:
+    ok = false;
+    break;
+  }
+
+  return ok;
+}
+
+bool HiFiLooper::overdub()
+{
+  bool ok = true;
+
+  switch (_state)
+  {
+  case HIFI_LOOPER_RECORDING:
+    // The write-behind just carries on from the end of the first pass
+    // into the start of the loop.
+    noInterrupts();
+    if (_recorded < getMinFrames())
+    {
+      ok = false;
+    }
+    else
+    {
+      _loopFrames = _recorded;
+      _playPos = 0;
+      _state = HIFI_LOOPER_OVERDUBBING;
+    }
+    interrupts();
+    break;
+
+  case HIFI_LOOPER_STOPPED:
+    play();
+    // fall through
+  case HIFI_LOOPER_PLAYING:
+    // process() starts the overdub once the write-behind ring is empty
+    // and it can point the writer at the play position.
+    _overdubPending = true;
+    break;
+
+  case HIFI_LOOPER_OVERDUBBING:
+    break;
+
+  default:
+    ok = false;
+    break;
+  }
+
+  return ok;
+}
+
+bool HiFiLooper::stop()
+{
+  switch (_state)
+  {
+  case HIFI_LOOPER_RECORDING:
+    noInterrupts();
+    _loopFrames = _recorded;
+    _state = HIFI_LOOPER_STOPPED;
+    interrupts();
+    if (_loopFrames < getMinFrames())
+    {
+      clear();
+      return false;
+    }
+    break;
+
+  case HIFI_LOOPER_PLAYING:
+  case HIFI_LOOPER_OVERDUBBING:
+    _overdubPending = false;
+    _state = HIFI_LOOPER_STOPPED;
+    break;
+
+  default:
+    return false;
+  }
+
+  while (_recordHead != _recordTail)
+  {
+    service();
+  }
+  _writer.flush();
+
+  return true;
+}
+
+void HiFiLooper::clear()
+{
+  _state = HIFI_LOOPER_IDLE;
+  _overdubPending = false;
+  _loopFrames = 0;
+  _playPos = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Audio path
+///////////////////////////////////////////////////////////////////////////
+uint32_t HiFiLooper::pack(int32_t left, int32_t right)
+{
+  // Round to 16 bits
+  int32_t l = hifi_sat32((int64_t)left + 0x8000) >> 16;
+  int32_t r = hifi_sat32((int64_t)right + 0x8000) >> 16;
+
+  return (uint16_t)l | ((uint32_t)r << 16);
+}
+
+void HiFiLooper::process(int32_t *buf, uint16_t frames)
+{
+  HiFiLooperState_t state = _state;
+  uint32_t mask = _ringMask;
+
+  _meter.start();
+
+  if (state == HIFI_LOOPER_IDLE || state == HIFI_LOOPER_STOPPED)
+  {
+    if (!_monitor)
+    {
+      memset(buf, 0, sizeof(int32_t) * 2 * frames);
+    }
+    _meter.stop();
+    return;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// First pass: everything goes to the write-behind ring.
+  ///////////////////////////////////////////////////////////////////////////
+  if (state == HIFI_LOOPER_RECORDING)
+  {
+    uint32_t head = _recordHead;
+    uint32_t tail = _recordTail;
+    uint32_t recorded = _recorded;
+
+    for (uint16_t i = 0; i < frames; i++, buf += 2)
+    {
+      if (recorded == _maxFrames)
+      {
+        // Out of file; the loop is as long as it can be.
+        _loopFrames = recorded;
+        _playPos = 0;
+        _state = HIFI_LOOPER_PLAYING;
+      }
+      else if (head - tail > mask)
+      {
+        _underruns++;
+      }
+      else
+      {
+        _recordRing[head & mask] = pack(buf[0], buf[1]);
+        head++;
+        recorded++;
+      }
+
+      if (!_monitor)
+      {
+        buf[0] = 0;
+        buf[1] = 0;
+      }
+    }
+    _recordHead = head;
+    _recorded = recorded;
+    _meter.stop();
+    return;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Playback, with or without overdub
+  ///////////////////////////////////////////////////////////////////////////
+  if (_overdubPending && _recordHead == _recordTail)
+  {
+    _writePos = _playPos;
+    _overdubPending = false;
+    _state = state = HIFI_LOOPER_OVERDUBBING;
+  }
+
+  bool overdubbing = (state == HIFI_LOOPER_OVERDUBBING);
+  uint32_t playHead = _playHead;
+  uint32_t playTail = _playTail;
+  uint32_t recordHead = _recordHead;
+  uint32_t recordTail = _recordTail;
+  uint32_t position = _playPos;
+  uint32_t loopFrames = _loopFrames;
+  int32_t feedback = _feedback;
+
+  for (uint16_t i = 0; i < frames; i++, buf += 2)
+  {
+    int32_t inLeft = _monitor ? buf[0] : 0;
+    int32_t inRight = _monitor ? buf[1] : 0;
+
+    // Wait for the card rather than letting the play position and the
+    // file get out of step.
+    if (playHead == playTail || (overdubbing && recordHead - recordTail > mask))
+    {
+      _underruns++;
+      buf[0] = inLeft;
+      buf[1] = inRight;
+      continue;
+    }
+
+    uint32_t stored = _playRing[playTail & mask];
+    int32_t left = (int32_t)(int16_t)stored * 65536;
+    int32_t right = (int32_t)(int16_t)(stored >> 16) * 65536;
+    playTail++;
+
+    if (overdubbing)
+    {
+      int64_t newLeft = (((int64_t)left * feedback) >> 15) + buf[0];
+      int64_t newRight = (((int64_t)right * feedback) >> 15) + buf[1];
+      _recordRing[recordHead & mask] = pack(hifi_sat32(newLeft),
+                                            hifi_sat32(newRight));
+      recordHead++;
+    }
+
+    buf[0] = hifi_sat32((int64_t)inLeft + left);
+    buf[1] = hifi_sat32((int64_t)inRight + right);
+
+    if (++position == loopFrames)
+    {
+      position = 0;
+    }
+  }
+
+  _playTail = playTail;
+  _recordHead = recordHead;
+  _playPos = position;
+  _meter.stop();
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// SD transfers
+///////////////////////////////////////////////////////////////////////////
+void HiFiLooper::service()
+{
+  if (!_playRing)
+  {
+    return;
+  }
+
+  HiFiLooperState_t state = _state;
+  uint32_t ringFrames = _ringMask + 1;
+  uint32_t loopFrames = _loopFrames;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Write-behind.  While the audio path is still adding frames, wait for
+  /// enough to reach the next chunk boundary so transfers stay aligned;
+  /// otherwise flush whatever is left.
+  ///////////////////////////////////////////////////////////////////////////
+  uint32_t tail = _recordTail;
+  uint32_t pending = _recordHead - tail;
+
+  if (pending)
+  {
+    bool active = (state == HIFI_LOOPER_RECORDING ||
+                   state == HIFI_LOOPER_OVERDUBBING);
+    uint32_t pos = _writePos;
+    uint32_t length = HIFI_LOOPER_CHUNK_FRAMES - (pos % HIFI_LOOPER_CHUNK_FRAMES);
+    uint32_t index = tail & _ringMask;
+
+    if (loopFrames && length > loopFrames - pos)
+    {
+      length = loopFrames - pos;
+    }
+    if (length > ringFrames - index)
+    {
+      length = ringFrames - index;
+    }
+    if (length > pending && !active)
+    {
+      length = pending;
+    }
+
+    if (length <= pending)
+    {
+      uint32_t offset = pos * HIFI_LOOPER_BYTES_PER_FRAME;
+
+      if (_writer.position() != offset)
+      {
+        _writer.seek(offset);
+      }
+      _writer.write((const uint8_t *)&_recordRing[index],
+                    length * HIFI_LOOPER_BYTES_PER_FRAME);
+
+      pos += length;
+      if (pos == loopFrames)
+      {
+        pos = 0;
+      }
+
+      // Position first: process() only moves _writePos once the ring is
+      // empty, and it must see this one by then.
+      _writePos = pos;
+      _recordTail = tail + length;
+    }
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Read-ahead.  During the first pass this primes the ring with the
+  /// start of the loop, as far as it has been written.
+  ///////////////////////////////////////////////////////////////////////////
+  if (state == HIFI_LOOPER_IDLE || state == HIFI_LOOPER_STOPPED)
+  {
+    return;
+  }
+
+  uint32_t head = _playHead;
+  uint32_t space = ringFrames - (head - _playTail);
+  uint32_t pos = _readPos;
+  uint32_t length = HIFI_LOOPER_CHUNK_FRAMES - (pos % HIFI_LOOPER_CHUNK_FRAMES);
+  uint32_t index = head & _ringMask;
+
+  if (loopFrames)
+  {
+    if (length > loopFrames - pos)
+    {
+      length = loopFrames - pos;
+    }
+  }
+  else if (length > _writePos - pos)
+  {
+    length = _writePos - pos;
+  }
+  if (length > ringFrames - index)
+  {
+    length = ringFrames - index;
+  }
+
+  if (length && length <= space)
+  {
+    uint32_t offset = pos * HIFI_LOOPER_BYTES_PER_FRAME;
+    uint16_t bytes = length * HIFI_LOOPER_BYTES_PER_FRAME;
+
+    if (_reader.position() != offset)
+    {
+      _reader.seek(offset);
+    }
+    int count = _reader.read(&_playRing[index], bytes);
+    if (count < (int)bytes)
+    {
+      memset((uint8_t *)&_playRing[index] + (count > 0 ? count : 0), 0,
+             bytes - (count > 0 ? count : 0));
+    }
+
+    pos += length;
+    if (pos == loopFrames)
+    {
+      pos = 0;
+    }
+    _readPos = pos;
+    _playHead = head + length;
+  }
+}
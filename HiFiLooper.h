@@ -0,0 +1,157 @@
+/*
+  HiFiLooper.h
+
+  Loop recorder with the loop stored on an SD card, so the length of a
+  loop is limited by the file rather than the few seconds that fit in
+  the Due's RAM.
+
+  The first pass is recorded into a pre-allocated file.  After that the
+  loop plays back from the card and new material can be overdubbed on top
+  of it; each overdubbed frame is mixed with what was already there and
+  written back in place.  Audio is stored as 16 bit stereo, 192K bytes/s
+  at 48kHz, so a 5 minute loop needs about 58M bytes.
+
+  The card is never touched from the audio path.  process() (called from
+  the audio interrupt or a block loop) only moves frames between two
+  rings in RAM:
+
+    - a read-ahead ring that service() keeps filled from the file ahead of
+      the play position, and
+    - a write-behind ring of overdubbed frames that service() writes back
+      to the file behind the play position.
+
+  service() must be called often from loop(); each call does at most one
+  read and one write of up to one chunk.  The rings give the card
+  (chunk frames * chunks) of slack, 85ms each with the defaults, to
+  absorb the occasional slow write.  If it falls behind anyway the
+  looper waits for it (playback pauses rather than drifting out of place)
+  and the shortfall is counted by getUnderruns().
+
+  Overdubbing needs both streams at once, about 384K bytes/s at 48kHz.
+  Whether a card sustains that hasn't been measured; getUnderruns()
+  shows when it doesn't.
+  The two streams use separate file handles so neither has to seek back
+  through the FAT, and transfers are kept aligned to the chunk size.
+
+  The loop has to be longer than twice the ring size so that the read
+  ahead never catches up with frames still waiting to be written back.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_LOOPER_H
+#define HIFI_LOOPER_H
+
+#include <SD.h>
+#include "HiFiDsp.h"
+
+// Frames per SD transfer (4 sectors of 16 bit stereo)
+#define HIFI_LOOPER_CHUNK_FRAMES    512
+
+typedef enum
+{
+  HIFI_LOOPER_IDLE,
+  HIFI_LOOPER_RECORDING,
+  HIFI_LOOPER_PLAYING,
+  HIFI_LOOPER_OVERDUBBING,
+  HIFI_LOOPER_STOPPED
+} HiFiLooperState_t;
+
+class HiFiLooper {
+public:
+  HiFiLooper();
+
+  // Open (creating and extending if needed) the loop file, large enough
+  // for maxSeconds at sampleRate.  SD.begin() must already have been
+  // called.  Extending a new file writes zeros to the whole of it, which
+  // takes a while; an existing file that is big enough is reused as is.
+  // 'chunks' is the depth of each ring and must be a power of two.
+  bool begin(const char *path, uint32_t maxSeconds, uint32_t sampleRate,
+             uint8_t chunks = 8);
+  void end();
+
+  // Transport.  These are called from loop().
+  //   record()  - start a new loop (from idle or stopped)
+  //   play()    - end the first pass, or punch out of an overdub, or
+  //               restart a stopped loop from the top
+  //   overdub() - end the first pass, or start mixing into the loop
+  //   stop()    - stop playback, keeping the loop
+  //   clear()   - forget the loop
+  // They return false if the request doesn't make sense in the current
+  // state, or if a first pass is still too short.
+  bool record();
+  bool play();
+  bool overdub();
+  bool stop();
+  void clear();
+
+  // Overdubs mix the input into the loop, scaling what was there by the
+  // feedback (1.0 keeps it, less makes old layers fade each pass).
+  void setFeedback(float feedback);
+
+  // Whether the input is heard in the output along with the loop.
+  void setMonitor(bool monitor) { _monitor = monitor; }
+
+  // Audio path.  'buf' is interleaved stereo: the input on the way in and
+  // the output (input monitor plus loop) on the way out.
+  void process(int32_t *buf, uint16_t frames);
+
+  // SD transfers.  Call from loop() as often as possible.
+  void service();
+
+  HiFiLooperState_t getState() const { return _state; }
+  uint32_t getLoopFrames() const { return _loopFrames; }
+  uint32_t getPosition() const { return _playPos; }
+  uint32_t getMaxFrames() const { return _maxFrames; }
+  uint32_t getMinFrames() const { return 2 * (_ringMask + 1); }
+  uint32_t getUnderruns() const { return _underruns; }
+
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  static uint32_t pack(int32_t left, int32_t right);
+
+  File _reader;
+  File _writer;
+  uint32_t _maxFrames;
+
+  // Rings of packed 16 bit stereo frames.  Head and tail are free running
+  // frame counts; the producer owns the head, the consumer the tail.
+  uint32_t *_playRing;
+  uint32_t *_recordRing;
+  uint32_t _ringMask;
+  volatile uint32_t _playHead;
+  volatile uint32_t _playTail;
+  volatile uint32_t _recordHead;
+  volatile uint32_t _recordTail;
+
+  // File positions in frames
+  volatile uint32_t _readPos;
+  volatile uint32_t _writePos;
+
+  volatile HiFiLooperState_t _state;
+  volatile bool _overdubPending;
+  volatile uint32_t _loopFrames;
+  volatile uint32_t _recorded;
+  volatile uint32_t _playPos;
+  volatile uint32_t _underruns;
+
+  int32_t _feedback;    // Q15
+  bool _monitor;
+
+  HiFiCycleMeter _meter;
+};
+
+#endif
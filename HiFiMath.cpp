@@ -0,0 +1,308 @@
+/*
+  HiFiMath.cpp
+
+  Fixed point math functions.  See HiFiMath.h for the formats and the
+  error bounds.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "HiFiMath.h"
+
+// Shared with the FFT: sin(2*pi*k/4096) in Q31 for k = 0..1024.
+extern "C" const int32_t hifi_fft_sine_q31[];
+
+extern "C" const int32_t hifi_exp2_table[64];
+extern "C" const int32_t hifi_log2_table[64];
+extern "C" const uint32_t hifi_log2_recip[64];
+extern "C" const uint16_t hifi_sqrt_seed[48];
+
+#define SINE_LOG2_SIZE      12
+#define SINE_QUARTER        (1 << (SINE_LOG2_SIZE - 2))
+
+// ln(2) in Q21, 1/ln(2) in Q30
+#define LN2_Q21             1453635
+#define INV_LN2_Q30         1549082005
+
+// log2(10) / 20 in Q32, and 20 * log10(2), 10 * log10(2) in Q24
+#define DB_TO_LOG2_Q32      713378626
+#define LOG2_TO_DB_Q24      101008905
+#define LOG2_TO_POWER_DB_Q24  50504453
+
+///////////////////////////////////////////////////////////////////////////
+/// Trigonometry: linear interpolation between the 4096 points of the
+/// FFT's sine table.  The error of a chord over a step of 2*pi/4096 is at
+/// most (2*pi/4096)^2 / 8 = 2.9e-7.
+///////////////////////////////////////////////////////////////////////////
+static inline int32_t tableSine(uint32_t j)
+{
+  uint32_t r = j & (SINE_QUARTER - 1);
+
+  switch ((j >> (SINE_LOG2_SIZE - 2)) & 3)
+  {
+    case 0:
+      return hifi_fft_sine_q31[r];
+    case 1:
+      return hifi_fft_sine_q31[SINE_QUARTER - r];
+    case 2:
+      return -hifi_fft_sine_q31[r];
+    default:
+      return -hifi_fft_sine_q31[SINE_QUARTER - r];
+  }
+}
+
+HIFI_RAMFUNC int32_t hifi_sin_q31(uint32_t angle)
+{
+  uint32_t j = angle >> (32 - SINE_LOG2_SIZE);
+  uint32_t frac = angle & ((1U << (32 - SINE_LOG2_SIZE)) - 1);
+  int32_t a = tableSine(j);
+  int32_t b = tableSine(j + 1);
+
+  return a + (int32_t)(((int64_t)(b - a) * frac) >> (32 - SINE_LOG2_SIZE));
+}
+
+HIFI_RAMFUNC int32_t hifi_cos_q31(uint32_t angle)
+{
+  return hifi_sin_q31(angle + 0x40000000);
+}
+
+int32_t hifi_tan_q24(uint32_t angle)
+{
+  int32_t s = hifi_sin_q31(angle);
+  int32_t c = hifi_cos_q31(angle);
+
+  // Saturate rather than divide once the result can't fit.
+  if ((hifi_abs32(s) >> 7) >= hifi_abs32(c))
+  {
+    return ((s < 0) != (c < 0)) ? -0x7FFFFFFF : 0x7FFFFFFF;
+  }
+  return (int32_t)(((int64_t)s * (1 << 24)) / c);
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// exp2: the top 6 bits of the fraction pick 2^(k/64) from the table and
+/// a cubic in the remaining bits (at most 0.0108 after scaling by ln 2)
+/// covers the rest.  The cubic's truncation error is below 6e-10.
+///////////////////////////////////////////////////////////////////////////
+
+// 2^f for a 24 bit fraction f as Q30, 1.0 .. 2.0.
+static inline uint32_t exp2Mantissa(uint32_t frac)
+{
+  int32_t t = (int32_t)(((int64_t)(frac & 0x3FFFF) * LN2_Q21) >> 14);  // Q31
+  int32_t t2 = hifi_mul_q31(t, t);
+  int32_t t3 = hifi_mul_q31(t2, t);
+  int32_t p = t + (t2 >> 1) + t3 / 6;                 // e^t - 1
+  int32_t m = hifi_exp2_table[frac >> 18];
+
+  return m + hifi_mul_q31(m, p);
+}
+
+// 2^x for x <= 0 in Q8.24, as Q31.
+static inline int32_t exp2Negative(int32_t x)
+{
+  int32_t whole = x >> 24;
+
+  if (whole < -32)
+  {
+    return 0;
+  }
+
+  // 2^whole * m with m Q30 is Q31 shifted down by -whole - 1.
+  uint32_t m = exp2Mantissa(x & 0xFFFFFF);
+  uint8_t shift = -whole - 1;
+  if (shift == 0)
+  {
+    return m;
+  }
+  return (m + (1U << (shift - 1))) >> shift;
+}
+
+HIFI_RAMFUNC uint32_t hifi_exp2_q16(int32_t x)
+{
+  int32_t whole = x >> 16;
+
+  if (whole >= 16)
+  {
+    return 0xFFFFFFFF;
+  }
+  if (whole < -17)
+  {
+    return 0;
+  }
+
+  uint32_t m = exp2Mantissa((x & 0xFFFF) << 8);
+
+  // m is Q30; the result wants Q16, shifted by the whole part.
+  if (whole >= 14)
+  {
+    return m << (whole - 14);
+  }
+  uint8_t shift = 14 - whole;
+  return (m + (1U << (shift - 1))) >> shift;
+}
+
+HIFI_RAMFUNC int32_t hifi_exp2_q31(int32_t x)
+{
+  if (x >= 0)
+  {
+    return HIFI_Q31_ONE;
+  }
+  if (x < -(32 << 16))
+  {
+    return 0;
+  }
+  return exp2Negative(x * 256);
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// log2: normalise, take the top 6 bits of the mantissa as a segment and
+/// divide by its centre c (a multiply by the tabulated 1/c), leaving
+/// 1 + u with |u| < 1/128.  log2(1 + u) is then a cubic in u, good to
+/// u^4 / (4 ln 2) < 1.4e-9.
+///////////////////////////////////////////////////////////////////////////
+HIFI_RAMFUNC int32_t hifi_log2_q24(uint32_t x)
+{
+  if (x == 0)
+  {
+    return (int32_t)0x80000000;
+  }
+
+  uint8_t lz = __builtin_clz(x);
+  uint32_t m = x << lz;                                // 1.31
+  uint8_t k = (m >> 25) & 63;
+
+  int32_t u = (int32_t)((uint32_t)(((uint64_t)m * hifi_log2_recip[k]) >> 31) -
+                        0x80000000);                   // Q31
+  int32_t u2 = hifi_mul_q31(u, u);
+  int32_t u3 = hifi_mul_q31(u2, u);
+  int32_t ln = u - (u2 >> 1) + u3 / 3;                 // ln(1 + u), Q31
+
+  return ((int32_t)(31 - lz) << 24) + hifi_log2_table[k] +
+    (int32_t)(((int64_t)ln * INV_LN2_Q30 + (1LL << 36)) >> 37);
+}
+
+int32_t hifi_log2_q24_u64(uint64_t x)
+{
+  uint32_t hi = (uint32_t)(x >> 32);
+
+  if (hi)
+  {
+    // Keep 32 significant bits and account for the ones dropped.
+    uint8_t shift = 32 - __builtin_clz(hi);
+    return hifi_log2_q24((uint32_t)(x >> shift)) + ((int32_t)shift << 24);
+  }
+  return hifi_log2_q24((uint32_t)x);
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// dB
+///////////////////////////////////////////////////////////////////////////
+int32_t hifi_db_to_q31(int32_t db)
+{
+  if (db >= 0)
+  {
+    return HIFI_Q31_ONE;
+  }
+  if (db < HIFI_DB_FLOOR_Q16)
+  {
+    return 0;
+  }
+
+  // The exponent is worked out to 24 fractional bits; with only 16 its
+  // rounding alone would be a 1e-5 error in the gain.
+  return exp2Negative((int32_t)(((int64_t)db * DB_TO_LOG2_Q32 +
+                                 (1LL << 23)) >> 24));
+}
+
+int32_t hifi_q31_to_db_q16(uint32_t x)
+{
+  if (x == 0)
+  {
+    return HIFI_DB_FLOOR_Q16;
+  }
+
+  int32_t l = hifi_log2_q24(x) - (31 << 24);
+  return (int32_t)(((int64_t)l * LOG2_TO_DB_Q24 + (1LL << 31)) >> 32);
+}
+
+int32_t hifi_power_to_db_q16(uint64_t power)
+{
+  if (power == 0)
+  {
+    return HIFI_DB_FLOOR_Q16;
+  }
+
+  int32_t l = hifi_log2_q24_u64(power) - (62 << 24);
+  return (int32_t)(((int64_t)l * LOG2_TO_POWER_DB_Q24 + (1LL << 31)) >> 32);
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Square roots: normalise to 2^30 .. 2^32, seed from the table (within
+/// 1.6%), two Newton steps (within 1e-8) and a final check that puts the
+/// result on floor(sqrt(x)) exactly.
+///////////////////////////////////////////////////////////////////////////
+uint32_t hifi_sqrt_u32(uint32_t x)
+{
+  if (x == 0)
+  {
+    return 0;
+  }
+
+  uint8_t shift = __builtin_clz(x) & ~1;
+  uint32_t n = x << shift;
+  uint32_t y = hifi_sqrt_seed[(n >> 26) - 16];
+
+  y = (y + n / y) >> 1;
+  y = (y + n / y) >> 1;
+
+  uint32_t r = y >> (shift >> 1);
+  while ((uint64_t)r * r > x)
+  {
+    r--;
+  }
+  while ((uint64_t)(r + 1) * (r + 1) <= x)
+  {
+    r++;
+  }
+  return r;
+}
+
+uint32_t hifi_sqrt_u64(uint64_t x)
+{
+  if ((x >> 32) == 0)
+  {
+    return hifi_sqrt_u32((uint32_t)x);
+  }
+
+  // With X = x * 4^s in 2^62 .. 2^64 and a = floor(sqrt(X / 2^32)),
+  // a * 2^16 is within 2^16 of sqrt(X), and one Newton step from there
+  // only needs a 32 bit division.
+  uint8_t shift = __builtin_clzll(x) & ~1;
+  uint64_t n = x << shift;
+  uint32_t a = hifi_sqrt_u32((uint32_t)(n >> 32));
+  uint64_t e = n - ((uint64_t)a * a << 32);
+  uint64_t y = ((uint64_t)a << 16) + (uint32_t)(e >> 17) / a;
+
+  uint64_t r = y >> (shift >> 1);
+  while (r * r > x || r > 0xFFFFFFFF)
+  {
+    r--;
+  }
+  while (r < 0xFFFFFFFF && (r + 1) * (r + 1) <= x)
+  {
+    r++;
+  }
+  return (uint32_t)r;
+}
@@ -0,0 +1,118 @@
+/*
+  HiFiMath.h
+
+  Fixed point replacements for the libm functions that filter design and
+  metering need: sine, cosine and tangent, exp2 and log2, dB conversion
+  and square roots.  The Due has no FPU, so sinf()/powf()/log10f() go
+  through soft float, which is slow.  Each of these is a table lookup
+  followed by a short polynomial or a Newton step in integer arithmetic.
+  They are plain functions with no state, safe to call from the audio
+  interrupt as well as from loop().
+
+  The error bounds below are the worst cases found by
+  extras/math/math_bench.cpp, which sweeps every function against libm
+  (in double precision) on the host.  The MathBenchmark example times
+  them against the float libm calls on the Due.
+
+  Formats:
+    - angles are a fraction of a full turn in 32 bits, the same as a
+      phase accumulator: 0x40000000 is pi/2.  hifi_angle() turns a
+      frequency into the angle it advances by per sample,
+    - logs and dB are Q8.24 / Q16.16 signed values,
+    - gains and samples are Q31 as everywhere else.
+
+    function               in          out       worst error
+    hifi_sin_q31/cos_q31   angle       Q31       3.0e-7 (630 LSB)
+    hifi_tan_q24           angle       Q8.24     6.1e-8 (1 LSB) below 1,
+                                                 relative above, to 89
+                                                 degrees
+    hifi_exp2_q16          Q16.16      Q16.16    3.1e-8 relative
+    hifi_exp2_q31          Q16.16 <=0  Q31       6.0e-8 relative
+    hifi_log2_q24(_u64)    integer     Q8.24     6.1e-8 (1 LSB)
+    hifi_db_to_q31         dB Q16.16   Q31       2.6e-7 relative
+    hifi_q31_to_db_q16     Q31         dB Q16.16 8.1e-6dB (0.5 LSB)
+    hifi_power_to_db_q16   Q62         dB Q16.16 8.9e-6dB (0.6 LSB)
+    hifi_sqrt_u32/u64      integer     integer   exact (rounded down)
+
+  The relative errors hold until the result gets down to its last few
+  bits, where rounding it to the output format takes over.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_MATH_H
+#define HIFI_MATH_H
+
+#include "HiFiDsp.h"
+
+// Returned by the dB conversions for zero, well below the -186.6dB of
+// one Q31 LSB.
+#define HIFI_DB_FLOOR_Q16   (-200 * 65536)
+
+// The angle a sample advances by at 'hz' (a fraction of a turn).
+static inline uint32_t hifi_angle(uint32_t hz, uint32_t sampleRate)
+{
+  return (uint32_t)(((uint64_t)hz << 32) / sampleRate);
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Trigonometry
+///////////////////////////////////////////////////////////////////////////
+int32_t hifi_sin_q31(uint32_t angle);
+int32_t hifi_cos_q31(uint32_t angle);
+
+// Q8.24, so the small values of low frequency filter design keep their
+// precision.  Saturates to +/-0x7FFFFFFF (128.0) within half a degree of
+// +/-90 degrees.
+int32_t hifi_tan_q24(uint32_t angle);
+
+///////////////////////////////////////////////////////////////////////////
+/// Exponentials and logs
+///////////////////////////////////////////////////////////////////////////
+
+// 2^x, saturating at 0xFFFFFFFF (x >= 16).
+uint32_t hifi_exp2_q16(int32_t x);
+
+// 2^x for x <= 0 as a Q31 gain; 0 and above give HIFI_Q31_ONE.
+int32_t hifi_exp2_q31(int32_t x);
+
+// log2 of an integer, 0 .. 32 in Q8.24 (and of a 64 bit one, 0 .. 64).
+// Zero gives INT32_MIN.  Subtract 31 << 24 for the log2 of a Q31 value.
+int32_t hifi_log2_q24(uint32_t x);
+int32_t hifi_log2_q24_u64(uint64_t x);
+
+///////////////////////////////////////////////////////////////////////////
+/// dB
+///////////////////////////////////////////////////////////////////////////
+
+// 20 * log10 conversions between dB (Q16.16) and Q31 gains or
+// magnitudes.  Positive dB give HIFI_Q31_ONE; zero gives
+// HIFI_DB_FLOOR_Q16.
+int32_t hifi_db_to_q31(int32_t db);
+int32_t hifi_q31_to_db_q16(uint32_t x);
+
+// 10 * log10 of a power in Q62 (a Q31 value squared, e.g. the mean of
+// squared samples), i.e. its level in dBFS.
+int32_t hifi_power_to_db_q16(uint64_t power);
+
+///////////////////////////////////////////////////////////////////////////
+/// Square roots
+///////////////////////////////////////////////////////////////////////////
+
+// floor(sqrt(x)).  The square root of a Q62 power is its Q31 RMS.
+uint32_t hifi_sqrt_u32(uint32_t x);
+uint32_t hifi_sqrt_u64(uint64_t x);
+
+#endif
@@ -0,0 +1,85 @@
+/*
+  HiFiMathTables.c
+
+  Tables for the fixed point functions in HiFiMath.h:
+    - hifi_exp2_table: 2^(k/64) for k = 0..63, Q30,
+    - hifi_log2_table: log2(c_k) in Q24, with c_k = 1 + (k + 0.5)/64 the
+      centre of segment k of the mantissa,
+    - hifi_log2_recip: 1/c_k, Q31,
+    - hifi_sqrt_seed: sqrt((k + 0.5) * 2^26) for k = 16..63, the starting
+      point for the Newton steps.
+
+  Generated by extras/math/math_tables.py; don't edit by hand.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdint.h>
+#include "HiFiConfig.h"
+
+HIFI_RAMDATA const int32_t hifi_exp2_table[64] =
+{
+  1073741824, 1085434106, 1097253708, 1109202018, 1121280436, 1133490379,
+  1145833280, 1158310587, 1170923762, 1183674286, 1196563654, 1209593378,
+  1222764986, 1236080024, 1249540052, 1263146652, 1276901417, 1290805962,
+  1304861917, 1319070932, 1333434672, 1347954824, 1362633090, 1377471191,
+  1392470869, 1407633882, 1422962010, 1438457051, 1454120821, 1469955159,
+  1485961921, 1502142985, 1518500250, 1535035634, 1551751076, 1568648537,
+  1585730000, 1602997467, 1620452965, 1638098541, 1655936265, 1673968228,
+  1692196547, 1710623359, 1729250827, 1748081133, 1767116489, 1786359126,
+  1805811301, 1825475297, 1845353420, 1865448001, 1885761398, 1906295993,
+  1927054196, 1948038440, 1969251188, 1990694927, 2012372174, 2034285470,
+  2056437387, 2078830522, 2101467502, 2124350982
+};
+
+HIFI_RAMDATA const int32_t hifi_log2_table[64] =
+{
+  188362, 560745, 927485, 1288752, 1644705, 1995500,
+  2341283, 2682196, 3018374, 3349946, 3677038, 3999768,
+  4318251, 4632599, 4942916, 5249305, 5551864, 5850688,
+  6145867, 6437490, 6725641, 7010402, 7291852, 7570066,
+  7845119, 8117082, 8386022, 8652008, 8915102, 9175366,
+  9432863, 9687648, 9939780, 10189312, 10436298, 10680789,
+  10922835, 11162484, 11399784, 11634780, 11867517, 12098037,
+  12326382, 12552593, 12776710, 12998770, 13218811, 13436871,
+  13652983, 13867183, 14079503, 14289978, 14498638, 14705514,
+  14910637, 15114037, 15315742, 15515779, 15714177, 15910962,
+  16106160, 16299796, 16491896, 16682482
+};
+
+HIFI_RAMDATA const uint32_t hifi_log2_recip[64] =
+{
+  2130836488, 2098304633, 2066751180, 2036132644, 2006408080, 1977538899,
+  1949488702, 1922223125, 1895709703, 1869917734, 1844818167, 1820383490,
+  1796587627, 1773405851, 1750814694, 1728791868, 1707316192, 1686367527,
+  1665926709, 1645975491, 1626496491, 1607473140, 1588889636, 1570730897,
+  1552982525, 1535630765, 1518662469, 1502065065, 1485826524, 1469935331,
+  1454380460, 1439151345, 1424237860, 1409630292, 1395319325, 1381296015,
+  1367551776, 1354078359, 1340867839, 1327912594, 1315205296, 1302738895,
+  1290506605, 1278501893, 1266718465, 1255150260, 1243791434, 1232636354,
+  1221679586, 1210915890, 1200340205, 1189947649, 1179733506, 1169693221,
+  1159822392, 1150116765, 1140572228, 1131184802, 1121950641, 1112866020,
+  1103927337, 1095131103, 1086473940, 1077952576
+};
+
+HIFI_RAMDATA const uint16_t hifi_sqrt_seed[48] =
+{
+  33276, 34270, 35235, 36175, 37091, 37985, 38858, 39712,
+  40548, 41368, 42171, 42959, 43733, 44494, 45242, 45977,
+  46702, 47415, 48117, 48809, 49492, 50166, 50830, 51486,
+  52134, 52773, 53405, 54030, 54647, 55258, 55862, 56459,
+  57051, 57636, 58215, 58789, 59357, 59919, 60477, 61029,
+  61576, 62119, 62657, 63190, 63719, 64243, 64763, 65279
+};
@@ -0,0 +1,334 @@
+/*
+  HiFiMfcc.cpp
+
+  MFCC pipeline.  See HiFiMfcc.h for an overview.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "HiFiMfcc.h"
+
+// A full scale sine through the Hann window and the scaled FFT has a power
+// of 2^58 in its bin (see HiFiSpectrogram.cpp).
+#define HIFI_MFCC_0DBFS_LOG2      58
+
+// 0.97 in Q15
+#define HIFI_MFCC_PRE_EMPHASIS    31785
+
+static float hzToMel(float hz)
+{
+  return 2595.0f * log10f(1.0f + hz / 700.0f);
+}
+
+static float melToHz(float mel)
+{
+  return 700.0f * (powf(10.0f, mel / 2595.0f) - 1.0f);
+}
+
+HiFiMfcc::HiFiMfcc() :
+  _size(0),
+  _hop(0),
+  _filters(0),
+  _coefficients(0),
+  _preEmphasis(true),
+  _ring(NULL),
+  _ringMask(0),
+  _written(0),
+  _nextFrame(0),
+  _dropped(0),
+  _firstBin(0),
+  _lastBin(0),
+  _binFilter(NULL),
+  _binWeight(NULL),
+  _dct(NULL),
+  _work(NULL),
+  onFeaturesCallback(NULL)
+{
+  memset(_energies, 0, sizeof(_energies));
+  memset(_features, 0, sizeof(_features));
+}
+
+bool HiFiMfcc::begin(uint8_t log2Size, uint16_t hop, uint8_t filters,
+                     uint8_t coefficients, uint32_t sampleRate,
+                     uint16_t lowHz, uint16_t highHz)
+{
+  end();
+
+  if (filters == 0 || filters > HIFI_MFCC_MAX_FILTERS ||
+      coefficients == 0 || coefficients > HIFI_MFCC_MAX_COEFFS ||
+      coefficients > filters || !_fft.begin(log2Size))
+  {
+    return false;
+  }
+
+  _size = _fft.getSize();
+  _hop = hop ? hop : _size;
+  _filters = filters;
+  _coefficients = coefficients;
+
+  if (highHz == 0 || highHz > sampleRate / 2)
+  {
+    highHz = sampleRate / 2;
+  }
+  if (lowHz >= highHz)
+  {
+    return false;
+  }
+
+  // Same ring sizing as HiFiSpectrogram: a frame plus two hops.
+  uint32_t ringSize = 1;
+  while (ringSize < (uint32_t)_size + 2 * _hop)
+  {
+    ringSize <<= 1;
+  }
+  _ringMask = ringSize - 1;
+
+  _ring = (int16_t *)malloc(sizeof(int16_t) * ringSize);
+  _work = (int32_t *)malloc(sizeof(int32_t) * _size);
+  _binFilter = (uint8_t *)malloc(sizeof(uint8_t) * _size / 2);
+  _binWeight = (uint16_t *)malloc(sizeof(uint16_t) * _size / 2);
+  _dct = (int16_t *)malloc(sizeof(int16_t) * _coefficients * _filters);
+  if (!_ring || !_work || !_binFilter || !_binWeight || !_dct)
+  {
+    end();
+    return false;
+  }
+  memset(_ring, 0, sizeof(int16_t) * ringSize);
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Filterbank.  filters + 2 edges evenly spaced in mel; filter m rises
+  /// from edge m to edge m + 1 and falls back to zero at edge m + 2.
+  ///////////////////////////////////////////////////////////////////////////
+  float binHz = (float)sampleRate / _size;
+  float lowMel = hzToMel(lowHz);
+  float stepMel = (hzToMel(highHz) - lowMel) / (_filters + 1);
+
+  _firstBin = (uint16_t)ceilf(lowHz / binHz);
+  if (_firstBin < 1)
+  {
+    _firstBin = 1;
+  }
+  _lastBin = (uint16_t)ceilf(highHz / binHz);
+  if (_lastBin > _size / 2)
+  {
+    // Nyquist shares the DC slot in the packed spectrum; leave it out.
+    _lastBin = _size / 2;
+  }
+
+  uint8_t edge = 0;
+  float lower = lowHz;
+  float upper = melToHz(lowMel + stepMel);
+
+  for (uint16_t k = _firstBin; k < _lastBin; k++)
+  {
+    float hz = k * binHz;
+
+    while (hz >= upper && edge < _filters)
+    {
+      edge++;
+      lower = upper;
+      upper = melToHz(lowMel + (edge + 1) * stepMel);
+    }
+
+    float rise = (hz - lower) / (upper - lower);
+    rise = (rise < 0.0f) ? 0.0f : ((rise > 1.0f) ? 1.0f : rise);
+    _binFilter[k] = edge;
+    _binWeight[k] = (uint16_t)(rise * 32767.0f + 0.5f);
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Orthonormal DCT-II basis
+  ///////////////////////////////////////////////////////////////////////////
+  for (uint8_t i = 0; i < _coefficients; i++)
+  {
+    float norm = sqrtf(((i == 0) ? 1.0f : 2.0f) / _filters);
+
+    for (uint8_t m = 0; m < _filters; m++)
+    {
+      float c = norm * cosf((float)M_PI * i * (m + 0.5f) / _filters);
+      _dct[i * _filters + m] = (int16_t)lrintf(c * 32767.0f);
+    }
+  }
+
+  _written = 0;
+  _nextFrame = _size;
+  _dropped = 0;
+
+  hifi_cycle_counter_enable();
+  return true;
+}
+
+void HiFiMfcc::end()
+{
+  free(_ring);
+  free(_work);
+  free(_binFilter);
+  free(_binWeight);
+  free(_dct);
+  _ring = NULL;
+  _work = NULL;
+  _binFilter = NULL;
+  _binWeight = NULL;
+  _dct = NULL;
+}
+
+void HiFiMfcc::onFeatures(void(*function)(const int16_t *features, uint8_t count))
+{
+  onFeaturesCallback = function;
+}
+
+void HiFiMfcc::write(const int32_t *buf, uint16_t frames, uint8_t stride)
+{
+  uint32_t written = _written;
+
+  for (uint16_t i = 0; i < frames; i++)
+  {
+    _ring[written & _ringMask] = (int16_t)(*buf >> 16);
+    buf += stride;
+    written++;
+  }
+  _written = written;
+}
+
+bool HiFiMfcc::update()
+{
+  uint32_t written = _written;
+
+  if (!_ring || (int32_t)(written - _nextFrame) < 0)
+  {
+    return false;
+  }
+
+  // Skip forward past frames whose samples have been overwritten.
+  uint32_t lag = written - _nextFrame;
+  if (lag > (uint32_t)(_ringMask + 1) - _size - 1)
+  {
+    uint32_t skip = (lag + _hop - 1) / _hop;
+    _nextFrame += skip * _hop;
+    _dropped += skip;
+    if ((int32_t)(written - _nextFrame) < 0)
+    {
+      _nextFrame -= _hop;
+      _dropped--;
+    }
+  }
+
+  _meter.start();
+  computeFrame(_nextFrame);
+  _nextFrame += _hop;
+  _meter.stop();
+
+  if (onFeaturesCallback)
+  {
+    onFeaturesCallback(_features, _coefficients);
+  }
+  return true;
+}
+
+void HiFiMfcc::computeFrame(uint32_t end)
+{
+  uint32_t start = end - _size;
+  int32_t reference = HIFI_MFCC_0DBFS_LOG2;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Pre-emphasis, Hann window and transform.  The pre-emphasised signal
+  /// can reach nearly twice full scale so it is kept one bit down, which
+  /// moves the 0dB reference by 2 in log2 power.
+  ///////////////////////////////////////////////////////////////////////////
+  int32_t previous = _ring[(start - 1) & _ringMask];
+
+  for (uint16_t n = 0; n < _size; n++)
+  {
+    int32_t s = _ring[(start + n) & _ringMask];
+    int32_t x;
+
+    if (_preEmphasis)
+    {
+      x = s * 32768 - previous * HIFI_MFCC_PRE_EMPHASIS;
+      previous = s;
+    }
+    else
+    {
+      x = s * 65536;
+    }
+
+    int32_t w = (int32_t)(((int64_t)0x7FFFFFFF - HiFiFft::cosine(n, _size)) >> 1);
+    _work[n] = hifi_mul_q31(x, w);
+  }
+  if (_preEmphasis)
+  {
+    reference -= 2;
+  }
+  _fft.forwardReal(_work, true);
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Mel filterbank.  Powers are taken down 16 bits so 512 bins of them can
+  /// be summed without overflow.
+  ///////////////////////////////////////////////////////////////////////////
+  uint64_t energy[HIFI_MFCC_MAX_FILTERS];
+
+  memset(energy, 0, sizeof(uint64_t) * _filters);
+
+  for (uint16_t k = _firstBin; k < _lastBin; k++)
+  {
+    int64_t re = _work[2 * k];
+    int64_t im = _work[2 * k + 1];
+    uint64_t power = ((uint64_t)(re * re) + (uint64_t)(im * im)) >> 16;
+    uint8_t m = _binFilter[k];
+    uint32_t rise = _binWeight[k];
+
+    if (m < _filters)
+    {
+      energy[m] += (power * rise) >> 15;
+    }
+    if (m > 0)
+    {
+      energy[m - 1] += (power * (32767 - rise)) >> 15;
+    }
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Log
+  ///////////////////////////////////////////////////////////////////////////
+  int32_t offset = (16 - reference) * 65536;
+  int32_t floor = HIFI_MFCC_LOG_FLOOR * 65536;
+
+  for (uint8_t m = 0; m < _filters; m++)
+  {
+    int32_t lg = energy[m] ? hifi_log2_q16_u64(energy[m]) + offset : floor;
+    _energies[m] = (lg < floor) ? floor : lg;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// DCT
+  ///////////////////////////////////////////////////////////////////////////
+  for (uint8_t i = 0; i < _coefficients; i++)
+  {
+    const int16_t *basis = _dct + i * _filters;
+    int64_t acc = 0;
+
+    for (uint8_t m = 0; m < _filters; m++)
+    {
+      acc += (int64_t)_energies[m] * basis[m];
+    }
+
+    // Q16 x Q15 -> Q31, down to HIFI_MFCC_FRAC_BITS with rounding
+    acc = (acc + (1LL << (30 - HIFI_MFCC_FRAC_BITS))) >> (31 - HIFI_MFCC_FRAC_BITS);
+    _features[i] = (acc > 32767) ? 32767 : ((acc < -32768) ? -32768 : (int16_t)acc);
+  }
+}
@@ -0,0 +1,139 @@
+/*
+  HiFiMfcc.h
+
+  Mel frequency cepstral coefficients (MFCCs) for small on-device sound
+  classifiers (alarms, glass break, clapping and the like).
+
+  Samples from one channel are written into a ring from the audio path,
+  the same way as HiFiSpectrogram, and update() in loop() works through
+  the pipeline one frame at a time:
+
+    framing    - a frame of 2^log2Size samples every 'hop' samples
+    window     - first order pre-emphasis and a Hann window
+    FFT        - scaled real transform (HiFiFft), power spectrum
+    filterbank - triangular filters evenly spaced on the mel scale, Q15
+                 weights, each FFT bin feeding at most two filters
+    log        - log2 of each filter's energy, relative to a full scale
+                 sine and floored at HIFI_MFCC_LOG_FLOOR
+    DCT        - orthonormal DCT-II of the log energies, Q15 table
+
+  Everything after begin() is fixed point.  Coefficients are int16_t in
+  log2 units scaled by 2^HIFI_MFCC_FRAC_BITS.  When a frame is ready the
+  onFeatures() callback is called with the coefficients, so a classifier
+  (nearest template, a small decision tree, a tiny MLP...) can be hooked
+  straight onto the end of the pipeline.
+
+  update() computes at most one frame per call, so the cost in loop() is
+  bounded at one frame.  With a 1024 point frame, 40 filters and 13
+  coefficients most of that is the FFT; getCycleMeter() reports the real
+  figure, and as long as it stays well below 'hop' samples' worth of CPU
+  time the pipeline runs continuously.  Frames that fall behind are
+  skipped and counted.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_MFCC_H
+#define HIFI_MFCC_H
+
+#include "HiFiDsp.h"
+#include "HiFiFft.h"
+
+#define HIFI_MFCC_MAX_FILTERS   40
+#define HIFI_MFCC_MAX_COEFFS    20
+
+// Coefficients are log2 units * 2^HIFI_MFCC_FRAC_BITS
+#define HIFI_MFCC_FRAC_BITS     6
+
+// Filter energies below this (log2 relative to a full scale sine, i.e.
+// about -96dB, the floor of the 16 bit sample ring) are clamped, so
+// silence gives a stable vector.
+#define HIFI_MFCC_LOG_FLOOR     -32
+
+class HiFiMfcc {
+public:
+  HiFiMfcc();
+
+  // Frame size is 2^log2Size, a frame is produced every 'hop' samples.
+  // The filters cover lowHz .. highHz (0 means half the sample rate).
+  bool begin(uint8_t log2Size, uint16_t hop, uint8_t filters,
+             uint8_t coefficients, uint32_t sampleRate,
+             uint16_t lowHz = 20, uint16_t highHz = 0);
+  void end();
+
+  // Pre-emphasis (y[n] = x[n] - 0.97 x[n-1]), on by default.
+  void enablePreEmphasis(bool enable) { _preEmphasis = enable; }
+
+  // Add samples.  Safe to call from the audio interrupt while update()
+  // runs in loop().
+  void write(const int32_t *buf, uint16_t frames, uint8_t stride = 1);
+  void write(int32_t sample)
+  {
+    _ring[_written & _ringMask] = (int16_t)(sample >> 16);
+    _written++;
+  }
+
+  // Called with each new set of coefficients, from update().
+  void onFeatures(void(*)(const int16_t *features, uint8_t count));
+
+  // Compute the next frame if one is due.  Returns true if it did.
+  bool update();
+
+  // Most recent results.  Filter energies are log2 in Q16.
+  const int16_t *getFeatures() const { return _features; }
+  uint8_t getCoefficientCount() const { return _coefficients; }
+  const int32_t *getFilterEnergies() const { return _energies; }
+  uint8_t getFilterCount() const { return _filters; }
+  uint32_t getDroppedFrames() const { return _dropped; }
+
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  void computeFrame(uint32_t end);
+
+  HiFiFft _fft;
+  uint16_t _size;
+  uint16_t _hop;
+  uint8_t _filters;
+  uint8_t _coefficients;
+  bool _preEmphasis;
+
+  int16_t *_ring;
+  uint32_t _ringMask;
+  volatile uint32_t _written;
+  uint32_t _nextFrame;
+  uint32_t _dropped;
+
+  // Filterbank: bins _firstBin .. _lastBin - 1 each rise into filter
+  // _binFilter[k] with weight _binWeight[k] and fall out of the one below
+  // it with the remainder.
+  uint16_t _firstBin;
+  uint16_t _lastBin;
+  uint8_t *_binFilter;
+  uint16_t *_binWeight;
+
+  // DCT-II basis, _coefficients rows of _filters entries, Q15
+  int16_t *_dct;
+
+  int32_t *_work;
+  int32_t _energies[HIFI_MFCC_MAX_FILTERS];
+  int16_t _features[HIFI_MFCC_MAX_COEFFS];
+
+  void (*onFeaturesCallback)(const int16_t *features, uint8_t count);
+
+  HiFiCycleMeter _meter;
+};
+
+#endif
@@ -0,0 +1,270 @@
+/*
+  HiFiModulation.cpp
+
+  Modulated delay, chorus and flanger.  See HiFiModulation.h for an
+  overview.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <string.h>
+#include "HiFiModulation.h"
+
+// The allpass interpolator is kept to fractional delays of 0.5..1.5 samples
+// where its phase delay is closest to flat, so the shortest usable delay is
+// two samples.
+#define HIFI_MIN_DELAY_SAMPLES    2
+
+// Parabolic sine approximation (max error about 0.1%), plenty for an LFO.
+// The full 32 bit phase range is one cycle; the result is Q30.
+static inline int32_t lfoSine(uint32_t phase)
+{
+  int32_t x = (int32_t)phase;                 // -pi..pi as Q31
+  int32_t ax = (x < 0) ? -(x + 1) : x;
+  int32_t y = (x - hifi_mul_q31(x, ax)) * 2;  // 4x(1-|x|) as Q30
+  int32_t ay = (y < 0) ? -y : y;
+  int32_t yy = (int32_t)(((int64_t)y * ay) >> 30);
+
+  // y += 0.225 * (y|y| - y)
+  return y + (int32_t)(((int64_t)(yy - y) * 7373) >> 15);
+}
+
+static inline int16_t sat16(int32_t x)
+{
+  if (x > 32767)
+  {
+    return 32767;
+  }
+  if (x < -32768)
+  {
+    return -32768;
+  }
+  return (int16_t)x;
+}
+
+static inline int32_t toQ15(float x)
+{
+  if (x > 1.0f)
+  {
+    x = 1.0f;
+  }
+  if (x < -1.0f)
+  {
+    x = -1.0f;
+  }
+  return (int32_t)(x * 32767.0f);
+}
+
+HiFiModulatedDelay::HiFiModulatedDelay(int16_t *storage, uint16_t length) :
+  _storage(storage),
+  _length(length),
+  _channels(1),
+  _sampleRate(48000),
+  _interp(HIFI_INTERP_LINEAR),
+  _writePos(0),
+  _lfoPhase(0),
+  _lfoIncrement(0),
+  _lfoSpread(0),
+  _delayMs(0.0f),
+  _depthMs(0.0f),
+  _baseDelay(0),
+  _sweep(0),
+  _feedback(0),
+  _wetGain(0),
+  _dryGain(32767)
+{
+  memset(_allpassState, 0, sizeof(_allpassState));
+}
+
+void HiFiModulatedDelay::begin(uint8_t channels, uint32_t sampleRate)
+{
+  if (channels > HIFI_MODULATION_MAX_CHANNELS)
+  {
+    channels = HIFI_MODULATION_MAX_CHANNELS;
+  }
+  _channels = channels ? channels : 1;
+  _sampleRate = sampleRate;
+  _writePos = 0;
+  _lfoPhase = 0;
+
+  memset(_storage, 0, sizeof(int16_t) * _length * HIFI_MODULATION_MAX_CHANNELS);
+  memset(_allpassState, 0, sizeof(_allpassState));
+
+  hifi_cycle_counter_enable();
+}
+
+void HiFiModulatedDelay::setRate(float hz)
+{
+  _lfoIncrement = (uint32_t)((hz * 4294967296.0f) / (float)_sampleRate);
+}
+
+void HiFiModulatedDelay::setDelay(float delayMs, float depthMs)
+{
+  _delayMs = delayMs;
+  _depthMs = depthMs;
+  updateDelay();
+}
+
+void HiFiModulatedDelay::updateDelay()
+{
+  float base = (_delayMs * _sampleRate) / 1000.0f;
+  float sweep = (_depthMs * _sampleRate) / 1000.0f;
+  float longest = (float)(_length - HIFI_MIN_DELAY_SAMPLES);
+
+  // Keep the whole sweep inside the delay line.
+  if (sweep < 0.0f)
+  {
+    sweep = -sweep;
+  }
+  if (sweep > (longest - HIFI_MIN_DELAY_SAMPLES) / 2.0f)
+  {
+    sweep = (longest - HIFI_MIN_DELAY_SAMPLES) / 2.0f;
+  }
+  if (base - sweep < HIFI_MIN_DELAY_SAMPLES)
+  {
+    base = HIFI_MIN_DELAY_SAMPLES + sweep;
+  }
+  if (base + sweep > longest)
+  {
+    base = longest - sweep;
+  }
+
+  _baseDelay = (int32_t)(base * 65536.0f);
+  _sweep = (int32_t)(sweep * 65536.0f);
+}
+
+void HiFiModulatedDelay::setFeedback(float feedback)
+{
+  // Stop just short of +/-1 so the loop can't run away.
+  if (feedback > 0.97f)
+  {
+    feedback = 0.97f;
+  }
+  if (feedback < -0.97f)
+  {
+    feedback = -0.97f;
+  }
+  _feedback = toQ15(feedback);
+}
+
+void HiFiModulatedDelay::setMix(float mix)
+{
+  _wetGain = toQ15(mix);
+  _dryGain = toQ15(1.0f - mix);
+}
+
+HIFI_RAMFUNC void HiFiModulatedDelay::process(int32_t *buf, uint16_t frames)
+{
+  uint16_t mask = _length - 1;
+
+  _meter.start();
+
+  for (uint16_t i = 0; i < frames; i++)
+  {
+    for (uint8_t ch = 0; ch < _channels; ch++)
+    {
+      int16_t *line = _storage + ch * _length;
+      int32_t x = *buf;
+
+      /////////////////////////////////////////////////////////////////////
+      /// Current delay in Q16.16 samples
+      /////////////////////////////////////////////////////////////////////
+      int32_t lfo = lfoSine(_lfoPhase + ch * _lfoSpread);
+      int32_t delay = _baseDelay + (int32_t)(((int64_t)_sweep * lfo) >> 30);
+      uint16_t whole = (uint16_t)(delay >> 16);
+      int32_t frac = delay & 0xFFFF;
+      int32_t wet;
+
+      /////////////////////////////////////////////////////////////////////
+      /// Fractional read
+      /////////////////////////////////////////////////////////////////////
+      if (_interp == HIFI_INTERP_ALLPASS)
+      {
+        // y[n] = eta * a + b - eta * y[n-1], eta = (1 - d) / (1 + d)
+        if (frac < 0x8000)
+        {
+          whole--;
+          frac += 0x10000;
+        }
+        int32_t a = line[(_writePos - whole) & mask];
+        int32_t b = line[(_writePos - whole - 1) & mask];
+        int32_t eta = ((0x10000 - frac) * 32768) / (0x10000 + frac);
+
+        wet = (eta * a + b * 32768 - eta * _allpassState[ch]) >> 15;
+        _allpassState[ch] = wet;
+      }
+      else
+      {
+        int32_t a = line[(_writePos - whole) & mask];
+        int32_t b = line[(_writePos - whole - 1) & mask];
+
+        wet = a + (((b - a) * frac) >> 16);
+      }
+
+      /////////////////////////////////////////////////////////////////////
+      /// Write the input (plus feedback) and mix
+      /////////////////////////////////////////////////////////////////////
+      line[_writePos] = sat16((x >> 16) + ((wet * _feedback) >> 15));
+
+      *buf++ = hifi_sat32((((int64_t)x * _dryGain) >> 15) +
+                          (int64_t)wet * _wetGain * 2);
+    }
+
+    _writePos = (_writePos + 1) & mask;
+    _lfoPhase += _lfoIncrement;
+  }
+
+  _meter.stop();
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Chorus: a slow, fairly deep sweep around 15ms with no feedback.  The two
+/// channels are swept in quadrature for a wider image.
+///////////////////////////////////////////////////////////////////////////
+HiFiChorus::HiFiChorus() :
+  HiFiModulatedDelay(_line, HIFI_CHORUS_DELAY_SAMPLES)
+{
+}
+
+void HiFiChorus::begin(uint8_t channels, uint32_t sampleRate)
+{
+  HiFiModulatedDelay::begin(channels, sampleRate);
+  setRate(0.8f);
+  setDelay(15.0f, 5.0f);
+  setFeedback(0.0f);
+  setMix(0.5f);
+  setInterpolation(HIFI_INTERP_LINEAR);
+  setSpread(90);
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Flanger: a short delay swept down close to zero with feedback.  Allpass
+/// interpolation keeps the comb notches deep at the short end of the sweep.
+///////////////////////////////////////////////////////////////////////////
+HiFiFlanger::HiFiFlanger() :
+  HiFiModulatedDelay(_line, HIFI_FLANGER_DELAY_SAMPLES)
+{
+}
+
+void HiFiFlanger::begin(uint8_t channels, uint32_t sampleRate)
+{
+  HiFiModulatedDelay::begin(channels, sampleRate);
+  setRate(0.25f);
+  setDelay(2.5f, 2.0f);
+  setFeedback(0.7f);
+  setMix(0.5f);
+  setInterpolation(HIFI_INTERP_ALLPASS);
+  setSpread(0);
+}
@@ -0,0 +1,124 @@
+/*
+  HiFiModulation.h
+
+  Chorus and flanger effects for the HiFi library.
+
+  Both effects are built on the same modulated delay: a short delay line
+  whose read position is swept by a low frequency oscillator (LFO).  The
+  read position almost never lands on a whole sample, so the delayed signal
+  is interpolated, either linearly (cheap, slight high frequency loss at
+  the sweep extremes) or with a first order allpass (flat magnitude, which
+  is what most flangers use).
+
+  The delay lines store 16 bit samples to keep the RAM cost down: a stereo
+  chorus uses 8K and a stereo flanger 4K.  The dry path keeps full 32 bit
+  resolution.
+
+  Processing is done in place on blocks of interleaved Q31 frames (see
+  HiFiDsp.h) from loop() on the full-duplex path.  Every instance keeps a
+  cycle meter so the CPU cost of each effect can be reported separately.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_MODULATION_H
+#define HIFI_MODULATION_H
+
+#include "HiFiDsp.h"
+
+#define HIFI_MODULATION_MAX_CHANNELS    2
+
+// Delay line lengths, must be powers of two.  At 48kHz these are 42ms and
+// 21ms, which covers the usual chorus and flanger ranges with room for depth.
+#define HIFI_CHORUS_DELAY_SAMPLES       2048
+#define HIFI_FLANGER_DELAY_SAMPLES      1024
+
+typedef enum
+{
+  HIFI_INTERP_LINEAR,
+  HIFI_INTERP_ALLPASS
+} HiFiInterpolation_t;
+
+class HiFiModulatedDelay {
+public:
+  void begin(uint8_t channels, uint32_t sampleRate);
+
+  void setRate(float hz);
+  // Centre delay and sweep depth (+/-) in milliseconds.
+  void setDelay(float delayMs, float depthMs);
+  // -1.0 to 1.0.  Negative feedback gives the hollow "through zero" flavour.
+  void setFeedback(float feedback);
+  // 0.0 is dry only, 1.0 wet only.
+  void setMix(float mix);
+  void setInterpolation(HiFiInterpolation_t interp) { _interp = interp; }
+  // LFO phase offset between the channels, in degrees.
+  void setSpread(uint16_t degrees)
+  {
+    _lfoSpread = (uint32_t)(((uint64_t)(degrees % 360) << 32) / 360);
+  }
+
+  void process(int32_t *buf, uint16_t frames);
+
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+protected:
+  HiFiModulatedDelay(int16_t *storage, uint16_t length);
+
+private:
+  void updateDelay();
+
+  int16_t *_storage;
+  uint16_t _length;             // per channel, power of two
+  uint8_t _channels;
+  uint32_t _sampleRate;
+  HiFiInterpolation_t _interp;
+
+  uint16_t _writePos;
+  uint32_t _lfoPhase;
+  uint32_t _lfoIncrement;
+  uint32_t _lfoSpread;          // phase offset between channels
+  float _delayMs;
+  float _depthMs;
+  int32_t _baseDelay;           // Q16.16 samples
+  int32_t _sweep;               // Q16.16 samples
+
+  int32_t _feedback;            // Q15
+  int32_t _wetGain;             // Q15
+  int32_t _dryGain;             // Q15
+
+  int32_t _allpassState[HIFI_MODULATION_MAX_CHANNELS];
+
+  HiFiCycleMeter _meter;
+};
+
+class HiFiChorus : public HiFiModulatedDelay {
+public:
+  HiFiChorus();
+  void begin(uint8_t channels, uint32_t sampleRate);
+
+private:
+  int16_t _line[HIFI_MODULATION_MAX_CHANNELS * HIFI_CHORUS_DELAY_SAMPLES];
+};
+
+class HiFiFlanger : public HiFiModulatedDelay {
+public:
+  HiFiFlanger();
+  void begin(uint8_t channels, uint32_t sampleRate);
+
+private:
+  int16_t _line[HIFI_MODULATION_MAX_CHANNELS * HIFI_FLANGER_DELAY_SAMPLES];
+};
+
+#endif
@@ -0,0 +1,352 @@
+/*
+  HiFiMultiTrack.cpp
+
+  Multi-track SD player.  See HiFiMultiTrack.h.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "HiFiMultiTrack.h"
+
+HiFiMultiTrack::HiFiMultiTrack() :
+  _trackCount(0),
+  _ringBytes(0),
+  _sampleRate(0),
+  _next(0),
+  _loop(false),
+  _playing(false),
+  _underruns(0),
+  _readBytes(0),
+  _readMicros(0)
+{
+  for (uint8_t i = 0; i < HIFI_MULTI_TRACK_MAX_TRACKS; i++)
+  {
+    _tracks[i].ring = NULL;
+  }
+}
+
+bool HiFiMultiTrack::begin(uint16_t ringBytes)
+{
+  end();
+
+  if (ringBytes < 2 * HIFI_MULTI_TRACK_SECTOR || (ringBytes & (ringBytes - 1)))
+  {
+    return false;
+  }
+  _ringBytes = ringBytes;
+
+  hifi_cycle_counter_enable();
+  return true;
+}
+
+void HiFiMultiTrack::end()
+{
+  _playing = false;
+
+  for (uint8_t i = 0; i < _trackCount; i++)
+  {
+    _tracks[i].file.close();
+    free(_tracks[i].ring);
+    _tracks[i].ring = NULL;
+  }
+  _trackCount = 0;
+  _sampleRate = 0;
+}
+
+int8_t HiFiMultiTrack::addTrack(const char *path)
+{
+  if (_trackCount == HIFI_MULTI_TRACK_MAX_TRACKS || !_ringBytes)
+  {
+    return -1;
+  }
+
+  Track &t = _tracks[_trackCount];
+
+  t.file = SD.open(path, FILE_READ);
+  if (!t.file)
+  {
+    return -1;
+  }
+  if (!t.wav.parse(t.file) ||
+      (_sampleRate && t.wav.getSampleRate() != _sampleRate))
+  {
+    t.file.close();
+    return -1;
+  }
+
+  t.ring = (uint8_t *)malloc(_ringBytes);
+  if (!t.ring)
+  {
+    t.file.close();
+    return -1;
+  }
+
+  _sampleRate = t.wav.getSampleRate();
+  t.gain = 32767;
+
+  // Start the ring at the data's offset within its sector, so every whole
+  // sector read lands in one piece.
+  t.filePos = t.wav.getDataOffset();
+  t.head = t.tail = t.filePos % HIFI_MULTI_TRACK_SECTOR;
+  t.eof = false;
+
+  return _trackCount++;
+}
+
+void HiFiMultiTrack::setGain(uint8_t track, float gain)
+{
+  if (track >= _trackCount)
+  {
+    return;
+  }
+  if (gain < 0.0f)
+  {
+    gain = 0.0f;
+  }
+  if (gain > 1.0f)
+  {
+    gain = 1.0f;
+  }
+  _tracks[track].gain = (int32_t)(gain * 32767.0f);
+}
+
+void HiFiMultiTrack::play()
+{
+  bool reading;
+
+  // Prime every ring before the first block is mixed.
+  do
+  {
+    reading = false;
+    for (uint8_t i = 0; i < _trackCount; i++)
+    {
+      reading |= readTrack(_tracks[i]);
+    }
+  } while (reading);
+
+  _playing = true;
+}
+
+void HiFiMultiTrack::rewind()
+{
+  _playing = false;
+
+  for (uint8_t i = 0; i < _trackCount; i++)
+  {
+    Track &t = _tracks[i];
+
+    t.filePos = t.wav.getDataOffset();
+    t.head = t.tail = t.filePos % HIFI_MULTI_TRACK_SECTOR;
+    t.eof = false;
+  }
+}
+
+bool HiFiMultiTrack::isFinished() const
+{
+  for (uint8_t i = 0; i < _trackCount; i++)
+  {
+    const Track &t = _tracks[i];
+
+    if (!t.eof || (t.head - t.tail) >= t.wav.getFrameBytes())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// SD reads
+///////////////////////////////////////////////////////////////////////////
+bool HiFiMultiTrack::readTrack(Track &t)
+{
+  uint32_t dataEnd = t.wav.getDataOffset() + t.wav.getDataBytes();
+
+  if (t.eof)
+  {
+    return false;
+  }
+  if (t.filePos >= dataEnd)
+  {
+    if (!_loop)
+    {
+      t.eof = true;
+      return false;
+    }
+    t.filePos = t.wav.getDataOffset();
+  }
+
+  uint32_t length = HIFI_MULTI_TRACK_SECTOR - (t.filePos % HIFI_MULTI_TRACK_SECTOR);
+  uint32_t index = t.head & (_ringBytes - 1);
+
+  if (length > dataEnd - t.filePos)
+  {
+    length = dataEnd - t.filePos;
+  }
+  if (length > (uint32_t)_ringBytes - index)
+  {
+    length = _ringBytes - index;
+  }
+  if (length > _ringBytes - (t.head - t.tail))
+  {
+    return false;
+  }
+
+  uint32_t start = micros();
+
+  if (t.file.position() != t.filePos)
+  {
+    t.file.seek(t.filePos);
+  }
+  int count = t.file.read(t.ring + index, length);
+  if (count < (int)length)
+  {
+    // A failed read plays as silence rather than stalling every track.
+    memset(t.ring + index + (count > 0 ? count : 0), 0,
+           length - (count > 0 ? count : 0));
+  }
+
+  _readMicros += micros() - start;
+  _readBytes += length;
+
+  t.filePos += length;
+  t.head += length;
+  return true;
+}
+
+void HiFiMultiTrack::service()
+{
+  for (uint8_t n = 0; n < _trackCount; n++)
+  {
+    uint8_t i = (_next + n) % _trackCount;
+
+    if (readTrack(_tracks[i]))
+    {
+      _next = (i + 1) % _trackCount;
+      return;
+    }
+  }
+}
+
+uint32_t HiFiMultiTrack::getReadRate() const
+{
+  if (_readMicros == 0)
+  {
+    return 0;
+  }
+  return (uint32_t)(((uint64_t)_readBytes * 1000000UL) / _readMicros);
+}
+
+uint8_t HiFiMultiTrack::maxTracksForRate(uint32_t bytesPerSecond,
+                                         uint32_t sampleRate,
+                                         uint8_t channels,
+                                         uint8_t bitsPerSample)
+{
+  uint32_t perTrack = sampleRate * channels * (bitsPerSample / 8);
+
+  if (perTrack == 0)
+  {
+    return 0;
+  }
+
+  uint32_t tracks = (bytesPerSecond / 4 * 3) / perTrack;
+  return (tracks > HIFI_MULTI_TRACK_MAX_TRACKS) ?
+    HIFI_MULTI_TRACK_MAX_TRACKS : tracks;
+}
+
+uint8_t HiFiMultiTrack::getMaxTracks(uint8_t channels,
+                                     uint8_t bitsPerSample) const
+{
+  return maxTracksForRate(getReadRate(), _sampleRate ? _sampleRate : 48000,
+                          channels, bitsPerSample);
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Mixing
+///////////////////////////////////////////////////////////////////////////
+void HiFiMultiTrack::process(int32_t *buf, uint16_t frames)
+{
+  uint32_t mask = _ringBytes - 1;
+  uint16_t available[HIFI_MULTI_TRACK_MAX_TRACKS];
+
+  if (!_playing)
+  {
+    return;
+  }
+
+  _meter.start();
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// All tracks move together or not at all.
+  ///////////////////////////////////////////////////////////////////////////
+  for (uint8_t i = 0; i < _trackCount; i++)
+  {
+    Track &t = _tracks[i];
+    uint32_t frameCount = (t.head - t.tail) / t.wav.getFrameBytes();
+
+    if (frameCount < frames && !t.eof)
+    {
+      _underruns++;
+      _meter.stop();
+      return;
+    }
+    available[i] = (frameCount < frames) ? frameCount : frames;
+  }
+
+  for (uint8_t i = 0; i < _trackCount; i++)
+  {
+    Track &t = _tracks[i];
+    uint8_t channels = t.wav.getChannels();
+    uint8_t frameBytes = t.wav.getFrameBytes();
+    bool wide = (t.wav.getBitsPerSample() == 24);
+    uint32_t pos = t.tail;
+    int32_t *out = buf;
+
+    for (uint16_t n = 0; n < available[i]; n++, out += 2)
+    {
+      int32_t left;
+      int32_t right;
+
+      if (wide)
+      {
+        left = (int32_t)(((uint32_t)t.ring[(pos + 0) & mask] << 8) |
+                         ((uint32_t)t.ring[(pos + 1) & mask] << 16) |
+                         ((uint32_t)t.ring[(pos + 2) & mask] << 24));
+        right = (channels == 2) ?
+                (int32_t)(((uint32_t)t.ring[(pos + 3) & mask] << 8) |
+                          ((uint32_t)t.ring[(pos + 4) & mask] << 16) |
+                          ((uint32_t)t.ring[(pos + 5) & mask] << 24)) : left;
+      }
+      else
+      {
+        // 16 bit data always sits at even ring offsets
+        left = (int32_t)*(const int16_t *)(t.ring + (pos & mask)) * 65536;
+        right = (channels == 2) ?
+                (int32_t)*(const int16_t *)(t.ring + ((pos + 2) & mask)) *
+                65536 : left;
+      }
+      pos += frameBytes;
+
+      out[0] = hifi_sat32((int64_t)out[0] + (((int64_t)left * t.gain) >> 15));
+      out[1] = hifi_sat32((int64_t)out[1] + (((int64_t)right * t.gain) >> 15));
+    }
+
+    t.tail = pos;
+  }
+
+  _meter.stop();
+}
@@ -0,0 +1,129 @@
+/*
+  HiFiMultiTrack.h
+
+  Synchronised playback of several WAV files (stems) from an SD card.
+
+  Each track has a ring of raw file data in RAM.  service(), called from
+  loop(), tops the rings up one read at a time, visiting the tracks in
+  round-robin order and skipping any that don't have room for a read.
+  Reads run up to the next 512 byte boundary in the file, so after the
+  first one every read is a whole sector.
+
+  process() mixes every track into a block of interleaved stereo frames
+  (mono tracks go to both sides).  It only ever takes the same number of
+  frames from every track: if any track doesn't have enough buffered, the
+  whole block is skipped and counted as an underrun, so the tracks can
+  never drift apart.  Tracks that end early go quiet; with looping on,
+  each track wraps back to its start on its own (stems of equal length
+  stay in step).
+
+  How many tracks a card can carry depends on how fast the SD library
+  can read it, which is mostly set by the SPI clock and the card's
+  latency, not its speed class (the classes only guarantee sequential
+  write speeds).  Each 48kHz track needs 96K bytes/s (mono, 16 bit) to
+  288K bytes/s (stereo, 24 bit).  getReadRate() measures the rate the
+  card is actually giving and getMaxTracks() turns it into a track count
+  for a given format, keeping 25% in hand for the slow reads every card
+  has now and again.  The MultiTrackPlayer example prints both.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_MULTI_TRACK_H
+#define HIFI_MULTI_TRACK_H
+
+#include <SD.h>
+#include "HiFiDsp.h"
+#include "HiFiWav.h"
+
+#define HIFI_MULTI_TRACK_MAX_TRACKS   8
+#define HIFI_MULTI_TRACK_SECTOR       512
+
+class HiFiMultiTrack {
+public:
+  HiFiMultiTrack();
+
+  // 'ringBytes' of RAM per track, a power of two of at least two sectors.
+  bool begin(uint16_t ringBytes = 4096);
+  void end();
+
+  // Open a WAV file as the next track.  Every track must have the same
+  // sample rate.  Returns the track number, or -1 on failure.
+  int8_t addTrack(const char *path);
+  uint8_t getTrackCount() const { return _trackCount; }
+  uint32_t getSampleRate() const { return _sampleRate; }
+
+  void setGain(uint8_t track, float gain);
+  void setLoop(bool loop) { _loop = loop; }
+
+  // Fill every ring and start; rewind() goes back to the start of every
+  // track (and stops).
+  void play();
+  void stop() { _playing = false; }
+  void rewind();
+  bool isPlaying() const { return _playing; }
+
+  // True once every track has played to the end (never, when looping).
+  bool isFinished() const;
+
+  // Mix the tracks into (adding to) a block of interleaved stereo frames.
+  void process(int32_t *buf, uint16_t frames);
+
+  // One read for the next track that needs one.  Call from loop() as
+  // often as possible.
+  void service();
+
+  uint32_t getUnderruns() const { return _underruns; }
+
+  // Measured card read rate in bytes/s, and the number of tracks of the
+  // given format it would sustain.
+  uint32_t getReadRate() const;
+  uint8_t getMaxTracks(uint8_t channels, uint8_t bitsPerSample) const;
+  static uint8_t maxTracksForRate(uint32_t bytesPerSecond, uint32_t sampleRate,
+                                  uint8_t channels, uint8_t bitsPerSample);
+
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  struct Track
+  {
+    File file;
+    HiFiWav wav;
+    uint8_t *ring;
+    volatile uint32_t head;     // bytes written into the ring
+    volatile uint32_t tail;     // bytes taken out
+    uint32_t filePos;           // offset of the next byte to read
+    bool eof;
+    int32_t gain;               // Q15
+  };
+
+  bool readTrack(Track &t);
+
+  Track _tracks[HIFI_MULTI_TRACK_MAX_TRACKS];
+  uint8_t _trackCount;
+  uint16_t _ringBytes;
+  uint32_t _sampleRate;
+  uint8_t _next;
+  bool _loop;
+  volatile bool _playing;
+
+  uint32_t _underruns;
+  uint32_t _readBytes;
+  uint32_t _readMicros;
+
+  HiFiCycleMeter _meter;
+};
+
+#endif
@@ -0,0 +1,322 @@
+/*
+  HiFiNoiseSuppressor.cpp
+
+  STFT spectral subtraction.  See HiFiNoiseSuppressor.h.
+
+  Scaling: the window is Q31, the forward transform is scaled (X/N) so it
+  can't overflow, and the unscaled inverse brings the frame back to the
+  input level.  Bin powers are kept as 64 bit values of the scaled
+  spectrum.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "HiFiNoiseSuppressor.h"
+
+// Power smoothing and noise fall, as shifts (1/8 and 1/32 per frame)
+#define NS_POWER_SHIFT    3
+#define NS_FALL_SHIFT     5
+
+HiFiNoiseSuppressor::HiFiNoiseSuppressor() :
+  _size(0),
+  _sampleRate(48000),
+  _window(NULL),
+  _input(NULL),
+  _overlap(NULL),
+  _work(NULL),
+  _power(NULL),
+  _noise(NULL),
+  _gain(NULL),
+  _primed(false),
+  _frozen(false),
+  _minGain(0),
+  _overSubtraction(0),
+  _riseQ16(0),
+  _riseDbPerSecond(3.0f),
+  _gainRise(32767),
+  _gainFall(32767),
+  _riseMs(0.0f),
+  _fallMs(40.0f)
+{
+  setMaxReduction(18.0f);
+  setOverSubtraction(2.0f);
+}
+
+bool HiFiNoiseSuppressor::begin(uint8_t log2Size, uint32_t sampleRate)
+{
+  end();
+
+  // The square root Hann window needs sin(pi*n/N) from a 2N point table.
+  if (log2Size < 4 || log2Size >= HIFI_FFT_MAX_LOG2 || !_fft.begin(log2Size))
+  {
+    return false;
+  }
+  _size = _fft.getSize();
+  _sampleRate = sampleRate;
+
+  uint16_t bins = _size / 2 + 1;
+
+  _window = (int32_t *)malloc(sizeof(int32_t) * _size);
+  _input = (int32_t *)malloc(sizeof(int32_t) * _size);
+  _overlap = (int32_t *)malloc(sizeof(int32_t) * _size / 2);
+  _work = (int32_t *)malloc(sizeof(int32_t) * _size);
+  _power = (uint64_t *)malloc(sizeof(uint64_t) * bins);
+  _noise = (uint64_t *)malloc(sizeof(uint64_t) * bins);
+  _gain = (int16_t *)malloc(sizeof(int16_t) * bins);
+
+  if (!_window || !_input || !_overlap || !_work || !_power || !_noise ||
+      !_gain)
+  {
+    end();
+    return false;
+  }
+
+  for (uint16_t n = 0; n < _size; n++)
+  {
+    _window[n] = HiFiFft::sine(n, 2 * _size);
+  }
+
+  reset();
+  updateRise();
+  setGainSmoothing(_riseMs, _fallMs);
+
+  hifi_cycle_counter_enable();
+  return true;
+}
+
+void HiFiNoiseSuppressor::end()
+{
+  free(_window);
+  free(_input);
+  free(_overlap);
+  free(_work);
+  free(_power);
+  free(_noise);
+  free(_gain);
+  _window = NULL;
+  _input = NULL;
+  _overlap = NULL;
+  _work = NULL;
+  _power = NULL;
+  _noise = NULL;
+  _gain = NULL;
+  _size = 0;
+}
+
+void HiFiNoiseSuppressor::reset()
+{
+  if (!_window)
+  {
+    return;
+  }
+
+  uint16_t bins = _size / 2 + 1;
+
+  memset(_input, 0, sizeof(int32_t) * _size);
+  memset(_overlap, 0, sizeof(int32_t) * _size / 2);
+  memset(_power, 0, sizeof(uint64_t) * bins);
+  memset(_noise, 0, sizeof(uint64_t) * bins);
+  for (uint16_t k = 0; k < bins; k++)
+  {
+    _gain[k] = 32767;
+  }
+  _primed = false;
+}
+
+void HiFiNoiseSuppressor::setMaxReduction(float db)
+{
+  _minGain = (int16_t)(32767.0f * powf(10.0f, -db / 20.0f));
+}
+
+void HiFiNoiseSuppressor::setOverSubtraction(float factor)
+{
+  _overSubtraction = (int32_t)(factor * 4096.0f);
+}
+
+void HiFiNoiseSuppressor::setNoiseRise(float dbPerSecond)
+{
+  _riseDbPerSecond = dbPerSecond;
+  updateRise();
+}
+
+void HiFiNoiseSuppressor::updateRise()
+{
+  if (!_size)
+  {
+    return;
+  }
+
+  // Growth per frame of N/2 samples
+  float framesPerSecond = (float)_sampleRate / (_size / 2);
+  float factor = powf(10.0f, _riseDbPerSecond / 10.0f / framesPerSecond);
+  _riseQ16 = (uint32_t)((factor - 1.0f) * 65536.0f + 0.5f);
+}
+
+void HiFiNoiseSuppressor::setGainSmoothing(float riseMs, float fallMs)
+{
+  _riseMs = riseMs;
+  _fallMs = fallMs;
+
+  if (!_size)
+  {
+    return;
+  }
+
+  float frameMs = 1000.0f * (_size / 2) / _sampleRate;
+  _gainRise = (riseMs <= 0.0f) ? 32767 :
+    (int16_t)(32767.0f * (1.0f - expf(-frameMs / riseMs)));
+  _gainFall = (fallMs <= 0.0f) ? 32767 :
+    (int16_t)(32767.0f * (1.0f - expf(-frameMs / fallMs)));
+}
+
+HIFI_RAMFUNC void HiFiNoiseSuppressor::process(int32_t *buf, uint8_t stride)
+{
+  uint16_t hop = _size / 2;
+
+  if (!_window)
+  {
+    return;
+  }
+
+  _meter.start();
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Slide the new samples in and window the frame.
+  ///////////////////////////////////////////////////////////////////////////
+  memcpy(_input, _input + hop, sizeof(int32_t) * hop);
+  for (uint16_t i = 0; i < hop; i++)
+  {
+    _input[hop + i] = buf[i * stride];
+  }
+  for (uint16_t n = 0; n < _size; n++)
+  {
+    _work[n] = hifi_mul_q31(_input[n], _window[n]);
+  }
+  _fft.forwardReal(_work, true);
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Per bin: track power and noise, work out and smooth the gain, apply.
+  /// Bin 0 is DC (_work[0]), bin N/2 is Nyquist (_work[1]).
+  ///////////////////////////////////////////////////////////////////////////
+  for (uint16_t k = 0; k <= hop; k++)
+  {
+    int32_t *re;
+    int32_t *im;
+
+    if (k == 0)
+    {
+      re = &_work[0];
+      im = NULL;
+    }
+    else if (k == hop)
+    {
+      re = &_work[1];
+      im = NULL;
+    }
+    else
+    {
+      re = &_work[2 * k];
+      im = &_work[2 * k + 1];
+    }
+
+    uint64_t power = (uint64_t)((int64_t)*re * *re);
+    if (im)
+    {
+      power += (uint64_t)((int64_t)*im * *im);
+    }
+
+    uint64_t smooth = _power[k];
+    if (!_primed)
+    {
+      smooth = power;
+    }
+    else if (power > smooth)
+    {
+      smooth += (power - smooth) >> NS_POWER_SHIFT;
+    }
+    else
+    {
+      smooth -= (smooth - power) >> NS_POWER_SHIFT;
+    }
+    _power[k] = smooth;
+
+    uint64_t noise = _noise[k];
+    if (!_primed)
+    {
+      noise = smooth;
+    }
+    else if (!_frozen)
+    {
+      if (smooth < noise)
+      {
+        noise -= (noise - smooth) >> NS_FALL_SHIFT;
+      }
+      else
+      {
+        noise += ((noise >> 16) * _riseQ16) + 1;
+      }
+    }
+    _noise[k] = noise;
+
+    // gain = 1 - a * noise / power, with both brought down to 16 bits so
+    // the ratio is a 32 bit division.
+    int32_t target = _minGain;
+    if (noise < smooth)
+    {
+      uint8_t shift = 0;
+      while ((smooth >> shift) > 0xFFFF)
+      {
+        shift++;
+      }
+      uint32_t p = (uint32_t)(smooth >> shift);
+      uint32_t ratio = ((uint32_t)(noise >> shift) << 15) / p;   // Q15
+
+      target = 32767 - (int32_t)(((int64_t)_overSubtraction * ratio) >> 12);
+      if (target < _minGain)
+      {
+        target = _minGain;
+      }
+    }
+
+    int32_t gain = _gain[k];
+    int32_t coeff = (target > gain) ? _gainRise : _gainFall;
+    gain += ((target - gain) * coeff) >> 15;
+    _gain[k] = (int16_t)gain;
+
+    *re = (int32_t)(((int64_t)*re * gain) >> 15);
+    if (im)
+    {
+      *im = (int32_t)(((int64_t)*im * gain) >> 15);
+    }
+  }
+  _primed = true;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Back to the time domain, window again and overlap-add.
+  ///////////////////////////////////////////////////////////////////////////
+  _fft.inverseReal(_work, false);
+
+  for (uint16_t i = 0; i < hop; i++)
+  {
+    int32_t head = hifi_mul_q31(_work[i], _window[i]);
+    buf[i * stride] = hifi_sat32((int64_t)_overlap[i] + head);
+    _overlap[i] = hifi_mul_q31(_work[hop + i], _window[hop + i]);
+  }
+
+  _meter.stop();
+}
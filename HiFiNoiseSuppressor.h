@@ -0,0 +1,110 @@
+/*
+  HiFiNoiseSuppressor.h
+
+  Spectral subtraction noise suppressor for steady background noise (fans,
+  HVAC, hum) on a captured channel.
+
+  The signal is cut into frames of N samples with 50% overlap.  Each frame
+  is windowed (square root Hann), transformed, and every bin is scaled by
+  a gain worked out from the bin's power and a running estimate of the
+  noise power in that bin:
+
+    gain = max(1 - overSubtraction * noise / power, minimum gain)
+
+  The noise estimate follows the smoothed bin power down quickly and only
+  creeps up (a few dB per second), so it settles on the floor between
+  words rather than on the words themselves.  Gains are smoothed over time
+  with a fast rise and a slower fall, which keeps onsets intact and tames
+  the "musical noise" of plain spectral subtraction.  The frames go back
+  through the same window and are overlap-added.
+
+  process() takes N/2 samples at a time, in place.  The output lags the
+  input by getLatency() = N/2 samples on top of whatever block buffering
+  the sketch does: 256 points at 48kHz is 2.7ms.  The cost is one real
+  FFT pair plus some 64 bit arithmetic per bin per call; getCycleMeter()
+  reports it.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_NOISE_SUPPRESSOR_H
+#define HIFI_NOISE_SUPPRESSOR_H
+
+#include "HiFiDsp.h"
+#include "HiFiFft.h"
+
+class HiFiNoiseSuppressor {
+public:
+  HiFiNoiseSuppressor();
+
+  // Frame size N = 2^log2Size (4 .. 11).
+  bool begin(uint8_t log2Size, uint32_t sampleRate);
+  void end();
+
+  // Forget the noise estimate and the overlap.
+  void reset();
+
+  // Most a bin is turned down, in dB (default 18).
+  void setMaxReduction(float db);
+  // How many times the noise estimate is taken off (default 2).
+  void setOverSubtraction(float factor);
+  // How fast the noise estimate may rise, dB/s (default 3).
+  void setNoiseRise(float dbPerSecond);
+  // Time constants of the gain smoothing (defaults 0 and 40ms).
+  void setGainSmoothing(float riseMs, float fallMs);
+  // Hold the noise estimate, e.g. once it has been learnt.
+  void freezeNoise(bool freeze) { _frozen = freeze; }
+
+  // Processes getBlockSize() samples in place.
+  void process(int32_t *buf, uint8_t stride = 1);
+
+  uint16_t getBlockSize() const { return _size / 2; }
+  uint16_t getLatency() const { return _size / 2; }
+
+  // Current gain of a bin (0 .. N/2), Q15.
+  int16_t getGain(uint16_t bin) const { return _gain ? _gain[bin] : 32767; }
+
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  void updateRise();
+
+  HiFiFft _fft;
+  uint16_t _size;
+  uint32_t _sampleRate;
+
+  int32_t *_window;
+  int32_t *_input;
+  int32_t *_overlap;
+  int32_t *_work;
+  uint64_t *_power;
+  uint64_t *_noise;
+  int16_t *_gain;
+  bool _primed;
+  bool _frozen;
+
+  int16_t _minGain;
+  int32_t _overSubtraction;   // Q12
+  uint32_t _riseQ16;
+  float _riseDbPerSecond;
+  int16_t _gainRise;          // Q15 smoothing coefficients
+  int16_t _gainFall;
+  float _riseMs;
+  float _fallMs;
+
+  HiFiCycleMeter _meter;
+};
+
+#endif
@@ -0,0 +1,424 @@
+/*
+  HiFiOnsetDetector.cpp
+
+  Spectral flux onsets and autocorrelation tempo.  See HiFiOnsetDetector.h.
+
+  Flux is in log2 Q16 units summed over the bins: a bin rising by 3dB
+  adds 1 << 16.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "HiFiOnsetDetector.h"
+
+// Bins below -70dBFS count as silence.  A full scale sine through the
+// Hann window and the scaled FFT has a power of 2^58 (see
+// HiFiSpectrogram.cpp); 70dB is 23.25 octaves of power below that.
+#define ONSET_FLOOR_LOG2_Q16    ((int32_t)(34.75 * 65536))
+
+// Flux that can never be an onset, whatever the statistics say: a total
+// rise of 6dB across the spectrum.
+#define ONSET_MIN_FLUX          (2L << 16)
+
+// Flux statistics and autocorrelation leak, as shifts per spectrum
+#define ONSET_STATS_SHIFT       5
+#define ONSET_ACF_SHIFT         8
+
+HiFiOnsetDetector::HiFiOnsetDetector() :
+  _size(0),
+  _hop(0),
+  _sampleRate(0),
+  _decimation(1),
+  _decimationShift(0),
+  _ring(NULL),
+  _ringMask(0),
+  _written(0),
+  _sum(0),
+  _phase(0),
+  _nextFrame(0),
+  _work(NULL),
+  _lastLog(NULL),
+  _primed(false),
+  _sensitivity(3 << 8),
+  _minGap(1),
+  _mean(0),
+  _deviation(0),
+  _lastOnset(0),
+  _spectra(0),
+  _minLag(0),
+  _maxLag(0),
+  _history(NULL),
+  _historyHead(0),
+  _acf(NULL),
+  _energy(0),
+  _weight(NULL),
+  _eventHead(0),
+  _eventTail(0),
+  _droppedEvents(0)
+{
+  memset(_flux, 0, sizeof(_flux));
+}
+
+bool HiFiOnsetDetector::begin(uint32_t sampleRate, uint8_t decimation,
+                              uint8_t log2Size)
+{
+  end();
+
+  if (decimation != 1 && decimation != 2 && decimation != 4 &&
+      decimation != 8)
+  {
+    return false;
+  }
+  if (!_fft.begin(log2Size))
+  {
+    return false;
+  }
+
+  _size = _fft.getSize();
+  _hop = _size / 2;
+  _sampleRate = sampleRate;
+  _decimation = decimation;
+  _decimationShift = 0;
+  while ((1 << _decimationShift) < decimation)
+  {
+    _decimationShift++;
+  }
+
+  // Tempo lags, in spectra
+  float spectraPerSecond = (float)sampleRate / decimation / _hop;
+  _minLag = (uint16_t)(spectraPerSecond * 60.0f / HIFI_ONSET_MAX_BPM);
+  _maxLag = (uint16_t)(spectraPerSecond * 60.0f / HIFI_ONSET_MIN_BPM + 1.0f);
+  if (_minLag < 2)
+  {
+    _minLag = 2;
+  }
+
+  uint32_t ringSize = 1;
+  while (ringSize < (uint32_t)_size + 2 * _hop)
+  {
+    ringSize <<= 1;
+  }
+  _ringMask = ringSize - 1;
+
+  _ring = (int16_t *)malloc(sizeof(int16_t) * ringSize);
+  _work = (int32_t *)malloc(sizeof(int32_t) * _size);
+  _lastLog = (int32_t *)malloc(sizeof(int32_t) * _size / 2);
+  _history = (uint16_t *)malloc(sizeof(uint16_t) * (_maxLag + 1));
+  _acf = (uint64_t *)malloc(sizeof(uint64_t) * (_maxLag + 1));
+  _weight = (uint16_t *)malloc(sizeof(uint16_t) * (_maxLag + 1));
+  if (!_ring || !_work || !_lastLog || !_history || !_acf || !_weight)
+  {
+    end();
+    return false;
+  }
+
+  memset(_ring, 0, sizeof(int16_t) * ringSize);
+  memset(_history, 0, sizeof(uint16_t) * (_maxLag + 1));
+  memset(_acf, 0, sizeof(uint64_t) * (_maxLag + 1));
+
+  // Log-Gaussian preference for 120 BPM, an octave wide
+  for (uint16_t lag = 0; lag <= _maxLag; lag++)
+  {
+    float octaves = (lag == 0) ? 8.0f :
+      log2f(60.0f * spectraPerSecond / lag / 120.0f);
+    _weight[lag] = (uint16_t)(32767.0f * expf(-0.5f * octaves * octaves));
+  }
+
+  _written = 0;
+  _sum = 0;
+  _phase = 0;
+  _nextFrame = _size;
+  _primed = false;
+  _mean = 0;
+  _deviation = 0;
+  memset(_flux, 0, sizeof(_flux));
+  _lastOnset = 0;
+  _spectra = 0;
+  _historyHead = 0;
+  _energy = 0;
+  _eventHead = 0;
+  _eventTail = 0;
+  _droppedEvents = 0;
+  setMinInterval(80.0f);
+
+  hifi_cycle_counter_enable();
+  return true;
+}
+
+void HiFiOnsetDetector::end()
+{
+  free(_ring);
+  free(_work);
+  free(_lastLog);
+  free(_history);
+  free(_acf);
+  free(_weight);
+  _ring = NULL;
+  _work = NULL;
+  _lastLog = NULL;
+  _history = NULL;
+  _acf = NULL;
+  _weight = NULL;
+}
+
+void HiFiOnsetDetector::setSensitivity(float sensitivity)
+{
+  _sensitivity = (int32_t)(sensitivity * 256.0f);
+}
+
+void HiFiOnsetDetector::setMinInterval(float ms)
+{
+  if (!_hop)
+  {
+    return;
+  }
+
+  float spectraPerSecond = (float)_sampleRate / _decimation / _hop;
+  _minGap = (uint16_t)(ms * spectraPerSecond / 1000.0f + 0.5f);
+  if (_minGap < 1)
+  {
+    _minGap = 1;
+  }
+}
+
+void HiFiOnsetDetector::write(const int32_t *buf, uint16_t frames,
+                              uint8_t stride)
+{
+  for (uint16_t i = 0; i < frames; i++)
+  {
+    write(*buf);
+    buf += stride;
+  }
+}
+
+uint8_t HiFiOnsetDetector::update()
+{
+  uint8_t onsets = 0;
+
+  if (!_ring)
+  {
+    return 0;
+  }
+
+  _meter.start();
+
+  while ((int32_t)(_written - _nextFrame) >= 0)
+  {
+    // Fallen so far behind that the samples are gone: start again from
+    // the newest complete frame.
+    uint32_t written = _written;
+    if (written - _nextFrame > (uint32_t)(_ringMask + 1) - _size)
+    {
+      _nextFrame = written;
+      _primed = false;
+    }
+
+    uint8_t head = _eventHead;
+    analyse(_nextFrame);
+    _nextFrame += _hop;
+    onsets += (uint8_t)((_eventHead - head + HIFI_ONSET_QUEUE) %
+                        HIFI_ONSET_QUEUE);
+  }
+
+  _meter.stop();
+  return onsets;
+}
+
+// Positive change in log magnitude summed over the bins, against the
+// previous spectrum.
+int32_t HiFiOnsetDetector::flux()
+{
+  int32_t sum = 0;
+
+  for (uint16_t k = 1; k < _size / 2; k++)
+  {
+    uint64_t power = (uint64_t)((int64_t)_work[2 * k] * _work[2 * k]) +
+                     (uint64_t)((int64_t)_work[2 * k + 1] * _work[2 * k + 1]);
+    int32_t level = power ? hifi_log2_q16_u64(power) - ONSET_FLOOR_LOG2_Q16 : 0;
+
+    if (level < 0)
+    {
+      level = 0;
+    }
+    if (level > _lastLog[k])
+    {
+      sum += level - _lastLog[k];
+    }
+    _lastLog[k] = level;
+  }
+  return sum;
+}
+
+void HiFiOnsetDetector::analyse(uint32_t end)
+{
+  uint32_t start = end - _size;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Hann window and transform
+  ///////////////////////////////////////////////////////////////////////////
+  for (uint16_t n = 0; n < _size; n++)
+  {
+    int32_t x = (int32_t)_ring[(start + n) & _ringMask] * 65536;
+    int32_t w = (int32_t)(((int64_t)0x7FFFFFFF - HiFiFft::cosine(n, _size)) >> 1);
+    _work[n] = hifi_mul_q31(x, w);
+  }
+  _fft.forwardReal(_work, true);
+
+  int32_t f = flux();
+  if (!_primed)
+  {
+    // Nothing to compare the first spectrum with
+    f = 0;
+    _primed = true;
+  }
+  _spectra++;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Onsets: the previous value is one if it is a local peak above the
+  /// adaptive threshold.  Its spectrum covered the window ending a hop ago;
+  /// the onset is stamped at that window's centre.
+  ///////////////////////////////////////////////////////////////////////////
+  _flux[2] = _flux[1];
+  _flux[1] = _flux[0];
+  _flux[0] = f;
+
+  int32_t threshold = _mean + ((_sensitivity * (int64_t)_deviation) >> 8);
+  if (threshold < ONSET_MIN_FLUX)
+  {
+    threshold = ONSET_MIN_FLUX;
+  }
+
+  if (_flux[1] > _flux[2] && _flux[1] >= _flux[0] && _flux[1] > threshold &&
+      _spectra - 1 - _lastOnset >= _minGap)
+  {
+    HiFiOnsetEvent_t event;
+    uint8_t next = (_eventHead + 1) % HIFI_ONSET_QUEUE;
+
+    event.frame = (end - _hop - _size / 2) << _decimationShift;
+    event.strength = _flux[1] - threshold;
+    _lastOnset = _spectra - 1;
+
+    if (next == _eventTail)
+    {
+      _droppedEvents++;
+    }
+    else
+    {
+      _events[_eventHead] = event;
+      _eventHead = next;
+    }
+  }
+
+  int32_t diff = f - _mean;
+  _mean += diff >> ONSET_STATS_SHIFT;
+  _deviation += (((diff < 0) ? -diff : diff) - _deviation) >> ONSET_STATS_SHIFT;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Tempo: leaky autocorrelation of the flux above its mean.
+  ///////////////////////////////////////////////////////////////////////////
+  int32_t odf = (diff > 0) ? (diff >> 8) : 0;
+  uint16_t value = (odf > 0xFFFF) ? 0xFFFF : (uint16_t)odf;
+  uint16_t length = _maxLag + 1;
+
+  _historyHead = (_historyHead + 1 == length) ? 0 : _historyHead + 1;
+  _history[_historyHead] = value;
+
+  _energy += (uint64_t)value * value;
+  _energy -= _energy >> ONSET_ACF_SHIFT;
+
+  uint16_t past = (_historyHead >= _minLag) ? _historyHead - _minLag :
+                                              _historyHead + length - _minLag;
+  for (uint16_t lag = _minLag; lag <= _maxLag; lag++)
+  {
+    uint64_t acf = _acf[lag];
+    acf += (uint64_t)value * _history[past];
+    acf -= acf >> ONSET_ACF_SHIFT;
+    _acf[lag] = acf;
+
+    past = (past == 0) ? length - 1 : past - 1;
+  }
+}
+
+bool HiFiOnsetDetector::readEvent(HiFiOnsetEvent_t &event)
+{
+  uint8_t tail = _eventTail;
+
+  if (tail == _eventHead)
+  {
+    return false;
+  }
+  event = _events[tail];
+  _eventTail = (tail + 1) % HIFI_ONSET_QUEUE;
+  return true;
+}
+
+float HiFiOnsetDetector::getTempo() const
+{
+  if (!_acf || _spectra < 2U * _maxLag || _energy == 0)
+  {
+    return 0.0f;
+  }
+
+  uint16_t best = _minLag;
+  float bestScore = -1.0f;
+  for (uint16_t lag = _minLag; lag <= _maxLag; lag++)
+  {
+    float score = (float)_acf[lag] * _weight[lag];
+    if (score > bestScore)
+    {
+      bestScore = score;
+      best = lag;
+    }
+  }
+
+  // Parabolic interpolation between the neighbouring lags
+  float lag = best;
+  if (best > _minLag && best < _maxLag)
+  {
+    float a = (float)_acf[best - 1] * _weight[best - 1];
+    float c = (float)_acf[best + 1] * _weight[best + 1];
+    float den = a - 2.0f * bestScore + c;
+    if (den < 0.0f)
+    {
+      lag += 0.5f * (a - c) / den;
+    }
+  }
+
+  float spectraPerSecond = (float)_sampleRate / _decimation / _hop;
+  return 60.0f * spectraPerSecond / lag;
+}
+
+float HiFiOnsetDetector::getTempoConfidence() const
+{
+  if (!_acf || _energy == 0)
+  {
+    return 0.0f;
+  }
+
+  uint64_t peak = 0;
+  for (uint16_t lag = _minLag; lag <= _maxLag; lag++)
+  {
+    if (_acf[lag] > peak)
+    {
+      peak = _acf[lag];
+    }
+  }
+
+  float confidence = (float)peak / (float)_energy;
+  return (confidence > 1.0f) ? 1.0f : confidence;
+}
@@ -0,0 +1,152 @@
+/*
+  HiFiOnsetDetector.h
+
+  Onset (beat, note start) detection and tempo estimation on live input,
+  e.g. for driving lights.
+
+  The audio path hands samples to write(), which averages them down
+  (4:1 by default, so 48kHz becomes 12kHz) into a small ring.  update()
+  in loop() then takes short-time spectra (256 points, a new one every
+  128 decimated samples, ~94 per second at 48kHz) and works out the
+  spectral flux: how much the log magnitude rose across all bins since
+  the previous spectrum.  Flux peaks that stand out from its running
+  mean by some multiple of its running deviation, and come no sooner than
+  a minimum interval after the last one, are onsets.
+
+  Onsets are queued as events stamped with the input frame they happened
+  at (counted from begin(), as passed to write()) and read back with
+  readEvent().
+
+  For the tempo, the flux above its mean is autocorrelated over the lags
+  for 60..200 BPM with leaky accumulators, one multiply-add per lag per
+  spectrum.  getTempo() picks the strongest lag, weighted towards 120 BPM
+  to steer clear of half and double tempo.
+
+  At the defaults the whole thing costs about one 256 point FFT every
+  10.7ms; getCycleMeter() reports the cost of the last update().
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_ONSET_DETECTOR_H
+#define HIFI_ONSET_DETECTOR_H
+
+#include "HiFiDsp.h"
+#include "HiFiFft.h"
+
+#define HIFI_ONSET_QUEUE      16
+#define HIFI_ONSET_MIN_BPM    60
+#define HIFI_ONSET_MAX_BPM    200
+
+typedef struct
+{
+  uint32_t frame;       // input frame of the onset
+  uint32_t strength;    // flux above the threshold, arbitrary units
+} HiFiOnsetEvent_t;
+
+class HiFiOnsetDetector {
+public:
+  HiFiOnsetDetector();
+
+  // 'decimation' input frames are averaged into each analysed sample
+  // (1, 2, 4 or 8).
+  bool begin(uint32_t sampleRate, uint8_t decimation = 4,
+             uint8_t log2Size = 8);
+  void end();
+
+  // Onsets need flux above mean + sensitivity * deviation (default 3).
+  void setSensitivity(float sensitivity);
+  // Shortest gap between onsets, ms (default 80).
+  void setMinInterval(float ms);
+
+  // Add input.  Safe to call from the audio interrupt while update()
+  // runs in loop().
+  void write(const int32_t *buf, uint16_t frames, uint8_t stride = 1);
+  void write(int32_t sample)
+  {
+    _sum += sample >> 16;
+    if (++_phase == _decimation)
+    {
+      _ring[_written & _ringMask] = (int16_t)(_sum >> _decimationShift);
+      _written++;
+      _sum = 0;
+      _phase = 0;
+    }
+  }
+
+  // Analyse the spectra that are due.  Returns the number of onsets
+  // found.
+  uint8_t update();
+
+  bool readEvent(HiFiOnsetEvent_t &event);
+  uint32_t getDroppedEvents() const { return _droppedEvents; }
+
+  // Beats per minute, 0 until there is enough history; and how strongly
+  // periodic the onsets are (0 .. 1).
+  float getTempo() const;
+  float getTempoConfidence() const;
+
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  void analyse(uint32_t end);
+  int32_t flux();
+
+  HiFiFft _fft;
+  uint16_t _size;
+  uint16_t _hop;
+  uint32_t _sampleRate;
+  uint8_t _decimation;
+  uint8_t _decimationShift;
+
+  // Input, decimated
+  int16_t *_ring;
+  uint32_t _ringMask;
+  volatile uint32_t _written;
+  int32_t _sum;
+  uint8_t _phase;
+  uint32_t _nextFrame;
+
+  int32_t *_work;
+  int32_t *_lastLog;
+  bool _primed;
+
+  // Onset picking
+  int32_t _sensitivity;   // Q8
+  uint16_t _minGap;       // spectra
+  int32_t _mean;
+  int32_t _deviation;
+  int32_t _flux[3];       // the last three flux values, newest first
+  uint32_t _lastOnset;
+  uint32_t _spectra;
+
+  // Tempo
+  uint16_t _minLag;
+  uint16_t _maxLag;
+  uint16_t *_history;
+  uint16_t _historyHead;
+  uint64_t *_acf;
+  uint64_t _energy;
+  uint16_t *_weight;      // Q15
+
+  HiFiOnsetEvent_t _events[HIFI_ONSET_QUEUE];
+  volatile uint8_t _eventHead;
+  volatile uint8_t _eventTail;
+  uint32_t _droppedEvents;
+
+  HiFiCycleMeter _meter;
+};
+
+#endif
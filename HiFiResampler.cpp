@@ -0,0 +1,194 @@
+/*
+  HiFiResampler.cpp
+
+  44.1kHz to 48kHz polyphase converter.  See HiFiResampler.h.
+
+  Output m sits at 147 * m on the 7.056MHz grid, i.e. input frame
+  n = floor(147 * m / 160) plus phase p = 147 * m mod 160.  It is the
+  dot product of phase p of the filter with the 64 input frames ending at
+  frame n.  Stepping from one output to the next adds 147 to the phase;
+  each time it wraps past 160 one more input frame is needed.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "HiFiResampler.h"
+
+HiFiResampler::HiFiResampler() :
+  _channels(0),
+  _history(NULL),
+  _position(0),
+  _phase(0),
+  _need(1),
+  _lastFrames(0)
+{
+}
+
+bool HiFiResampler::begin(uint8_t channels)
+{
+  end();
+
+  if (channels < 1 || channels > HIFI_RESAMPLER_MAX_CHANNELS)
+  {
+    return false;
+  }
+
+  _channels = channels;
+  _history = (int16_t *)malloc(sizeof(int16_t) * 2 * HIFI_RESAMPLER_TAPS *
+                               channels);
+  if (!_history)
+  {
+    end();
+    return false;
+  }
+
+  reset();
+  hifi_cycle_counter_enable();
+  return true;
+}
+
+void HiFiResampler::end()
+{
+  free(_history);
+  _history = NULL;
+  _channels = 0;
+}
+
+void HiFiResampler::reset()
+{
+  if (_history)
+  {
+    memset(_history, 0, sizeof(int16_t) * 2 * HIFI_RESAMPLER_TAPS * _channels);
+  }
+  _position = 0;
+  _phase = 0;
+  _need = 1;
+  _lastFrames = 0;
+  _meter.reset();
+}
+
+uint16_t HiFiResampler::getInputFrames(uint16_t outFrames) const
+{
+  if (outFrames == 0)
+  {
+    return 0;
+  }
+  return _need + (_phase + (uint32_t)HIFI_RESAMPLER_DOWN * (outFrames - 1)) /
+    HIFI_RESAMPLER_UP;
+}
+
+inline void HiFiResampler::push(const int32_t *frame)
+{
+  int16_t *h = _history + _position * _channels;
+
+  for (uint8_t c = 0; c < _channels; c++)
+  {
+    int16_t s = (int16_t)(frame[c] >> 16);
+    h[c] = s;
+    h[c + HIFI_RESAMPLER_TAPS * _channels] = s;
+  }
+  if (++_position == HIFI_RESAMPLER_TAPS)
+  {
+    _position = 0;
+  }
+}
+
+HIFI_RAMFUNC uint16_t HiFiResampler::process(const int32_t *in,
+                                             uint16_t inFrames,
+                                             uint16_t &used,
+                                             int32_t *out,
+                                             uint16_t outFrames)
+{
+  uint16_t produced = 0;
+
+  used = 0;
+  if (!_history)
+  {
+    return 0;
+  }
+
+  _meter.start();
+
+  while (produced < outFrames)
+  {
+    if (_need)
+    {
+      if (used == inFrames)
+      {
+        break;
+      }
+      push(in + used * _channels);
+      used++;
+      _need = 0;
+    }
+
+    // Q15 samples x Q15 taps, summed unsigned so the 32 bit total can
+    // wrap on the way; the result comes out right as long as it is inside
+    // twice full scale, which only contrived inputs can leave.
+    const int16_t *c = hifi_resampler_phases[_phase];
+
+    if (_channels == 2)
+    {
+      const int16_t *x = _history + 2 * _position;
+      uint32_t left = 0;
+      uint32_t right = 0;
+
+      for (uint8_t k = 0; k < HIFI_RESAMPLER_TAPS; k += 4)
+      {
+        int32_t c0 = c[k];
+        int32_t c1 = c[k + 1];
+        int32_t c2 = c[k + 2];
+        int32_t c3 = c[k + 3];
+
+        left += (uint32_t)(c0 * x[0]) + (uint32_t)(c1 * x[2]) +
+                (uint32_t)(c2 * x[4]) + (uint32_t)(c3 * x[6]);
+        right += (uint32_t)(c0 * x[1]) + (uint32_t)(c1 * x[3]) +
+                 (uint32_t)(c2 * x[5]) + (uint32_t)(c3 * x[7]);
+        x += 8;
+      }
+      out[0] = hifi_sat32((int64_t)(int32_t)left * 2);
+      out[1] = hifi_sat32((int64_t)(int32_t)right * 2);
+      out += 2;
+    }
+    else
+    {
+      const int16_t *x = _history + _position;
+      uint32_t acc = 0;
+
+      for (uint8_t k = 0; k < HIFI_RESAMPLER_TAPS; k += 4)
+      {
+        acc += (uint32_t)(c[k] * x[k]) + (uint32_t)(c[k + 1] * x[k + 1]) +
+               (uint32_t)(c[k + 2] * x[k + 2]) +
+               (uint32_t)(c[k + 3] * x[k + 3]);
+      }
+      *out++ = hifi_sat32((int64_t)(int32_t)acc * 2);
+    }
+    produced++;
+
+    uint16_t phase = _phase + HIFI_RESAMPLER_DOWN;
+    if (phase >= HIFI_RESAMPLER_UP)
+    {
+      phase -= HIFI_RESAMPLER_UP;
+      _need = 1;
+    }
+    _phase = phase;
+  }
+
+  _meter.stop();
+  _lastFrames = produced;
+  return produced;
+}
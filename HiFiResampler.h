@@ -0,0 +1,117 @@
+/*
+  HiFiResampler.h
+
+  Fixed ratio 44.1kHz to 48kHz sample rate converter for playing CD rate
+  files through a codec clocked at 48kHz.
+
+  The conversion is 160/147 exactly: conceptually the input is stuffed
+  with 159 zeros between samples, low pass filtered at 7.056MHz and every
+  147th sample kept.  Only the filter taps that land on real samples are
+  ever computed, so each output sample is a 64 tap FIR over the most
+  recent input samples, using one of 160 precomputed phases of the
+  filter.  The phases live in flash (HiFiResamplerTable.c, 20K bytes,
+  generated by extras/resampler/resampler_table.py).
+
+  Measured with extras/resampler/resampler_check.cpp:
+    - passband flat to within 0.0005dB up to 20kHz,
+    - filter response 90dB down at and above 24.1kHz, where the first
+      image of a 20kHz input falls, so anything that folds back into the
+      audio band is at least 90dB down,
+    - THD+N of a -1dBFS sine better than -82dB across the band (about
+      -95dB at the bottom of it), set by the 16 bit taps.
+
+  Samples and taps are both 16 bits (the top half of the Q31 input), so
+  the inner loop is all 32 bit multiply-adds, which the M3 does in one or
+  two cycles; 64 bit ones take up to seven.  The output is full Q31.  The
+  filter delays the signal by getLatency() output frames (0.73ms).
+
+  process() is meant to run in loop(), between reading a file and
+  HiFi.writeFrames(); it costs about 64 multiply-adds per output sample
+  per channel.  getCyclesPerFrame() reports the measured cost of the last
+  call per output frame, which the ResamplingPlayer example prints.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_RESAMPLER_H
+#define HIFI_RESAMPLER_H
+
+#include "HiFiDsp.h"
+
+#define HIFI_RESAMPLER_UP             160
+#define HIFI_RESAMPLER_DOWN           147
+#define HIFI_RESAMPLER_TAPS           64
+#define HIFI_RESAMPLER_MAX_CHANNELS   2
+
+extern "C" const int16_t hifi_resampler_phases[HIFI_RESAMPLER_UP][HIFI_RESAMPLER_TAPS];
+
+class HiFiResampler {
+public:
+  HiFiResampler();
+
+  // 1 or 2 interleaved channels.
+  bool begin(uint8_t channels = 2);
+  void end();
+
+  // Clear the filter history, e.g. between files.
+  void reset();
+
+  // Convert interleaved 44.1kHz frames from 'in' into 48kHz frames in
+  // 'out', until 'outFrames' have been written or the input runs out.
+  // 'used' is set to the number of input frames taken.  Returns the
+  // number of output frames written.
+  uint16_t process(const int32_t *in, uint16_t inFrames, uint16_t &used,
+                   int32_t *out, uint16_t outFrames);
+
+  // Input frames process() needs to produce exactly 'outFrames' from the
+  // current state (never more than outFrames * 147 / 160 + 1).
+  uint16_t getInputFrames(uint16_t outFrames) const;
+
+  uint8_t getChannels() const { return _channels; }
+
+  // Delay through the filter, in output frames.
+  uint16_t getLatency() const
+  {
+    return ((HIFI_RESAMPLER_TAPS * HIFI_RESAMPLER_UP) / 2 +
+            HIFI_RESAMPLER_DOWN / 2) / HIFI_RESAMPLER_DOWN;
+  }
+
+  // Cycles the last process() took per output frame (all channels).
+  uint32_t getCyclesPerFrame() const
+  {
+    return _lastFrames ? _meter.getCycles() / _lastFrames : 0;
+  }
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  void push(const int32_t *frame);
+
+  uint8_t _channels;
+
+  // The last TAPS input frames, stored twice so a filter can always read
+  // them as one run, oldest first, starting at _position.
+  int16_t *_history;
+  uint8_t _position;
+
+  // Phase of the next output, and whether an input frame is needed
+  // before it can be computed.
+  uint8_t _phase;
+  uint8_t _need;
+
+  uint16_t _lastFrames;
+  HiFiCycleMeter _meter;
+};
+
+#endif
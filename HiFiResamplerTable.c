@@ -0,0 +1,1631 @@
+/*
+  HiFiResamplerTable.c
+
+  Polyphase filter for HiFiResampler: 160 phases of 64 taps, Q15, each
+  phase stored oldest sample first.  Kaiser windowed sinc (beta 9.0)
+  at 160 x 44.1kHz, cut off at 22050Hz.
+
+  Generated by extras/resampler/resampler_table.py; don't edit by hand.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdint.h>
+
+// Left in flash (no HIFI_RAMDATA): at 20K bytes it is too big to copy
+// and the filter reads it sequentially, which the flash prefetch handles.
+const int16_t hifi_resampler_phases[160][64] =
+{
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 1, -1, 1, -2, 2,
+    -3, 3, -4, 5, -6, 7, -8, 10,
+    -12, 15, -18, 24, -33, 50, -102, 32767,
+    102, -50, 33, -24, 18, -15, 12, -10,
+    8, -7, 6, -5, 4, -3, 3, -2,
+    2, -1, 1, -1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, 0, 0, -1, 1,
+    -1, 1, -2, 2, -3, 4, -5, 6,
+    -8, 9, -11, 14, -17, 20, -24, 29,
+    -36, 44, -55, 72, -98, 150, -303, 32762,
+    309, -152, 99, -72, 55, -44, 36, -29,
+    24, -20, 17, -14, 11, -9, 8, -6,
+    5, -4, 3, -2, 2, -1, 1, -1,
+    1, 0, 0, 0, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, 0, 1, -1, 1,
+    -2, 2, -3, 4, -5, 7, -8, 10,
+    -13, 16, -19, 23, -28, 33, -40, 49,
+    -59, 73, -92, 119, -163, 250, -502, 32754,
+    518, -254, 165, -120, 93, -74, 60, -49,
+    40, -34, 28, -23, 19, -16, 13, -10,
+    8, -7, 5, -4, 3, -2, 2, -1,
+    1, -1, 0, 0, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, -1, 1, -1, 2,
+    -2, 3, -4, 6, -7, 9, -12, 14,
+    -18, 22, -26, 32, -39, 47, -56, 68,
+    -83, 102, -128, 166, -228, 348, -698, 32741,
+    729, -356, 232, -169, 130, -103, 84, -69,
+    57, -47, 39, -32, 27, -22, 18, -15,
+    12, -9, 7, -6, 4, -3, 2, -2,
+    1, -1, 1, 0, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, -1, 1, -2, 2,
+    -3, 4, -5, 7, -9, 12, -15, 18,
+    -23, 28, -34, 41, -50, 60, -72, 87,
+    -106, 131, -165, 214, -293, 446, -891, 32724,
+    943, -459, 299, -217, 167, -133, 108, -88,
+    73, -60, 50, -42, 34, -28, 23, -19,
+    15, -12, 9, -7, 6, -4, 3, -2,
+    2, -1, 1, 0, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 1, -1, 1, -2, 3,
+    -4, 5, -7, 9, -11, 14, -18, 23,
+    -28, 34, -41, 50, -61, 73, -88, 107,
+    -130, 160, -201, 260, -357, 543, -1082, 32703,
+    1160, -563, 366, -265, 204, -162, 132, -108,
+    89, -74, 61, -51, 42, -34, 28, -23,
+    18, -15, 12, -9, 7, -5, 4, -3,
+    2, -1, 1, -1, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 1, -1, 2, -2, 3,
+    -4, 6, -8, 10, -13, 17, -21, 26,
+    -33, 40, -49, 59, -72, 86, -104, 126,
+    -153, 189, -237, 307, -420, 639, -1270, 32678,
+    1378, -667, 433, -314, 242, -192, 156, -128,
+    106, -88, 73, -60, 50, -41, 33, -27,
+    22, -17, 14, -11, 8, -6, 4, -3,
+    2, -2, 1, -1, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 1, -1, 2, -3, 4,
+    -5, 7, -9, 12, -15, 19, -25, 31,
+    -38, 46, -56, 68, -82, 99, -120, 145,
+    -176, 217, -273, 353, -483, 735, -1455, 32648,
+    1600, -771, 500, -363, 279, -222, 180, -148,
+    122, -101, 84, -69, 57, -47, 38, -31,
+    25, -20, 16, -12, 9, -7, 5, -4,
+    3, -2, 1, -1, 0, 0, 0, 0
+  },
+  {
+    0, 0, -1, 1, -1, 2, -3, 4,
+    -6, 8, -10, 13, -17, 22, -28, 34,
+    -43, 52, -64, 77, -93, 112, -135, 164,
+    -199, 246, -308, 399, -546, 829, -1638, 32615,
+    1823, -876, 567, -411, 316, -251, 204, -167,
+    138, -115, 95, -79, 65, -53, 44, -35,
+    28, -23, 18, -14, 11, -8, 6, -4,
+    3, -2, 1, -1, 1, 0, 0, 0
+  },
+  {
+    0, 0, -1, 1, -2, 2, -3, 5,
+    -6, 9, -12, 15, -19, 25, -31, 38,
+    -48, 58, -71, 86, -104, 125, -151, 183,
+    -222, 274, -344, 445, -608, 923, -1817, 32577,
+    2049, -981, 635, -460, 354, -281, 228, -187,
+    154, -128, 106, -88, 72, -60, 49, -40,
+    32, -25, 20, -16, 12, -9, 7, -5,
+    3, -2, 1, -1, 1, 0, 0, 0
+  },
+  {
+    0, 0, -1, 1, -2, 2, -4, 5,
+    -7, 10, -13, 17, -21, 27, -34, 42,
+    -52, 64, -78, 95, -114, 138, -166, 201,
+    -245, 302, -379, 490, -670, 1016, -1994, 32535,
+    2277, -1087, 702, -509, 391, -311, 252, -207,
+    171, -141, 117, -97, 80, -66, 54, -44,
+    35, -28, 22, -17, 13, -10, 7, -5,
+    4, -3, 2, -1, 1, 0, 0, 0
+  },
+  {
+    0, 0, -1, 1, -2, 3, -4, 6,
+    -8, 10, -14, 18, -23, 30, -37, 46,
+    -57, 70, -85, 104, -125, 151, -182, 220,
+    -268, 330, -414, 535, -731, 1107, -2168, 32489,
+    2507, -1193, 770, -557, 428, -340, 276, -226,
+    187, -155, 128, -106, 88, -72, 59, -48,
+    38, -31, 24, -19, 14, -11, 8, -6,
+    4, -3, 2, -1, 1, 0, 0, 0
+  },
+  {
+    0, 0, -1, 1, -2, 3, -4, 6,
+    -8, 11, -15, 20, -25, 32, -40, 50,
+    -62, 76, -93, 112, -136, 163, -197, 238,
+    -290, 357, -448, 580, -792, 1198, -2339, 32438,
+    2739, -1299, 837, -606, 465, -370, 300, -246,
+    203, -168, 140, -116, 95, -78, 64, -52,
+    42, -33, 26, -20, 16, -12, 9, -6,
+    5, -3, 2, -1, 1, 0, 0, 0
+  },
+  {
+    0, 0, -1, 1, -2, 3, -5, 7,
+    -9, 12, -16, 21, -27, 35, -43, 54,
+    -67, 82, -100, 121, -146, 176, -212, 257,
+    -312, 385, -483, 624, -852, 1288, -2508, 32384,
+    2974, -1405, 905, -655, 503, -399, 323, -265,
+    219, -182, 151, -125, 103, -85, 69, -56,
+    45, -36, 28, -22, 17, -13, 9, -7,
+    5, -3, 2, -1, 1, 0, 0, 0
+  },
+  {
+    0, 1, -1, 1, -2, 3, -5, 7,
+    -10, 13, -17, 23, -29, 37, -46, 58,
+    -71, 88, -107, 129, -156, 188, -227, 275,
+    -335, 412, -517, 668, -911, 1376, -2673, 32325,
+    3211, -1511, 972, -703, 540, -428, 347, -285,
+    235, -195, 162, -134, 111, -91, 74, -60,
+    48, -39, 30, -24, 18, -14, 10, -7,
+    5, -4, 2, -1, 1, 0, 0, 0
+  },
+  {
+    0, 0, -1, 2, -2, 4, -5, 7,
+    -10, 14, -18, 24, -31, 39, -50, 62,
+    -76, 93, -114, 138, -167, 201, -242, 293,
+    -357, 439, -550, 711, -970, 1464, -2835, 32262,
+    3449, -1618, 1040, -752, 577, -458, 371, -304,
+    251, -208, 173, -143, 118, -97, 79, -64,
+    52, -41, 32, -25, 19, -15, 11, -8,
+    6, -4, 3, -2, 1, -1, 0, 0
+  },
+  {
+    0, 1, -1, 2, -3, 4, -6, 8,
+    -11, 15, -20, 25, -33, 42, -53, 65,
+    -81, 99, -121, 146, -177, 213, -257, 311,
+    -378, 466, -584, 754, -1028, 1550, -2995, 32195,
+    3690, -1724, 1107, -800, 614, -487, 394, -323,
+    267, -221, 184, -152, 126, -103, 84, -68,
+    55, -44, 35, -27, 21, -16, 12, -8,
+    6, -4, 3, -2, 1, -1, 0, 0
+  },
+  {
+    0, 1, -1, 2, -3, 4, -6, 8,
+    -11, 16, -21, 27, -35, 44, -55, 69,
+    -85, 105, -128, 155, -187, 225, -272, 329,
+    -400, 492, -617, 797, -1086, 1635, -3151, 32124,
+    3932, -1831, 1174, -848, 650, -516, 418, -343,
+    283, -235, 195, -161, 133, -109, 89, -72,
+    58, -46, 37, -28, 22, -16, 12, -9,
+    6, -4, 3, -2, 1, -1, 0, 0
+  },
+  {
+    0, 1, -1, 2, -3, 4, -6, 9,
+    -12, 16, -22, 28, -37, 47, -58, 73,
+    -90, 110, -134, 163, -197, 237, -286, 346,
+    -421, 518, -650, 839, -1142, 1719, -3305, 32049,
+    4177, -1938, 1241, -896, 687, -545, 441, -362,
+    299, -248, 206, -170, 141, -115, 94, -77,
+    62, -49, 39, -30, 23, -17, 13, -9,
+    7, -5, 3, -2, 1, -1, 0, 0
+  },
+  {
+    0, 1, -1, 2, -3, 5, -6, 9,
+    -13, 17, -23, 30, -38, 49, -61, 77,
+    -94, 116, -141, 171, -207, 249, -300, 364,
+    -442, 544, -682, 881, -1199, 1802, -3455, 31970,
+    4423, -2045, 1308, -944, 723, -574, 465, -381,
+    315, -261, 216, -179, 148, -122, 99, -81,
+    65, -52, 41, -32, 24, -18, 14, -10,
+    7, -5, 3, -2, 1, -1, 0, 0
+  },
+  {
+    0, 1, -1, 2, -3, 5, -7, 10,
+    -13, 18, -24, 31, -40, 51, -64, 80,
+    -99, 121, -148, 179, -216, 261, -315, 381,
+    -463, 570, -714, 922, -1254, 1884, -3603, 31887,
+    4671, -2151, 1375, -991, 760, -603, 488, -400,
+    330, -274, 227, -188, 155, -128, 104, -85,
+    68, -54, 43, -33, 26, -19, 14, -10,
+    7, -5, 3, -2, 1, -1, 0, 0
+  },
+  {
+    0, 1, -1, 2, -3, 5, -7, 10,
+    -14, 19, -25, 32, -42, 53, -67, 84,
+    -103, 127, -154, 187, -226, 273, -329, 398,
+    -484, 595, -746, 963, -1309, 1965, -3747, 31800,
+    4921, -2258, 1441, -1039, 796, -631, 511, -419,
+    346, -287, 238, -197, 163, -134, 109, -89,
+    71, -57, 45, -35, 27, -20, 15, -11,
+    8, -5, 3, -2, 1, -1, 0, 0
+  },
+  {
+    0, 1, -1, 2, -3, 5, -7, 10,
+    -14, 20, -26, 34, -44, 56, -70, 87,
+    -108, 132, -161, 195, -236, 284, -343, 414,
+    -504, 620, -777, 1003, -1363, 2044, -3889, 31709,
+    5173, -2364, 1508, -1086, 832, -659, 534, -438,
+    361, -300, 248, -206, 170, -140, 114, -93,
+    75, -59, 47, -36, 28, -21, 16, -11,
+    8, -6, 4, -2, 1, -1, 0, 0
+  },
+  {
+    0, 1, -1, 2, -3, 5, -8, 11,
+    -15, 20, -27, 35, -45, 58, -73, 91,
+    -112, 137, -167, 203, -245, 296, -356, 431,
+    -524, 645, -808, 1042, -1416, 2122, -4027, 31614,
+    5427, -2470, 1573, -1133, 867, -688, 557, -456,
+    377, -312, 259, -215, 177, -146, 119, -97,
+    78, -62, 49, -38, 29, -22, 16, -12,
+    8, -6, 4, -3, 2, -1, 0, 0
+  },
+  {
+    0, 1, -1, 2, -4, 5, -8, 11,
+    -16, 21, -28, 37, -47, 60, -76, 94,
+    -116, 143, -174, 211, -254, 307, -370, 447,
+    -544, 670, -838, 1082, -1469, 2199, -4162, 31515,
+    5682, -2576, 1639, -1180, 903, -716, 579, -475,
+    392, -325, 269, -223, 184, -152, 124, -101,
+    81, -64, 51, -40, 30, -23, 17, -12,
+    9, -6, 4, -3, 2, -1, 0, 0
+  },
+  {
+    0, 1, -1, 2, -4, 6, -8, 12,
+    -16, 22, -29, 38, -49, 62, -78, 97,
+    -121, 148, -180, 218, -264, 318, -384, 464,
+    -564, 694, -869, 1120, -1520, 2274, -4295, 31412,
+    5939, -2682, 1704, -1226, 938, -743, 602, -493,
+    407, -338, 280, -232, 191, -158, 129, -104,
+    84, -67, 53, -41, 32, -24, 18, -13,
+    9, -6, 4, -3, 2, -1, 0, 0
+  },
+  {
+    0, 1, -1, 2, -4, 6, -8, 12,
+    -17, 23, -30, 39, -51, 64, -81, 101,
+    -125, 153, -186, 226, -273, 329, -397, 480,
+    -583, 717, -898, 1158, -1571, 2348, -4424, 31305,
+    6197, -2788, 1769, -1272, 973, -771, 624, -511,
+    422, -350, 290, -240, 199, -163, 133, -108,
+    87, -69, 55, -43, 33, -25, 18, -13,
+    10, -7, 4, -3, 2, -1, 0, 0
+  },
+  {
+    0, 1, -1, 2, -4, 6, -9, 12,
+    -17, 23, -31, 40, -52, 66, -84, 104,
+    -129, 158, -192, 233, -282, 340, -410, 495,
+    -603, 741, -927, 1196, -1621, 2421, -4550, 31194,
+    6457, -2893, 1834, -1318, 1008, -798, 646, -529,
+    437, -362, 300, -249, 206, -169, 138, -112,
+    90, -72, 57, -44, 34, -26, 19, -14,
+    10, -7, 5, -3, 2, -1, 1, 0
+  },
+  {
+    0, 1, -2, 3, -4, 6, -9, 13,
+    -18, 24, -32, 42, -54, 68, -86, 107,
+    -133, 163, -198, 240, -291, 350, -423, 511,
+    -621, 764, -956, 1232, -1671, 2492, -4673, 31079,
+    6718, -2997, 1898, -1363, 1042, -826, 668, -547,
+    452, -374, 311, -257, 213, -175, 143, -116,
+    93, -74, 59, -46, 35, -27, 20, -14,
+    10, -7, 5, -3, 2, -1, 1, 0
+  },
+  {
+    0, 1, -2, 3, -4, 6, -9, 13,
+    -18, 25, -33, 43, -55, 70, -89, 111,
+    -137, 168, -204, 248, -299, 361, -435, 526,
+    -640, 787, -985, 1269, -1719, 2562, -4793, 30961,
+    6980, -3102, 1962, -1408, 1076, -852, 690, -565,
+    467, -387, 321, -266, 219, -180, 147, -120,
+    96, -77, 61, -47, 36, -28, 20, -15,
+    11, -7, 5, -3, 2, -1, 0, 0
+  },
+  {
+    0, 1, -2, 3, -4, 7, -10, 14,
+    -19, 25, -34, 44, -57, 72, -91, 114,
+    -141, 172, -210, 255, -308, 371, -448, 541,
+    -658, 809, -1012, 1304, -1766, 2631, -4909, 30839,
+    7245, -3206, 2025, -1453, 1110, -879, 711, -583,
+    481, -399, 331, -274, 226, -186, 152, -123,
+    99, -79, 63, -49, 37, -28, 21, -15,
+    11, -8, 5, -3, 2, -1, 1, 0
+  },
+  {
+    0, 1, -2, 3, -4, 7, -10, 14,
+    -19, 26, -35, 45, -58, 74, -94, 117,
+    -144, 177, -216, 262, -316, 381, -460, 556,
+    -676, 831, -1040, 1339, -1813, 2698, -5023, 30713,
+    7510, -3309, 2088, -1497, 1144, -905, 732, -600,
+    495, -411, 340, -282, 233, -192, 157, -127,
+    102, -82, 64, -50, 39, -29, 22, -16,
+    11, -8, 5, -3, 2, -1, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 7, -10, 14,
+    -20, 27, -36, 46, -60, 76, -96, 120,
+    -148, 182, -221, 269, -325, 391, -472, 571,
+    -694, 853, -1067, 1373, -1859, 2764, -5133, 30583,
+    7776, -3412, 2150, -1541, 1177, -931, 753, -617,
+    510, -422, 350, -290, 240, -197, 161, -131,
+    105, -84, 66, -52, 40, -30, 22, -16,
+    12, -8, 5, -3, 2, -1, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 7, -10, 15,
+    -20, 27, -36, 48, -61, 78, -99, 123,
+    -152, 186, -227, 275, -333, 401, -484, 585,
+    -711, 874, -1093, 1407, -1904, 2828, -5241, 30449,
+    8044, -3514, 2212, -1585, 1210, -957, 774, -634,
+    524, -434, 360, -298, 246, -203, 166, -134,
+    108, -86, 68, -53, 41, -31, 23, -17,
+    12, -8, 6, -4, 2, -1, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 7, -10, 15,
+    -21, 28, -37, 49, -63, 80, -101, 126,
+    -155, 191, -232, 282, -341, 411, -495, 599,
+    -728, 895, -1119, 1440, -1948, 2891, -5345, 30312,
+    8313, -3616, 2273, -1628, 1242, -983, 795, -651,
+    537, -445, 369, -306, 253, -208, 170, -138,
+    111, -89, 70, -55, 42, -32, 24, -17,
+    12, -8, 6, -4, 2, -1, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 7, -11, 15,
+    -21, 29, -38, 50, -64, 82, -103, 129,
+    -159, 195, -238, 288, -348, 420, -507, 613,
+    -745, 915, -1144, 1473, -1990, 2952, -5446, 30171,
+    8583, -3716, 2334, -1670, 1274, -1008, 815, -668,
+    551, -457, 379, -314, 259, -213, 174, -141,
+    114, -91, 72, -56, 43, -33, 24, -18,
+    13, -9, 6, -4, 2, -1, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 7, -11, 16,
+    -22, 29, -39, 51, -66, 84, -105, 131,
+    -163, 199, -243, 295, -356, 429, -518, 626,
+    -761, 935, -1169, 1504, -2033, 3012, -5544, 30027,
+    8854, -3817, 2394, -1712, 1306, -1033, 835, -684,
+    565, -468, 388, -321, 266, -218, 179, -145,
+    117, -93, 73, -57, 44, -33, 25, -18,
+    13, -9, 6, -4, 2, -1, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 8, -11, 16,
+    -22, 30, -40, 52, -67, 85, -108, 134,
+    -166, 204, -248, 301, -364, 439, -529, 639,
+    -777, 955, -1194, 1535, -2074, 3071, -5639, 29879,
+    9126, -3916, 2454, -1754, 1337, -1057, 855, -700,
+    578, -479, 397, -329, 272, -224, 183, -148,
+    120, -95, 75, -59, 45, -34, 25, -19,
+    13, -9, 6, -4, 2, -1, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 8, -11, 16,
+    -22, 30, -40, 53, -68, 87, -110, 137,
+    -169, 208, -253, 307, -371, 448, -540, 652,
+    -793, 974, -1217, 1566, -2114, 3127, -5730, 29727,
+    9399, -4015, 2512, -1795, 1368, -1082, 874, -716,
+    591, -490, 406, -336, 278, -229, 187, -152,
+    122, -98, 77, -60, 46, -35, 26, -19,
+    14, -9, 6, -4, 2, -1, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 8, -12, 16,
+    -23, 31, -41, 54, -70, 89, -112, 140,
+    -173, 212, -258, 313, -378, 456, -550, 665,
+    -808, 993, -1241, 1595, -2153, 3183, -5819, 29572,
+    9673, -4113, 2570, -1835, 1398, -1105, 893, -732,
+    604, -500, 415, -344, 284, -234, 191, -155,
+    125, -100, 79, -61, 47, -36, 27, -19,
+    14, -10, 6, -4, 3, -1, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 8, -12, 17,
+    -23, 32, -42, 55, -71, 90, -114, 142,
+    -176, 216, -263, 319, -385, 465, -560, 677,
+    -823, 1011, -1264, 1624, -2191, 3236, -5904, 29413,
+    9948, -4210, 2628, -1875, 1428, -1129, 912, -747,
+    617, -511, 424, -351, 290, -239, 195, -158,
+    128, -102, 80, -63, 48, -37, 27, -20,
+    14, -10, 7, -4, 3, -1, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 8, -12, 17,
+    -24, 32, -43, 56, -72, 92, -116, 145,
+    -179, 219, -268, 325, -392, 473, -570, 689,
+    -838, 1029, -1286, 1652, -2228, 3289, -5987, 29251,
+    10224, -4306, 2684, -1914, 1458, -1152, 931, -762,
+    629, -521, 432, -358, 296, -243, 199, -162,
+    130, -104, 82, -64, 49, -37, 28, -20,
+    14, -10, 7, -4, 3, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 3, -6, 8, -12, 17,
+    -24, 33, -44, 57, -74, 94, -118, 147,
+    -182, 223, -272, 330, -399, 481, -580, 701,
+    -852, 1047, -1307, 1680, -2264, 3339, -6066, 29086,
+    10500, -4401, 2740, -1953, 1487, -1175, 949, -777,
+    641, -531, 441, -365, 302, -248, 203, -165,
+    133, -106, 84, -65, 50, -38, 28, -21,
+    15, -10, 7, -4, 3, -2, 1, 0
+  },
+  {
+    0, 1, -2, 3, -6, 8, -12, 18,
+    -24, 33, -44, 58, -75, 95, -120, 150,
+    -185, 227, -277, 336, -405, 489, -590, 713,
+    -866, 1064, -1328, 1706, -2299, 3388, -6142, 28917,
+    10777, -4495, 2795, -1991, 1515, -1197, 967, -792,
+    653, -541, 449, -372, 307, -253, 207, -168,
+    135, -108, 85, -67, 51, -39, 29, -21,
+    15, -10, 7, -4, 3, -2, 1, 0
+  },
+  {
+    0, 1, -2, 4, -6, 9, -13, 18,
+    -25, 34, -45, 59, -76, 97, -122, 152,
+    -188, 230, -281, 341, -412, 497, -599, 724,
+    -880, 1080, -1349, 1732, -2333, 3436, -6215, 28745,
+    11055, -4588, 2849, -2028, 1543, -1219, 985, -806,
+    665, -551, 457, -379, 313, -257, 211, -171,
+    138, -110, 87, -68, 52, -40, 29, -21,
+    15, -11, 7, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -2, 4, -6, 9, -13, 18,
+    -25, 34, -45, 60, -77, 98, -123, 154,
+    -191, 234, -285, 346, -418, 504, -608, 735,
+    -893, 1096, -1369, 1757, -2366, 3482, -6285, 28569,
+    11333, -4680, 2903, -2065, 1571, -1241, 1002, -820,
+    677, -561, 465, -385, 318, -262, 214, -174,
+    140, -112, 88, -69, 53, -40, 30, -22,
+    16, -11, 7, -5, 3, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -6, 9, -13, 18,
+    -26, 35, -46, 60, -78, 99, -125, 156,
+    -193, 237, -289, 351, -424, 511, -617, 745,
+    -906, 1112, -1388, 1782, -2398, 3526, -6351, 28391,
+    11611, -4770, 2955, -2101, 1598, -1262, 1019, -834,
+    688, -570, 473, -392, 324, -266, 218, -177,
+    143, -114, 90, -70, 54, -41, 30, -22,
+    16, -11, 7, -5, 3, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -6, 9, -13, 19,
+    -26, 35, -47, 61, -79, 101, -127, 158,
+    -196, 240, -293, 356, -430, 519, -625, 756,
+    -918, 1127, -1407, 1806, -2429, 3568, -6415, 28209,
+    11890, -4860, 3007, -2137, 1625, -1282, 1035, -848,
+    699, -579, 481, -398, 329, -271, 221, -180,
+    145, -116, 91, -71, 55, -42, 31, -23,
+    16, -11, 8, -5, 3, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -6, 9, -13, 19,
+    -26, 35, -47, 62, -80, 102, -129, 160,
+    -198, 244, -297, 360, -436, 525, -633, 766,
+    -930, 1142, -1425, 1828, -2459, 3609, -6475, 28024,
+    12170, -4949, 3057, -2172, 1650, -1303, 1052, -861,
+    710, -588, 488, -404, 334, -275, 225, -183,
+    147, -118, 93, -72, 56, -42, 32, -23,
+    16, -11, 8, -5, 3, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -6, 9, -13, 19,
+    -26, 36, -48, 63, -81, 103, -130, 162,
+    -201, 247, -301, 365, -441, 532, -641, 775,
+    -942, 1156, -1443, 1850, -2487, 3649, -6533, 27835,
+    12450, -5036, 3107, -2206, 1676, -1322, 1068, -874,
+    721, -597, 495, -410, 339, -279, 228, -186,
+    149, -119, 94, -74, 57, -43, 32, -23,
+    17, -12, 8, -5, 3, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -6, 9, -14, 19,
+    -27, 36, -48, 63, -82, 104, -132, 164,
+    -203, 250, -304, 369, -446, 538, -649, 784,
+    -953, 1170, -1460, 1872, -2515, 3687, -6587, 27644,
+    12730, -5122, 3156, -2239, 1701, -1342, 1083, -886,
+    731, -606, 502, -416, 344, -283, 232, -188,
+    152, -121, 96, -75, 58, -44, 33, -24,
+    17, -12, 8, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -2, 4, -6, 9, -14, 20,
+    -27, 37, -49, 64, -83, 106, -133, 166,
+    -206, 252, -308, 374, -451, 545, -657, 794,
+    -964, 1183, -1476, 1892, -2542, 3723, -6639, 27450,
+    13010, -5206, 3204, -2272, 1725, -1361, 1098, -899,
+    741, -614, 509, -422, 349, -287, 235, -191,
+    154, -123, 97, -76, 58, -44, 33, -24,
+    17, -12, 8, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -2, 4, -6, 9, -14, 20,
+    -27, 37, -49, 65, -84, 107, -135, 168,
+    -208, 255, -311, 378, -456, 550, -664, 802,
+    -974, 1196, -1492, 1912, -2567, 3757, -6687, 27252,
+    13290, -5289, 3251, -2304, 1749, -1379, 1113, -911,
+    751, -622, 516, -428, 353, -291, 238, -193,
+    156, -124, 98, -77, 59, -45, 33, -24,
+    17, -12, 8, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -2, 4, -6, 9, -14, 20,
+    -28, 37, -50, 65, -85, 108, -136, 170,
+    -210, 258, -314, 382, -461, 556, -671, 810,
+    -985, 1208, -1507, 1931, -2592, 3790, -6732, 27052,
+    13571, -5371, 3296, -2335, 1772, -1397, 1127, -922,
+    761, -630, 523, -433, 358, -295, 241, -196,
+    158, -126, 100, -78, 60, -45, 34, -25,
+    18, -12, 8, -5, 3, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -6, 10, -14, 20,
+    -28, 38, -50, 66, -85, 109, -137, 171,
+    -212, 260, -318, 385, -466, 562, -677, 818,
+    -994, 1220, -1521, 1949, -2615, 3821, -6774, 26849,
+    13851, -5451, 3341, -2365, 1794, -1414, 1141, -934,
+    770, -638, 529, -439, 362, -298, 244, -198,
+    160, -128, 101, -79, 61, -46, 34, -25,
+    18, -12, 8, -5, 3, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -6, 10, -14, 20,
+    -28, 38, -51, 67, -86, 110, -139, 173,
+    -214, 263, -320, 389, -470, 567, -684, 826,
+    -1003, 1231, -1535, 1966, -2637, 3851, -6814, 26643,
+    14132, -5530, 3385, -2395, 1816, -1431, 1155, -945,
+    779, -645, 535, -444, 367, -302, 247, -201,
+    162, -129, 102, -80, 61, -47, 35, -25,
+    18, -13, 8, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -2, 4, -6, 10, -14, 20,
+    -28, 38, -51, 67, -87, 111, -140, 174,
+    -216, 265, -323, 392, -474, 572, -690, 833,
+    -1012, 1242, -1548, 1983, -2658, 3879, -6850, 26434,
+    14413, -5607, 3427, -2423, 1837, -1448, 1168, -955,
+    788, -653, 541, -449, 371, -305, 250, -203,
+    164, -131, 103, -81, 62, -47, 35, -26,
+    18, -13, 9, -6, 3, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -6, 10, -14, 20,
+    -28, 39, -52, 68, -88, 112, -141, 176,
+    -218, 267, -326, 396, -478, 577, -695, 840,
+    -1021, 1252, -1561, 1998, -2678, 3905, -6883, 26222,
+    14693, -5683, 3469, -2451, 1858, -1464, 1181, -966,
+    796, -660, 547, -453, 375, -308, 252, -205,
+    165, -132, 104, -82, 63, -48, 36, -26,
+    19, -13, 9, -6, 3, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -6, 10, -14, 21,
+    -29, 39, -52, 68, -88, 113, -142, 177,
+    -219, 269, -329, 399, -482, 581, -701, 847,
+    -1029, 1262, -1573, 2013, -2697, 3930, -6913, 26008,
+    14973, -5757, 3509, -2478, 1877, -1479, 1193, -976,
+    805, -667, 553, -458, 379, -312, 255, -207,
+    167, -134, 105, -82, 63, -48, 36, -26,
+    19, -13, 9, -6, 3, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -6, 10, -15, 21,
+    -29, 39, -52, 69, -89, 113, -143, 179,
+    -221, 271, -331, 402, -486, 586, -706, 853,
+    -1036, 1271, -1584, 2027, -2715, 3953, -6941, 25791,
+    15253, -5830, 3548, -2504, 1897, -1494, 1205, -985,
+    813, -673, 558, -463, 382, -315, 258, -209,
+    169, -135, 107, -83, 64, -49, 36, -27,
+    19, -13, 9, -6, 3, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 21,
+    -29, 39, -53, 69, -89, 114, -144, 180,
+    -222, 273, -333, 404, -489, 590, -711, 859,
+    -1043, 1280, -1594, 2040, -2731, 3974, -6965, 25571,
+    15533, -5901, 3586, -2530, 1915, -1508, 1216, -995,
+    820, -679, 563, -467, 386, -318, 260, -211,
+    170, -136, 108, -84, 65, -49, 37, -27,
+    19, -13, 9, -6, 4, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 21,
+    -29, 40, -53, 70, -90, 115, -145, 181,
+    -224, 275, -335, 407, -492, 594, -716, 865,
+    -1050, 1288, -1604, 2053, -2747, 3994, -6987, 25349,
+    15812, -5970, 3623, -2554, 1933, -1522, 1227, -1003,
+    827, -685, 568, -471, 389, -321, 262, -213,
+    172, -137, 109, -85, 65, -50, 37, -27,
+    19, -14, 9, -6, 4, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 21,
+    -29, 40, -53, 70, -91, 115, -146, 182,
+    -225, 277, -337, 410, -495, 597, -720, 870,
+    -1057, 1295, -1614, 2064, -2761, 4012, -7005, 25124,
+    16091, -6037, 3659, -2577, 1950, -1535, 1237, -1012,
+    834, -691, 573, -475, 393, -323, 265, -215,
+    173, -139, 110, -86, 66, -50, 37, -27,
+    20, -14, 9, -6, 4, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 21,
+    -30, 40, -54, 70, -91, 116, -146, 183,
+    -226, 278, -339, 412, -498, 601, -724, 875,
+    -1062, 1302, -1622, 2075, -2775, 4028, -7021, 24897,
+    16369, -6102, 3693, -2600, 1967, -1548, 1248, -1020,
+    841, -697, 578, -479, 396, -326, 267, -217,
+    175, -140, 110, -86, 67, -51, 38, -28,
+    20, -14, 9, -6, 4, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 21,
+    -30, 40, -54, 71, -91, 117, -147, 184,
+    -228, 280, -341, 414, -500, 604, -728, 880,
+    -1068, 1309, -1630, 2085, -2787, 4043, -7034, 24667,
+    16647, -6166, 3726, -2622, 1982, -1560, 1257, -1028,
+    848, -702, 582, -483, 399, -328, 269, -218,
+    176, -141, 111, -87, 67, -51, 38, -28,
+    20, -14, 9, -6, 4, -2, 1, 0
+  },
+  {
+    0, 1, -2, 4, -7, 10, -15, 21,
+    -30, 41, -54, 71, -92, 117, -148, 185,
+    -229, 281, -343, 416, -503, 607, -731, 884,
+    -1073, 1315, -1638, 2094, -2798, 4056, -7044, 24435,
+    16924, -6228, 3758, -2642, 1997, -1572, 1266, -1035,
+    854, -707, 586, -486, 402, -331, 271, -220,
+    178, -142, 112, -88, 68, -51, 38, -28,
+    20, -14, 9, -6, 4, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 21,
+    -30, 41, -54, 71, -92, 118, -148, 185,
+    -230, 282, -344, 418, -505, 609, -735, 888,
+    -1078, 1321, -1645, 2102, -2808, 4067, -7052, 24201,
+    17201, -6287, 3788, -2662, 2012, -1582, 1275, -1042,
+    859, -712, 590, -489, 404, -333, 273, -222,
+    179, -143, 113, -88, 68, -52, 39, -28,
+    20, -14, 10, -6, 4, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -54, 71, -92, 118, -149, 186,
+    -231, 283, -346, 419, -507, 612, -738, 891,
+    -1082, 1326, -1651, 2109, -2816, 4077, -7056, 23964,
+    17476, -6345, 3818, -2681, 2025, -1593, 1283, -1049,
+    865, -716, 594, -492, 407, -335, 274, -223,
+    180, -144, 114, -89, 69, -52, 39, -28,
+    20, -14, 10, -6, 4, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -55, 72, -93, 118, -150, 187,
+    -231, 284, -347, 421, -509, 614, -740, 894,
+    -1086, 1330, -1656, 2116, -2824, 4085, -7058, 23726,
+    17751, -6401, 3845, -2699, 2038, -1603, 1291, -1055,
+    870, -720, 598, -495, 409, -337, 276, -224,
+    181, -145, 114, -89, 69, -52, 39, -29,
+    21, -14, 10, -6, 4, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -55, 72, -93, 119, -150, 187,
+    -232, 285, -348, 422, -510, 616, -742, 897,
+    -1089, 1334, -1661, 2121, -2830, 4092, -7057, 23485,
+    18025, -6455, 3872, -2716, 2050, -1612, 1298, -1061,
+    875, -724, 601, -498, 412, -339, 278, -226,
+    182, -146, 115, -90, 69, -53, 39, -29,
+    21, -14, 10, -6, 4, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -55, 72, -93, 119, -150, 188,
+    -233, 286, -349, 423, -512, 618, -745, 899,
+    -1092, 1338, -1665, 2126, -2836, 4097, -7053, 23242,
+    18299, -6507, 3897, -2732, 2062, -1620, 1305, -1067,
+    879, -728, 604, -501, 414, -341, 279, -227,
+    183, -146, 116, -91, 70, -53, 40, -29,
+    21, -15, 10, -6, 4, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -55, 72, -93, 119, -151, 188,
+    -233, 286, -349, 424, -513, 619, -746, 901,
+    -1094, 1341, -1668, 2130, -2840, 4100, -7047, 22997,
+    18571, -6556, 3921, -2747, 2072, -1628, 1311, -1072,
+    883, -732, 607, -503, 416, -342, 280, -228,
+    184, -147, 116, -91, 70, -53, 40, -29,
+    21, -15, 10, -6, 4, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -55, 72, -94, 120, -151, 189,
+    -234, 287, -350, 425, -514, 620, -748, 903,
+    -1096, 1343, -1671, 2133, -2843, 4102, -7038, 22750,
+    18842, -6604, 3943, -2761, 2082, -1636, 1317, -1076,
+    887, -735, 609, -505, 418, -344, 282, -229,
+    185, -148, 117, -91, 71, -54, 40, -29,
+    21, -15, 10, -6, 4, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -55, 72, -94, 120, -151, 189,
+    -234, 287, -351, 426, -515, 621, -749, 905,
+    -1098, 1345, -1673, 2136, -2845, 4102, -7026, 22501,
+    19113, -6649, 3964, -2774, 2091, -1643, 1322, -1081,
+    891, -738, 612, -507, 419, -345, 283, -230,
+    185, -148, 117, -92, 71, -54, 40, -29,
+    21, -15, 10, -6, 4, -2, 1, 0
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -55, 72, -94, 120, -151, 189,
+    -234, 288, -351, 426, -516, 622, -750, 906,
+    -1099, 1346, -1675, 2137, -2846, 4101, -7012, 22250,
+    19382, -6692, 3984, -2785, 2099, -1649, 1327, -1084,
+    894, -740, 614, -509, 421, -346, 284, -231,
+    186, -149, 118, -92, 71, -54, 40, -30,
+    21, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -55, 72, -94, 120, -151, 189,
+    -234, 288, -351, 427, -516, 622, -750, 906,
+    -1100, 1347, -1676, 2138, -2846, 4098, -6996, 21997,
+    19649, -6733, 4002, -2796, 2107, -1654, 1331, -1088,
+    897, -742, 616, -510, 422, -348, 285, -232,
+    187, -149, 118, -92, 71, -54, 41, -30,
+    21, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -55, 72, -94, 120, -151, 189,
+    -234, 288, -351, 427, -516, 623, -751, 907,
+    -1100, 1348, -1676, 2138, -2845, 4093, -6976, 21742,
+    19916, -6772, 4019, -2806, 2113, -1659, 1335, -1091,
+    899, -744, 617, -512, 423, -348, 285, -232,
+    187, -150, 119, -93, 72, -54, 41, -30,
+    21, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -55, 72, -94, 120, -151, 189,
+    -234, 288, -351, 427, -516, 623, -751, 907,
+    -1100, 1347, -1675, 2137, -2843, 4087, -6954, 21486,
+    20181, -6808, 4034, -2815, 2119, -1664, 1339, -1093,
+    901, -746, 619, -513, 424, -349, 286, -233,
+    188, -150, 119, -93, 72, -55, 41, -30,
+    21, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -55, 72, -94, 120, -151, 189,
+    -234, 288, -351, 427, -516, 622, -750, 906,
+    -1100, 1347, -1674, 2135, -2839, 4080, -6930, 21228,
+    20445, -6842, 4048, -2823, 2124, -1667, 1341, -1096,
+    903, -748, 620, -514, 425, -350, 287, -233,
+    188, -151, 119, -93, 72, -55, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, 0
+  },
+  {
+    0, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -55, 72, -94, 120, -151, 189,
+    -234, 288, -351, 426, -515, 622, -750, 905,
+    -1099, 1345, -1673, 2132, -2835, 4070, -6903, 20969,
+    20708, -6874, 4060, -2829, 2129, -1670, 1344, -1097,
+    904, -749, 621, -515, 426, -351, 287, -234,
+    189, -151, 119, -93, 72, -55, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, 0
+  },
+  {
+    0, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -55, 72, -93, 119, -151, 189,
+    -234, 287, -351, 426, -515, 621, -749, 904,
+    -1097, 1344, -1670, 2129, -2829, 4060, -6874, 20708,
+    20969, -6903, 4070, -2835, 2132, -1673, 1345, -1099,
+    905, -750, 622, -515, 426, -351, 288, -234,
+    189, -151, 120, -94, 72, -55, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, 0
+  },
+  {
+    0, 1, -2, 4, -7, 10, -15, 22,
+    -30, 41, -55, 72, -93, 119, -151, 188,
+    -233, 287, -350, 425, -514, 620, -748, 903,
+    -1096, 1341, -1667, 2124, -2823, 4048, -6842, 20445,
+    21228, -6930, 4080, -2839, 2135, -1674, 1347, -1100,
+    906, -750, 622, -516, 427, -351, 288, -234,
+    189, -151, 120, -94, 72, -55, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 21,
+    -30, 41, -55, 72, -93, 119, -150, 188,
+    -233, 286, -349, 424, -513, 619, -746, 901,
+    -1093, 1339, -1664, 2119, -2815, 4034, -6808, 20181,
+    21486, -6954, 4087, -2843, 2137, -1675, 1347, -1100,
+    907, -751, 623, -516, 427, -351, 288, -234,
+    189, -151, 120, -94, 72, -55, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 21,
+    -30, 41, -54, 72, -93, 119, -150, 187,
+    -232, 285, -348, 423, -512, 617, -744, 899,
+    -1091, 1335, -1659, 2113, -2806, 4019, -6772, 19916,
+    21742, -6976, 4093, -2845, 2138, -1676, 1348, -1100,
+    907, -751, 623, -516, 427, -351, 288, -234,
+    189, -151, 120, -94, 72, -55, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 21,
+    -30, 41, -54, 71, -92, 118, -149, 187,
+    -232, 285, -348, 422, -510, 616, -742, 897,
+    -1088, 1331, -1654, 2107, -2796, 4002, -6733, 19649,
+    21997, -6996, 4098, -2846, 2138, -1676, 1347, -1100,
+    906, -750, 622, -516, 427, -351, 288, -234,
+    189, -151, 120, -94, 72, -55, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    -1, 1, -2, 4, -7, 10, -15, 21,
+    -30, 40, -54, 71, -92, 118, -149, 186,
+    -231, 284, -346, 421, -509, 614, -740, 894,
+    -1084, 1327, -1649, 2099, -2785, 3984, -6692, 19382,
+    22250, -7012, 4101, -2846, 2137, -1675, 1346, -1099,
+    906, -750, 622, -516, 426, -351, 288, -234,
+    189, -151, 120, -94, 72, -55, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 4, -6, 10, -15, 21,
+    -29, 40, -54, 71, -92, 117, -148, 185,
+    -230, 283, -345, 419, -507, 612, -738, 891,
+    -1081, 1322, -1643, 2091, -2774, 3964, -6649, 19113,
+    22501, -7026, 4102, -2845, 2136, -1673, 1345, -1098,
+    905, -749, 621, -515, 426, -351, 287, -234,
+    189, -151, 120, -94, 72, -55, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 4, -6, 10, -15, 21,
+    -29, 40, -54, 71, -91, 117, -148, 185,
+    -229, 282, -344, 418, -505, 609, -735, 887,
+    -1076, 1317, -1636, 2082, -2761, 3943, -6604, 18842,
+    22750, -7038, 4102, -2843, 2133, -1671, 1343, -1096,
+    903, -748, 620, -514, 425, -350, 287, -234,
+    189, -151, 120, -94, 72, -55, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 4, -6, 10, -15, 21,
+    -29, 40, -53, 70, -91, 116, -147, 184,
+    -228, 280, -342, 416, -503, 607, -732, 883,
+    -1072, 1311, -1628, 2072, -2747, 3921, -6556, 18571,
+    22997, -7047, 4100, -2840, 2130, -1668, 1341, -1094,
+    901, -746, 619, -513, 424, -349, 286, -233,
+    188, -151, 119, -93, 72, -55, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 4, -6, 10, -15, 21,
+    -29, 40, -53, 70, -91, 116, -146, 183,
+    -227, 279, -341, 414, -501, 604, -728, 879,
+    -1067, 1305, -1620, 2062, -2732, 3897, -6507, 18299,
+    23242, -7053, 4097, -2836, 2126, -1665, 1338, -1092,
+    899, -745, 618, -512, 423, -349, 286, -233,
+    188, -150, 119, -93, 72, -55, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 4, -6, 10, -14, 21,
+    -29, 39, -53, 69, -90, 115, -146, 182,
+    -226, 278, -339, 412, -498, 601, -724, 875,
+    -1061, 1298, -1612, 2050, -2716, 3872, -6455, 18025,
+    23485, -7057, 4092, -2830, 2121, -1661, 1334, -1089,
+    897, -742, 616, -510, 422, -348, 285, -232,
+    187, -150, 119, -93, 72, -55, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 4, -6, 10, -14, 21,
+    -29, 39, -52, 69, -89, 114, -145, 181,
+    -224, 276, -337, 409, -495, 598, -720, 870,
+    -1055, 1291, -1603, 2038, -2699, 3845, -6401, 17751,
+    23726, -7058, 4085, -2824, 2116, -1656, 1330, -1086,
+    894, -740, 614, -509, 421, -347, 284, -231,
+    187, -150, 118, -93, 72, -55, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 4, -6, 10, -14, 20,
+    -28, 39, -52, 69, -89, 114, -144, 180,
+    -223, 274, -335, 407, -492, 594, -716, 865,
+    -1049, 1283, -1593, 2025, -2681, 3818, -6345, 17476,
+    23964, -7056, 4077, -2816, 2109, -1651, 1326, -1082,
+    891, -738, 612, -507, 419, -346, 283, -231,
+    186, -149, 118, -92, 71, -54, 41, -30,
+    22, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 4, -6, 10, -14, 20,
+    -28, 39, -52, 68, -88, 113, -143, 179,
+    -222, 273, -333, 404, -489, 590, -712, 859,
+    -1042, 1275, -1582, 2012, -2662, 3788, -6287, 17201,
+    24201, -7052, 4067, -2808, 2102, -1645, 1321, -1078,
+    888, -735, 609, -505, 418, -344, 282, -230,
+    185, -148, 118, -92, 71, -54, 41, -30,
+    21, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 4, -6, 9, -14, 20,
+    -28, 38, -51, 68, -88, 112, -142, 178,
+    -220, 271, -331, 402, -486, 586, -707, 854,
+    -1035, 1266, -1572, 1997, -2642, 3758, -6228, 16924,
+    24435, -7044, 4056, -2798, 2094, -1638, 1315, -1073,
+    884, -731, 607, -503, 416, -343, 281, -229,
+    185, -148, 117, -92, 71, -54, 41, -30,
+    21, -15, 10, -7, 4, -2, 1, 0
+  },
+  {
+    0, 1, -2, 4, -6, 9, -14, 20,
+    -28, 38, -51, 67, -87, 111, -141, 176,
+    -218, 269, -328, 399, -483, 582, -702, 848,
+    -1028, 1257, -1560, 1982, -2622, 3726, -6166, 16647,
+    24667, -7034, 4043, -2787, 2085, -1630, 1309, -1068,
+    880, -728, 604, -500, 414, -341, 280, -228,
+    184, -147, 117, -91, 71, -54, 40, -30,
+    21, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 4, -6, 9, -14, 20,
+    -28, 38, -51, 67, -86, 110, -140, 175,
+    -217, 267, -326, 396, -479, 578, -697, 841,
+    -1020, 1248, -1548, 1967, -2600, 3693, -6102, 16369,
+    24897, -7021, 4028, -2775, 2075, -1622, 1302, -1062,
+    875, -724, 601, -498, 412, -339, 278, -226,
+    183, -146, 116, -91, 70, -54, 40, -30,
+    21, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 4, -6, 9, -14, 20,
+    -27, 37, -50, 66, -86, 110, -139, 173,
+    -215, 265, -323, 393, -475, 573, -691, 834,
+    -1012, 1237, -1535, 1950, -2577, 3659, -6037, 16091,
+    25124, -7005, 4012, -2761, 2064, -1614, 1295, -1057,
+    870, -720, 597, -495, 410, -337, 277, -225,
+    182, -146, 115, -91, 70, -53, 40, -29,
+    21, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 4, -6, 9, -14, 19,
+    -27, 37, -50, 65, -85, 109, -137, 172,
+    -213, 262, -321, 389, -471, 568, -685, 827,
+    -1003, 1227, -1522, 1933, -2554, 3623, -5970, 15812,
+    25349, -6987, 3994, -2747, 2053, -1604, 1288, -1050,
+    865, -716, 594, -492, 407, -335, 275, -224,
+    181, -145, 115, -90, 70, -53, 40, -29,
+    21, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 4, -6, 9, -13, 19,
+    -27, 37, -49, 65, -84, 108, -136, 170,
+    -211, 260, -318, 386, -467, 563, -679, 820,
+    -995, 1216, -1508, 1915, -2530, 3586, -5901, 15533,
+    25571, -6965, 3974, -2731, 2040, -1594, 1280, -1043,
+    859, -711, 590, -489, 404, -333, 273, -222,
+    180, -144, 114, -89, 69, -53, 39, -29,
+    21, -15, 10, -7, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 3, -6, 9, -13, 19,
+    -27, 36, -49, 64, -83, 107, -135, 169,
+    -209, 258, -315, 382, -463, 558, -673, 813,
+    -985, 1205, -1494, 1897, -2504, 3548, -5830, 15253,
+    25791, -6941, 3953, -2715, 2027, -1584, 1271, -1036,
+    853, -706, 586, -486, 402, -331, 271, -221,
+    179, -143, 113, -89, 69, -52, 39, -29,
+    21, -15, 10, -6, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 3, -6, 9, -13, 19,
+    -26, 36, -48, 63, -82, 105, -134, 167,
+    -207, 255, -312, 379, -458, 553, -667, 805,
+    -976, 1193, -1479, 1877, -2478, 3509, -5757, 14973,
+    26008, -6913, 3930, -2697, 2013, -1573, 1262, -1029,
+    847, -701, 581, -482, 399, -329, 269, -219,
+    177, -142, 113, -88, 68, -52, 39, -29,
+    21, -14, 10, -6, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 3, -6, 9, -13, 19,
+    -26, 36, -48, 63, -82, 104, -132, 165,
+    -205, 252, -308, 375, -453, 547, -660, 796,
+    -966, 1181, -1464, 1858, -2451, 3469, -5683, 14693,
+    26222, -6883, 3905, -2678, 1998, -1561, 1252, -1021,
+    840, -695, 577, -478, 396, -326, 267, -218,
+    176, -141, 112, -88, 68, -52, 39, -28,
+    20, -14, 10, -6, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 3, -6, 9, -13, 18,
+    -26, 35, -47, 62, -81, 103, -131, 164,
+    -203, 250, -305, 371, -449, 541, -653, 788,
+    -955, 1168, -1448, 1837, -2423, 3427, -5607, 14413,
+    26434, -6850, 3879, -2658, 1983, -1548, 1242, -1012,
+    833, -690, 572, -474, 392, -323, 265, -216,
+    174, -140, 111, -87, 67, -51, 38, -28,
+    20, -14, 10, -6, 4, -2, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 8, -13, 18,
+    -25, 35, -47, 61, -80, 102, -129, 162,
+    -201, 247, -302, 367, -444, 535, -645, 779,
+    -945, 1155, -1431, 1816, -2395, 3385, -5530, 14132,
+    26643, -6814, 3851, -2637, 1966, -1535, 1231, -1003,
+    826, -684, 567, -470, 389, -320, 263, -214,
+    173, -139, 110, -86, 67, -51, 38, -28,
+    20, -14, 10, -6, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 3, -5, 8, -12, 18,
+    -25, 34, -46, 61, -79, 101, -128, 160,
+    -198, 244, -298, 362, -439, 529, -638, 770,
+    -934, 1141, -1414, 1794, -2365, 3341, -5451, 13851,
+    26849, -6774, 3821, -2615, 1949, -1521, 1220, -994,
+    818, -677, 562, -466, 385, -318, 260, -212,
+    171, -137, 109, -85, 66, -50, 38, -28,
+    20, -14, 10, -6, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 3, -5, 8, -12, 18,
+    -25, 34, -45, 60, -78, 100, -126, 158,
+    -196, 241, -295, 358, -433, 523, -630, 761,
+    -922, 1127, -1397, 1772, -2335, 3296, -5371, 13571,
+    27052, -6732, 3790, -2592, 1931, -1507, 1208, -985,
+    810, -671, 556, -461, 382, -314, 258, -210,
+    170, -136, 108, -85, 65, -50, 37, -28,
+    20, -14, 9, -6, 4, -2, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 8, -12, 17,
+    -24, 33, -45, 59, -77, 98, -124, 156,
+    -193, 238, -291, 353, -428, 516, -622, 751,
+    -911, 1113, -1379, 1749, -2304, 3251, -5289, 13290,
+    27252, -6687, 3757, -2567, 1912, -1492, 1196, -974,
+    802, -664, 550, -456, 378, -311, 255, -208,
+    168, -135, 107, -84, 65, -49, 37, -27,
+    20, -14, 9, -6, 4, -2, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 8, -12, 17,
+    -24, 33, -44, 58, -76, 97, -123, 154,
+    -191, 235, -287, 349, -422, 509, -614, 741,
+    -899, 1098, -1361, 1725, -2272, 3204, -5206, 13010,
+    27450, -6639, 3723, -2542, 1892, -1476, 1183, -964,
+    794, -657, 545, -451, 374, -308, 252, -206,
+    166, -133, 106, -83, 64, -49, 37, -27,
+    20, -14, 9, -6, 4, -2, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 8, -12, 17,
+    -24, 33, -44, 58, -75, 96, -121, 152,
+    -188, 232, -283, 344, -416, 502, -606, 731,
+    -886, 1083, -1342, 1701, -2239, 3156, -5122, 12730,
+    27644, -6587, 3687, -2515, 1872, -1460, 1170, -953,
+    784, -649, 538, -446, 369, -304, 250, -203,
+    164, -132, 104, -82, 63, -48, 36, -27,
+    19, -14, 9, -6, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 3, -5, 8, -12, 17,
+    -23, 32, -43, 57, -74, 94, -119, 149,
+    -186, 228, -279, 339, -410, 495, -597, 721,
+    -874, 1068, -1322, 1676, -2206, 3107, -5036, 12450,
+    27835, -6533, 3649, -2487, 1850, -1443, 1156, -942,
+    775, -641, 532, -441, 365, -301, 247, -201,
+    162, -130, 103, -81, 63, -48, 36, -26,
+    19, -13, 9, -6, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 3, -5, 8, -11, 16,
+    -23, 32, -42, 56, -72, 93, -118, 147,
+    -183, 225, -275, 334, -404, 488, -588, 710,
+    -861, 1052, -1303, 1650, -2172, 3057, -4949, 12170,
+    28024, -6475, 3609, -2459, 1828, -1425, 1142, -930,
+    766, -633, 525, -436, 360, -297, 244, -198,
+    160, -129, 102, -80, 62, -47, 35, -26,
+    19, -13, 9, -6, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 3, -5, 8, -11, 16,
+    -23, 31, -42, 55, -71, 91, -116, 145,
+    -180, 221, -271, 329, -398, 481, -579, 699,
+    -848, 1035, -1282, 1625, -2137, 3007, -4860, 11890,
+    28209, -6415, 3568, -2429, 1806, -1407, 1127, -918,
+    756, -625, 519, -430, 356, -293, 240, -196,
+    158, -127, 101, -79, 61, -47, 35, -26,
+    19, -13, 9, -6, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 3, -5, 7, -11, 16,
+    -22, 30, -41, 54, -70, 90, -114, 143,
+    -177, 218, -266, 324, -392, 473, -570, 688,
+    -834, 1019, -1262, 1598, -2101, 2955, -4770, 11611,
+    28391, -6351, 3526, -2398, 1782, -1388, 1112, -906,
+    745, -617, 511, -424, 351, -289, 237, -193,
+    156, -125, 99, -78, 60, -46, 35, -26,
+    18, -13, 9, -6, 4, -2, 1, -1
+  },
+  {
+    0, 1, -2, 3, -5, 7, -11, 16,
+    -22, 30, -40, 53, -69, 88, -112, 140,
+    -174, 214, -262, 318, -385, 465, -561, 677,
+    -820, 1002, -1241, 1571, -2065, 2903, -4680, 11333,
+    28569, -6285, 3482, -2366, 1757, -1369, 1096, -893,
+    735, -608, 504, -418, 346, -285, 234, -191,
+    154, -123, 98, -77, 60, -45, 34, -25,
+    18, -13, 9, -6, 4, -2, 1, 0
+  },
+  {
+    0, 1, -2, 3, -5, 7, -11, 15,
+    -21, 29, -40, 52, -68, 87, -110, 138,
+    -171, 211, -257, 313, -379, 457, -551, 665,
+    -806, 985, -1219, 1543, -2028, 2849, -4588, 11055,
+    28745, -6215, 3436, -2333, 1732, -1349, 1080, -880,
+    724, -599, 497, -412, 341, -281, 230, -188,
+    152, -122, 97, -76, 59, -45, 34, -25,
+    18, -13, 9, -6, 4, -2, 1, 0
+  },
+  {
+    0, 1, -2, 3, -4, 7, -10, 15,
+    -21, 29, -39, 51, -67, 85, -108, 135,
+    -168, 207, -253, 307, -372, 449, -541, 653,
+    -792, 967, -1197, 1515, -1991, 2795, -4495, 10777,
+    28917, -6142, 3388, -2299, 1706, -1328, 1064, -866,
+    713, -590, 489, -405, 336, -277, 227, -185,
+    150, -120, 95, -75, 58, -44, 33, -24,
+    18, -12, 8, -6, 3, -2, 1, 0
+  },
+  {
+    0, 1, -2, 3, -4, 7, -10, 15,
+    -21, 28, -38, 50, -65, 84, -106, 133,
+    -165, 203, -248, 302, -365, 441, -531, 641,
+    -777, 949, -1175, 1487, -1953, 2740, -4401, 10500,
+    29086, -6066, 3339, -2264, 1680, -1307, 1047, -852,
+    701, -580, 481, -399, 330, -272, 223, -182,
+    147, -118, 94, -74, 57, -44, 33, -24,
+    17, -12, 8, -6, 3, -2, 1, -1
+  },
+  {
+    0, 1, -2, 3, -4, 7, -10, 14,
+    -20, 28, -37, 49, -64, 82, -104, 130,
+    -162, 199, -243, 296, -358, 432, -521, 629,
+    -762, 931, -1152, 1458, -1914, 2684, -4306, 10224,
+    29251, -5987, 3289, -2228, 1652, -1286, 1029, -838,
+    689, -570, 473, -392, 325, -268, 219, -179,
+    145, -116, 92, -72, 56, -43, 32, -24,
+    17, -12, 8, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -1, 3, -4, 7, -10, 14,
+    -20, 27, -37, 48, -63, 80, -102, 128,
+    -158, 195, -239, 290, -351, 424, -511, 617,
+    -747, 912, -1129, 1428, -1875, 2628, -4210, 9948,
+    29413, -5904, 3236, -2191, 1624, -1264, 1011, -823,
+    677, -560, 465, -385, 319, -263, 216, -176,
+    142, -114, 90, -71, 55, -42, 32, -23,
+    17, -12, 8, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -1, 3, -4, 6, -10, 14,
+    -19, 27, -36, 47, -61, 79, -100, 125,
+    -155, 191, -234, 284, -344, 415, -500, 604,
+    -732, 893, -1105, 1398, -1835, 2570, -4113, 9673,
+    29572, -5819, 3183, -2153, 1595, -1241, 993, -808,
+    665, -550, 456, -378, 313, -258, 212, -173,
+    140, -112, 89, -70, 54, -41, 31, -23,
+    16, -12, 8, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -1, 2, -4, 6, -9, 14,
+    -19, 26, -35, 46, -60, 77, -98, 122,
+    -152, 187, -229, 278, -336, 406, -490, 591,
+    -716, 874, -1082, 1368, -1795, 2512, -4015, 9399,
+    29727, -5730, 3127, -2114, 1566, -1217, 974, -793,
+    652, -540, 448, -371, 307, -253, 208, -169,
+    137, -110, 87, -68, 53, -40, 30, -22,
+    16, -11, 8, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -1, 2, -4, 6, -9, 13,
+    -19, 25, -34, 45, -59, 75, -95, 120,
+    -148, 183, -224, 272, -329, 397, -479, 578,
+    -700, 855, -1057, 1337, -1754, 2454, -3916, 9126,
+    29879, -5639, 3071, -2074, 1535, -1194, 955, -777,
+    639, -529, 439, -364, 301, -248, 204, -166,
+    134, -108, 85, -67, 52, -40, 30, -22,
+    16, -11, 8, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -1, 2, -4, 6, -9, 13,
+    -18, 25, -33, 44, -57, 73, -93, 117,
+    -145, 179, -218, 266, -321, 388, -468, 565,
+    -684, 835, -1033, 1306, -1712, 2394, -3817, 8854,
+    30027, -5544, 3012, -2033, 1504, -1169, 935, -761,
+    626, -518, 429, -356, 295, -243, 199, -163,
+    131, -105, 84, -66, 51, -39, 29, -22,
+    16, -11, 7, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -1, 2, -4, 6, -9, 13,
+    -18, 24, -33, 43, -56, 72, -91, 114,
+    -141, 174, -213, 259, -314, 379, -457, 551,
+    -668, 815, -1008, 1274, -1670, 2334, -3716, 8583,
+    30171, -5446, 2952, -1990, 1473, -1144, 915, -745,
+    613, -507, 420, -348, 288, -238, 195, -159,
+    129, -103, 82, -64, 50, -38, 29, -21,
+    15, -11, 7, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -1, 2, -4, 6, -8, 12,
+    -17, 24, -32, 42, -55, 70, -89, 111,
+    -138, 170, -208, 253, -306, 369, -445, 537,
+    -651, 795, -983, 1242, -1628, 2273, -3616, 8313,
+    30312, -5345, 2891, -1948, 1440, -1119, 895, -728,
+    599, -495, 411, -341, 282, -232, 191, -155,
+    126, -101, 80, -63, 49, -37, 28, -21,
+    15, -10, 7, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -1, 2, -4, 6, -8, 12,
+    -17, 23, -31, 41, -53, 68, -86, 108,
+    -134, 166, -203, 246, -298, 360, -434, 524,
+    -634, 774, -957, 1210, -1585, 2212, -3514, 8044,
+    30449, -5241, 2828, -1904, 1407, -1093, 874, -711,
+    585, -484, 401, -333, 275, -227, 186, -152,
+    123, -99, 78, -61, 48, -36, 27, -20,
+    15, -10, 7, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -1, 2, -3, 5, -8, 12,
+    -16, 22, -30, 40, -52, 66, -84, 105,
+    -131, 161, -197, 240, -290, 350, -422, 510,
+    -617, 753, -931, 1177, -1541, 2150, -3412, 7776,
+    30583, -5133, 2764, -1859, 1373, -1067, 853, -694,
+    571, -472, 391, -325, 269, -221, 182, -148,
+    120, -96, 76, -60, 46, -36, 27, -20,
+    14, -10, 7, -5, 3, -2, 1, 0
+  },
+  {
+    0, 1, -1, 2, -3, 5, -8, 11,
+    -16, 22, -29, 39, -50, 64, -82, 102,
+    -127, 157, -192, 233, -282, 340, -411, 495,
+    -600, 732, -905, 1144, -1497, 2088, -3309, 7510,
+    30713, -5023, 2698, -1813, 1339, -1040, 831, -676,
+    556, -460, 381, -316, 262, -216, 177, -144,
+    117, -94, 74, -58, 45, -35, 26, -19,
+    14, -10, 7, -4, 3, -2, 1, 0
+  },
+  {
+    0, 1, -1, 2, -3, 5, -8, 11,
+    -15, 21, -28, 37, -49, 63, -79, 99,
+    -123, 152, -186, 226, -274, 331, -399, 481,
+    -583, 711, -879, 1110, -1453, 2025, -3206, 7245,
+    30839, -4909, 2631, -1766, 1304, -1012, 809, -658,
+    541, -448, 371, -308, 255, -210, 172, -141,
+    114, -91, 72, -57, 44, -34, 25, -19,
+    14, -10, 7, -4, 3, -2, 1, 0
+  },
+  {
+    0, 0, -1, 2, -3, 5, -7, 11,
+    -15, 20, -28, 36, -47, 61, -77, 96,
+    -120, 147, -180, 219, -266, 321, -387, 467,
+    -565, 690, -852, 1076, -1408, 1962, -3102, 6980,
+    30961, -4793, 2562, -1719, 1269, -985, 787, -640,
+    526, -435, 361, -299, 248, -204, 168, -137,
+    111, -89, 70, -55, 43, -33, 25, -18,
+    13, -9, 6, -4, 3, -2, 1, 0
+  },
+  {
+    0, 1, -1, 2, -3, 5, -7, 10,
+    -14, 20, -27, 35, -46, 59, -74, 93,
+    -116, 143, -175, 213, -257, 311, -374, 452,
+    -547, 668, -826, 1042, -1363, 1898, -2997, 6718,
+    31079, -4673, 2492, -1671, 1232, -956, 764, -621,
+    511, -423, 350, -291, 240, -198, 163, -133,
+    107, -86, 68, -54, 42, -32, 24, -18,
+    13, -9, 6, -4, 3, -2, 1, 0
+  },
+  {
+    0, 1, -1, 2, -3, 5, -7, 10,
+    -14, 19, -26, 34, -44, 57, -72, 90,
+    -112, 138, -169, 206, -249, 300, -362, 437,
+    -529, 646, -798, 1008, -1318, 1834, -2893, 6457,
+    31194, -4550, 2421, -1621, 1196, -927, 741, -603,
+    495, -410, 340, -282, 233, -192, 158, -129,
+    104, -84, 66, -52, 40, -31, 23, -17,
+    12, -9, 6, -4, 2, -1, 1, 0
+  },
+  {
+    0, 0, -1, 2, -3, 4, -7, 10,
+    -13, 18, -25, 33, -43, 55, -69, 87,
+    -108, 133, -163, 199, -240, 290, -350, 422,
+    -511, 624, -771, 973, -1272, 1769, -2788, 6197,
+    31305, -4424, 2348, -1571, 1158, -898, 717, -583,
+    480, -397, 329, -273, 226, -186, 153, -125,
+    101, -81, 64, -51, 39, -30, 23, -17,
+    12, -8, 6, -4, 2, -1, 1, 0
+  },
+  {
+    0, 0, -1, 2, -3, 4, -6, 9,
+    -13, 18, -24, 32, -41, 53, -67, 84,
+    -104, 129, -158, 191, -232, 280, -338, 407,
+    -493, 602, -743, 938, -1226, 1704, -2682, 5939,
+    31412, -4295, 2274, -1520, 1120, -869, 694, -564,
+    464, -384, 318, -264, 218, -180, 148, -121,
+    97, -78, 62, -49, 38, -29, 22, -16,
+    12, -8, 6, -4, 2, -1, 1, 0
+  },
+  {
+    0, 0, -1, 2, -3, 4, -6, 9,
+    -12, 17, -23, 30, -40, 51, -64, 81,
+    -101, 124, -152, 184, -223, 269, -325, 392,
+    -475, 579, -716, 903, -1180, 1639, -2576, 5682,
+    31515, -4162, 2199, -1469, 1082, -838, 670, -544,
+    447, -370, 307, -254, 211, -174, 143, -116,
+    94, -76, 60, -47, 37, -28, 21, -16,
+    11, -8, 5, -4, 2, -1, 1, 0
+  },
+  {
+    0, 0, -1, 2, -3, 4, -6, 8,
+    -12, 16, -22, 29, -38, 49, -62, 78,
+    -97, 119, -146, 177, -215, 259, -312, 377,
+    -456, 557, -688, 867, -1133, 1573, -2470, 5427,
+    31614, -4027, 2122, -1416, 1042, -808, 645, -524,
+    431, -356, 296, -245, 203, -167, 137, -112,
+    91, -73, 58, -45, 35, -27, 20, -15,
+    11, -8, 5, -3, 2, -1, 1, 0
+  },
+  {
+    0, 0, -1, 1, -2, 4, -6, 8,
+    -11, 16, -21, 28, -36, 47, -59, 75,
+    -93, 114, -140, 170, -206, 248, -300, 361,
+    -438, 534, -659, 832, -1086, 1508, -2364, 5173,
+    31709, -3889, 2044, -1363, 1003, -777, 620, -504,
+    414, -343, 284, -236, 195, -161, 132, -108,
+    87, -70, 56, -44, 34, -26, 20, -14,
+    10, -7, 5, -3, 2, -1, 1, 0
+  },
+  {
+    0, 0, -1, 1, -2, 3, -5, 8,
+    -11, 15, -20, 27, -35, 45, -57, 71,
+    -89, 109, -134, 163, -197, 238, -287, 346,
+    -419, 511, -631, 796, -1039, 1441, -2258, 4921,
+    31800, -3747, 1965, -1309, 963, -746, 595, -484,
+    398, -329, 273, -226, 187, -154, 127, -103,
+    84, -67, 53, -42, 32, -25, 19, -14,
+    10, -7, 5, -3, 2, -1, 1, 0
+  },
+  {
+    0, 0, -1, 1, -2, 3, -5, 7,
+    -10, 14, -19, 26, -33, 43, -54, 68,
+    -85, 104, -128, 155, -188, 227, -274, 330,
+    -400, 488, -603, 760, -991, 1375, -2151, 4671,
+    31887, -3603, 1884, -1254, 922, -714, 570, -463,
+    381, -315, 261, -216, 179, -148, 121, -99,
+    80, -64, 51, -40, 31, -24, 18, -13,
+    10, -7, 5, -3, 2, -1, 1, 0
+  },
+  {
+    0, 0, -1, 1, -2, 3, -5, 7,
+    -10, 14, -18, 24, -32, 41, -52, 65,
+    -81, 99, -122, 148, -179, 216, -261, 315,
+    -381, 465, -574, 723, -944, 1308, -2045, 4423,
+    31970, -3455, 1802, -1199, 881, -682, 544, -442,
+    364, -300, 249, -207, 171, -141, 116, -94,
+    77, -61, 49, -38, 30, -23, 17, -13,
+    9, -6, 5, -3, 2, -1, 1, 0
+  },
+  {
+    0, 0, -1, 1, -2, 3, -5, 7,
+    -9, 13, -17, 23, -30, 39, -49, 62,
+    -77, 94, -115, 141, -170, 206, -248, 299,
+    -362, 441, -545, 687, -896, 1241, -1938, 4177,
+    32049, -3305, 1719, -1142, 839, -650, 518, -421,
+    346, -286, 237, -197, 163, -134, 110, -90,
+    73, -58, 47, -37, 28, -22, 16, -12,
+    9, -6, 4, -3, 2, -1, 1, 0
+  },
+  {
+    0, 0, -1, 1, -2, 3, -4, 6,
+    -9, 12, -16, 22, -28, 37, -46, 58,
+    -72, 89, -109, 133, -161, 195, -235, 283,
+    -343, 418, -516, 650, -848, 1174, -1831, 3932,
+    32124, -3151, 1635, -1086, 797, -617, 492, -400,
+    329, -272, 225, -187, 155, -128, 105, -85,
+    69, -55, 44, -35, 27, -21, 16, -11,
+    8, -6, 4, -3, 2, -1, 1, 0
+  },
+  {
+    0, 0, -1, 1, -2, 3, -4, 6,
+    -8, 12, -16, 21, -27, 35, -44, 55,
+    -68, 84, -103, 126, -152, 184, -221, 267,
+    -323, 394, -487, 614, -800, 1107, -1724, 3690,
+    32195, -2995, 1550, -1028, 754, -584, 466, -378,
+    311, -257, 213, -177, 146, -121, 99, -81,
+    65, -53, 42, -33, 25, -20, 15, -11,
+    8, -6, 4, -3, 2, -1, 1, 0
+  },
+  {
+    0, 0, -1, 1, -2, 3, -4, 6,
+    -8, 11, -15, 19, -25, 32, -41, 52,
+    -64, 79, -97, 118, -143, 173, -208, 251,
+    -304, 371, -458, 577, -752, 1040, -1618, 3449,
+    32262, -2835, 1464, -970, 711, -550, 439, -357,
+    293, -242, 201, -167, 138, -114, 93, -76,
+    62, -50, 39, -31, 24, -18, 14, -10,
+    7, -5, 4, -2, 2, -1, 0, 0
+  },
+  {
+    0, 0, 0, 1, -1, 2, -4, 5,
+    -7, 10, -14, 18, -24, 30, -39, 48,
+    -60, 74, -91, 111, -134, 162, -195, 235,
+    -285, 347, -428, 540, -703, 972, -1511, 3211,
+    32325, -2673, 1376, -911, 668, -517, 412, -335,
+    275, -227, 188, -156, 129, -107, 88, -71,
+    58, -46, 37, -29, 23, -17, 13, -10,
+    7, -5, 3, -2, 1, -1, 1, 0
+  },
+  {
+    0, 0, 0, 1, -1, 2, -3, 5,
+    -7, 9, -13, 17, -22, 28, -36, 45,
+    -56, 69, -85, 103, -125, 151, -182, 219,
+    -265, 323, -399, 503, -655, 905, -1405, 2974,
+    32384, -2508, 1288, -852, 624, -483, 385, -312,
+    257, -212, 176, -146, 121, -100, 82, -67,
+    54, -43, 35, -27, 21, -16, 12, -9,
+    7, -5, 3, -2, 1, -1, 0, 0
+  },
+  {
+    0, 0, 0, 1, -1, 2, -3, 5,
+    -6, 9, -12, 16, -20, 26, -33, 42,
+    -52, 64, -78, 95, -116, 140, -168, 203,
+    -246, 300, -370, 465, -606, 837, -1299, 2739,
+    32438, -2339, 1198, -792, 580, -448, 357, -290,
+    238, -197, 163, -136, 112, -93, 76, -62,
+    50, -40, 32, -25, 20, -15, 11, -8,
+    6, -4, 3, -2, 1, -1, 0, 0
+  },
+  {
+    0, 0, 0, 1, -1, 2, -3, 4,
+    -6, 8, -11, 14, -19, 24, -31, 38,
+    -48, 59, -72, 88, -106, 128, -155, 187,
+    -226, 276, -340, 428, -557, 770, -1193, 2507,
+    32489, -2168, 1107, -731, 535, -414, 330, -268,
+    220, -182, 151, -125, 104, -85, 70, -57,
+    46, -37, 30, -23, 18, -14, 10, -8,
+    6, -4, 3, -2, 1, -1, 0, 0
+  },
+  {
+    0, 0, 0, 1, -1, 2, -3, 4,
+    -5, 7, -10, 13, -17, 22, -28, 35,
+    -44, 54, -66, 80, -97, 117, -141, 171,
+    -207, 252, -311, 391, -509, 702, -1087, 2277,
+    32535, -1994, 1016, -670, 490, -379, 302, -245,
+    201, -166, 138, -114, 95, -78, 64, -52,
+    42, -34, 27, -21, 17, -13, 10, -7,
+    5, -4, 2, -2, 1, -1, 0, 0
+  },
+  {
+    0, 0, 0, 1, -1, 1, -2, 3,
+    -5, 7, -9, 12, -16, 20, -25, 32,
+    -40, 49, -60, 72, -88, 106, -128, 154,
+    -187, 228, -281, 354, -460, 635, -981, 2049,
+    32577, -1817, 923, -608, 445, -344, 274, -222,
+    183, -151, 125, -104, 86, -71, 58, -48,
+    38, -31, 25, -19, 15, -12, 9, -6,
+    5, -3, 2, -2, 1, -1, 0, 0
+  },
+  {
+    0, 0, 0, 1, -1, 1, -2, 3,
+    -4, 6, -8, 11, -14, 18, -23, 28,
+    -35, 44, -53, 65, -79, 95, -115, 138,
+    -167, 204, -251, 316, -411, 567, -876, 1823,
+    32615, -1638, 829, -546, 399, -308, 246, -199,
+    164, -135, 112, -93, 77, -64, 52, -43,
+    34, -28, 22, -17, 13, -10, 8, -6,
+    4, -3, 2, -1, 1, -1, 0, 0
+  },
+  {
+    0, 0, 0, 0, -1, 1, -2, 3,
+    -4, 5, -7, 9, -12, 16, -20, 25,
+    -31, 38, -47, 57, -69, 84, -101, 122,
+    -148, 180, -222, 279, -363, 500, -771, 1600,
+    32648, -1455, 735, -483, 353, -273, 217, -176,
+    145, -120, 99, -82, 68, -56, 46, -38,
+    31, -25, 19, -15, 12, -9, 7, -5,
+    4, -3, 2, -1, 1, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, -1, 1, -2, 2,
+    -3, 4, -6, 8, -11, 14, -17, 22,
+    -27, 33, -41, 50, -60, 73, -88, 106,
+    -128, 156, -192, 242, -314, 433, -667, 1378,
+    32678, -1270, 639, -420, 307, -237, 189, -153,
+    126, -104, 86, -72, 59, -49, 40, -33,
+    26, -21, 17, -13, 10, -8, 6, -4,
+    3, -2, 2, -1, 1, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, -1, 1, -1, 2,
+    -3, 4, -5, 7, -9, 12, -15, 18,
+    -23, 28, -34, 42, -51, 61, -74, 89,
+    -108, 132, -162, 204, -265, 366, -563, 1160,
+    32703, -1082, 543, -357, 260, -201, 160, -130,
+    107, -88, 73, -61, 50, -41, 34, -28,
+    23, -18, 14, -11, 9, -7, 5, -4,
+    3, -2, 1, -1, 1, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, 0, 1, -1, 2,
+    -2, 3, -4, 6, -7, 9, -12, 15,
+    -19, 23, -28, 34, -42, 50, -60, 73,
+    -88, 108, -133, 167, -217, 299, -459, 943,
+    32724, -891, 446, -293, 214, -165, 131, -106,
+    87, -72, 60, -50, 41, -34, 28, -23,
+    18, -15, 12, -9, 7, -5, 4, -3,
+    2, -2, 1, -1, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, 0, 1, -1, 1,
+    -2, 2, -3, 4, -6, 7, -9, 12,
+    -15, 18, -22, 27, -32, 39, -47, 57,
+    -69, 84, -103, 130, -169, 232, -356, 729,
+    32741, -698, 348, -228, 166, -128, 102, -83,
+    68, -56, 47, -39, 32, -26, 22, -18,
+    14, -12, 9, -7, 6, -4, 3, -2,
+    2, -1, 1, -1, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, 0, 0, -1, 1,
+    -1, 2, -2, 3, -4, 5, -7, 8,
+    -10, 13, -16, 19, -23, 28, -34, 40,
+    -49, 60, -74, 93, -120, 165, -254, 518,
+    32754, -502, 250, -163, 119, -92, 73, -59,
+    49, -40, 33, -28, 23, -19, 16, -13,
+    10, -8, 7, -5, 4, -3, 2, -2,
+    1, -1, 1, 0, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 1,
+    -1, 1, -1, 2, -2, 3, -4, 5,
+    -6, 8, -9, 11, -14, 17, -20, 24,
+    -29, 36, -44, 55, -72, 99, -152, 309,
+    32762, -303, 150, -98, 72, -55, 44, -36,
+    29, -24, 20, -17, 14, -11, 9, -8,
+    6, -5, 4, -3, 2, -2, 1, -1,
+    1, -1, 0, 0, 0, 0, 0, 0
+  },
+  {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, -1, 1, -1, 2,
+    -2, 3, -3, 4, -5, 6, -7, 8,
+    -10, 12, -15, 18, -24, 33, -50, 102,
+    32767, -102, 50, -33, 24, -18, 15, -12,
+    10, -8, 7, -6, 5, -4, 3, -3,
+    2, -2, 1, -1, 1, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0
+  }
+};
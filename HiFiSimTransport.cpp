@@ -0,0 +1,149 @@
+/*
+  HiFiSimTransport.cpp
+
+  Software HiFi transport.  See HiFiSimTransport.h.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "HiFi.h"
+#include "HiFiSimTransport.h"
+
+HiFiSimTransport::HiFiSimTransport() :
+  _txData(0),
+  _rxData(0),
+  _txChannels(0),
+  _rxChannels(0),
+  _txEnabled(false),
+  _rxEnabled(false),
+  _source(NULL),
+  _sourceCount(0),
+  _sourcePos(0),
+  _repeat(true),
+  _loopback(false),
+  _capture(NULL),
+  _captureCount(0),
+  _captured(0),
+  _frames(0)
+{
+  _lastTx[0] = 0;
+  _lastTx[1] = 0;
+}
+
+void HiFiSimTransport::begin()
+{
+  _txData = 0;
+  _rxData = 0;
+  _txEnabled = false;
+  _rxEnabled = false;
+  _sourcePos = 0;
+  _captured = 0;
+  _lastTx[0] = 0;
+  _lastTx[1] = 0;
+  _frames = 0;
+}
+
+// Like the SSC, mono modes have a single slot per frame (reported as
+// channel 1) whichever side of the frame clock it is on.  The clock mode
+// and word length don't change anything here.
+void HiFiSimTransport::configureTx(HiFiAudioMode_t audioMode,
+                                   HiFiClockMode_t /* clkMode */,
+                                   uint8_t /* bitsPerChannel */)
+{
+  _txChannels = (audioMode == HIFI_AUDIO_MODE_STEREO) ? 2 : 1;
+}
+
+void HiFiSimTransport::enableTx(bool enable)
+{
+  _txEnabled = enable;
+}
+
+void HiFiSimTransport::configureRx(HiFiAudioMode_t audioMode,
+                                   HiFiClockMode_t /* clkMode */,
+                                   uint8_t /* bitsPerChannel */)
+{
+  _rxChannels = (audioMode == HIFI_AUDIO_MODE_STEREO) ? 2 : 1;
+}
+
+void HiFiSimTransport::enableRx(bool enable)
+{
+  _rxEnabled = enable;
+}
+
+void HiFiSimTransport::setRxSource(const uint32_t *words, uint32_t count,
+                                   bool repeat)
+{
+  _source = words;
+  _sourceCount = count;
+  _sourcePos = 0;
+  _repeat = repeat;
+}
+
+void HiFiSimTransport::setTxCapture(uint32_t *words, uint32_t count)
+{
+  _capture = words;
+  _captureCount = count;
+  _captured = 0;
+}
+
+void HiFiSimTransport::run(uint32_t frames)
+{
+  if (!_owner)
+  {
+    return;
+  }
+
+  for (uint32_t f = 0; f < frames; f++)
+  {
+    if (_rxEnabled)
+    {
+      for (uint8_t ch = 0; ch < _rxChannels; ch++)
+      {
+        if (_loopback)
+        {
+          _rxData = _lastTx[ch];
+        }
+        else if (_sourcePos < _sourceCount)
+        {
+          _rxData = _source[_sourcePos++];
+          if (_repeat && _sourcePos == _sourceCount)
+          {
+            _sourcePos = 0;
+          }
+        }
+        else
+        {
+          _rxData = 0;
+        }
+        _owner->rxReady((HiFiChannelID_t)ch);
+      }
+    }
+
+    if (_txEnabled)
+    {
+      for (uint8_t ch = 0; ch < _txChannels; ch++)
+      {
+        _owner->txReady((HiFiChannelID_t)ch);
+        _lastTx[ch] = _txData;
+        if (_captured < _captureCount)
+        {
+          _capture[_captured++] = _txData;
+        }
+      }
+    }
+
+    _frames++;
+  }
+}
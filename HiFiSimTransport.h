@@ -0,0 +1,101 @@
+/*
+  HiFiSimTransport.h
+
+  A HiFi transport with no hardware behind it.  The "data registers" are
+  plain variables and run() plays the part of the interrupt, raising the
+  receive and transmit events for a number of frames in the same order
+  the SSC would.  Receive words come from a buffer (or from what was
+  transmitted, in loopback), transmit words are captured into a buffer.
+
+  It builds on a PC as well as on the Due, so the same callbacks a sketch
+  uses with the SSC can be exercised against known input on the host, or
+  run side by side with the real engine (e.g. one simulated frame per SSC
+  frame) to compare two versions of a processing chain.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_SIM_TRANSPORT_H
+#define HIFI_SIM_TRANSPORT_H
+
+#include "HiFiTransport.h"
+
+class HiFiSimTransport : public HiFiTransport {
+public:
+  HiFiSimTransport();
+
+  void begin();
+
+  void configureTx(HiFiAudioMode_t audioMode,
+                   HiFiClockMode_t clkMode,
+                   uint8_t bitsPerChannel);
+  void enableTx(bool enable);
+
+  void configureRx(HiFiAudioMode_t audioMode,
+                   HiFiClockMode_t clkMode,
+                   uint8_t bitsPerChannel);
+  void enableRx(bool enable);
+
+  uint32_t *getTxDataRegister() { return &_txData; }
+  uint32_t *getRxDataRegister() { return &_rxData; }
+
+  // Nothing is pending outside of run().
+  void service() { };
+
+  // A blocked readFrames()/writeFrames() moves the simulation on a frame.
+  void idle() { run(1); }
+
+  // Interleaved words fed to the receiver.  With 'repeat' the buffer is
+  // played round and round, otherwise zeros follow the last word.
+  void setRxSource(const uint32_t *words, uint32_t count, bool repeat = true);
+
+  // Receive the words transmitted in the previous frame instead.
+  void setLoopback(bool enable) { _loopback = enable; }
+
+  // Interleaved words written by the transmit callback are stored here
+  // until 'count' is reached.
+  void setTxCapture(uint32_t *words, uint32_t count);
+  uint32_t getTxCaptured() const { return _captured; }
+
+  // Raise the events for 'frames' frames: every receive slot of a frame,
+  // then every transmit slot.
+  void run(uint32_t frames);
+
+  uint32_t getFrameCount() const { return _frames; }
+
+private:
+  uint32_t _txData;
+  uint32_t _rxData;
+
+  uint8_t _txChannels;
+  uint8_t _rxChannels;
+  bool _txEnabled;
+  bool _rxEnabled;
+
+  const uint32_t *_source;
+  uint32_t _sourceCount;
+  uint32_t _sourcePos;
+  bool _repeat;
+  bool _loopback;
+  uint32_t _lastTx[2];
+
+  uint32_t *_capture;
+  uint32_t _captureCount;
+  uint32_t _captured;
+
+  uint32_t _frames;
+};
+
+#endif
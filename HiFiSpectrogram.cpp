@@ -0,0 +1,278 @@
+/*
+  HiFiSpectrogram.cpp
+
+  Short-time spectrum frames and their packet encoding.  See
+  HiFiSpectrogram.h for the stream format.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "HiFiSpectrogram.h"
+
+// A full scale sine through the Hann window and the scaled FFT lands in
+// its bin at 1/4 of full scale, i.e. a power of 2^58 in Q31 units.
+#define HIFI_SPECTROGRAM_0DBFS_LOG2   58
+
+// 10 * log10(2) in Q16
+#define HIFI_DB_PER_LOG2_Q16          197283
+
+#define HIFI_SPECTROGRAM_INFO_EVERY   32
+
+HiFiSpectrogram::HiFiSpectrogram() :
+  _size(0),
+  _hop(0),
+  _bands(0),
+  _sampleRate(0),
+  _floorDb(-120),
+  _ceilingDb(0),
+  _levelScale(0),
+  _ring(NULL),
+  _ringMask(0),
+  _written(0),
+  _nextFrame(0),
+  _dropped(0),
+  _sequence(0),
+  _work(NULL)
+{
+  memset(_levels, 0, sizeof(_levels));
+}
+
+bool HiFiSpectrogram::begin(uint8_t log2Size, uint16_t hop, uint8_t bands,
+                            uint32_t sampleRate)
+{
+  end();
+
+  if (!_fft.begin(log2Size))
+  {
+    return false;
+  }
+
+  _size = _fft.getSize();
+  _hop = hop ? hop : _size;
+  _sampleRate = sampleRate;
+
+  _bands = bands;
+  if (_bands > HIFI_SPECTROGRAM_MAX_BANDS)
+  {
+    _bands = HIFI_SPECTROGRAM_MAX_BANDS;
+  }
+  if (_bands > _size / 2)
+  {
+    _bands = _size / 2;
+  }
+
+  // Room for one frame, the hop that makes the next one due and another
+  // hop of new samples arriving while it is being computed.
+  uint32_t ringSize = 1;
+  while (ringSize < (uint32_t)_size + 2 * _hop)
+  {
+    ringSize <<= 1;
+  }
+  _ringMask = ringSize - 1;
+
+  _ring = (int16_t *)malloc(sizeof(int16_t) * ringSize);
+  _work = (int32_t *)malloc(sizeof(int32_t) * _size);
+  if (!_ring || !_work)
+  {
+    end();
+    return false;
+  }
+  memset(_ring, 0, sizeof(int16_t) * ringSize);
+
+  _written = 0;
+  _nextFrame = _size;
+  _dropped = 0;
+  _sequence = 0;
+  setRange(_floorDb, _ceilingDb);
+
+  hifi_cycle_counter_enable();
+  return true;
+}
+
+void HiFiSpectrogram::end()
+{
+  free(_ring);
+  free(_work);
+  _ring = NULL;
+  _work = NULL;
+}
+
+void HiFiSpectrogram::setRange(int16_t floorDb, int16_t ceilingDb)
+{
+  if (ceilingDb <= floorDb)
+  {
+    ceilingDb = floorDb + 1;
+  }
+  _floorDb = floorDb;
+  _ceilingDb = ceilingDb;
+
+  // Levels per dB, Q16
+  _levelScale = (255L << 16) / (ceilingDb - floorDb);
+}
+
+void HiFiSpectrogram::write(const int32_t *buf, uint16_t frames, uint8_t stride)
+{
+  uint32_t written = _written;
+
+  for (uint16_t i = 0; i < frames; i++)
+  {
+    _ring[written & _ringMask] = (int16_t)(*buf >> 16);
+    buf += stride;
+    written++;
+  }
+  _written = written;
+}
+
+size_t HiFiSpectrogram::update(uint8_t *packet)
+{
+  uint32_t written = _written;
+  size_t length = 0;
+
+  if (!_ring || (int32_t)(written - _nextFrame) < 0)
+  {
+    return 0;
+  }
+
+  // If the samples for the due frame have already been overwritten, skip
+  // forward to the most recent frame that is still intact.
+  uint32_t lag = written - _nextFrame;
+  if (lag > (uint32_t)(_ringMask + 1) - _size)
+  {
+    uint32_t skip = (lag + _hop - 1) / _hop;
+    _nextFrame += skip * _hop;
+    _dropped += skip;
+    if ((int32_t)(written - _nextFrame) < 0)
+    {
+      _nextFrame -= _hop;
+      _dropped--;
+    }
+  }
+
+  _meter.start();
+  computeFrame(_nextFrame);
+  _nextFrame += _hop;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Encode
+  ///////////////////////////////////////////////////////////////////////////
+  if ((_sequence % HIFI_SPECTROGRAM_INFO_EVERY) == 0)
+  {
+    uint8_t info[HIFI_SPECTROGRAM_INFO_BYTES];
+
+    info[0] = _sampleRate;
+    info[1] = _sampleRate >> 8;
+    info[2] = _sampleRate >> 16;
+    info[3] = _sampleRate >> 24;
+    info[4] = _size;
+    info[5] = _size >> 8;
+    info[6] = _hop;
+    info[7] = _hop >> 8;
+    info[8] = _bands;
+    info[9] = _floorDb;
+    info[10] = _floorDb >> 8;
+    info[11] = _ceilingDb;
+    info[12] = _ceilingDb >> 8;
+    length += encode(packet, HIFI_SPECTROGRAM_PACKET_INFO, info, sizeof(info));
+  }
+
+  uint8_t frame[1 + HIFI_SPECTROGRAM_MAX_BANDS];
+  frame[0] = _sequence++;
+  memcpy(frame + 1, _levels, _bands);
+  length += encode(packet + length, HIFI_SPECTROGRAM_PACKET_FRAME,
+                   frame, 1 + _bands);
+
+  _meter.stop();
+  return length;
+}
+
+void HiFiSpectrogram::computeFrame(uint32_t end)
+{
+  uint32_t start = end - _size;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Window (Hann, from the FFT's own cosine table) and transform
+  ///////////////////////////////////////////////////////////////////////////
+  for (uint16_t n = 0; n < _size; n++)
+  {
+    int32_t x = (int32_t)_ring[(start + n) & _ringMask] * 65536;
+    int32_t w = (int32_t)(((int64_t)0x7FFFFFFF - HiFiFft::cosine(n, _size)) >> 1);
+    _work[n] = hifi_mul_q31(x, w);
+  }
+  _fft.forwardReal(_work, true);
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Group bins 1 .. N/2 into bands (peak power per band) and map each to
+  /// 8 bits on a dB scale.
+  ///////////////////////////////////////////////////////////////////////////
+  uint16_t bins = _size / 2;
+  int32_t floorQ16 = (int32_t)_floorDb * 65536;
+
+  for (uint8_t b = 0; b < _bands; b++)
+  {
+    uint16_t first = 1 + ((uint32_t)b * bins) / _bands;
+    uint16_t last = 1 + ((uint32_t)(b + 1) * bins) / _bands;
+    uint64_t peak = 0;
+
+    for (uint16_t k = first; k < last; k++)
+    {
+      uint64_t power;
+
+      if (k == bins)
+      {
+        // Nyquist is packed into the DC slot
+        power = (uint64_t)((int64_t)_work[1] * _work[1]);
+      }
+      else
+      {
+        power = (uint64_t)((int64_t)_work[2 * k] * _work[2 * k]) +
+                (uint64_t)((int64_t)_work[2 * k + 1] * _work[2 * k + 1]);
+      }
+      if (power > peak)
+      {
+        peak = power;
+      }
+    }
+
+    int32_t level = 0;
+    if (peak)
+    {
+      int32_t lg = hifi_log2_q16_u64(peak) - (HIFI_SPECTROGRAM_0DBFS_LOG2 << 16);
+      int32_t db = (int32_t)(((int64_t)lg * HIFI_DB_PER_LOG2_Q16) >> 16);
+      level = (int32_t)(((int64_t)(db - floorQ16) * _levelScale) >> 32);
+    }
+    _levels[b] = (level < 0) ? 0 : ((level > 255) ? 255 : level);
+  }
+}
+
+size_t HiFiSpectrogram::encode(uint8_t *packet, uint8_t type,
+                               const uint8_t *payload, uint8_t length)
+{
+  uint8_t sum = type + length;
+
+  packet[0] = HIFI_SPECTROGRAM_SYNC_1;
+  packet[1] = HIFI_SPECTROGRAM_SYNC_2;
+  packet[2] = type;
+  packet[3] = length;
+  for (uint8_t i = 0; i < length; i++)
+  {
+    packet[4 + i] = payload[i];
+    sum += payload[i];
+  }
+  packet[4 + length] = sum;
+
+  return 5 + length;
+}
@@ -0,0 +1,125 @@
+/*
+  HiFiSpectrogram.h
+
+  Live spectrum frames for streaming to a host.
+
+  Samples from one channel are copied into a small ring from the audio
+  path (cheap enough for a callback or a block loop), and loop() turns them
+  into short-time FFT frames: Hann window, power spectrum, bins grouped
+  into a fixed number of bands and each band quantised to an 8 bit log
+  scale between two dBFS limits.
+
+  Each frame goes out as a small packet, so a 64 band display at ~47
+  frames per second (1024 point FFT, 1024 sample hop at 48kHz) needs about
+  3.3K bytes/s instead of the 192K bytes/s of the raw stereo audio.  The
+  packet layout is:
+
+    0xA5 0x5A  sync
+    type       'I' (stream info) or 'F' (frame)
+    length     number of payload bytes
+    payload
+    checksum   8 bit sum of type, length and payload
+
+  An info packet (sample rate, FFT size, hop, band count and dB range) is
+  sent before the first frame and then every 32 frames so a viewer can
+  join a stream at any time.  extras/spectrogram has a viewer for Linux.
+
+  update() computes at most one frame per call, so the cost in loop() is
+  bounded at one FFT regardless of how far behind the sketch gets.  Frames
+  that can't be computed in time are skipped and counted.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_SPECTROGRAM_H
+#define HIFI_SPECTROGRAM_H
+
+#include <stddef.h>
+#include "HiFiDsp.h"
+#include "HiFiFft.h"
+
+#define HIFI_SPECTROGRAM_MAX_BANDS      128
+
+#define HIFI_SPECTROGRAM_SYNC_1         0xA5
+#define HIFI_SPECTROGRAM_SYNC_2         0x5A
+#define HIFI_SPECTROGRAM_PACKET_INFO    'I'
+#define HIFI_SPECTROGRAM_PACKET_FRAME   'F'
+#define HIFI_SPECTROGRAM_INFO_BYTES     13
+
+// Worst case output of one update(): an info packet plus a frame packet.
+#define HIFI_SPECTROGRAM_MAX_PACKET     (5 + HIFI_SPECTROGRAM_INFO_BYTES + \
+                                         5 + 1 + HIFI_SPECTROGRAM_MAX_BANDS)
+
+class HiFiSpectrogram {
+public:
+  HiFiSpectrogram();
+
+  // FFT size is 2^log2Size, a frame is produced every 'hop' samples.
+  bool begin(uint8_t log2Size, uint16_t hop, uint8_t bands,
+             uint32_t sampleRate);
+  void end();
+
+  // Levels at or below floorDb map to 0, at or above ceilingDb to 255.
+  void setRange(int16_t floorDb, int16_t ceilingDb);
+
+  // Add samples.  Safe to call from the audio interrupt while update()
+  // runs in loop().
+  void write(const int32_t *buf, uint16_t frames, uint8_t stride = 1);
+  void write(int32_t sample)
+  {
+    _ring[_written & _ringMask] = (int16_t)(sample >> 16);
+    _written++;
+  }
+
+  // Compute the next frame if one is due and encode it into 'packet'
+  // (at least HIFI_SPECTROGRAM_MAX_PACKET bytes).  Returns the number of
+  // bytes to send, 0 if there was nothing to do.
+  size_t update(uint8_t *packet);
+
+  // Band levels of the most recent frame.
+  const uint8_t *getBands() const { return _levels; }
+  uint8_t getBandCount() const { return _bands; }
+  uint32_t getDroppedFrames() const { return _dropped; }
+
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  void computeFrame(uint32_t end);
+  size_t encode(uint8_t *packet, uint8_t type, const uint8_t *payload,
+                uint8_t length);
+
+  HiFiFft _fft;
+  uint16_t _size;
+  uint16_t _hop;
+  uint8_t _bands;
+  uint32_t _sampleRate;
+  int16_t _floorDb;
+  int16_t _ceilingDb;
+  int32_t _levelScale;
+
+  int16_t *_ring;
+  uint32_t _ringMask;
+  volatile uint32_t _written;
+  uint32_t _nextFrame;
+  uint32_t _dropped;
+  uint8_t _sequence;
+
+  int32_t *_work;
+  uint8_t _levels[HIFI_SPECTROGRAM_MAX_BANDS];
+
+  HiFiCycleMeter _meter;
+};
+
+#endif
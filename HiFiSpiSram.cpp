@@ -0,0 +1,233 @@
+/*
+  HiFiSpiSram.cpp
+
+  23LC1024 SPI SRAM driver.  See HiFiSpiSram.h.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "HiFiSpiSram.h"
+
+#if defined(ARDUINO_ARCH_SAM)
+
+#include "Arduino.h"
+#include <SPI.h>
+
+// 23LC1024 instructions
+#define SRAM_READ             0x03
+#define SRAM_WRITE            0x02
+#define SRAM_WRMR             0x01
+#define SRAM_MODE_SEQUENTIAL  0x40
+
+// SPI0 DMA handshaking interfaces
+#define SPI0_TX_HANDSHAKE     1
+#define SPI0_RX_HANDSHAKE     2
+
+// SPI.begin() sets SPI0 up on NPCS3 (pin 78, not brought out), so that is
+// the chip select register used here, with the real chip selects on GPIO.
+#define SRAM_NPCS             3
+#define SRAM_SCBR             5
+
+// Largest single DMA transfer (BTSIZE is 12 bits)
+#define SRAM_MAX_DMA          4095
+
+HiFiSpiSram::HiFiSpiSram() :
+  _chips(0),
+  _chip(0),
+  _write(false),
+  _savedMode(0),
+  _savedCsr(0)
+{
+}
+
+bool HiFiSpiSram::begin(const uint8_t *csPins, uint8_t chips)
+{
+  if (chips == 0 || chips > HIFI_SPI_SRAM_MAX_CHIPS)
+  {
+    return false;
+  }
+
+  _chips = chips;
+  _boundary = HIFI_SPI_SRAM_CHIP_SIZE;
+  _maxTransfer = SRAM_MAX_DMA;
+
+  for (uint8_t i = 0; i < chips; i++)
+  {
+    _csPins[i] = csPins[i];
+    pinMode(_csPins[i], OUTPUT);
+    digitalWrite(_csPins[i], HIGH);
+  }
+
+  SPI.begin();
+
+  // Leave the controller alone if it is already running (e.g. for
+  // HiFiDma), other channels may be busy.
+  pmc_enable_periph_clk(ID_DMAC);
+  if (!(DMAC->DMAC_EN & DMAC_EN_ENABLE))
+  {
+    DMAC->DMAC_GCFG = DMAC_GCFG_ARB_CFG_FIXED;
+    DMAC->DMAC_EN = DMAC_EN_ENABLE;
+  }
+
+  // Sequential mode lets a transfer run on through the whole chip.  It is
+  // the power on default, but a chip that was reset mid-transfer may not
+  // be in it.
+  saveSpi();
+  for (uint8_t i = 0; i < chips; i++)
+  {
+    select(i, true);
+    transferByte(SRAM_WRMR);
+    transferByte(SRAM_MODE_SEQUENTIAL);
+    select(i, false);
+  }
+  restoreSpi();
+
+  return true;
+}
+
+void HiFiSpiSram::select(uint8_t chip, bool selected)
+{
+  const PinDescription &pin = g_APinDescription[_csPins[chip]];
+
+  if (selected)
+  {
+    pin.pPort->PIO_CODR = pin.ulPin;
+  }
+  else
+  {
+    pin.pPort->PIO_SODR = pin.ulPin;
+  }
+}
+
+uint8_t HiFiSpiSram::transferByte(uint8_t value)
+{
+  SPI0->SPI_TDR = value;
+  while ((SPI0->SPI_SR & SPI_SR_RDRF) == 0);
+  return SPI0->SPI_RDR;
+}
+
+void HiFiSpiSram::saveSpi()
+{
+  _savedMode = SPI0->SPI_MR;
+  _savedCsr = SPI0->SPI_CSR[SRAM_NPCS];
+
+  // Fixed peripheral select so that DMA byte writes to TDR go to NPCS3,
+  // mode 0, 8 bits.
+  SPI0->SPI_MR = SPI_MR_MSTR | SPI_MR_MODFDIS |
+                 SPI_MR_PCS(~(1 << SRAM_NPCS) & 0x0F);
+  SPI0->SPI_CSR[SRAM_NPCS] = SPI_CSR_NCPHA | SPI_CSR_BITS_8_BIT |
+                             SPI_CSR_SCBR(SRAM_SCBR);
+
+  // Drop anything left over in the receiver.
+  (void)SPI0->SPI_RDR;
+  (void)SPI0->SPI_SR;
+}
+
+void HiFiSpiSram::restoreSpi()
+{
+  SPI0->SPI_MR = _savedMode;
+  SPI0->SPI_CSR[SRAM_NPCS] = _savedCsr;
+}
+
+void HiFiSpiSram::startTransfer(bool write, uint32_t address, uint8_t *data,
+                                uint16_t bytes)
+{
+  static uint8_t dummy = 0xFF;
+
+  _write = write;
+  _chip = address / HIFI_SPI_SRAM_CHIP_SIZE;
+  address %= HIFI_SPI_SRAM_CHIP_SIZE;
+
+  saveSpi();
+  select(_chip, true);
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Header by hand
+  ///////////////////////////////////////////////////////////////////////////
+  transferByte(write ? SRAM_WRITE : SRAM_READ);
+  transferByte(address >> 16);
+  transferByte(address >> 8);
+  transferByte(address);
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Data by DMA.  A read needs the transmitter clocking out dummy bytes
+  /// while the receive channel collects; a write ignores the receiver.
+  ///////////////////////////////////////////////////////////////////////////
+  DMAC->DMAC_CHDR = (DMAC_CHDR_DIS0 << HIFI_SPI_SRAM_TX_CHANNEL) |
+                    (DMAC_CHDR_DIS0 << HIFI_SPI_SRAM_RX_CHANNEL);
+  (void)DMAC->DMAC_EBCISR;
+
+  if (!write)
+  {
+    DmacCh_num *rx = &DMAC->DMAC_CH_NUM[HIFI_SPI_SRAM_RX_CHANNEL];
+
+    rx->DMAC_SADDR = (uint32_t)&SPI0->SPI_RDR;
+    rx->DMAC_DADDR = (uint32_t)data;
+    rx->DMAC_DSCR = 0;
+    rx->DMAC_CTRLA = bytes | DMAC_CTRLA_SRC_WIDTH_BYTE |
+                     DMAC_CTRLA_DST_WIDTH_BYTE;
+    rx->DMAC_CTRLB = DMAC_CTRLB_SRC_DSCR | DMAC_CTRLB_DST_DSCR |
+                     DMAC_CTRLB_FC_PER2MEM_DMA_FC |
+                     DMAC_CTRLB_SRC_INCR_FIXED |
+                     DMAC_CTRLB_DST_INCR_INCREMENTING;
+    rx->DMAC_CFG = DMAC_CFG_SRC_PER(SPI0_RX_HANDSHAKE) | DMAC_CFG_SRC_H2SEL |
+                   DMAC_CFG_SOD | DMAC_CFG_FIFOCFG_ASAP_CFG;
+    DMAC->DMAC_CHER = DMAC_CHER_ENA0 << HIFI_SPI_SRAM_RX_CHANNEL;
+  }
+
+  DmacCh_num *tx = &DMAC->DMAC_CH_NUM[HIFI_SPI_SRAM_TX_CHANNEL];
+
+  tx->DMAC_SADDR = write ? (uint32_t)data : (uint32_t)&dummy;
+  tx->DMAC_DADDR = (uint32_t)&SPI0->SPI_TDR;
+  tx->DMAC_DSCR = 0;
+  tx->DMAC_CTRLA = bytes | DMAC_CTRLA_SRC_WIDTH_BYTE |
+                   DMAC_CTRLA_DST_WIDTH_BYTE;
+  tx->DMAC_CTRLB = DMAC_CTRLB_SRC_DSCR | DMAC_CTRLB_DST_DSCR |
+                   DMAC_CTRLB_FC_MEM2PER_DMA_FC |
+                   (write ? DMAC_CTRLB_SRC_INCR_INCREMENTING :
+                            DMAC_CTRLB_SRC_INCR_FIXED) |
+                   DMAC_CTRLB_DST_INCR_FIXED;
+  tx->DMAC_CFG = DMAC_CFG_DST_PER(SPI0_TX_HANDSHAKE) | DMAC_CFG_DST_H2SEL |
+                 DMAC_CFG_SOD | DMAC_CFG_FIFOCFG_ALAP_CFG;
+  DMAC->DMAC_CHER = DMAC_CHER_ENA0 << HIFI_SPI_SRAM_TX_CHANNEL;
+}
+
+bool HiFiSpiSram::isTransferDone()
+{
+  // A channel clears its enable bit when its buffer is done.
+  uint32_t busy = DMAC_CHSR_ENA0 << (_write ? HIFI_SPI_SRAM_TX_CHANNEL :
+                                              HIFI_SPI_SRAM_RX_CHANNEL);
+  if (DMAC->DMAC_CHSR & busy)
+  {
+    return false;
+  }
+
+  // The last byte of a write is still shifting out.
+  if (_write && (SPI0->SPI_SR & SPI_SR_TXEMPTY) == 0)
+  {
+    return false;
+  }
+
+  select(_chip, false);
+
+  // A write leaves the receiver overrun; clear it.
+  (void)SPI0->SPI_RDR;
+  (void)SPI0->SPI_SR;
+  restoreSpi();
+
+  return true;
+}
+
+#endif
@@ -0,0 +1,81 @@
+/*
+  HiFiSpiSram.h
+
+  Microchip 23LC1024 (128K byte) SPI SRAM as an HiFiExtMemory.
+
+  Up to four chips share SPI0 (MOSI/MISO/SCK on the SPI header) with a
+  chip select pin each; together they look like one memory of 128K bytes
+  per chip, chip 0 first.  Each transfer sends the 4 byte command/address
+  header by hand and then moves the data with the DMA controller, so the
+  CPU is free for the whole of the data phase.  Completion is found by
+  polling the DMA channel status, no interrupt is used.
+
+  The SPI clock is 84MHz / 5 = 16.8MHz (the 23LC1024 is good for 20MHz),
+  about 2M bytes/s, so a block of 64 stereo 16 bit frames takes around
+  130us each way.
+
+  SPI0 can still be used by other libraries (e.g. SD) in between
+  transfers: the mode and chip select settings that the SPI library uses
+  are saved before each transfer and put back afterwards.  Don't start
+  other SPI traffic while a transfer is running (poll() from the same
+  place as the other SPI users).
+
+  Uses DMA channels HIFI_SPI_SRAM_TX_CHANNEL and HIFI_SPI_SRAM_RX_CHANNEL.
+  Only available on the Due.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_SPI_SRAM_H
+#define HIFI_SPI_SRAM_H
+
+#include "HiFiExtMemory.h"
+
+#define HIFI_SPI_SRAM_CHIP_SIZE     0x20000UL
+#define HIFI_SPI_SRAM_MAX_CHIPS     4
+
+#define HIFI_SPI_SRAM_TX_CHANNEL    2
+#define HIFI_SPI_SRAM_RX_CHANNEL    3
+
+class HiFiSpiSram : public HiFiExtMemory {
+public:
+  HiFiSpiSram();
+
+  bool begin(const uint8_t *csPins, uint8_t chips);
+  bool begin(uint8_t csPin) { return begin(&csPin, 1); }
+
+  uint32_t getSize() const { return (uint32_t)_chips * HIFI_SPI_SRAM_CHIP_SIZE; }
+
+protected:
+  void startTransfer(bool write, uint32_t address, uint8_t *data,
+                     uint16_t bytes);
+  bool isTransferDone();
+
+private:
+  void select(uint8_t chip, bool selected);
+  uint8_t transferByte(uint8_t value);
+  void saveSpi();
+  void restoreSpi();
+
+  uint8_t _csPins[HIFI_SPI_SRAM_MAX_CHIPS];
+  uint8_t _chips;
+  uint8_t _chip;
+  bool _write;
+
+  uint32_t _savedMode;
+  uint32_t _savedCsr;
+};
+
+#endif
@@ -0,0 +1,115 @@
+/*
+  HiFiSscRegs.h
+
+  Inline access to the SSC registers used on the audio path.  The Atmel
+  driver in ssc.c puts every access, even a single register read, behind
+  an out-of-line call, and its ssc_is_*_ready() helpers read the status
+  register again and return a code that then has to be compared.  In an
+  interrupt that runs twice per frame those calls cost more than the
+  work they do.
+
+  Here the status is read once and the bits are tested on the saved
+  value (TXSYN/RXSYN are cleared by the read, so a second read would lose
+  them anyway).  Each function compiles to a load or store at a fixed
+  address.  Configuration stays with ssc.c.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_SSC_REGS_H
+#define HIFI_SSC_REGS_H
+
+#if defined(ARDUINO_ARCH_SAM)
+
+#include "Arduino.h"
+
+///////////////////////////////////////////////////////////////////////////
+/// Status
+///////////////////////////////////////////////////////////////////////////
+static inline uint32_t hifi_ssc_status(Ssc *ssc)
+{
+  return ssc->SSC_SR;
+}
+
+static inline bool hifi_ssc_tx_ready(uint32_t status)
+{
+  return (status & SSC_SR_TXRDY) != 0;
+}
+
+static inline bool hifi_ssc_rx_ready(uint32_t status)
+{
+  return (status & SSC_SR_RXRDY) != 0;
+}
+
+// Set when the start condition (the first slot of a frame) was seen.
+static inline bool hifi_ssc_tx_sync(uint32_t status)
+{
+  return (status & SSC_SR_TXSYN) != 0;
+}
+
+static inline bool hifi_ssc_rx_sync(uint32_t status)
+{
+  return (status & SSC_SR_RXSYN) != 0;
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Data
+///////////////////////////////////////////////////////////////////////////
+static inline void hifi_ssc_write(Ssc *ssc, uint32_t value)
+{
+  ssc->SSC_THR = value;
+}
+
+static inline uint32_t hifi_ssc_read(Ssc *ssc)
+{
+  return ssc->SSC_RHR;
+}
+
+static inline uint32_t *hifi_ssc_tx_register(Ssc *ssc)
+{
+  return (uint32_t *)&ssc->SSC_THR;
+}
+
+static inline uint32_t *hifi_ssc_rx_register(Ssc *ssc)
+{
+  return (uint32_t *)&ssc->SSC_RHR;
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Control
+///////////////////////////////////////////////////////////////////////////
+static inline void hifi_ssc_enable_interrupt(Ssc *ssc, uint32_t sources)
+{
+  ssc->SSC_IER = sources;
+}
+
+static inline void hifi_ssc_disable_interrupt(Ssc *ssc, uint32_t sources)
+{
+  ssc->SSC_IDR = sources;
+}
+
+static inline void hifi_ssc_enable_tx(Ssc *ssc, bool enable)
+{
+  ssc->SSC_CR = enable ? SSC_CR_TXEN : SSC_CR_TXDIS;
+}
+
+static inline void hifi_ssc_enable_rx(Ssc *ssc, bool enable)
+{
+  ssc->SSC_CR = enable ? SSC_CR_RXEN : SSC_CR_RXDIS;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,70 @@
+/*
+  HiFiSscTransport.h
+
+  HiFi transport on the SAM3X SSC peripheral, in I2S slave mode.  This is
+  the engine behind the global HiFi object.  There is only one SSC, so
+  there should only be one of these.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_SSC_TRANSPORT_H
+#define HIFI_SSC_TRANSPORT_H
+
+#if defined(ARDUINO_ARCH_SAM)
+
+#include "Arduino.h"
+#include "ssc.h"
+#include "HiFiTransport.h"
+
+class HiFiSscTransport : public HiFiTransport {
+public:
+  HiFiSscTransport() : _dataOutAddr(NULL), _dataInAddr(NULL) { };
+
+  void begin();
+
+  void configureTx(HiFiAudioMode_t audioMode,
+                   HiFiClockMode_t clkMode,
+                   uint8_t bitsPerChannel);
+  void enableTx(bool enable);
+
+  void configureRx(HiFiAudioMode_t audioMode,
+                   HiFiClockMode_t clkMode,
+                   uint8_t bitsPerChannel);
+  void enableRx(bool enable);
+
+  uint32_t *getTxDataRegister() { return _dataOutAddr; }
+  uint32_t *getRxDataRegister() { return _dataInAddr; }
+
+  void service();
+
+  // Called first thing in SSC_Handler() when set, for timing the
+  // interrupt entry (see HiFiLatencyProbe).  NULL removes it.
+  static void setEntryProbe(void (*probe)(void)) { _entryProbe = probe; }
+
+private:
+  friend void ::SSC_Handler(void);
+
+  // The instance SSC_Handler() dispatches to (the last one begun).
+  static HiFiSscTransport *_active;
+  static void (*_entryProbe)(void);
+
+  uint32_t *_dataOutAddr;
+  uint32_t *_dataInAddr;
+};
+
+#endif
+
+#endif
@@ -0,0 +1,321 @@
+/*
+  HiFiStats.cpp
+
+  Statistics registry and its packet encoding.  See HiFiStats.h for the
+  stream format.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <string.h>
+#include "HiFiStats.h"
+
+// sync, type and length in front of the payload, checksum after it
+#define HIFI_STATS_HEADER_BYTES     5
+#define HIFI_STATS_OVERHEAD         (HIFI_STATS_HEADER_BYTES + 1)
+
+HiFiStat *HiFiStat::_first;
+HiFiStat *HiFiStat::_last;
+uint8_t HiFiStat::_count;
+
+HiFiStatsClass HiFiStats;
+
+HiFiStat::HiFiStat(const char *name, HiFiStatType_t type) :
+  _name(name),
+  _type(type),
+  _next(NULL)
+{
+  // The schema count is a single byte; anything past that is ignored.
+  if (_count == 0xFF)
+  {
+    return;
+  }
+
+  if (_last)
+  {
+    _last->_next = this;
+  }
+  else
+  {
+    _first = this;
+  }
+  _last = this;
+  _count++;
+}
+
+HiFiStatHistogramBase::HiFiStatHistogramBase(const char *name,
+                                             volatile uint32_t *counts,
+                                             uint8_t bins, int32_t low,
+                                             uint32_t width) :
+  HiFiStat(name, HIFI_STAT_HISTOGRAM),
+  _counts(counts),
+  _bins(bins ? bins : 1),
+  _low(low),
+  _width(width ? width : 1)
+{
+  clear();
+}
+
+void HiFiStatHistogramBase::clear()
+{
+  for (uint8_t i = 0; i < _bins; i++)
+  {
+    _counts[i] = 0;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Encoding helpers.  Each returns NULL once the buffer is full, and
+/// passes a NULL straight through so the callers only check at the end.
+///////////////////////////////////////////////////////////////////////////
+static uint8_t *putByte(uint8_t *p, const uint8_t *end, uint8_t value)
+{
+  if (!p || p >= end)
+  {
+    return NULL;
+  }
+  *p++ = value;
+  return p;
+}
+
+static uint8_t *putVarint(uint8_t *p, const uint8_t *end, uint32_t value)
+{
+  while (value >= 0x80)
+  {
+    p = putByte(p, end, (uint8_t)(value | 0x80));
+    value >>= 7;
+  }
+  return putByte(p, end, (uint8_t)value);
+}
+
+static uint8_t *putSigned(uint8_t *p, const uint8_t *end, int32_t value)
+{
+  // Zigzag, so small negative numbers stay short too
+  return putVarint(p, end, ((uint32_t)value << 1) ^ (uint32_t)(value >> 31));
+}
+
+static uint32_t fnv1a(uint32_t hash, uint8_t value)
+{
+  return (hash ^ value) * 16777619UL;
+}
+
+HiFiStat *HiFiStatsClass::find(const char *name) const
+{
+  for (HiFiStat *s = HiFiStat::_first; s; s = s->_next)
+  {
+    if (strcmp(s->_name, name) == 0)
+    {
+      return s;
+    }
+  }
+  return NULL;
+}
+
+uint16_t HiFiStatsClass::getSchemaId()
+{
+  // Statistics are only ever added, so the count going up is the only way
+  // the schema can change.
+  if (_schemaId && _schemaCount == HiFiStat::_count)
+  {
+    return _schemaId;
+  }
+
+  uint32_t hash = 2166136261UL;
+
+  for (HiFiStat *s = HiFiStat::_first; s; s = s->_next)
+  {
+    hash = fnv1a(hash, s->_type);
+    for (const char *c = s->_name; *c; c++)
+    {
+      hash = fnv1a(hash, *c);
+    }
+    hash = fnv1a(hash, 0);
+
+    if (s->_type == HIFI_STAT_HISTOGRAM)
+    {
+      HiFiStatHistogramBase *h = static_cast<HiFiStatHistogramBase *>(s);
+
+      hash = fnv1a(hash, h->getBins());
+      for (uint8_t i = 0; i < 32; i += 8)
+      {
+        hash = fnv1a(hash, (uint8_t)(h->getLow() >> i));
+        hash = fnv1a(hash, (uint8_t)(h->getWidth() >> i));
+      }
+    }
+  }
+
+  _schemaId = (uint16_t)(hash ^ (hash >> 16));
+  if (_schemaId == 0)
+  {
+    _schemaId = 1;
+  }
+  _schemaCount = HiFiStat::_count;
+  return _schemaId;
+}
+
+size_t HiFiStatsClass::writeSchema(uint8_t *packet, size_t size)
+{
+  if (size < HIFI_STATS_OVERHEAD)
+  {
+    return 0;
+  }
+
+  const uint8_t *end = packet + size - 1;
+  uint16_t id = getSchemaId();
+  uint8_t *p = packet + HIFI_STATS_HEADER_BYTES;
+
+  p = putByte(p, end, (uint8_t)id);
+  p = putByte(p, end, (uint8_t)(id >> 8));
+  p = putByte(p, end, HiFiStat::_count);
+
+  for (HiFiStat *s = HiFiStat::_first; s; s = s->_next)
+  {
+    size_t length = strlen(s->_name);
+
+    if (length > 0xFF)
+    {
+      length = 0xFF;
+    }
+    p = putByte(p, end, s->_type);
+    p = putByte(p, end, (uint8_t)length);
+    for (size_t i = 0; i < length; i++)
+    {
+      p = putByte(p, end, (uint8_t)s->_name[i]);
+    }
+
+    if (s->_type == HIFI_STAT_HISTOGRAM)
+    {
+      HiFiStatHistogramBase *h = static_cast<HiFiStatHistogramBase *>(s);
+
+      p = putByte(p, end, h->getBins());
+      p = putSigned(p, end, h->getLow());
+      p = putVarint(p, end, h->getWidth());
+    }
+  }
+
+  if (!p)
+  {
+    return 0;
+  }
+  return finish(packet, HIFI_STATS_PACKET_SCHEMA,
+                p - packet - HIFI_STATS_HEADER_BYTES);
+}
+
+size_t HiFiStatsClass::writeValues(uint8_t *packet, size_t size)
+{
+  if (size < HIFI_STATS_OVERHEAD)
+  {
+    return 0;
+  }
+
+  const uint8_t *end = packet + size - 1;
+  uint16_t id = getSchemaId();
+  uint8_t *p = packet + HIFI_STATS_HEADER_BYTES;
+
+#if defined(ARDUINO)
+  uint32_t uptime = millis();
+#else
+  uint32_t uptime = 0;
+#endif
+
+  p = putByte(p, end, (uint8_t)id);
+  p = putByte(p, end, (uint8_t)(id >> 8));
+  p = putByte(p, end, _sequence);
+  p = putVarint(p, end, uptime);
+
+  // Each word is read once; a histogram can be a few counts out between
+  // its bins if an interrupt lands mid-way, but never torn within one.
+  for (HiFiStat *s = HiFiStat::_first; s; s = s->_next)
+  {
+    switch (s->_type)
+    {
+      case HIFI_STAT_COUNTER:
+        p = putVarint(p, end, s->getValue());
+        break;
+
+      case HIFI_STAT_GAUGE:
+        p = putSigned(p, end, (int32_t)s->getValue());
+        break;
+
+      case HIFI_STAT_HISTOGRAM:
+      {
+        HiFiStatHistogramBase *h = static_cast<HiFiStatHistogramBase *>(s);
+
+        for (uint8_t i = 0; i < h->getBins(); i++)
+        {
+          p = putVarint(p, end, h->getCount(i));
+        }
+        break;
+      }
+    }
+  }
+
+  if (!p)
+  {
+    return 0;
+  }
+  _sequence++;
+  return finish(packet, HIFI_STATS_PACKET_VALUES,
+                p - packet - HIFI_STATS_HEADER_BYTES);
+}
+
+size_t HiFiStatsClass::finish(uint8_t *packet, uint8_t type, size_t length)
+{
+  uint8_t sum = type + (uint8_t)length + (uint8_t)(length >> 8);
+
+  packet[0] = HIFI_STATS_SYNC_1;
+  packet[1] = HIFI_STATS_SYNC_2;
+  packet[2] = type;
+  packet[3] = (uint8_t)length;
+  packet[4] = (uint8_t)(length >> 8);
+  for (size_t i = 0; i < length; i++)
+  {
+    sum += packet[HIFI_STATS_HEADER_BYTES + i];
+  }
+  packet[HIFI_STATS_HEADER_BYTES + length] = sum;
+
+  return HIFI_STATS_OVERHEAD + length;
+}
+
+#if defined(ARDUINO)
+void HiFiStatsClass::service(Stream &port)
+{
+  static uint8_t packet[HIFI_STATS_MAX_PACKET];
+
+  while (port.available() > 0)
+  {
+    size_t length = 0;
+
+    switch (port.read())
+    {
+      case HIFI_STATS_PACKET_SCHEMA:
+        length = writeSchema(packet, sizeof(packet));
+        break;
+
+      case HIFI_STATS_PACKET_VALUES:
+        length = writeValues(packet, sizeof(packet));
+        break;
+
+      default:
+        break;
+    }
+
+    if (length)
+    {
+      port.write(packet, length);
+    }
+  }
+}
+#endif
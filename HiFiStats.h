@@ -0,0 +1,257 @@
+/*
+  HiFiStats.h
+
+  One registry for the numbers every block ends up wanting to report:
+  xrun counts, CPU loads, levels, clock drift and the like.
+
+  A statistic is an object with static storage that registers itself by
+  name when it is constructed.  There are three kinds:
+
+    HiFiStatCounter     monotonic 32 bit count (the host works out rates)
+    HiFiStatGauge       signed 32 bit value that is overwritten
+    HiFiStatHistogram   fixed number of equal width bins, the first and
+                        last also catching anything below / above range
+
+  Updates are a single store (gauges) or an LDREX/STREX loop (counters,
+  histogram bins, gauge maxima), so they are safe from any interrupt and
+  never block.  HiFiStatFunction covers values that already live somewhere
+  else (HiFi.getUnderruns() for instance): the function is only called
+  when a snapshot is taken, so it costs nothing in the audio path.
+
+  Snapshots are encoded on demand, in loop(), in response to a one byte
+  request from the host, and go out as packets in the same framing as the
+  spectrogram stream but with a 16 bit length:
+
+    0xA5 0x5A  sync
+    type       'S' (schema) or 'V' (values)
+    length     number of payload bytes, little endian, 2 bytes
+    payload
+    checksum   8 bit sum of type, both length bytes and payload
+
+  The schema gives each statistic's type and name (and a histogram's bin
+  count, lower edge and bin width) once; value packets then carry only the
+  numbers, in registration order, as LEB128 varints (zigzag for gauges and
+  the uptime in milliseconds up front).  Both start with a 16 bit schema id
+  so the host can tell when it needs to ask for the schema again.  A
+  dozen counters and gauges with everyday values come to around 30 bytes
+  per poll.  extras/stats has a decoder for Linux that polls any number of
+  units.
+
+  Registration isn't thread safe; it is meant to happen during static
+  construction or setup(), before the first snapshot.  Statistics must
+  outlive the registry (i.e. be globals or function statics).
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_STATS_H
+#define HIFI_STATS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "HiFiConfig.h"
+
+#if defined(ARDUINO)
+#include "Arduino.h"
+#endif
+
+#define HIFI_STATS_SYNC_1           0xA5
+#define HIFI_STATS_SYNC_2           0x5A
+#define HIFI_STATS_PACKET_SCHEMA    'S'
+#define HIFI_STATS_PACKET_VALUES    'V'
+
+// Packet buffer used by service().  A value packet needs at most 5 bytes
+// per counter or gauge (5 per histogram bin) plus 14; a schema packet
+// needs 2 bytes plus the name per statistic (and up to 11 more for a
+// histogram) plus 9.
+#ifndef HIFI_STATS_MAX_PACKET
+#define HIFI_STATS_MAX_PACKET       512
+#endif
+
+typedef enum {
+  HIFI_STAT_COUNTER = 0,
+  HIFI_STAT_GAUGE = 1,
+  HIFI_STAT_HISTOGRAM = 2
+} HiFiStatType_t;
+
+class HiFiStat {
+public:
+  const char *getName() const { return _name; }
+  HiFiStatType_t getType() const { return _type; }
+
+  // Current value of a counter or gauge (reinterpret as int32_t for a
+  // gauge).  Not meaningful for a histogram.
+  virtual uint32_t getValue() const { return 0; }
+
+  // Registration order, which is also the order on the wire.
+  HiFiStat *getNext() const { return _next; }
+
+protected:
+  HiFiStat(const char *name, HiFiStatType_t type);
+
+private:
+  friend class HiFiStatsClass;
+
+  const char *_name;
+  HiFiStatType_t _type;
+  HiFiStat *_next;
+
+  // Plain zero-initialised statics, so statistics constructed in other
+  // translation units can register before anything else has run.
+  static HiFiStat *_first;
+  static HiFiStat *_last;
+  static uint8_t _count;
+};
+
+class HiFiStatCounter : public HiFiStat {
+public:
+  HiFiStatCounter(const char *name) : HiFiStat(name, HIFI_STAT_COUNTER),
+    _value(0) { };
+
+  void increment(uint32_t n = 1)
+  {
+    __atomic_fetch_add(&_value, n, __ATOMIC_RELAXED);
+  }
+
+  uint32_t getValue() const { return _value; }
+
+private:
+  volatile uint32_t _value;
+};
+
+class HiFiStatGauge : public HiFiStat {
+public:
+  HiFiStatGauge(const char *name) : HiFiStat(name, HIFI_STAT_GAUGE),
+    _value(0) { };
+
+  void set(int32_t value) { _value = value; }
+
+  // Raise the gauge to 'value' if it is higher, e.g. for a peak level or
+  // a worst case load that the sketch clears with set().
+  void setMax(int32_t value)
+  {
+    int32_t current = _value;
+
+    while (value > current &&
+           !__atomic_compare_exchange_n(&_value, &current, value, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+  }
+
+  int32_t get() const { return _value; }
+  uint32_t getValue() const { return (uint32_t)_value; }
+
+private:
+  volatile int32_t _value;
+};
+
+// Reads a value that is kept elsewhere when a snapshot is taken.  'type'
+// is HIFI_STAT_COUNTER or HIFI_STAT_GAUGE.  A captureless lambda will do:
+//
+//   HiFiStatFunction underruns("hifi.underruns", HIFI_STAT_COUNTER,
+//                              []() { return HiFi.getUnderruns(); });
+class HiFiStatFunction : public HiFiStat {
+public:
+  HiFiStatFunction(const char *name, HiFiStatType_t type,
+                   uint32_t (*read)(void)) :
+    HiFiStat(name, (type == HIFI_STAT_COUNTER) ? HIFI_STAT_COUNTER :
+                                                 HIFI_STAT_GAUGE),
+    _read(read) { };
+
+  uint32_t getValue() const { return _read ? _read() : 0; }
+
+private:
+  uint32_t (*_read)(void);
+};
+
+class HiFiStatHistogramBase : public HiFiStat {
+public:
+  // Bin i counts values in [low + i * width, low + (i + 1) * width).
+  void add(int32_t value)
+  {
+    uint32_t bin = 0;
+
+    if (value > _low)
+    {
+      bin = ((uint32_t)value - (uint32_t)_low) / _width;
+      if (bin >= _bins)
+      {
+        bin = _bins - 1;
+      }
+    }
+    __atomic_fetch_add(&_counts[bin], 1, __ATOMIC_RELAXED);
+  }
+
+  // Zero all the bins.  Not atomic with respect to add().
+  void clear();
+
+  uint8_t getBins() const { return _bins; }
+  uint32_t getCount(uint8_t bin) const { return _counts[bin]; }
+  int32_t getLow() const { return _low; }
+  uint32_t getWidth() const { return _width; }
+
+protected:
+  HiFiStatHistogramBase(const char *name, volatile uint32_t *counts,
+                        uint8_t bins, int32_t low, uint32_t width);
+
+private:
+  volatile uint32_t *_counts;
+  uint8_t _bins;
+  int32_t _low;
+  uint32_t _width;
+};
+
+template <uint8_t BINS>
+class HiFiStatHistogram : public HiFiStatHistogramBase {
+public:
+  HiFiStatHistogram(const char *name, int32_t low, uint32_t width) :
+    HiFiStatHistogramBase(name, _storage, BINS, low, width) { };
+
+private:
+  volatile uint32_t _storage[BINS];
+};
+
+class HiFiStatsClass {
+public:
+  uint8_t getCount() const { return HiFiStat::_count; }
+  HiFiStat *getFirst() const { return HiFiStat::_first; }
+  HiFiStat *find(const char *name) const;
+
+  // Hash of the schema, carried by every packet.
+  uint16_t getSchemaId();
+
+  // Encode a schema or value packet into 'packet'.  Return the number of
+  // bytes to send, or 0 if it didn't fit in 'size'.
+  size_t writeSchema(uint8_t *packet, size_t size);
+  size_t writeValues(uint8_t *packet, size_t size);
+
+#if defined(ARDUINO)
+  // Answer any requests waiting on 'port': 'S' for the schema, 'V' for
+  // the values.  Call from loop().
+  void service(Stream &port);
+#endif
+
+private:
+  size_t finish(uint8_t *packet, uint8_t type, size_t length);
+
+  uint8_t _sequence;
+  uint8_t _schemaCount;
+  uint16_t _schemaId;
+};
+
+extern HiFiStatsClass HiFiStats;
+
+#endif
@@ -0,0 +1,188 @@
+/*
+  HiFiSwitcher.cpp
+
+  Sample-accurate crossfading between two sources.  See HiFiSwitcher.h.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <string.h>
+#include "HiFiSwitcher.h"
+#include "HiFiMath.h"
+
+HiFiSwitcher::HiFiSwitcher() :
+  _channels(2),
+  _source(0),
+  _frame(0),
+  _pending(false),
+  _nextSource(0),
+  _startFrame(0),
+  _nextFadeFrames(0),
+  _fading(false),
+  _target(0),
+  _fadeFrames(0),
+  _fadeDone(0),
+  _angle(0),
+  _step(0)
+{
+}
+
+void HiFiSwitcher::begin(uint8_t channels, uint8_t source)
+{
+  _channels = channels ? channels : 1;
+  _source = source ? 1 : 0;
+  _frame = 0;
+  _pending = false;
+  _fading = false;
+
+  hifi_cycle_counter_enable();
+}
+
+bool HiFiSwitcher::select(uint8_t source, uint32_t frame, uint16_t fadeFrames)
+{
+  if (_fading)
+  {
+    return false;
+  }
+
+  // process() only looks at the rest once _pending is set.
+  _pending = false;
+  _nextSource = source ? 1 : 0;
+  _startFrame = frame;
+  _nextFadeFrames = fadeFrames;
+  _pending = true;
+
+  return true;
+}
+
+void HiFiSwitcher::copy(int32_t *out, const int32_t *in, uint32_t words)
+{
+  if (in)
+  {
+    memcpy(out, in, sizeof(int32_t) * words);
+  }
+  else
+  {
+    memset(out, 0, sizeof(int32_t) * words);
+  }
+}
+
+HIFI_RAMFUNC const int32_t *HiFiSwitcher::process(const int32_t *a,
+                                                  const int32_t *b,
+                                                  int32_t *out,
+                                                  uint16_t frames)
+{
+  const int32_t *src[2] = { a, b };
+  uint32_t first = _frame;
+  uint16_t i = 0;
+
+  _meter.start();
+  _frame += frames;
+
+  if (!_fading && (!_pending || (int32_t)(_startFrame - _frame) >= 0))
+  {
+    // Nothing happens in this block.
+    if (!src[_source])
+    {
+      copy(out, NULL, (uint32_t)frames * _channels);
+      _meter.stop();
+      return out;
+    }
+    _meter.stop();
+    return src[_source];
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Start the queued fade on its frame, playing the old source up to it.
+  ///////////////////////////////////////////////////////////////////////////
+  if (!_fading)
+  {
+    int32_t offset = (int32_t)(_startFrame - first);
+
+    if (offset > 0)
+    {
+      i = (uint16_t)offset;
+      copy(out, src[_source], (uint32_t)i * _channels);
+    }
+
+    _target = _nextSource;
+    _fadeFrames = _nextFadeFrames;
+    _pending = false;
+
+    if (_fadeFrames == 0 || _target == _source)
+    {
+      _source = _target;
+    }
+    else
+    {
+      // Gains sampled at the middle of each frame, so the curve is
+      // symmetrical and neither end repeats a full gain.
+      _fading = true;
+      _fadeDone = 0;
+      _step = 0x40000000UL / _fadeFrames;
+      _angle = _step >> 1;
+    }
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Equal-power crossfade: cos on the way out, sin on the way in.
+  ///////////////////////////////////////////////////////////////////////////
+  const int32_t *from = src[_source];
+  const int32_t *to = src[_target];
+
+  while (_fading && i < frames)
+  {
+    int32_t fromGain = hifi_cos_q31(_angle);
+    int32_t toGain = hifi_sin_q31(_angle);
+    uint32_t n = (uint32_t)i * _channels;
+
+    for (uint8_t ch = 0; ch < _channels; ch++)
+    {
+      int64_t acc = 0;
+
+      if (from)
+      {
+        acc += (int64_t)from[n + ch] * fromGain;
+      }
+      if (to)
+      {
+        acc += (int64_t)to[n + ch] * toGain;
+      }
+      out[n + ch] = hifi_sat32(acc >> 31);
+    }
+
+    _angle += _step;
+    i++;
+    if (++_fadeDone == _fadeFrames)
+    {
+      _fading = false;
+      _source = _target;
+    }
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// The new source for whatever is left of the block.
+  ///////////////////////////////////////////////////////////////////////////
+  if (i < frames)
+  {
+    uint32_t n = (uint32_t)i * _channels;
+    const int32_t *in = src[_source];
+
+    copy(out + n, in ? in + n : NULL, (uint32_t)(frames - i) * _channels);
+  }
+
+  _meter.stop();
+  return out;
+}
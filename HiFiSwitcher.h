@@ -0,0 +1,97 @@
+/*
+  HiFiSwitcher.h
+
+  Click-free switching between two sources (inputs, playlist items, a
+  test tone), at an exact frame.
+
+  The switcher counts the frames that pass through process() and a switch
+  is queued with the frame it should start on and the length of the
+  crossfade.  The fade uses equal-power curves (cos / sin of a quarter
+  turn), so uncorrelated sources keep the same loudness through the
+  middle of it; a fade of 0 frames is a hard cut on that frame.
+
+  Outside a fade, process() returns the selected source's own block
+  without touching it, so the only cost is a comparison per block.  Only
+  the block(s) a fade overlaps are written to the output buffer.
+
+  A NULL source is silence, e.g. to fade out at the end of a file.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_SWITCHER_H
+#define HIFI_SWITCHER_H
+
+#include "HiFiDsp.h"
+
+class HiFiSwitcher {
+public:
+  HiFiSwitcher();
+
+  // Blocks are 'channels' interleaved channels; 'source' (0 or 1) is
+  // selected to begin with.
+  void begin(uint8_t channels = 2, uint8_t source = 0);
+
+  // Frame number of the next frame into process().  Counts from 0 at
+  // begin(); set it to line the switcher up with another count, such as
+  // HiFi.getFrameCount().
+  void setFrame(uint32_t frame) { _frame = frame; }
+  uint32_t getFrame() const { return _frame; }
+
+  // Start crossfading to 'source' at 'frame', over 'fadeFrames' frames.
+  // A frame that has already gone starts the fade at the next block.
+  // Replaces a switch that hasn't started yet; returns false during a
+  // fade.  Can be called from loop() while process() runs in an
+  // interrupt.
+  bool select(uint8_t source, uint32_t frame, uint16_t fadeFrames);
+
+  // Returns the block to play: 'a' or 'b' themselves when not fading,
+  // otherwise 'out' (frames * channels words) with the mix.
+  const int32_t *process(const int32_t *a, const int32_t *b, int32_t *out,
+                         uint16_t frames);
+
+  // The source playing, or being faded from.
+  uint8_t getSource() const { return _source; }
+  bool isFading() const { return _fading; }
+  bool isPending() const { return _pending; }
+
+  // Cycles for the last process()
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  void copy(int32_t *out, const int32_t *in, uint32_t words);
+
+  uint8_t _channels;
+  uint8_t _source;
+  uint32_t _frame;
+
+  // Queued switch
+  volatile bool _pending;
+  volatile uint8_t _nextSource;
+  volatile uint32_t _startFrame;
+  volatile uint16_t _nextFadeFrames;
+
+  // Fade in progress
+  bool _fading;
+  uint8_t _target;
+  uint16_t _fadeFrames;
+  uint16_t _fadeDone;
+  uint32_t _angle;          // quarter turn is 0x40000000
+  uint32_t _step;
+
+  HiFiCycleMeter _meter;
+};
+
+#endif
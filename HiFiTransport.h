@@ -0,0 +1,110 @@
+/*
+  HiFiTransport.h
+
+  The interface between HiFiClass and the peripheral that actually moves
+  the samples.  A transport owns the hardware (pins, clocks, interrupt) and
+  turns its "ready" events into calls back into the HiFiClass it is
+  attached to, which then runs that instance's user callbacks.
+
+  Each transport hands HiFiClass the address of a 32 bit transmit and
+  receive data register, so HiFi.write() and HiFi.read() stay a single
+  store/load in the interrupt no matter which engine is underneath.
+
+  Implementations in the library:
+    - HiFiSscTransport: the SSC in I2S slave mode (the default, used by
+      the global HiFi object).
+    - HiFiSimTransport: a software engine with no hardware behind it, for
+      running the audio path on a PC or alongside a real engine.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_TRANSPORT_H
+#define HIFI_TRANSPORT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "HiFiConfig.h"
+
+#if defined(ARDUINO_ARCH_SAM)
+#include "Arduino.h"
+#endif
+
+typedef enum
+{
+  HIFI_AUDIO_MODE_MONO_LEFT,
+  HIFI_AUDIO_MODE_MONO_RIGHT,
+  HIFI_AUDIO_MODE_STEREO
+} HiFiAudioMode_t;
+
+typedef enum
+{
+  HIFI_CLK_MODE_USE_EXT_CLKS,
+  HIFI_CLK_MODE_USE_TK_RK_CLK
+} HiFiClockMode_t;
+
+typedef enum
+{
+  // in MONO modes, channel 1 will be the only one used.  
+  // In STEREO modes, channel 1 is left, channel 2 is right
+  HIFI_CHANNEL_ID_1,
+  HIFI_CHANNEL_ID_2
+} HiFiChannelID_t;
+
+class HiFiClass;
+
+class HiFiTransport {
+public:
+  HiFiTransport() : _owner(NULL) { };
+  virtual ~HiFiTransport() { };
+
+  virtual void begin() = 0;
+
+  virtual void configureTx(HiFiAudioMode_t audioMode,
+                           HiFiClockMode_t clkMode,
+                           uint8_t bitsPerChannel) = 0;
+  virtual void enableTx(bool enable) = 0;
+
+  virtual void configureRx(HiFiAudioMode_t audioMode,
+                           HiFiClockMode_t clkMode,
+                           uint8_t bitsPerChannel) = 0;
+  virtual void enableRx(bool enable) = 0;
+
+  virtual uint32_t *getTxDataRegister() = 0;
+  virtual uint32_t *getRxDataRegister() = 0;
+
+  // Check the peripheral for pending events and dispatch them to the
+  // owner.  Called from the transport's interrupt handler.
+  virtual void service() = 0;
+
+  // Called by the blocking HiFiClass calls while they wait for the
+  // interrupt to make room or deliver data.  Sleeps until the next
+  // interrupt on the Due.
+  virtual void idle()
+  {
+#if defined(ARDUINO_ARCH_SAM)
+    __WFI();
+#endif
+  }
+
+  // Set by HiFiClass::begin().  A transport serves one HiFiClass.
+  void attach(HiFiClass *owner) { _owner = owner; }
+  HiFiClass *getOwner() const { return _owner; }
+
+protected:
+  HiFiClass *_owner;
+};
+
+#endif
@@ -0,0 +1,129 @@
+/*
+  HiFiWav.cpp
+
+  WAV header parser.  See HiFiWav.h.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <string.h>
+#include "HiFiWav.h"
+
+#define WAVE_FORMAT_PCM           0x0001
+#define WAVE_FORMAT_EXTENSIBLE    0xFFFE
+
+static uint16_t get16(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+HiFiWav::HiFiWav() :
+  _channels(0),
+  _sampleRate(0),
+  _bitsPerSample(0),
+  _frameBytes(0),
+  _dataOffset(0),
+  _dataBytes(0)
+{
+}
+
+bool HiFiWav::parse(File &file)
+{
+  uint8_t header[12];
+  bool haveFormat = false;
+
+  _frameBytes = 0;
+
+  if (!file.seek(0) || file.read(header, 12) != 12 ||
+      memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0)
+  {
+    return false;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Walk the chunks until the data chunk, picking up the format on the
+  /// way.  Chunks are padded to an even length.
+  ///////////////////////////////////////////////////////////////////////////
+  uint32_t position = 12;
+
+  while (file.seek(position) && file.read(header, 8) == 8)
+  {
+    uint32_t size = get32(header + 4);
+
+    if (memcmp(header, "fmt ", 4) == 0)
+    {
+      uint8_t fmt[24];
+      uint16_t length = (size < sizeof(fmt)) ? size : sizeof(fmt);
+
+      if (length < 16 || file.read(fmt, length) != length)
+      {
+        return false;
+      }
+
+      uint16_t tag = get16(fmt);
+      if (tag == WAVE_FORMAT_EXTENSIBLE && length >= 24)
+      {
+        // The sub-format GUID starts with the real format tag.
+        if (file.read(fmt, 2) != 2)
+        {
+          return false;
+        }
+        tag = get16(fmt);
+        file.seek(position + 8);
+        file.read(fmt, 16);
+      }
+      if (tag != WAVE_FORMAT_PCM)
+      {
+        return false;
+      }
+
+      _channels = get16(fmt + 2);
+      _sampleRate = get32(fmt + 4);
+      _bitsPerSample = get16(fmt + 14);
+      haveFormat = true;
+    }
+    else if (memcmp(header, "data", 4) == 0)
+    {
+      if (!haveFormat ||
+          _channels < 1 || _channels > 2 ||
+          (_bitsPerSample != 16 && _bitsPerSample != 24))
+      {
+        return false;
+      }
+
+      _frameBytes = _channels * (_bitsPerSample / 8);
+      _dataOffset = position + 8;
+      _dataBytes = size - (size % _frameBytes);
+
+      // A header written before the recording finished may claim more
+      // than is there.
+      if (_dataOffset + _dataBytes > file.size())
+      {
+        _dataBytes = file.size() - _dataOffset;
+        _dataBytes -= _dataBytes % _frameBytes;
+      }
+      return file.seek(_dataOffset);
+    }
+
+    position += 8 + size + (size & 1);
+  }
+
+  return false;
+}
@@ -0,0 +1,56 @@
+/*
+  HiFiWav.h
+
+  Minimal WAV file header parser for the SD players.
+
+  Walks the RIFF chunks of an open file and picks out the format and the
+  position of the sample data.  Uncompressed PCM (including
+  WAVE_FORMAT_EXTENSIBLE wrappers around PCM) with 16 or 24 bits per
+  sample and one or two channels is accepted; anything else is rejected.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_WAV_H
+#define HIFI_WAV_H
+
+#include <SD.h>
+
+class HiFiWav {
+public:
+  HiFiWav();
+
+  // Parse the header of 'file'.  The file position is left at the start
+  // of the sample data.
+  bool parse(File &file);
+
+  uint16_t getChannels() const { return _channels; }
+  uint32_t getSampleRate() const { return _sampleRate; }
+  uint8_t getBitsPerSample() const { return _bitsPerSample; }
+  uint8_t getFrameBytes() const { return _frameBytes; }
+  uint32_t getDataOffset() const { return _dataOffset; }
+  uint32_t getDataBytes() const { return _dataBytes; }
+  uint32_t getFrames() const { return _frameBytes ? _dataBytes / _frameBytes : 0; }
+
+private:
+  uint16_t _channels;
+  uint32_t _sampleRate;
+  uint8_t _bitsPerSample;
+  uint8_t _frameBytes;
+  uint32_t _dataOffset;
+  uint32_t _dataBytes;
+};
+
+#endif
@@ -0,0 +1,203 @@
+/*
+  HiFiWavetable.cpp
+
+  Mipmapped wavetable oscillator.  See HiFiWavetable.h.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "HiFiWavetable.h"
+
+#define HIFI_WAVETABLE_MAX_MORPH  ((uint32_t)(HIFI_WAVETABLE_WAVES - 1) << 16)
+
+// Linearly interpolated Q15 read; tables repeat their first sample at the
+// end so i + 1 never needs wrapping.
+static inline int32_t readTable(const int16_t *table, uint32_t phase,
+                                uint8_t shift)
+{
+  uint32_t i = phase >> shift;
+  int32_t frac = (phase >> (shift - 15)) & 0x7FFF;
+  int32_t a = table[i];
+
+  return a + (((table[i + 1] - a) * frac) >> 15);
+}
+
+HiFiWavetable::HiFiWavetable() :
+  _sampleRate(48000),
+  _phase(0),
+  _increment(0),
+  _level(0),
+  _morph(0),
+  _lastMorph(0),
+  _amplitude(HIFI_Q31_ONE),
+  _lastAmplitude(HIFI_Q31_ONE),
+  _lastFrames(0)
+{
+}
+
+void HiFiWavetable::begin(uint32_t sampleRate)
+{
+  _sampleRate = sampleRate ? sampleRate : 48000;
+  _phase = 0;
+  _lastMorph = _morph;
+  _lastAmplitude = _amplitude;
+
+  hifi_cycle_counter_enable();
+}
+
+void HiFiWavetable::setFrequency(float hz)
+{
+  float turns = hz / (float)_sampleRate;
+
+  if (turns < 0.0f)
+  {
+    turns = 0.0f;
+  }
+  if (turns > 0.5f)
+  {
+    turns = 0.5f;
+  }
+  setIncrement((uint32_t)(turns * 4294967296.0f));
+}
+
+void HiFiWavetable::setIncrement(uint32_t increment)
+{
+  _increment = increment;
+}
+
+void HiFiWavetable::setMorph(uint32_t position)
+{
+  _morph = (position > HIFI_WAVETABLE_MAX_MORPH) ? HIFI_WAVETABLE_MAX_MORPH :
+                                                   position;
+}
+
+void HiFiWavetable::setAmplitude(int32_t amplitude)
+{
+  _amplitude = (amplitude < 0) ? 0 : amplitude;
+}
+
+template <bool MIX>
+HIFI_RAMFUNC void HiFiWavetable::run(int32_t *buf, uint16_t frames,
+                                     uint8_t stride)
+{
+  if (frames == 0)
+  {
+    return;
+  }
+
+  _meter.start();
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Per block: the mipmap level for the pitch and the ramps.
+  ///////////////////////////////////////////////////////////////////////////
+  uint32_t increment = _increment;
+  uint8_t level = 0;
+
+  while (level < HIFI_WAVETABLE_LEVELS - 1 &&
+         increment > hifi_wavetable_max_increment[level])
+  {
+    level++;
+  }
+  _level = level;
+
+  uint8_t shift = 32 - hifi_wavetable_log2_size[level];
+  uint32_t phase = _phase;
+
+  // Amplitude is ramped in Q31 and applied as Q15.
+  int32_t amplitude = _lastAmplitude;
+  int32_t amplitudeStep = (_amplitude - _lastAmplitude) / (int32_t)frames;
+
+  int32_t morph = (int32_t)_lastMorph;
+  int32_t morphStep = ((int32_t)_morph - morph) / (int32_t)frames;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// Steady morph: one table, or two mixed by a fixed fraction.  While the
+  /// morph is moving, the pair and fraction are worked out every frame.
+  ///////////////////////////////////////////////////////////////////////////
+  if (morphStep == 0 && (morph & 0xFFFF) == 0)
+  {
+    const int16_t *table = hifi_wavetable[morph >> 16][level];
+
+    for (uint16_t i = 0; i < frames; i++)
+    {
+      int32_t s = readTable(table, phase, shift);
+      int32_t y = s * (amplitude >> 16) * 2;
+
+      *buf = MIX ? hifi_sat32((int64_t)*buf + y) : y;
+      buf += stride;
+      phase += increment;
+      amplitude += amplitudeStep;
+    }
+  }
+  else if (morphStep == 0)
+  {
+    const int16_t *a = hifi_wavetable[morph >> 16][level];
+    const int16_t *b = hifi_wavetable[(morph >> 16) + 1][level];
+    int32_t frac = (morph & 0xFFFF) >> 1;
+
+    for (uint16_t i = 0; i < frames; i++)
+    {
+      int32_t sa = readTable(a, phase, shift);
+      int32_t sb = readTable(b, phase, shift);
+      int32_t s = sa + (((sb - sa) * frac) >> 15);
+      int32_t y = s * (amplitude >> 16) * 2;
+
+      *buf = MIX ? hifi_sat32((int64_t)*buf + y) : y;
+      buf += stride;
+      phase += increment;
+      amplitude += amplitudeStep;
+    }
+  }
+  else
+  {
+    for (uint16_t i = 0; i < frames; i++)
+    {
+      uint8_t w = morph >> 16;
+      int32_t frac = (morph & 0xFFFF) >> 1;
+      int32_t s = readTable(hifi_wavetable[w][level], phase, shift);
+
+      if (frac)
+      {
+        int32_t sb = readTable(hifi_wavetable[w + 1][level], phase, shift);
+        s += ((sb - s) * frac) >> 15;
+      }
+
+      int32_t y = s * (amplitude >> 16) * 2;
+
+      *buf = MIX ? hifi_sat32((int64_t)*buf + y) : y;
+      buf += stride;
+      phase += increment;
+      amplitude += amplitudeStep;
+      morph += morphStep;
+    }
+  }
+
+  _phase = phase;
+  _lastAmplitude = _amplitude;
+  _lastMorph = _morph;
+  _lastFrames = frames;
+
+  _meter.stop();
+}
+
+void HiFiWavetable::render(int32_t *buf, uint16_t frames, uint8_t stride)
+{
+  run<false>(buf, frames, stride);
+}
+
+void HiFiWavetable::mix(int32_t *buf, uint16_t frames, uint8_t stride)
+{
+  run<true>(buf, frames, stride);
+}
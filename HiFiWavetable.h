@@ -0,0 +1,116 @@
+/*
+  HiFiWavetable.h
+
+  Band-limited wavetable oscillator.
+
+  A single cycle table played back at any pitch aliases as soon as its
+  harmonics pass Nyquist, so the waves are stored as mipmaps: one table
+  per octave with only the harmonics that fit (see HiFiWavetableTables.c,
+  generated by extras/wavetable/wavetable_tables.py).  Each block picks
+  the level for the current pitch, which keeps every harmonic below 28kHz
+  at 48kHz so anything that folds back lands above 20kHz.
+
+  Reads are linearly interpolated (tables hold up to 16 samples per
+  cycle of their top harmonic), and the images of the interpolation are
+  what is left: extras/wavetable/wavetable_check.cpp puts the loudest
+  component below 20kHz that isn't a harmonic at -75dB for a saw or
+  square under 55Hz, -82dB above that and -107dB for the triangle.
+
+  The morph position slides across the waves in the order sine,
+  triangle, saw, square, mixing the two either side of it; whole-number
+  positions read a single table.  Morph and amplitude changes are ramped
+  across the next block.
+
+  render() writes a block and mix() adds one to it (saturating), so a
+  bank of voices can be summed straight into a TX block.  Reading two
+  waves costs about one more table read per frame than one; the
+  WavetableVoices example measures both as voices per percent of CPU.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef HIFI_WAVETABLE_H
+#define HIFI_WAVETABLE_H
+
+#include "HiFiDsp.h"
+
+#define HIFI_WAVETABLE_WAVES    4
+#define HIFI_WAVETABLE_LEVELS   10
+
+typedef enum {
+  HIFI_WAVE_SINE = 0,
+  HIFI_WAVE_TRIANGLE = 1,
+  HIFI_WAVE_SAW = 2,
+  HIFI_WAVE_SQUARE = 3
+} HiFiWave_t;
+
+extern "C" const int16_t *const hifi_wavetable[HIFI_WAVETABLE_WAVES][HIFI_WAVETABLE_LEVELS];
+extern "C" const uint8_t hifi_wavetable_log2_size[HIFI_WAVETABLE_LEVELS];
+extern "C" const uint32_t hifi_wavetable_max_increment[HIFI_WAVETABLE_LEVELS];
+
+class HiFiWavetable {
+public:
+  HiFiWavetable();
+
+  void begin(uint32_t sampleRate = 48000);
+
+  // Pitch, in Hz or as the fraction of a turn per sample (see
+  // hifi_angle()).  Takes effect from the next block.
+  void setFrequency(float hz);
+  void setIncrement(uint32_t increment);
+
+  // Position across the waves, Q16: 0 is the sine, 3.0 the square.
+  void setMorph(uint32_t position);
+  void setWave(HiFiWave_t wave) { setMorph((uint32_t)wave << 16); }
+
+  // Q31 gain (HIFI_Q31_ONE is full scale).
+  void setAmplitude(int32_t amplitude);
+
+  // Restart the cycle at 'phase' (a fraction of a turn).
+  void reset(uint32_t phase = 0) { _phase = phase; }
+
+  // Write, or add, 'frames' samples to every 'stride'th word of 'buf'.
+  void render(int32_t *buf, uint16_t frames, uint8_t stride = 1);
+  void mix(int32_t *buf, uint16_t frames, uint8_t stride = 1);
+
+  // Mipmap level used by the last block (0 has the most harmonics).
+  uint8_t getLevel() const { return _level; }
+
+  // Cycles the last block took per frame.
+  uint32_t getCyclesPerFrame() const
+  {
+    return _lastFrames ? _meter.getCycles() / _lastFrames : 0;
+  }
+  const HiFiCycleMeter &getCycleMeter() const { return _meter; }
+
+private:
+  template <bool MIX>
+  void run(int32_t *buf, uint16_t frames, uint8_t stride);
+
+  uint32_t _sampleRate;
+  uint32_t _phase;
+  uint32_t _increment;
+  uint8_t _level;
+
+  uint32_t _morph;          // target, Q16
+  uint32_t _lastMorph;      // at the start of the next block
+  int32_t _amplitude;
+  int32_t _lastAmplitude;
+
+  uint16_t _lastFrames;
+  HiFiCycleMeter _meter;
+};
+
+#endif
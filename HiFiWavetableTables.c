@@ -0,0 +1,5207 @@
+/*
+  HiFiWavetableTables.c
+
+  Band-limited mipmaps for HiFiWavetable: 4 waves (sine, triangle, saw,
+  square) at 10 levels.  Level l keeps harmonics 1 .. 512 >> l and is used
+  for phase increments up to hifi_wavetable_max_increment[l].  Each
+  table has 2^hifi_wavetable_log2_size[l] samples, Q15, plus a repeat of
+  the first.
+
+  Generated by extras/wavetable/wavetable_tables.py; don't edit by hand.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdint.h>
+#include "HiFiConfig.h"
+
+// Left in flash (no HIFI_RAMDATA): about 78K bytes in all, and each
+// voice only reads one or two small stretches of it per block.
+
+const uint8_t hifi_wavetable_log2_size[10] =
+{
+  11, 11, 11, 10, 10, 10, 10, 10, 10, 10
+};
+
+const uint32_t hifi_wavetable_max_increment[10] =
+{
+  4893354, 9786709, 19573418, 39146837, 78293674,
+  156587349, 313174698, 626349397, 1252698794, 2505397589
+};
+
+static const int16_t hifi_wavetable_sine_0[2049] =
+{
+  0, 101, 201, 302, 402, 503, 603, 704,
+  804, 905, 1005, 1106, 1206, 1307, 1407, 1507,
+  1608, 1708, 1809, 1909, 2009, 2110, 2210, 2310,
+  2410, 2511, 2611, 2711, 2811, 2911, 3012, 3112,
+  3212, 3312, 3412, 3512, 3612, 3712, 3811, 3911,
+  4011, 4111, 4210, 4310, 4410, 4509, 4609, 4708,
+  4808, 4907, 5007, 5106, 5205, 5305, 5404, 5503,
+  5602, 5701, 5800, 5899, 5998, 6096, 6195, 6294,
+  6393, 6491, 6590, 6688, 6786, 6885, 6983, 7081,
+  7179, 7277, 7375, 7473, 7571, 7669, 7767, 7864,
+  7962, 8059, 8157, 8254, 8351, 8448, 8545, 8642,
+  8739, 8836, 8933, 9030, 9126, 9223, 9319, 9416,
+  9512, 9608, 9704, 9800, 9896, 9992, 10087, 10183,
+  10278, 10374, 10469, 10564, 10659, 10754, 10849, 10944,
+  11039, 11133, 11228, 11322, 11417, 11511, 11605, 11699,
+  11793, 11886, 11980, 12074, 12167, 12260, 12353, 12446,
+  12539, 12632, 12725, 12817, 12910, 13002, 13094, 13187,
+  13279, 13370, 13462, 13554, 13645, 13736, 13828, 13919,
+  14010, 14101, 14191, 14282, 14372, 14462, 14553, 14643,
+  14732, 14822, 14912, 15001, 15090, 15180, 15269, 15358,
+  15446, 15535, 15623, 15712, 15800, 15888, 15976, 16063,
+  16151, 16238, 16325, 16413, 16499, 16586, 16673, 16759,
+  16846, 16932, 17018, 17104, 17189, 17275, 17360, 17445,
+  17530, 17615, 17700, 17784, 17869, 17953, 18037, 18121,
+  18204, 18288, 18371, 18454, 18537, 18620, 18703, 18785,
+  18868, 18950, 19032, 19113, 19195, 19276, 19357, 19438,
+  19519, 19600, 19680, 19761, 19841, 19921, 20000, 20080,
+  20159, 20238, 20317, 20396, 20475, 20553, 20631, 20709,
+  20787, 20865, 20942, 21019, 21096, 21173, 21250, 21326,
+  21403, 21479, 21554, 21630, 21705, 21781, 21856, 21930,
+  22005, 22079, 22154, 22227, 22301, 22375, 22448, 22521,
+  22594, 22667, 22739, 22812, 22884, 22956, 23027, 23099,
+  23170, 23241, 23311, 23382, 23452, 23522, 23592, 23662,
+  23731, 23801, 23870, 23938, 24007, 24075, 24143, 24211,
+  24279, 24346, 24413, 24480, 24547, 24613, 24680, 24746,
+  24811, 24877, 24942, 25007, 25072, 25137, 25201, 25265,
+  25329, 25393, 25456, 25519, 25582, 25645, 25708, 25770,
+  25832, 25893, 25955, 26016, 26077, 26138, 26198, 26259,
+  26319, 26378, 26438, 26497, 26556, 26615, 26674, 26732,
+  26790, 26848, 26905, 26962, 27019, 27076, 27133, 27189,
+  27245, 27300, 27356, 27411, 27466, 27521, 27575, 27629,
+  27683, 27737, 27790, 27843, 27896, 27949, 28001, 28053,
+  28105, 28157, 28208, 28259, 28310, 28360, 28411, 28460,
+  28510, 28560, 28609, 28658, 28706, 28755, 28803, 28850,
+  28898, 28945, 28992, 29039, 29085, 29131, 29177, 29223,
+  29268, 29313, 29358, 29403, 29447, 29491, 29534, 29578,
+  29621, 29664, 29706, 29749, 29791, 29832, 29874, 29915,
+  29956, 29997, 30037, 30077, 30117, 30156, 30195, 30234,
+  30273, 30311, 30349, 30387, 30424, 30462, 30498, 30535,
+  30571, 30607, 30643, 30679, 30714, 30749, 30783, 30818,
+  30852, 30885, 30919, 30952, 30985, 31017, 31050, 31082,
+  31113, 31145, 31176, 31206, 31237, 31267, 31297, 31327,
+  31356, 31385, 31414, 31442, 31470, 31498, 31526, 31553,
+  31580, 31607, 31633, 31659, 31685, 31710, 31736, 31760,
+  31785, 31809, 31833, 31857, 31880, 31903, 31926, 31949,
+  31971, 31993, 32014, 32036, 32057, 32077, 32098, 32118,
+  32137, 32157, 32176, 32195, 32213, 32232, 32250, 32267,
+  32285, 32302, 32318, 32335, 32351, 32367, 32382, 32397,
+  32412, 32427, 32441, 32455, 32469, 32482, 32495, 32508,
+  32521, 32533, 32545, 32556, 32567, 32578, 32589, 32599,
+  32609, 32619, 32628, 32637, 32646, 32655, 32663, 32671,
+  32678, 32685, 32692, 32699, 32705, 32711, 32717, 32722,
+  32728, 32732, 32737, 32741, 32745, 32748, 32752, 32755,
+  32757, 32759, 32761, 32763, 32765, 32766, 32766, 32767,
+  32767, 32767, 32766, 32766, 32765, 32763, 32761, 32759,
+  32757, 32755, 32752, 32748, 32745, 32741, 32737, 32732,
+  32728, 32722, 32717, 32711, 32705, 32699, 32692, 32685,
+  32678, 32671, 32663, 32655, 32646, 32637, 32628, 32619,
+  32609, 32599, 32589, 32578, 32567, 32556, 32545, 32533,
+  32521, 32508, 32495, 32482, 32469, 32455, 32441, 32427,
+  32412, 32397, 32382, 32367, 32351, 32335, 32318, 32302,
+  32285, 32267, 32250, 32232, 32213, 32195, 32176, 32157,
+  32137, 32118, 32098, 32077, 32057, 32036, 32014, 31993,
+  31971, 31949, 31926, 31903, 31880, 31857, 31833, 31809,
+  31785, 31760, 31736, 31710, 31685, 31659, 31633, 31607,
+  31580, 31553, 31526, 31498, 31470, 31442, 31414, 31385,
+  31356, 31327, 31297, 31267, 31237, 31206, 31176, 31145,
+  31113, 31082, 31050, 31017, 30985, 30952, 30919, 30885,
+  30852, 30818, 30783, 30749, 30714, 30679, 30643, 30607,
+  30571, 30535, 30498, 30462, 30424, 30387, 30349, 30311,
+  30273, 30234, 30195, 30156, 30117, 30077, 30037, 29997,
+  29956, 29915, 29874, 29832, 29791, 29749, 29706, 29664,
+  29621, 29578, 29534, 29491, 29447, 29403, 29358, 29313,
+  29268, 29223, 29177, 29131, 29085, 29039, 28992, 28945,
+  28898, 28850, 28803, 28755, 28706, 28658, 28609, 28560,
+  28510, 28460, 28411, 28360, 28310, 28259, 28208, 28157,
+  28105, 28053, 28001, 27949, 27896, 27843, 27790, 27737,
+  27683, 27629, 27575, 27521, 27466, 27411, 27356, 27300,
+  27245, 27189, 27133, 27076, 27019, 26962, 26905, 26848,
+  26790, 26732, 26674, 26615, 26556, 26497, 26438, 26378,
+  26319, 26259, 26198, 26138, 26077, 26016, 25955, 25893,
+  25832, 25770, 25708, 25645, 25582, 25519, 25456, 25393,
+  25329, 25265, 25201, 25137, 25072, 25007, 24942, 24877,
+  24811, 24746, 24680, 24613, 24547, 24480, 24413, 24346,
+  24279, 24211, 24143, 24075, 24007, 23938, 23870, 23801,
+  23731, 23662, 23592, 23522, 23452, 23382, 23311, 23241,
+  23170, 23099, 23027, 22956, 22884, 22812, 22739, 22667,
+  22594, 22521, 22448, 22375, 22301, 22227, 22154, 22079,
+  22005, 21930, 21856, 21781, 21705, 21630, 21554, 21479,
+  21403, 21326, 21250, 21173, 21096, 21019, 20942, 20865,
+  20787, 20709, 20631, 20553, 20475, 20396, 20317, 20238,
+  20159, 20080, 20000, 19921, 19841, 19761, 19680, 19600,
+  19519, 19438, 19357, 19276, 19195, 19113, 19032, 18950,
+  18868, 18785, 18703, 18620, 18537, 18454, 18371, 18288,
+  18204, 18121, 18037, 17953, 17869, 17784, 17700, 17615,
+  17530, 17445, 17360, 17275, 17189, 17104, 17018, 16932,
+  16846, 16759, 16673, 16586, 16499, 16413, 16325, 16238,
+  16151, 16063, 15976, 15888, 15800, 15712, 15623, 15535,
+  15446, 15358, 15269, 15180, 15090, 15001, 14912, 14822,
+  14732, 14643, 14553, 14462, 14372, 14282, 14191, 14101,
+  14010, 13919, 13828, 13736, 13645, 13554, 13462, 13370,
+  13279, 13187, 13094, 13002, 12910, 12817, 12725, 12632,
+  12539, 12446, 12353, 12260, 12167, 12074, 11980, 11886,
+  11793, 11699, 11605, 11511, 11417, 11322, 11228, 11133,
+  11039, 10944, 10849, 10754, 10659, 10564, 10469, 10374,
+  10278, 10183, 10087, 9992, 9896, 9800, 9704, 9608,
+  9512, 9416, 9319, 9223, 9126, 9030, 8933, 8836,
+  8739, 8642, 8545, 8448, 8351, 8254, 8157, 8059,
+  7962, 7864, 7767, 7669, 7571, 7473, 7375, 7277,
+  7179, 7081, 6983, 6885, 6786, 6688, 6590, 6491,
+  6393, 6294, 6195, 6096, 5998, 5899, 5800, 5701,
+  5602, 5503, 5404, 5305, 5205, 5106, 5007, 4907,
+  4808, 4708, 4609, 4509, 4410, 4310, 4210, 4111,
+  4011, 3911, 3811, 3712, 3612, 3512, 3412, 3312,
+  3212, 3112, 3012, 2911, 2811, 2711, 2611, 2511,
+  2410, 2310, 2210, 2110, 2009, 1909, 1809, 1708,
+  1608, 1507, 1407, 1307, 1206, 1106, 1005, 905,
+  804, 704, 603, 503, 402, 302, 201, 101,
+  0, -101, -201, -302, -402, -503, -603, -704,
+  -804, -905, -1005, -1106, -1206, -1307, -1407, -1507,
+  -1608, -1708, -1809, -1909, -2009, -2110, -2210, -2310,
+  -2410, -2511, -2611, -2711, -2811, -2911, -3012, -3112,
+  -3212, -3312, -3412, -3512, -3612, -3712, -3811, -3911,
+  -4011, -4111, -4210, -4310, -4410, -4509, -4609, -4708,
+  -4808, -4907, -5007, -5106, -5205, -5305, -5404, -5503,
+  -5602, -5701, -5800, -5899, -5998, -6096, -6195, -6294,
+  -6393, -6491, -6590, -6688, -6786, -6885, -6983, -7081,
+  -7179, -7277, -7375, -7473, -7571, -7669, -7767, -7864,
+  -7962, -8059, -8157, -8254, -8351, -8448, -8545, -8642,
+  -8739, -8836, -8933, -9030, -9126, -9223, -9319, -9416,
+  -9512, -9608, -9704, -9800, -9896, -9992, -10087, -10183,
+  -10278, -10374, -10469, -10564, -10659, -10754, -10849, -10944,
+  -11039, -11133, -11228, -11322, -11417, -11511, -11605, -11699,
+  -11793, -11886, -11980, -12074, -12167, -12260, -12353, -12446,
+  -12539, -12632, -12725, -12817, -12910, -13002, -13094, -13187,
+  -13279, -13370, -13462, -13554, -13645, -13736, -13828, -13919,
+  -14010, -14101, -14191, -14282, -14372, -14462, -14553, -14643,
+  -14732, -14822, -14912, -15001, -15090, -15180, -15269, -15358,
+  -15446, -15535, -15623, -15712, -15800, -15888, -15976, -16063,
+  -16151, -16238, -16325, -16413, -16499, -16586, -16673, -16759,
+  -16846, -16932, -17018, -17104, -17189, -17275, -17360, -17445,
+  -17530, -17615, -17700, -17784, -17869, -17953, -18037, -18121,
+  -18204, -18288, -18371, -18454, -18537, -18620, -18703, -18785,
+  -18868, -18950, -19032, -19113, -19195, -19276, -19357, -19438,
+  -19519, -19600, -19680, -19761, -19841, -19921, -20000, -20080,
+  -20159, -20238, -20317, -20396, -20475, -20553, -20631, -20709,
+  -20787, -20865, -20942, -21019, -21096, -21173, -21250, -21326,
+  -21403, -21479, -21554, -21630, -21705, -21781, -21856, -21930,
+  -22005, -22079, -22154, -22227, -22301, -22375, -22448, -22521,
+  -22594, -22667, -22739, -22812, -22884, -22956, -23027, -23099,
+  -23170, -23241, -23311, -23382, -23452, -23522, -23592, -23662,
+  -23731, -23801, -23870, -23938, -24007, -24075, -24143, -24211,
+  -24279, -24346, -24413, -24480, -24547, -24613, -24680, -24746,
+  -24811, -24877, -24942, -25007, -25072, -25137, -25201, -25265,
+  -25329, -25393, -25456, -25519, -25582, -25645, -25708, -25770,
+  -25832, -25893, -25955, -26016, -26077, -26138, -26198, -26259,
+  -26319, -26378, -26438, -26497, -26556, -26615, -26674, -26732,
+  -26790, -26848, -26905, -26962, -27019, -27076, -27133, -27189,
+  -27245, -27300, -27356, -27411, -27466, -27521, -27575, -27629,
+  -27683, -27737, -27790, -27843, -27896, -27949, -28001, -28053,
+  -28105, -28157, -28208, -28259, -28310, -28360, -28411, -28460,
+  -28510, -28560, -28609, -28658, -28706, -28755, -28803, -28850,
+  -28898, -28945, -28992, -29039, -29085, -29131, -29177, -29223,
+  -29268, -29313, -29358, -29403, -29447, -29491, -29534, -29578,
+  -29621, -29664, -29706, -29749, -29791, -29832, -29874, -29915,
+  -29956, -29997, -30037, -30077, -30117, -30156, -30195, -30234,
+  -30273, -30311, -30349, -30387, -30424, -30462, -30498, -30535,
+  -30571, -30607, -30643, -30679, -30714, -30749, -30783, -30818,
+  -30852, -30885, -30919, -30952, -30985, -31017, -31050, -31082,
+  -31113, -31145, -31176, -31206, -31237, -31267, -31297, -31327,
+  -31356, -31385, -31414, -31442, -31470, -31498, -31526, -31553,
+  -31580, -31607, -31633, -31659, -31685, -31710, -31736, -31760,
+  -31785, -31809, -31833, -31857, -31880, -31903, -31926, -31949,
+  -31971, -31993, -32014, -32036, -32057, -32077, -32098, -32118,
+  -32137, -32157, -32176, -32195, -32213, -32232, -32250, -32267,
+  -32285, -32302, -32318, -32335, -32351, -32367, -32382, -32397,
+  -32412, -32427, -32441, -32455, -32469, -32482, -32495, -32508,
+  -32521, -32533, -32545, -32556, -32567, -32578, -32589, -32599,
+  -32609, -32619, -32628, -32637, -32646, -32655, -32663, -32671,
+  -32678, -32685, -32692, -32699, -32705, -32711, -32717, -32722,
+  -32728, -32732, -32737, -32741, -32745, -32748, -32752, -32755,
+  -32757, -32759, -32761, -32763, -32765, -32766, -32766, -32767,
+  -32767, -32767, -32766, -32766, -32765, -32763, -32761, -32759,
+  -32757, -32755, -32752, -32748, -32745, -32741, -32737, -32732,
+  -32728, -32722, -32717, -32711, -32705, -32699, -32692, -32685,
+  -32678, -32671, -32663, -32655, -32646, -32637, -32628, -32619,
+  -32609, -32599, -32589, -32578, -32567, -32556, -32545, -32533,
+  -32521, -32508, -32495, -32482, -32469, -32455, -32441, -32427,
+  -32412, -32397, -32382, -32367, -32351, -32335, -32318, -32302,
+  -32285, -32267, -32250, -32232, -32213, -32195, -32176, -32157,
+  -32137, -32118, -32098, -32077, -32057, -32036, -32014, -31993,
+  -31971, -31949, -31926, -31903, -31880, -31857, -31833, -31809,
+  -31785, -31760, -31736, -31710, -31685, -31659, -31633, -31607,
+  -31580, -31553, -31526, -31498, -31470, -31442, -31414, -31385,
+  -31356, -31327, -31297, -31267, -31237, -31206, -31176, -31145,
+  -31113, -31082, -31050, -31017, -30985, -30952, -30919, -30885,
+  -30852, -30818, -30783, -30749, -30714, -30679, -30643, -30607,
+  -30571, -30535, -30498, -30462, -30424, -30387, -30349, -30311,
+  -30273, -30234, -30195, -30156, -30117, -30077, -30037, -29997,
+  -29956, -29915, -29874, -29832, -29791, -29749, -29706, -29664,
+  -29621, -29578, -29534, -29491, -29447, -29403, -29358, -29313,
+  -29268, -29223, -29177, -29131, -29085, -29039, -28992, -28945,
+  -28898, -28850, -28803, -28755, -28706, -28658, -28609, -28560,
+  -28510, -28460, -28411, -28360, -28310, -28259, -28208, -28157,
+  -28105, -28053, -28001, -27949, -27896, -27843, -27790, -27737,
+  -27683, -27629, -27575, -27521, -27466, -27411, -27356, -27300,
+  -27245, -27189, -27133, -27076, -27019, -26962, -26905, -26848,
+  -26790, -26732, -26674, -26615, -26556, -26497, -26438, -26378,
+  -26319, -26259, -26198, -26138, -26077, -26016, -25955, -25893,
+  -25832, -25770, -25708, -25645, -25582, -25519, -25456, -25393,
+  -25329, -25265, -25201, -25137, -25072, -25007, -24942, -24877,
+  -24811, -24746, -24680, -24613, -24547, -24480, -24413, -24346,
+  -24279, -24211, -24143, -24075, -24007, -23938, -23870, -23801,
+  -23731, -23662, -23592, -23522, -23452, -23382, -23311, -23241,
+  -23170, -23099, -23027, -22956, -22884, -22812, -22739, -22667,
+  -22594, -22521, -22448, -22375, -22301, -22227, -22154, -22079,
+  -22005, -21930, -21856, -21781, -21705, -21630, -21554, -21479,
+  -21403, -21326, -21250, -21173, -21096, -21019, -20942, -20865,
+  -20787, -20709, -20631, -20553, -20475, -20396, -20317, -20238,
+  -20159, -20080, -20000, -19921, -19841, -19761, -19680, -19600,
+  -19519, -19438, -19357, -19276, -19195, -19113, -19032, -18950,
+  -18868, -18785, -18703, -18620, -18537, -18454, -18371, -18288,
+  -18204, -18121, -18037, -17953, -17869, -17784, -17700, -17615,
+  -17530, -17445, -17360, -17275, -17189, -17104, -17018, -16932,
+  -16846, -16759, -16673, -16586, -16499, -16413, -16325, -16238,
+  -16151, -16063, -15976, -15888, -15800, -15712, -15623, -15535,
+  -15446, -15358, -15269, -15180, -15090, -15001, -14912, -14822,
+  -14732, -14643, -14553, -14462, -14372, -14282, -14191, -14101,
+  -14010, -13919, -13828, -13736, -13645, -13554, -13462, -13370,
+  -13279, -13187, -13094, -13002, -12910, -12817, -12725, -12632,
+  -12539, -12446, -12353, -12260, -12167, -12074, -11980, -11886,
+  -11793, -11699, -11605, -11511, -11417, -11322, -11228, -11133,
+  -11039, -10944, -10849, -10754, -10659, -10564, -10469, -10374,
+  -10278, -10183, -10087, -9992, -9896, -9800, -9704, -9608,
+  -9512, -9416, -9319, -9223, -9126, -9030, -8933, -8836,
+  -8739, -8642, -8545, -8448, -8351, -8254, -8157, -8059,
+  -7962, -7864, -7767, -7669, -7571, -7473, -7375, -7277,
+  -7179, -7081, -6983, -6885, -6786, -6688, -6590, -6491,
+  -6393, -6294, -6195, -6096, -5998, -5899, -5800, -5701,
+  -5602, -5503, -5404, -5305, -5205, -5106, -5007, -4907,
+  -4808, -4708, -4609, -4509, -4410, -4310, -4210, -4111,
+  -4011, -3911, -3811, -3712, -3612, -3512, -3412, -3312,
+  -3212, -3112, -3012, -2911, -2811, -2711, -2611, -2511,
+  -2410, -2310, -2210, -2110, -2009, -1909, -1809, -1708,
+  -1608, -1507, -1407, -1307, -1206, -1106, -1005, -905,
+  -804, -704, -603, -503, -402, -302, -201, -101,
+  0
+};
+
+static const int16_t hifi_wavetable_sine_3[1025] =
+{
+  0, 201, 402, 603, 804, 1005, 1206, 1407,
+  1608, 1809, 2009, 2210, 2410, 2611, 2811, 3012,
+  3212, 3412, 3612, 3811, 4011, 4210, 4410, 4609,
+  4808, 5007, 5205, 5404, 5602, 5800, 5998, 6195,
+  6393, 6590, 6786, 6983, 7179, 7375, 7571, 7767,
+  7962, 8157, 8351, 8545, 8739, 8933, 9126, 9319,
+  9512, 9704, 9896, 10087, 10278, 10469, 10659, 10849,
+  11039, 11228, 11417, 11605, 11793, 11980, 12167, 12353,
+  12539, 12725, 12910, 13094, 13279, 13462, 13645, 13828,
+  14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269,
+  15446, 15623, 15800, 15976, 16151, 16325, 16499, 16673,
+  16846, 17018, 17189, 17360, 17530, 17700, 17869, 18037,
+  18204, 18371, 18537, 18703, 18868, 19032, 19195, 19357,
+  19519, 19680, 19841, 20000, 20159, 20317, 20475, 20631,
+  20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856,
+  22005, 22154, 22301, 22448, 22594, 22739, 22884, 23027,
+  23170, 23311, 23452, 23592, 23731, 23870, 24007, 24143,
+  24279, 24413, 24547, 24680, 24811, 24942, 25072, 25201,
+  25329, 25456, 25582, 25708, 25832, 25955, 26077, 26198,
+  26319, 26438, 26556, 26674, 26790, 26905, 27019, 27133,
+  27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001,
+  28105, 28208, 28310, 28411, 28510, 28609, 28706, 28803,
+  28898, 28992, 29085, 29177, 29268, 29358, 29447, 29534,
+  29621, 29706, 29791, 29874, 29956, 30037, 30117, 30195,
+  30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783,
+  30852, 30919, 30985, 31050, 31113, 31176, 31237, 31297,
+  31356, 31414, 31470, 31526, 31580, 31633, 31685, 31736,
+  31785, 31833, 31880, 31926, 31971, 32014, 32057, 32098,
+  32137, 32176, 32213, 32250, 32285, 32318, 32351, 32382,
+  32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589,
+  32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717,
+  32728, 32737, 32745, 32752, 32757, 32761, 32765, 32766,
+  32767, 32766, 32765, 32761, 32757, 32752, 32745, 32737,
+  32728, 32717, 32705, 32692, 32678, 32663, 32646, 32628,
+  32609, 32589, 32567, 32545, 32521, 32495, 32469, 32441,
+  32412, 32382, 32351, 32318, 32285, 32250, 32213, 32176,
+  32137, 32098, 32057, 32014, 31971, 31926, 31880, 31833,
+  31785, 31736, 31685, 31633, 31580, 31526, 31470, 31414,
+  31356, 31297, 31237, 31176, 31113, 31050, 30985, 30919,
+  30852, 30783, 30714, 30643, 30571, 30498, 30424, 30349,
+  30273, 30195, 30117, 30037, 29956, 29874, 29791, 29706,
+  29621, 29534, 29447, 29358, 29268, 29177, 29085, 28992,
+  28898, 28803, 28706, 28609, 28510, 28411, 28310, 28208,
+  28105, 28001, 27896, 27790, 27683, 27575, 27466, 27356,
+  27245, 27133, 27019, 26905, 26790, 26674, 26556, 26438,
+  26319, 26198, 26077, 25955, 25832, 25708, 25582, 25456,
+  25329, 25201, 25072, 24942, 24811, 24680, 24547, 24413,
+  24279, 24143, 24007, 23870, 23731, 23592, 23452, 23311,
+  23170, 23027, 22884, 22739, 22594, 22448, 22301, 22154,
+  22005, 21856, 21705, 21554, 21403, 21250, 21096, 20942,
+  20787, 20631, 20475, 20317, 20159, 20000, 19841, 19680,
+  19519, 19357, 19195, 19032, 18868, 18703, 18537, 18371,
+  18204, 18037, 17869, 17700, 17530, 17360, 17189, 17018,
+  16846, 16673, 16499, 16325, 16151, 15976, 15800, 15623,
+  15446, 15269, 15090, 14912, 14732, 14553, 14372, 14191,
+  14010, 13828, 13645, 13462, 13279, 13094, 12910, 12725,
+  12539, 12353, 12167, 11980, 11793, 11605, 11417, 11228,
+  11039, 10849, 10659, 10469, 10278, 10087, 9896, 9704,
+  9512, 9319, 9126, 8933, 8739, 8545, 8351, 8157,
+  7962, 7767, 7571, 7375, 7179, 6983, 6786, 6590,
+  6393, 6195, 5998, 5800, 5602, 5404, 5205, 5007,
+  4808, 4609, 4410, 4210, 4011, 3811, 3612, 3412,
+  3212, 3012, 2811, 2611, 2410, 2210, 2009, 1809,
+  1608, 1407, 1206, 1005, 804, 603, 402, 201,
+  0, -201, -402, -603, -804, -1005, -1206, -1407,
+  -1608, -1809, -2009, -2210, -2410, -2611, -2811, -3012,
+  -3212, -3412, -3612, -3811, -4011, -4210, -4410, -4609,
+  -4808, -5007, -5205, -5404, -5602, -5800, -5998, -6195,
+  -6393, -6590, -6786, -6983, -7179, -7375, -7571, -7767,
+  -7962, -8157, -8351, -8545, -8739, -8933, -9126, -9319,
+  -9512, -9704, -9896, -10087, -10278, -10469, -10659, -10849,
+  -11039, -11228, -11417, -11605, -11793, -11980, -12167, -12353,
+  -12539, -12725, -12910, -13094, -13279, -13462, -13645, -13828,
+  -14010, -14191, -14372, -14553, -14732, -14912, -15090, -15269,
+  -15446, -15623, -15800, -15976, -16151, -16325, -16499, -16673,
+  -16846, -17018, -17189, -17360, -17530, -17700, -17869, -18037,
+  -18204, -18371, -18537, -18703, -18868, -19032, -19195, -19357,
+  -19519, -19680, -19841, -20000, -20159, -20317, -20475, -20631,
+  -20787, -20942, -21096, -21250, -21403, -21554, -21705, -21856,
+  -22005, -22154, -22301, -22448, -22594, -22739, -22884, -23027,
+  -23170, -23311, -23452, -23592, -23731, -23870, -24007, -24143,
+  -24279, -24413, -24547, -24680, -24811, -24942, -25072, -25201,
+  -25329, -25456, -25582, -25708, -25832, -25955, -26077, -26198,
+  -26319, -26438, -26556, -26674, -26790, -26905, -27019, -27133,
+  -27245, -27356, -27466, -27575, -27683, -27790, -27896, -28001,
+  -28105, -28208, -28310, -28411, -28510, -28609, -28706, -28803,
+  -28898, -28992, -29085, -29177, -29268, -29358, -29447, -29534,
+  -29621, -29706, -29791, -29874, -29956, -30037, -30117, -30195,
+  -30273, -30349, -30424, -30498, -30571, -30643, -30714, -30783,
+  -30852, -30919, -30985, -31050, -31113, -31176, -31237, -31297,
+  -31356, -31414, -31470, -31526, -31580, -31633, -31685, -31736,
+  -31785, -31833, -31880, -31926, -31971, -32014, -32057, -32098,
+  -32137, -32176, -32213, -32250, -32285, -32318, -32351, -32382,
+  -32412, -32441, -32469, -32495, -32521, -32545, -32567, -32589,
+  -32609, -32628, -32646, -32663, -32678, -32692, -32705, -32717,
+  -32728, -32737, -32745, -32752, -32757, -32761, -32765, -32766,
+  -32767, -32766, -32765, -32761, -32757, -32752, -32745, -32737,
+  -32728, -32717, -32705, -32692, -32678, -32663, -32646, -32628,
+  -32609, -32589, -32567, -32545, -32521, -32495, -32469, -32441,
+  -32412, -32382, -32351, -32318, -32285, -32250, -32213, -32176,
+  -32137, -32098, -32057, -32014, -31971, -31926, -31880, -31833,
+  -31785, -31736, -31685, -31633, -31580, -31526, -31470, -31414,
+  -31356, -31297, -31237, -31176, -31113, -31050, -30985, -30919,
+  -30852, -30783, -30714, -30643, -30571, -30498, -30424, -30349,
+  -30273, -30195, -30117, -30037, -29956, -29874, -29791, -29706,
+  -29621, -29534, -29447, -29358, -29268, -29177, -29085, -28992,
+  -28898, -28803, -28706, -28609, -28510, -28411, -28310, -28208,
+  -28105, -28001, -27896, -27790, -27683, -27575, -27466, -27356,
+  -27245, -27133, -27019, -26905, -26790, -26674, -26556, -26438,
+  -26319, -26198, -26077, -25955, -25832, -25708, -25582, -25456,
+  -25329, -25201, -25072, -24942, -24811, -24680, -24547, -24413,
+  -24279, -24143, -24007, -23870, -23731, -23592, -23452, -23311,
+  -23170, -23027, -22884, -22739, -22594, -22448, -22301, -22154,
+  -22005, -21856, -21705, -21554, -21403, -21250, -21096, -20942,
+  -20787, -20631, -20475, -20317, -20159, -20000, -19841, -19680,
+  -19519, -19357, -19195, -19032, -18868, -18703, -18537, -18371,
+  -18204, -18037, -17869, -17700, -17530, -17360, -17189, -17018,
+  -16846, -16673, -16499, -16325, -16151, -15976, -15800, -15623,
+  -15446, -15269, -15090, -14912, -14732, -14553, -14372, -14191,
+  -14010, -13828, -13645, -13462, -13279, -13094, -12910, -12725,
+  -12539, -12353, -12167, -11980, -11793, -11605, -11417, -11228,
+  -11039, -10849, -10659, -10469, -10278, -10087, -9896, -9704,
+  -9512, -9319, -9126, -8933, -8739, -8545, -8351, -8157,
+  -7962, -7767, -7571, -7375, -7179, -6983, -6786, -6590,
+  -6393, -6195, -5998, -5800, -5602, -5404, -5205, -5007,
+  -4808, -4609, -4410, -4210, -4011, -3811, -3612, -3412,
+  -3212, -3012, -2811, -2611, -2410, -2210, -2009, -1809,
+  -1608, -1407, -1206, -1005, -804, -603, -402, -201,
+  0
+};
+
+static const int16_t hifi_wavetable_triangle_0[2049] =
+{
+  0, 64, 128, 192, 256, 320, 384, 448,
+  512, 576, 640, 705, 769, 833, 897, 961,
+  1025, 1089, 1153, 1217, 1281, 1345, 1409, 1473,
+  1537, 1601, 1665, 1729, 1793, 1857, 1921, 1986,
+  2050, 2114, 2178, 2242, 2306, 2370, 2434, 2498,
+  2562, 2626, 2690, 2754, 2818, 2882, 2946, 3010,
+  3074, 3138, 3202, 3267, 3331, 3395, 3459, 3523,
+  3587, 3651, 3715, 3779, 3843, 3907, 3971, 4035,
+  4099, 4163, 4227, 4291, 4355, 4419, 4483, 4548,
+  4612, 4676, 4740, 4804, 4868, 4932, 4996, 5060,
+  5124, 5188, 5252, 5316, 5380, 5444, 5508, 5572,
+  5636, 5700, 5764, 5828, 5892, 5956, 6021, 6085,
+  6149, 6213, 6277, 6341, 6405, 6469, 6533, 6597,
+  6661, 6725, 6789, 6853, 6917, 6981, 7045, 7109,
+  7173, 7237, 7302, 7366, 7430, 7494, 7558, 7622,
+  7686, 7750, 7814, 7878, 7942, 8006, 8070, 8134,
+  8198, 8262, 8326, 8390, 8454, 8518, 8583, 8647,
+  8711, 8775, 8839, 8903, 8967, 9031, 9095, 9159,
+  9223, 9287, 9351, 9415, 9479, 9543, 9607, 9671,
+  9735, 9799, 9864, 9928, 9992, 10056, 10120, 10184,
+  10248, 10312, 10376, 10440, 10504, 10568, 10632, 10696,
+  10760, 10824, 10888, 10952, 11016, 11080, 11144, 11209,
+  11273, 11337, 11401, 11465, 11529, 11593, 11657, 11721,
+  11785, 11849, 11913, 11977, 12041, 12105, 12169, 12233,
+  12297, 12361, 12425, 12490, 12554, 12618, 12682, 12746,
+  12810, 12874, 12938, 13002, 13066, 13130, 13194, 13258,
+  13322, 13386, 13450, 13514, 13578, 13642, 13706, 13771,
+  13835, 13899, 13963, 14027, 14091, 14155, 14219, 14283,
+  14347, 14411, 14475, 14539, 14603, 14667, 14731, 14795,
+  14859, 14923, 14987, 15052, 15116, 15179, 15244, 15308,
+  15372, 15436, 15500, 15564, 15628, 15692, 15756, 15820,
+  15884, 15948, 16012, 16076, 16140, 16204, 16268, 16333,
+  16396, 16460, 16525, 16589, 16653, 16717, 16781, 16845,
+  16909, 16973, 17037, 17101, 17165, 17229, 17293, 17357,
+  17421, 17485, 17549, 17613, 17677, 17741, 17806, 17870,
+  17934, 17998, 18062, 18126, 18190, 18254, 18318, 18382,
+  18446, 18510, 18574, 18638, 18702, 18766, 18830, 18894,
+  18958, 19022, 19087, 19151, 19215, 19279, 19343, 19407,
+  19471, 19535, 19599, 19663, 19727, 19791, 19855, 19919,
+  19983, 20047, 20111, 20175, 20239, 20303, 20368, 20432,
+  20496, 20560, 20624, 20688, 20752, 20816, 20880, 20944,
+  21008, 21072, 21136, 21200, 21264, 21328, 21392, 21456,
+  21520, 21584, 21648, 21713, 21777, 21841, 21905, 21969,
+  22033, 22097, 22161, 22225, 22289, 22353, 22417, 22481,
+  22545, 22609, 22673, 22737, 22801, 22865, 22929, 22994,
+  23058, 23121, 23186, 23250, 23314, 23378, 23442, 23506,
+  23570, 23634, 23698, 23762, 23826, 23890, 23954, 24018,
+  24082, 24146, 24210, 24275, 24339, 24402, 24467, 24531,
+  24595, 24659, 24723, 24787, 24851, 24915, 24979, 25043,
+  25107, 25171, 25235, 25299, 25363, 25427, 25491, 25556,
+  25619, 25683, 25748, 25812, 25876, 25940, 26004, 26068,
+  26132, 26196, 26260, 26324, 26388, 26452, 26516, 26580,
+  26644, 26708, 26772, 26837, 26900, 26964, 27029, 27093,
+  27157, 27221, 27285, 27349, 27413, 27477, 27541, 27605,
+  27669, 27733, 27797, 27861, 27925, 27989, 28053, 28118,
+  28181, 28245, 28310, 28374, 28438, 28501, 28566, 28630,
+  28694, 28758, 28822, 28886, 28950, 29014, 29078, 29142,
+  29206, 29270, 29334, 29399, 29462, 29526, 29591, 29655,
+  29719, 29782, 29847, 29911, 29975, 30038, 30103, 30167,
+  30231, 30295, 30359, 30424, 30487, 30551, 30615, 30680,
+  30743, 30807, 30872, 30936, 31000, 31063, 31128, 31192,
+  31256, 31319, 31384, 31449, 31512, 31575, 31640, 31705,
+  31768, 31831, 31896, 31962, 32024, 32087, 32153, 32218,
+  32280, 32342, 32409, 32476, 32536, 32596, 32668, 32737,
+  32767, 32737, 32668, 32596, 32536, 32476, 32409, 32342,
+  32280, 32218, 32153, 32087, 32024, 31962, 31896, 31831,
+  31768, 31705, 31640, 31575, 31512, 31449, 31384, 31319,
+  31256, 31192, 31128, 31063, 31000, 30936, 30872, 30807,
+  30743, 30680, 30615, 30551, 30487, 30424, 30359, 30295,
+  30231, 30167, 30103, 30038, 29975, 29911, 29847, 29782,
+  29719, 29655, 29591, 29526, 29462, 29399, 29334, 29270,
+  29206, 29142, 29078, 29014, 28950, 28886, 28822, 28758,
+  28694, 28630, 28566, 28501, 28438, 28374, 28310, 28245,
+  28181, 28118, 28053, 27989, 27925, 27861, 27797, 27733,
+  27669, 27605, 27541, 27477, 27413, 27349, 27285, 27221,
+  27157, 27093, 27029, 26964, 26900, 26837, 26772, 26708,
+  26644, 26580, 26516, 26452, 26388, 26324, 26260, 26196,
+  26132, 26068, 26004, 25940, 25876, 25812, 25748, 25683,
+  25619, 25556, 25491, 25427, 25363, 25299, 25235, 25171,
+  25107, 25043, 24979, 24915, 24851, 24787, 24723, 24659,
+  24595, 24531, 24467, 24402, 24339, 24275, 24210, 24146,
+  24082, 24018, 23954, 23890, 23826, 23762, 23698, 23634,
+  23570, 23506, 23442, 23378, 23314, 23250, 23186, 23121,
+  23058, 22994, 22929, 22865, 22801, 22737, 22673, 22609,
+  22545, 22481, 22417, 22353, 22289, 22225, 22161, 22097,
+  22033, 21969, 21905, 21841, 21777, 21713, 21648, 21584,
+  21520, 21456, 21392, 21328, 21264, 21200, 21136, 21072,
+  21008, 20944, 20880, 20816, 20752, 20688, 20624, 20560,
+  20496, 20432, 20368, 20303, 20239, 20175, 20111, 20047,
+  19983, 19919, 19855, 19791, 19727, 19663, 19599, 19535,
+  19471, 19407, 19343, 19279, 19215, 19151, 19087, 19022,
+  18958, 18894, 18830, 18766, 18702, 18638, 18574, 18510,
+  18446, 18382, 18318, 18254, 18190, 18126, 18062, 17998,
+  17934, 17870, 17806, 17741, 17677, 17613, 17549, 17485,
+  17421, 17357, 17293, 17229, 17165, 17101, 17037, 16973,
+  16909, 16845, 16781, 16717, 16653, 16589, 16525, 16460,
+  16396, 16333, 16268, 16204, 16140, 16076, 16012, 15948,
+  15884, 15820, 15756, 15692, 15628, 15564, 15500, 15436,
+  15372, 15308, 15244, 15179, 15116, 15052, 14987, 14923,
+  14859, 14795, 14731, 14667, 14603, 14539, 14475, 14411,
+  14347, 14283, 14219, 14155, 14091, 14027, 13963, 13899,
+  13835, 13771, 13706, 13642, 13578, 13514, 13450, 13386,
+  13322, 13258, 13194, 13130, 13066, 13002, 12938, 12874,
+  12810, 12746, 12682, 12618, 12554, 12490, 12425, 12361,
+  12297, 12233, 12169, 12105, 12041, 11977, 11913, 11849,
+  11785, 11721, 11657, 11593, 11529, 11465, 11401, 11337,
+  11273, 11209, 11144, 11080, 11016, 10952, 10888, 10824,
+  10760, 10696, 10632, 10568, 10504, 10440, 10376, 10312,
+  10248, 10184, 10120, 10056, 9992, 9928, 9864, 9799,
+  9735, 9671, 9607, 9543, 9479, 9415, 9351, 9287,
+  9223, 9159, 9095, 9031, 8967, 8903, 8839, 8775,
+  8711, 8647, 8583, 8518, 8454, 8390, 8326, 8262,
+  8198, 8134, 8070, 8006, 7942, 7878, 7814, 7750,
+  7686, 7622, 7558, 7494, 7430, 7366, 7302, 7237,
+  7173, 7109, 7045, 6981, 6917, 6853, 6789, 6725,
+  6661, 6597, 6533, 6469, 6405, 6341, 6277, 6213,
+  6149, 6085, 6021, 5956, 5892, 5828, 5764, 5700,
+  5636, 5572, 5508, 5444, 5380, 5316, 5252, 5188,
+  5124, 5060, 4996, 4932, 4868, 4804, 4740, 4676,
+  4612, 4548, 4483, 4419, 4355, 4291, 4227, 4163,
+  4099, 4035, 3971, 3907, 3843, 3779, 3715, 3651,
+  3587, 3523, 3459, 3395, 3331, 3267, 3202, 3138,
+  3074, 3010, 2946, 2882, 2818, 2754, 2690, 2626,
+  2562, 2498, 2434, 2370, 2306, 2242, 2178, 2114,
+  2050, 1986, 1921, 1857, 1793, 1729, 1665, 1601,
+  1537, 1473, 1409, 1345, 1281, 1217, 1153, 1089,
+  1025, 961, 897, 833, 769, 705, 640, 576,
+  512, 448, 384, 320, 256, 192, 128, 64,
+  0, -64, -128, -192, -256, -320, -384, -448,
+  -512, -576, -640, -705, -769, -833, -897, -961,
+  -1025, -1089, -1153, -1217, -1281, -1345, -1409, -1473,
+  -1537, -1601, -1665, -1729, -1793, -1857, -1921, -1986,
+  -2050, -2114, -2178, -2242, -2306, -2370, -2434, -2498,
+  -2562, -2626, -2690, -2754, -2818, -2882, -2946, -3010,
+  -3074, -3138, -3202, -3267, -3331, -3395, -3459, -3523,
+  -3587, -3651, -3715, -3779, -3843, -3907, -3971, -4035,
+  -4099, -4163, -4227, -4291, -4355, -4419, -4483, -4548,
+  -4612, -4676, -4740, -4804, -4868, -4932, -4996, -5060,
+  -5124, -5188, -5252, -5316, -5380, -5444, -5508, -5572,
+  -5636, -5700, -5764, -5828, -5892, -5956, -6021, -6085,
+  -6149, -6213, -6277, -6341, -6405, -6469, -6533, -6597,
+  -6661, -6725, -6789, -6853, -6917, -6981, -7045, -7109,
+  -7173, -7237, -7302, -7366, -7430, -7494, -7558, -7622,
+  -7686, -7750, -7814, -7878, -7942, -8006, -8070, -8134,
+  -8198, -8262, -8326, -8390, -8454, -8518, -8583, -8647,
+  -8711, -8775, -8839, -8903, -8967, -9031, -9095, -9159,
+  -9223, -9287, -9351, -9415, -9479, -9543, -9607, -9671,
+  -9735, -9799, -9864, -9928, -9992, -10056, -10120, -10184,
+  -10248, -10312, -10376, -10440, -10504, -10568, -10632, -10696,
+  -10760, -10824, -10888, -10952, -11016, -11080, -11144, -11209,
+  -11273, -11337, -11401, -11465, -11529, -11593, -11657, -11721,
+  -11785, -11849, -11913, -11977, -12041, -12105, -12169, -12233,
+  -12297, -12361, -12425, -12490, -12554, -12618, -12682, -12746,
+  -12810, -12874, -12938, -13002, -13066, -13130, -13194, -13258,
+  -13322, -13386, -13450, -13514, -13578, -13642, -13706, -13771,
+  -13835, -13899, -13963, -14027, -14091, -14155, -14219, -14283,
+  -14347, -14411, -14475, -14539, -14603, -14667, -14731, -14795,
+  -14859, -14923, -14987, -15052, -15116, -15179, -15244, -15308,
+  -15372, -15436, -15500, -15564, -15628, -15692, -15756, -15820,
+  -15884, -15948, -16012, -16076, -16140, -16204, -16268, -16333,
+  -16396, -16460, -16525, -16589, -16653, -16717, -16781, -16845,
+  -16909, -16973, -17037, -17101, -17165, -17229, -17293, -17357,
+  -17421, -17485, -17549, -17613, -17677, -17741, -17806, -17870,
+  -17934, -17998, -18062, -18126, -18190, -18254, -18318, -18382,
+  -18446, -18510, -18574, -18638, -18702, -18766, -18830, -18894,
+  -18958, -19022, -19087, -19151, -19215, -19279, -19343, -19407,
+  -19471, -19535, -19599, -19663, -19727, -19791, -19855, -19919,
+  -19983, -20047, -20111, -20175, -20239, -20303, -20368, -20432,
+  -20496, -20560, -20624, -20688, -20752, -20816, -20880, -20944,
+  -21008, -21072, -21136, -21200, -21264, -21328, -21392, -21456,
+  -21520, -21584, -21648, -21713, -21777, -21841, -21905, -21969,
+  -22033, -22097, -22161, -22225, -22289, -22353, -22417, -22481,
+  -22545, -22609, -22673, -22737, -22801, -22865, -22929, -22994,
+  -23058, -23121, -23186, -23250, -23314, -23378, -23442, -23506,
+  -23570, -23634, -23698, -23762, -23826, -23890, -23954, -24018,
+  -24082, -24146, -24210, -24275, -24339, -24402, -24467, -24531,
+  -24595, -24659, -24723, -24787, -24851, -24915, -24979, -25043,
+  -25107, -25171, -25235, -25299, -25363, -25427, -25491, -25556,
+  -25619, -25683, -25748, -25812, -25876, -25940, -26004, -26068,
+  -26132, -26196, -26260, -26324, -26388, -26452, -26516, -26580,
+  -26644, -26708, -26772, -26837, -26900, -26964, -27029, -27093,
+  -27157, -27221, -27285, -27349, -27413, -27477, -27541, -27605,
+  -27669, -27733, -27797, -27861, -27925, -27989, -28053, -28118,
+  -28181, -28245, -28310, -28374, -28438, -28501, -28566, -28630,
+  -28694, -28758, -28822, -28886, -28950, -29014, -29078, -29142,
+  -29206, -29270, -29334, -29399, -29462, -29526, -29591, -29655,
+  -29719, -29782, -29847, -29911, -29975, -30038, -30103, -30167,
+  -30231, -30295, -30359, -30424, -30487, -30551, -30615, -30680,
+  -30743, -30807, -30872, -30936, -31000, -31063, -31128, -31192,
+  -31256, -31319, -31384, -31449, -31512, -31575, -31640, -31705,
+  -31768, -31831, -31896, -31962, -32024, -32087, -32153, -32218,
+  -32280, -32342, -32409, -32476, -32536, -32596, -32668, -32737,
+  -32767, -32737, -32668, -32596, -32536, -32476, -32409, -32342,
+  -32280, -32218, -32153, -32087, -32024, -31962, -31896, -31831,
+  -31768, -31705, -31640, -31575, -31512, -31449, -31384, -31319,
+  -31256, -31192, -31128, -31063, -31000, -30936, -30872, -30807,
+  -30743, -30680, -30615, -30551, -30487, -30424, -30359, -30295,
+  -30231, -30167, -30103, -30038, -29975, -29911, -29847, -29782,
+  -29719, -29655, -29591, -29526, -29462, -29399, -29334, -29270,
+  -29206, -29142, -29078, -29014, -28950, -28886, -28822, -28758,
+  -28694, -28630, -28566, -28501, -28438, -28374, -28310, -28245,
+  -28181, -28118, -28053, -27989, -27925, -27861, -27797, -27733,
+  -27669, -27605, -27541, -27477, -27413, -27349, -27285, -27221,
+  -27157, -27093, -27029, -26964, -26900, -26837, -26772, -26708,
+  -26644, -26580, -26516, -26452, -26388, -26324, -26260, -26196,
+  -26132, -26068, -26004, -25940, -25876, -25812, -25748, -25683,
+  -25619, -25556, -25491, -25427, -25363, -25299, -25235, -25171,
+  -25107, -25043, -24979, -24915, -24851, -24787, -24723, -24659,
+  -24595, -24531, -24467, -24402, -24339, -24275, -24210, -24146,
+  -24082, -24018, -23954, -23890, -23826, -23762, -23698, -23634,
+  -23570, -23506, -23442, -23378, -23314, -23250, -23186, -23121,
+  -23058, -22994, -22929, -22865, -22801, -22737, -22673, -22609,
+  -22545, -22481, -22417, -22353, -22289, -22225, -22161, -22097,
+  -22033, -21969, -21905, -21841, -21777, -21713, -21648, -21584,
+  -21520, -21456, -21392, -21328, -21264, -21200, -21136, -21072,
+  -21008, -20944, -20880, -20816, -20752, -20688, -20624, -20560,
+  -20496, -20432, -20368, -20303, -20239, -20175, -20111, -20047,
+  -19983, -19919, -19855, -19791, -19727, -19663, -19599, -19535,
+  -19471, -19407, -19343, -19279, -19215, -19151, -19087, -19022,
+  -18958, -18894, -18830, -18766, -18702, -18638, -18574, -18510,
+  -18446, -18382, -18318, -18254, -18190, -18126, -18062, -17998,
+  -17934, -17870, -17806, -17741, -17677, -17613, -17549, -17485,
+  -17421, -17357, -17293, -17229, -17165, -17101, -17037, -16973,
+  -16909, -16845, -16781, -16717, -16653, -16589, -16525, -16460,
+  -16396, -16333, -16268, -16204, -16140, -16076, -16012, -15948,
+  -15884, -15820, -15756, -15692, -15628, -15564, -15500, -15436,
+  -15372, -15308, -15244, -15179, -15116, -15052, -14987, -14923,
+  -14859, -14795, -14731, -14667, -14603, -14539, -14475, -14411,
+  -14347, -14283, -14219, -14155, -14091, -14027, -13963, -13899,
+  -13835, -13771, -13706, -13642, -13578, -13514, -13450, -13386,
+  -13322, -13258, -13194, -13130, -13066, -13002, -12938, -12874,
+  -12810, -12746, -12682, -12618, -12554, -12490, -12425, -12361,
+  -12297, -12233, -12169, -12105, -12041, -11977, -11913, -11849,
+  -11785, -11721, -11657, -11593, -11529, -11465, -11401, -11337,
+  -11273, -11209, -11144, -11080, -11016, -10952, -10888, -10824,
+  -10760, -10696, -10632, -10568, -10504, -10440, -10376, -10312,
+  -10248, -10184, -10120, -10056, -9992, -9928, -9864, -9799,
+  -9735, -9671, -9607, -9543, -9479, -9415, -9351, -9287,
+  -9223, -9159, -9095, -9031, -8967, -8903, -8839, -8775,
+  -8711, -8647, -8583, -8518, -8454, -8390, -8326, -8262,
+  -8198, -8134, -8070, -8006, -7942, -7878, -7814, -7750,
+  -7686, -7622, -7558, -7494, -7430, -7366, -7302, -7237,
+  -7173, -7109, -7045, -6981, -6917, -6853, -6789, -6725,
+  -6661, -6597, -6533, -6469, -6405, -6341, -6277, -6213,
+  -6149, -6085, -6021, -5956, -5892, -5828, -5764, -5700,
+  -5636, -5572, -5508, -5444, -5380, -5316, -5252, -5188,
+  -5124, -5060, -4996, -4932, -4868, -4804, -4740, -4676,
+  -4612, -4548, -4483, -4419, -4355, -4291, -4227, -4163,
+  -4099, -4035, -3971, -3907, -3843, -3779, -3715, -3651,
+  -3587, -3523, -3459, -3395, -3331, -3267, -3202, -3138,
+  -3074, -3010, -2946, -2882, -2818, -2754, -2690, -2626,
+  -2562, -2498, -2434, -2370, -2306, -2242, -2178, -2114,
+  -2050, -1986, -1921, -1857, -1793, -1729, -1665, -1601,
+  -1537, -1473, -1409, -1345, -1281, -1217, -1153, -1089,
+  -1025, -961, -897, -833, -769, -705, -640, -576,
+  -512, -448, -384, -320, -256, -192, -128, -64,
+  0
+};
+
+static const int16_t hifi_wavetable_triangle_1[2049] =
+{
+  0, 64, 128, 192, 256, 320, 384, 448,
+  512, 576, 640, 704, 769, 833, 897, 961,
+  1025, 1089, 1153, 1217, 1281, 1345, 1409, 1473,
+  1537, 1601, 1665, 1729, 1793, 1858, 1922, 1986,
+  2050, 2113, 2177, 2242, 2306, 2370, 2434, 2498,
+  2562, 2626, 2690, 2754, 2818, 2882, 2946, 3010,
+  3074, 3138, 3202, 3266, 3331, 3395, 3459, 3523,
+  3587, 3651, 3715, 3779, 3843, 3907, 3971, 4035,
+  4099, 4163, 4227, 4291, 4355, 4420, 4484, 4548,
+  4612, 4675, 4739, 4804, 4868, 4932, 4996, 5060,
+  5124, 5188, 5252, 5316, 5380, 5444, 5508, 5572,
+  5636, 5700, 5764, 5828, 5892, 5957, 6021, 6085,
+  6149, 6213, 6277, 6341, 6405, 6469, 6533, 6597,
+  6661, 6725, 6789, 6853, 6917, 6981, 7046, 7110,
+  7173, 7237, 7301, 7365, 7430, 7494, 7558, 7622,
+  7686, 7750, 7814, 7878, 7942, 8006, 8070, 8134,
+  8198, 8262, 8326, 8390, 8454, 8519, 8583, 8647,
+  8711, 8775, 8839, 8903, 8967, 9031, 9095, 9159,
+  9223, 9287, 9351, 9415, 9479, 9543, 9608, 9672,
+  9735, 9799, 9863, 9927, 9992, 10056, 10120, 10184,
+  10248, 10312, 10376, 10440, 10504, 10568, 10632, 10696,
+  10760, 10824, 10888, 10952, 11016, 11081, 11145, 11209,
+  11273, 11336, 11400, 11465, 11529, 11593, 11657, 11721,
+  11785, 11849, 11913, 11977, 12041, 12105, 12170, 12233,
+  12297, 12361, 12425, 12489, 12554, 12618, 12682, 12746,
+  12810, 12874, 12938, 13002, 13066, 13130, 13194, 13258,
+  13322, 13386, 13450, 13514, 13578, 13643, 13707, 13771,
+  13835, 13898, 13962, 14026, 14091, 14155, 14219, 14283,
+  14347, 14411, 14475, 14539, 14603, 14667, 14731, 14795,
+  14859, 14923, 14987, 15051, 15116, 15180, 15244, 15308,
+  15372, 15436, 15500, 15564, 15628, 15692, 15756, 15820,
+  15884, 15948, 16012, 16076, 16140, 16205, 16269, 16333,
+  16396, 16460, 16524, 16588, 16653, 16717, 16781, 16845,
+  16909, 16973, 17037, 17101, 17165, 17229, 17293, 17357,
+  17421, 17485, 17549, 17613, 17677, 17742, 17806, 17870,
+  17934, 17997, 18061, 18126, 18190, 18254, 18318, 18382,
+  18446, 18510, 18574, 18638, 18702, 18767, 18831, 18895,
+  18958, 19022, 19086, 19150, 19215, 19279, 19343, 19407,
+  19471, 19535, 19599, 19663, 19727, 19791, 19855, 19919,
+  19983, 20047, 20111, 20175, 20239, 20304, 20368, 20432,
+  20496, 20559, 20623, 20687, 20752, 20816, 20880, 20944,
+  21008, 21072, 21136, 21200, 21264, 21329, 21393, 21457,
+  21520, 21584, 21648, 21712, 21777, 21841, 21905, 21969,
+  22033, 22097, 22160, 22225, 22289, 22353, 22417, 22481,
+  22545, 22609, 22673, 22737, 22801, 22866, 22930, 22994,
+  23058, 23121, 23185, 23249, 23314, 23378, 23442, 23506,
+  23570, 23634, 23698, 23762, 23826, 23891, 23955, 24019,
+  24082, 24146, 24210, 24274, 24339, 24403, 24467, 24531,
+  24595, 24658, 24722, 24786, 24851, 24915, 24980, 25043,
+  25107, 25171, 25235, 25299, 25363, 25428, 25492, 25556,
+  25619, 25683, 25747, 25811, 25876, 25940, 26004, 26068,
+  26132, 26195, 26259, 26324, 26388, 26453, 26517, 26581,
+  26644, 26708, 26772, 26836, 26900, 26965, 27029, 27093,
+  27157, 27220, 27284, 27348, 27413, 27477, 27542, 27606,
+  27669, 27732, 27796, 27861, 27925, 27990, 28054, 28118,
+  28181, 28245, 28309, 28373, 28438, 28502, 28567, 28630,
+  28694, 28757, 28821, 28885, 28950, 29015, 29079, 29143,
+  29206, 29269, 29333, 29398, 29462, 29527, 29592, 29655,
+  29719, 29782, 29845, 29910, 29975, 30040, 30104, 30168,
+  30231, 30294, 30357, 30422, 30487, 30553, 30617, 30681,
+  30743, 30806, 30869, 30934, 31000, 31066, 31130, 31193,
+  31256, 31318, 31381, 31446, 31512, 31579, 31644, 31706,
+  31768, 31829, 31892, 31958, 32025, 32093, 32159, 32220,
+  32278, 32337, 32399, 32468, 32543, 32617, 32681, 32725,
+  32741, 32725, 32681, 32617, 32543, 32468, 32399, 32337,
+  32278, 32220, 32159, 32093, 32025, 31958, 31892, 31829,
+  31768, 31706, 31644, 31579, 31512, 31446, 31381, 31318,
+  31256, 31193, 31130, 31066, 31000, 30934, 30869, 30806,
+  30743, 30681, 30617, 30553, 30487, 30422, 30357, 30294,
+  30231, 30168, 30104, 30040, 29975, 29910, 29845, 29782,
+  29719, 29655, 29592, 29527, 29462, 29398, 29333, 29269,
+  29206, 29143, 29079, 29015, 28950, 28885, 28821, 28757,
+  28694, 28630, 28567, 28502, 28438, 28373, 28309, 28245,
+  28181, 28118, 28054, 27990, 27925, 27861, 27796, 27732,
+  27669, 27606, 27542, 27477, 27413, 27348, 27284, 27220,
+  27157, 27093, 27029, 26965, 26900, 26836, 26772, 26708,
+  26644, 26581, 26517, 26453, 26388, 26324, 26259, 26195,
+  26132, 26068, 26004, 25940, 25876, 25811, 25747, 25683,
+  25619, 25556, 25492, 25428, 25363, 25299, 25235, 25171,
+  25107, 25043, 24980, 24915, 24851, 24786, 24722, 24658,
+  24595, 24531, 24467, 24403, 24339, 24274, 24210, 24146,
+  24082, 24019, 23955, 23891, 23826, 23762, 23698, 23634,
+  23570, 23506, 23442, 23378, 23314, 23249, 23185, 23121,
+  23058, 22994, 22930, 22866, 22801, 22737, 22673, 22609,
+  22545, 22481, 22417, 22353, 22289, 22225, 22160, 22097,
+  22033, 21969, 21905, 21841, 21777, 21712, 21648, 21584,
+  21520, 21457, 21393, 21329, 21264, 21200, 21136, 21072,
+  21008, 20944, 20880, 20816, 20752, 20687, 20623, 20559,
+  20496, 20432, 20368, 20304, 20239, 20175, 20111, 20047,
+  19983, 19919, 19855, 19791, 19727, 19663, 19599, 19535,
+  19471, 19407, 19343, 19279, 19215, 19150, 19086, 19022,
+  18958, 18895, 18831, 18767, 18702, 18638, 18574, 18510,
+  18446, 18382, 18318, 18254, 18190, 18126, 18061, 17997,
+  17934, 17870, 17806, 17742, 17677, 17613, 17549, 17485,
+  17421, 17357, 17293, 17229, 17165, 17101, 17037, 16973,
+  16909, 16845, 16781, 16717, 16653, 16588, 16524, 16460,
+  16396, 16333, 16269, 16205, 16140, 16076, 16012, 15948,
+  15884, 15820, 15756, 15692, 15628, 15564, 15500, 15436,
+  15372, 15308, 15244, 15180, 15116, 15051, 14987, 14923,
+  14859, 14795, 14731, 14667, 14603, 14539, 14475, 14411,
+  14347, 14283, 14219, 14155, 14091, 14026, 13962, 13898,
+  13835, 13771, 13707, 13643, 13578, 13514, 13450, 13386,
+  13322, 13258, 13194, 13130, 13066, 13002, 12938, 12874,
+  12810, 12746, 12682, 12618, 12554, 12489, 12425, 12361,
+  12297, 12233, 12170, 12105, 12041, 11977, 11913, 11849,
+  11785, 11721, 11657, 11593, 11529, 11465, 11400, 11336,
+  11273, 11209, 11145, 11081, 11016, 10952, 10888, 10824,
+  10760, 10696, 10632, 10568, 10504, 10440, 10376, 10312,
+  10248, 10184, 10120, 10056, 9992, 9927, 9863, 9799,
+  9735, 9672, 9608, 9543, 9479, 9415, 9351, 9287,
+  9223, 9159, 9095, 9031, 8967, 8903, 8839, 8775,
+  8711, 8647, 8583, 8519, 8454, 8390, 8326, 8262,
+  8198, 8134, 8070, 8006, 7942, 7878, 7814, 7750,
+  7686, 7622, 7558, 7494, 7430, 7365, 7301, 7237,
+  7173, 7110, 7046, 6981, 6917, 6853, 6789, 6725,
+  6661, 6597, 6533, 6469, 6405, 6341, 6277, 6213,
+  6149, 6085, 6021, 5957, 5892, 5828, 5764, 5700,
+  5636, 5572, 5508, 5444, 5380, 5316, 5252, 5188,
+  5124, 5060, 4996, 4932, 4868, 4804, 4739, 4675,
+  4612, 4548, 4484, 4420, 4355, 4291, 4227, 4163,
+  4099, 4035, 3971, 3907, 3843, 3779, 3715, 3651,
+  3587, 3523, 3459, 3395, 3331, 3266, 3202, 3138,
+  3074, 3010, 2946, 2882, 2818, 2754, 2690, 2626,
+  2562, 2498, 2434, 2370, 2306, 2242, 2177, 2113,
+  2050, 1986, 1922, 1858, 1793, 1729, 1665, 1601,
+  1537, 1473, 1409, 1345, 1281, 1217, 1153, 1089,
+  1025, 961, 897, 833, 769, 704, 640, 576,
+  512, 448, 384, 320, 256, 192, 128, 64,
+  0, -64, -128, -192, -256, -320, -384, -448,
+  -512, -576, -640, -704, -769, -833, -897, -961,
+  -1025, -1089, -1153, -1217, -1281, -1345, -1409, -1473,
+  -1537, -1601, -1665, -1729, -1793, -1858, -1922, -1986,
+  -2050, -2113, -2177, -2242, -2306, -2370, -2434, -2498,
+  -2562, -2626, -2690, -2754, -2818, -2882, -2946, -3010,
+  -3074, -3138, -3202, -3266, -3331, -3395, -3459, -3523,
+  -3587, -3651, -3715, -3779, -3843, -3907, -3971, -4035,
+  -4099, -4163, -4227, -4291, -4355, -4420, -4484, -4548,
+  -4612, -4675, -4739, -4804, -4868, -4932, -4996, -5060,
+  -5124, -5188, -5252, -5316, -5380, -5444, -5508, -5572,
+  -5636, -5700, -5764, -5828, -5892, -5957, -6021, -6085,
+  -6149, -6213, -6277, -6341, -6405, -6469, -6533, -6597,
+  -6661, -6725, -6789, -6853, -6917, -6981, -7046, -7110,
+  -7173, -7237, -7301, -7365, -7430, -7494, -7558, -7622,
+  -7686, -7750, -7814, -7878, -7942, -8006, -8070, -8134,
+  -8198, -8262, -8326, -8390, -8454, -8519, -8583, -8647,
+  -8711, -8775, -8839, -8903, -8967, -9031, -9095, -9159,
+  -9223, -9287, -9351, -9415, -9479, -9543, -9608, -9672,
+  -9735, -9799, -9863, -9927, -9992, -10056, -10120, -10184,
+  -10248, -10312, -10376, -10440, -10504, -10568, -10632, -10696,
+  -10760, -10824, -10888, -10952, -11016, -11081, -11145, -11209,
+  -11273, -11336, -11400, -11465, -11529, -11593, -11657, -11721,
+  -11785, -11849, -11913, -11977, -12041, -12105, -12170, -12233,
+  -12297, -12361, -12425, -12489, -12554, -12618, -12682, -12746,
+  -12810, -12874, -12938, -13002, -13066, -13130, -13194, -13258,
+  -13322, -13386, -13450, -13514, -13578, -13643, -13707, -13771,
+  -13835, -13898, -13962, -14026, -14091, -14155, -14219, -14283,
+  -14347, -14411, -14475, -14539, -14603, -14667, -14731, -14795,
+  -14859, -14923, -14987, -15051, -15116, -15180, -15244, -15308,
+  -15372, -15436, -15500, -15564, -15628, -15692, -15756, -15820,
+  -15884, -15948, -16012, -16076, -16140, -16205, -16269, -16333,
+  -16396, -16460, -16524, -16588, -16653, -16717, -16781, -16845,
+  -16909, -16973, -17037, -17101, -17165, -17229, -17293, -17357,
+  -17421, -17485, -17549, -17613, -17677, -17742, -17806, -17870,
+  -17934, -17997, -18061, -18126, -18190, -18254, -18318, -18382,
+  -18446, -18510, -18574, -18638, -18702, -18767, -18831, -18895,
+  -18958, -19022, -19086, -19150, -19215, -19279, -19343, -19407,
+  -19471, -19535, -19599, -19663, -19727, -19791, -19855, -19919,
+  -19983, -20047, -20111, -20175, -20239, -20304, -20368, -20432,
+  -20496, -20559, -20623, -20687, -20752, -20816, -20880, -20944,
+  -21008, -21072, -21136, -21200, -21264, -21329, -21393, -21457,
+  -21520, -21584, -21648, -21712, -21777, -21841, -21905, -21969,
+  -22033, -22097, -22160, -22225, -22289, -22353, -22417, -22481,
+  -22545, -22609, -22673, -22737, -22801, -22866, -22930, -22994,
+  -23058, -23121, -23185, -23249, -23314, -23378, -23442, -23506,
+  -23570, -23634, -23698, -23762, -23826, -23891, -23955, -24019,
+  -24082, -24146, -24210, -24274, -24339, -24403, -24467, -24531,
+  -24595, -24658, -24722, -24786, -24851, -24915, -24980, -25043,
+  -25107, -25171, -25235, -25299, -25363, -25428, -25492, -25556,
+  -25619, -25683, -25747, -25811, -25876, -25940, -26004, -26068,
+  -26132, -26195, -26259, -26324, -26388, -26453, -26517, -26581,
+  -26644, -26708, -26772, -26836, -26900, -26965, -27029, -27093,
+  -27157, -27220, -27284, -27348, -27413, -27477, -27542, -27606,
+  -27669, -27732, -27796, -27861, -27925, -27990, -28054, -28118,
+  -28181, -28245, -28309, -28373, -28438, -28502, -28567, -28630,
+  -28694, -28757, -28821, -28885, -28950, -29015, -29079, -29143,
+  -29206, -29269, -29333, -29398, -29462, -29527, -29592, -29655,
+  -29719, -29782, -29845, -29910, -29975, -30040, -30104, -30168,
+  -30231, -30294, -30357, -30422, -30487, -30553, -30617, -30681,
+  -30743, -30806, -30869, -30934, -31000, -31066, -31130, -31193,
+  -31256, -31318, -31381, -31446, -31512, -31579, -31644, -31706,
+  -31768, -31829, -31892, -31958, -32025, -32093, -32159, -32220,
+  -32278, -32337, -32399, -32468, -32543, -32617, -32681, -32725,
+  -32741, -32725, -32681, -32617, -32543, -32468, -32399, -32337,
+  -32278, -32220, -32159, -32093, -32025, -31958, -31892, -31829,
+  -31768, -31706, -31644, -31579, -31512, -31446, -31381, -31318,
+  -31256, -31193, -31130, -31066, -31000, -30934, -30869, -30806,
+  -30743, -30681, -30617, -30553, -30487, -30422, -30357, -30294,
+  -30231, -30168, -30104, -30040, -29975, -29910, -29845, -29782,
+  -29719, -29655, -29592, -29527, -29462, -29398, -29333, -29269,
+  -29206, -29143, -29079, -29015, -28950, -28885, -28821, -28757,
+  -28694, -28630, -28567, -28502, -28438, -28373, -28309, -28245,
+  -28181, -28118, -28054, -27990, -27925, -27861, -27796, -27732,
+  -27669, -27606, -27542, -27477, -27413, -27348, -27284, -27220,
+  -27157, -27093, -27029, -26965, -26900, -26836, -26772, -26708,
+  -26644, -26581, -26517, -26453, -26388, -26324, -26259, -26195,
+  -26132, -26068, -26004, -25940, -25876, -25811, -25747, -25683,
+  -25619, -25556, -25492, -25428, -25363, -25299, -25235, -25171,
+  -25107, -25043, -24980, -24915, -24851, -24786, -24722, -24658,
+  -24595, -24531, -24467, -24403, -24339, -24274, -24210, -24146,
+  -24082, -24019, -23955, -23891, -23826, -23762, -23698, -23634,
+  -23570, -23506, -23442, -23378, -23314, -23249, -23185, -23121,
+  -23058, -22994, -22930, -22866, -22801, -22737, -22673, -22609,
+  -22545, -22481, -22417, -22353, -22289, -22225, -22160, -22097,
+  -22033, -21969, -21905, -21841, -21777, -21712, -21648, -21584,
+  -21520, -21457, -21393, -21329, -21264, -21200, -21136, -21072,
+  -21008, -20944, -20880, -20816, -20752, -20687, -20623, -20559,
+  -20496, -20432, -20368, -20304, -20239, -20175, -20111, -20047,
+  -19983, -19919, -19855, -19791, -19727, -19663, -19599, -19535,
+  -19471, -19407, -19343, -19279, -19215, -19150, -19086, -19022,
+  -18958, -18895, -18831, -18767, -18702, -18638, -18574, -18510,
+  -18446, -18382, -18318, -18254, -18190, -18126, -18061, -17997,
+  -17934, -17870, -17806, -17742, -17677, -17613, -17549, -17485,
+  -17421, -17357, -17293, -17229, -17165, -17101, -17037, -16973,
+  -16909, -16845, -16781, -16717, -16653, -16588, -16524, -16460,
+  -16396, -16333, -16269, -16205, -16140, -16076, -16012, -15948,
+  -15884, -15820, -15756, -15692, -15628, -15564, -15500, -15436,
+  -15372, -15308, -15244, -15180, -15116, -15051, -14987, -14923,
+  -14859, -14795, -14731, -14667, -14603, -14539, -14475, -14411,
+  -14347, -14283, -14219, -14155, -14091, -14026, -13962, -13898,
+  -13835, -13771, -13707, -13643, -13578, -13514, -13450, -13386,
+  -13322, -13258, -13194, -13130, -13066, -13002, -12938, -12874,
+  -12810, -12746, -12682, -12618, -12554, -12489, -12425, -12361,
+  -12297, -12233, -12170, -12105, -12041, -11977, -11913, -11849,
+  -11785, -11721, -11657, -11593, -11529, -11465, -11400, -11336,
+  -11273, -11209, -11145, -11081, -11016, -10952, -10888, -10824,
+  -10760, -10696, -10632, -10568, -10504, -10440, -10376, -10312,
+  -10248, -10184, -10120, -10056, -9992, -9927, -9863, -9799,
+  -9735, -9672, -9608, -9543, -9479, -9415, -9351, -9287,
+  -9223, -9159, -9095, -9031, -8967, -8903, -8839, -8775,
+  -8711, -8647, -8583, -8519, -8454, -8390, -8326, -8262,
+  -8198, -8134, -8070, -8006, -7942, -7878, -7814, -7750,
+  -7686, -7622, -7558, -7494, -7430, -7365, -7301, -7237,
+  -7173, -7110, -7046, -6981, -6917, -6853, -6789, -6725,
+  -6661, -6597, -6533, -6469, -6405, -6341, -6277, -6213,
+  -6149, -6085, -6021, -5957, -5892, -5828, -5764, -5700,
+  -5636, -5572, -5508, -5444, -5380, -5316, -5252, -5188,
+  -5124, -5060, -4996, -4932, -4868, -4804, -4739, -4675,
+  -4612, -4548, -4484, -4420, -4355, -4291, -4227, -4163,
+  -4099, -4035, -3971, -3907, -3843, -3779, -3715, -3651,
+  -3587, -3523, -3459, -3395, -3331, -3266, -3202, -3138,
+  -3074, -3010, -2946, -2882, -2818, -2754, -2690, -2626,
+  -2562, -2498, -2434, -2370, -2306, -2242, -2177, -2113,
+  -2050, -1986, -1922, -1858, -1793, -1729, -1665, -1601,
+  -1537, -1473, -1409, -1345, -1281, -1217, -1153, -1089,
+  -1025, -961, -897, -833, -769, -704, -640, -576,
+  -512, -448, -384, -320, -256, -192, -128, -64,
+  0
+};
+
+static const int16_t hifi_wavetable_triangle_2[2049] =
+{
+  0, 64, 128, 191, 255, 319, 384, 448,
+  512, 577, 641, 705, 769, 833, 897, 961,
+  1025, 1089, 1152, 1216, 1280, 1344, 1408, 1473,
+  1537, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+  2050, 2113, 2177, 2241, 2305, 2369, 2433, 2498,
+  2562, 2626, 2691, 2755, 2819, 2883, 2947, 3011,
+  3074, 3138, 3202, 3266, 3330, 3394, 3458, 3522,
+  3587, 3651, 3715, 3780, 3844, 3908, 3972, 4035,
+  4099, 4163, 4227, 4290, 4354, 4419, 4483, 4547,
+  4612, 4676, 4740, 4804, 4869, 4933, 4996, 5060,
+  5124, 5188, 5251, 5315, 5379, 5443, 5508, 5572,
+  5636, 5701, 5765, 5829, 5893, 5957, 6021, 6085,
+  6149, 6212, 6276, 6340, 6404, 6468, 6532, 6597,
+  6661, 6725, 6790, 6854, 6918, 6982, 7046, 7110,
+  7173, 7237, 7301, 7365, 7429, 7493, 7557, 7621,
+  7686, 7750, 7815, 7879, 7943, 8007, 8071, 8135,
+  8198, 8262, 8326, 8390, 8454, 8518, 8582, 8646,
+  8711, 8775, 8839, 8904, 8968, 9032, 9096, 9159,
+  9223, 9287, 9350, 9414, 9478, 9542, 9607, 9671,
+  9735, 9800, 9864, 9928, 9993, 10056, 10120, 10184,
+  10248, 10311, 10375, 10439, 10503, 10567, 10631, 10696,
+  10760, 10825, 10889, 10953, 11017, 11081, 11145, 11209,
+  11273, 11336, 11400, 11464, 11528, 11592, 11656, 11721,
+  11785, 11849, 11914, 11978, 12042, 12106, 12170, 12234,
+  12297, 12361, 12425, 12489, 12553, 12617, 12681, 12745,
+  12810, 12874, 12939, 13003, 13067, 13131, 13195, 13258,
+  13322, 13386, 13450, 13513, 13577, 13641, 13706, 13770,
+  13835, 13899, 13963, 14028, 14092, 14156, 14220, 14283,
+  14347, 14411, 14474, 14538, 14602, 14666, 14730, 14795,
+  14859, 14924, 14988, 15052, 15117, 15181, 15244, 15308,
+  15372, 15435, 15499, 15563, 15627, 15691, 15755, 15820,
+  15884, 15949, 16013, 16077, 16141, 16205, 16269, 16333,
+  16396, 16460, 16524, 16588, 16652, 16716, 16780, 16844,
+  16909, 16973, 17038, 17102, 17166, 17230, 17294, 17358,
+  17421, 17485, 17548, 17612, 17676, 17740, 17805, 17869,
+  17934, 17998, 18063, 18127, 18191, 18255, 18319, 18382,
+  18446, 18510, 18573, 18637, 18701, 18765, 18829, 18894,
+  18958, 19023, 19087, 19152, 19216, 19280, 19344, 19407,
+  19471, 19534, 19598, 19662, 19726, 19790, 19854, 19919,
+  19983, 20048, 20112, 20177, 20241, 20305, 20368, 20432,
+  20496, 20559, 20623, 20686, 20750, 20814, 20879, 20943,
+  21008, 21073, 21137, 21202, 21266, 21330, 21393, 21457,
+  21520, 21584, 21647, 21711, 21775, 21839, 21904, 21968,
+  22033, 22097, 22162, 22226, 22291, 22355, 22418, 22482,
+  22545, 22608, 22672, 22736, 22800, 22864, 22928, 22993,
+  23058, 23122, 23187, 23251, 23316, 23379, 23443, 23507,
+  23570, 23633, 23697, 23760, 23824, 23888, 23953, 24018,
+  24082, 24147, 24212, 24276, 24341, 24404, 24468, 24531,
+  24595, 24658, 24721, 24785, 24849, 24913, 24978, 25042,
+  25107, 25172, 25237, 25301, 25366, 25429, 25493, 25556,
+  25619, 25683, 25746, 25809, 25873, 25937, 26002, 26067,
+  26132, 26197, 26262, 26327, 26391, 26455, 26518, 26581,
+  26644, 26707, 26770, 26834, 26898, 26962, 27027, 27092,
+  27157, 27222, 27287, 27352, 27416, 27480, 27543, 27606,
+  27669, 27732, 27795, 27858, 27922, 27986, 28051, 28116,
+  28182, 28247, 28312, 28377, 28442, 28505, 28568, 28631,
+  28694, 28756, 28819, 28882, 28946, 29010, 29075, 29141,
+  29207, 29273, 29338, 29403, 29467, 29531, 29594, 29656,
+  29718, 29780, 29842, 29905, 29969, 30034, 30099, 30165,
+  30232, 30298, 30365, 30430, 30494, 30558, 30620, 30681,
+  30742, 30803, 30865, 30927, 30991, 31056, 31122, 31190,
+  31258, 31326, 31394, 31460, 31524, 31587, 31647, 31706,
+  31764, 31822, 31881, 31942, 32006, 32073, 32144, 32217,
+  32293, 32368, 32441, 32509, 32569, 32620, 32658, 32681,
+  32689, 32681, 32658, 32620, 32569, 32509, 32441, 32368,
+  32293, 32217, 32144, 32073, 32006, 31942, 31881, 31822,
+  31764, 31706, 31647, 31587, 31524, 31460, 31394, 31326,
+  31258, 31190, 31122, 31056, 30991, 30927, 30865, 30803,
+  30742, 30681, 30620, 30558, 30494, 30430, 30365, 30298,
+  30232, 30165, 30099, 30034, 29969, 29905, 29842, 29780,
+  29718, 29656, 29594, 29531, 29467, 29403, 29338, 29273,
+  29207, 29141, 29075, 29010, 28946, 28882, 28819, 28756,
+  28694, 28631, 28568, 28505, 28442, 28377, 28312, 28247,
+  28182, 28116, 28051, 27986, 27922, 27858, 27795, 27732,
+  27669, 27606, 27543, 27480, 27416, 27352, 27287, 27222,
+  27157, 27092, 27027, 26962, 26898, 26834, 26770, 26707,
+  26644, 26581, 26518, 26455, 26391, 26327, 26262, 26197,
+  26132, 26067, 26002, 25937, 25873, 25809, 25746, 25683,
+  25619, 25556, 25493, 25429, 25366, 25301, 25237, 25172,
+  25107, 25042, 24978, 24913, 24849, 24785, 24721, 24658,
+  24595, 24531, 24468, 24404, 24341, 24276, 24212, 24147,
+  24082, 24018, 23953, 23888, 23824, 23760, 23697, 23633,
+  23570, 23507, 23443, 23379, 23316, 23251, 23187, 23122,
+  23058, 22993, 22928, 22864, 22800, 22736, 22672, 22608,
+  22545, 22482, 22418, 22355, 22291, 22226, 22162, 22097,
+  22033, 21968, 21904, 21839, 21775, 21711, 21647, 21584,
+  21520, 21457, 21393, 21330, 21266, 21202, 21137, 21073,
+  21008, 20943, 20879, 20814, 20750, 20686, 20623, 20559,
+  20496, 20432, 20368, 20305, 20241, 20177, 20112, 20048,
+  19983, 19919, 19854, 19790, 19726, 19662, 19598, 19534,
+  19471, 19407, 19344, 19280, 19216, 19152, 19087, 19023,
+  18958, 18894, 18829, 18765, 18701, 18637, 18573, 18510,
+  18446, 18382, 18319, 18255, 18191, 18127, 18063, 17998,
+  17934, 17869, 17805, 17740, 17676, 17612, 17548, 17485,
+  17421, 17358, 17294, 17230, 17166, 17102, 17038, 16973,
+  16909, 16844, 16780, 16716, 16652, 16588, 16524, 16460,
+  16396, 16333, 16269, 16205, 16141, 16077, 16013, 15949,
+  15884, 15820, 15755, 15691, 15627, 15563, 15499, 15435,
+  15372, 15308, 15244, 15181, 15117, 15052, 14988, 14924,
+  14859, 14795, 14730, 14666, 14602, 14538, 14474, 14411,
+  14347, 14283, 14220, 14156, 14092, 14028, 13963, 13899,
+  13835, 13770, 13706, 13641, 13577, 13513, 13450, 13386,
+  13322, 13258, 13195, 13131, 13067, 13003, 12939, 12874,
+  12810, 12745, 12681, 12617, 12553, 12489, 12425, 12361,
+  12297, 12234, 12170, 12106, 12042, 11978, 11914, 11849,
+  11785, 11721, 11656, 11592, 11528, 11464, 11400, 11336,
+  11273, 11209, 11145, 11081, 11017, 10953, 10889, 10825,
+  10760, 10696, 10631, 10567, 10503, 10439, 10375, 10311,
+  10248, 10184, 10120, 10056, 9993, 9928, 9864, 9800,
+  9735, 9671, 9607, 9542, 9478, 9414, 9350, 9287,
+  9223, 9159, 9096, 9032, 8968, 8904, 8839, 8775,
+  8711, 8646, 8582, 8518, 8454, 8390, 8326, 8262,
+  8198, 8135, 8071, 8007, 7943, 7879, 7815, 7750,
+  7686, 7621, 7557, 7493, 7429, 7365, 7301, 7237,
+  7173, 7110, 7046, 6982, 6918, 6854, 6790, 6725,
+  6661, 6597, 6532, 6468, 6404, 6340, 6276, 6212,
+  6149, 6085, 6021, 5957, 5893, 5829, 5765, 5701,
+  5636, 5572, 5508, 5443, 5379, 5315, 5251, 5188,
+  5124, 5060, 4996, 4933, 4869, 4804, 4740, 4676,
+  4612, 4547, 4483, 4419, 4354, 4290, 4227, 4163,
+  4099, 4035, 3972, 3908, 3844, 3780, 3715, 3651,
+  3587, 3522, 3458, 3394, 3330, 3266, 3202, 3138,
+  3074, 3011, 2947, 2883, 2819, 2755, 2691, 2626,
+  2562, 2498, 2433, 2369, 2305, 2241, 2177, 2113,
+  2050, 1986, 1922, 1858, 1794, 1730, 1666, 1602,
+  1537, 1473, 1408, 1344, 1280, 1216, 1152, 1089,
+  1025, 961, 897, 833, 769, 705, 641, 577,
+  512, 448, 384, 319, 255, 191, 128, 64,
+  0, -64, -128, -191, -255, -319, -384, -448,
+  -512, -577, -641, -705, -769, -833, -897, -961,
+  -1025, -1089, -1152, -1216, -1280, -1344, -1408, -1473,
+  -1537, -1602, -1666, -1730, -1794, -1858, -1922, -1986,
+  -2050, -2113, -2177, -2241, -2305, -2369, -2433, -2498,
+  -2562, -2626, -2691, -2755, -2819, -2883, -2947, -3011,
+  -3074, -3138, -3202, -3266, -3330, -3394, -3458, -3522,
+  -3587, -3651, -3715, -3780, -3844, -3908, -3972, -4035,
+  -4099, -4163, -4227, -4290, -4354, -4419, -4483, -4547,
+  -4612, -4676, -4740, -4804, -4869, -4933, -4996, -5060,
+  -5124, -5188, -5251, -5315, -5379, -5443, -5508, -5572,
+  -5636, -5701, -5765, -5829, -5893, -5957, -6021, -6085,
+  -6149, -6212, -6276, -6340, -6404, -6468, -6532, -6597,
+  -6661, -6725, -6790, -6854, -6918, -6982, -7046, -7110,
+  -7173, -7237, -7301, -7365, -7429, -7493, -7557, -7621,
+  -7686, -7750, -7815, -7879, -7943, -8007, -8071, -8135,
+  -8198, -8262, -8326, -8390, -8454, -8518, -8582, -8646,
+  -8711, -8775, -8839, -8904, -8968, -9032, -9096, -9159,
+  -9223, -9287, -9350, -9414, -9478, -9542, -9607, -9671,
+  -9735, -9800, -9864, -9928, -9993, -10056, -10120, -10184,
+  -10248, -10311, -10375, -10439, -10503, -10567, -10631, -10696,
+  -10760, -10825, -10889, -10953, -11017, -11081, -11145, -11209,
+  -11273, -11336, -11400, -11464, -11528, -11592, -11656, -11721,
+  -11785, -11849, -11914, -11978, -12042, -12106, -12170, -12234,
+  -12297, -12361, -12425, -12489, -12553, -12617, -12681, -12745,
+  -12810, -12874, -12939, -13003, -13067, -13131, -13195, -13258,
+  -13322, -13386, -13450, -13513, -13577, -13641, -13706, -13770,
+  -13835, -13899, -13963, -14028, -14092, -14156, -14220, -14283,
+  -14347, -14411, -14474, -14538, -14602, -14666, -14730, -14795,
+  -14859, -14924, -14988, -15052, -15117, -15181, -15244, -15308,
+  -15372, -15435, -15499, -15563, -15627, -15691, -15755, -15820,
+  -15884, -15949, -16013, -16077, -16141, -16205, -16269, -16333,
+  -16396, -16460, -16524, -16588, -16652, -16716, -16780, -16844,
+  -16909, -16973, -17038, -17102, -17166, -17230, -17294, -17358,
+  -17421, -17485, -17548, -17612, -17676, -17740, -17805, -17869,
+  -17934, -17998, -18063, -18127, -18191, -18255, -18319, -18382,
+  -18446, -18510, -18573, -18637, -18701, -18765, -18829, -18894,
+  -18958, -19023, -19087, -19152, -19216, -19280, -19344, -19407,
+  -19471, -19534, -19598, -19662, -19726, -19790, -19854, -19919,
+  -19983, -20048, -20112, -20177, -20241, -20305, -20368, -20432,
+  -20496, -20559, -20623, -20686, -20750, -20814, -20879, -20943,
+  -21008, -21073, -21137, -21202, -21266, -21330, -21393, -21457,
+  -21520, -21584, -21647, -21711, -21775, -21839, -21904, -21968,
+  -22033, -22097, -22162, -22226, -22291, -22355, -22418, -22482,
+  -22545, -22608, -22672, -22736, -22800, -22864, -22928, -22993,
+  -23058, -23122, -23187, -23251, -23316, -23379, -23443, -23507,
+  -23570, -23633, -23697, -23760, -23824, -23888, -23953, -24018,
+  -24082, -24147, -24212, -24276, -24341, -24404, -24468, -24531,
+  -24595, -24658, -24721, -24785, -24849, -24913, -24978, -25042,
+  -25107, -25172, -25237, -25301, -25366, -25429, -25493, -25556,
+  -25619, -25683, -25746, -25809, -25873, -25937, -26002, -26067,
+  -26132, -26197, -26262, -26327, -26391, -26455, -26518, -26581,
+  -26644, -26707, -26770, -26834, -26898, -26962, -27027, -27092,
+  -27157, -27222, -27287, -27352, -27416, -27480, -27543, -27606,
+  -27669, -27732, -27795, -27858, -27922, -27986, -28051, -28116,
+  -28182, -28247, -28312, -28377, -28442, -28505, -28568, -28631,
+  -28694, -28756, -28819, -28882, -28946, -29010, -29075, -29141,
+  -29207, -29273, -29338, -29403, -29467, -29531, -29594, -29656,
+  -29718, -29780, -29842, -29905, -29969, -30034, -30099, -30165,
+  -30232, -30298, -30365, -30430, -30494, -30558, -30620, -30681,
+  -30742, -30803, -30865, -30927, -30991, -31056, -31122, -31190,
+  -31258, -31326, -31394, -31460, -31524, -31587, -31647, -31706,
+  -31764, -31822, -31881, -31942, -32006, -32073, -32144, -32217,
+  -32293, -32368, -32441, -32509, -32569, -32620, -32658, -32681,
+  -32689, -32681, -32658, -32620, -32569, -32509, -32441, -32368,
+  -32293, -32217, -32144, -32073, -32006, -31942, -31881, -31822,
+  -31764, -31706, -31647, -31587, -31524, -31460, -31394, -31326,
+  -31258, -31190, -31122, -31056, -30991, -30927, -30865, -30803,
+  -30742, -30681, -30620, -30558, -30494, -30430, -30365, -30298,
+  -30232, -30165, -30099, -30034, -29969, -29905, -29842, -29780,
+  -29718, -29656, -29594, -29531, -29467, -29403, -29338, -29273,
+  -29207, -29141, -29075, -29010, -28946, -28882, -28819, -28756,
+  -28694, -28631, -28568, -28505, -28442, -28377, -28312, -28247,
+  -28182, -28116, -28051, -27986, -27922, -27858, -27795, -27732,
+  -27669, -27606, -27543, -27480, -27416, -27352, -27287, -27222,
+  -27157, -27092, -27027, -26962, -26898, -26834, -26770, -26707,
+  -26644, -26581, -26518, -26455, -26391, -26327, -26262, -26197,
+  -26132, -26067, -26002, -25937, -25873, -25809, -25746, -25683,
+  -25619, -25556, -25493, -25429, -25366, -25301, -25237, -25172,
+  -25107, -25042, -24978, -24913, -24849, -24785, -24721, -24658,
+  -24595, -24531, -24468, -24404, -24341, -24276, -24212, -24147,
+  -24082, -24018, -23953, -23888, -23824, -23760, -23697, -23633,
+  -23570, -23507, -23443, -23379, -23316, -23251, -23187, -23122,
+  -23058, -22993, -22928, -22864, -22800, -22736, -22672, -22608,
+  -22545, -22482, -22418, -22355, -22291, -22226, -22162, -22097,
+  -22033, -21968, -21904, -21839, -21775, -21711, -21647, -21584,
+  -21520, -21457, -21393, -21330, -21266, -21202, -21137, -21073,
+  -21008, -20943, -20879, -20814, -20750, -20686, -20623, -20559,
+  -20496, -20432, -20368, -20305, -20241, -20177, -20112, -20048,
+  -19983, -19919, -19854, -19790, -19726, -19662, -19598, -19534,
+  -19471, -19407, -19344, -19280, -19216, -19152, -19087, -19023,
+  -18958, -18894, -18829, -18765, -18701, -18637, -18573, -18510,
+  -18446, -18382, -18319, -18255, -18191, -18127, -18063, -17998,
+  -17934, -17869, -17805, -17740, -17676, -17612, -17548, -17485,
+  -17421, -17358, -17294, -17230, -17166, -17102, -17038, -16973,
+  -16909, -16844, -16780, -16716, -16652, -16588, -16524, -16460,
+  -16396, -16333, -16269, -16205, -16141, -16077, -16013, -15949,
+  -15884, -15820, -15755, -15691, -15627, -15563, -15499, -15435,
+  -15372, -15308, -15244, -15181, -15117, -15052, -14988, -14924,
+  -14859, -14795, -14730, -14666, -14602, -14538, -14474, -14411,
+  -14347, -14283, -14220, -14156, -14092, -14028, -13963, -13899,
+  -13835, -13770, -13706, -13641, -13577, -13513, -13450, -13386,
+  -13322, -13258, -13195, -13131, -13067, -13003, -12939, -12874,
+  -12810, -12745, -12681, -12617, -12553, -12489, -12425, -12361,
+  -12297, -12234, -12170, -12106, -12042, -11978, -11914, -11849,
+  -11785, -11721, -11656, -11592, -11528, -11464, -11400, -11336,
+  -11273, -11209, -11145, -11081, -11017, -10953, -10889, -10825,
+  -10760, -10696, -10631, -10567, -10503, -10439, -10375, -10311,
+  -10248, -10184, -10120, -10056, -9993, -9928, -9864, -9800,
+  -9735, -9671, -9607, -9542, -9478, -9414, -9350, -9287,
+  -9223, -9159, -9096, -9032, -8968, -8904, -8839, -8775,
+  -8711, -8646, -8582, -8518, -8454, -8390, -8326, -8262,
+  -8198, -8135, -8071, -8007, -7943, -7879, -7815, -7750,
+  -7686, -7621, -7557, -7493, -7429, -7365, -7301, -7237,
+  -7173, -7110, -7046, -6982, -6918, -6854, -6790, -6725,
+  -6661, -6597, -6532, -6468, -6404, -6340, -6276, -6212,
+  -6149, -6085, -6021, -5957, -5893, -5829, -5765, -5701,
+  -5636, -5572, -5508, -5443, -5379, -5315, -5251, -5188,
+  -5124, -5060, -4996, -4933, -4869, -4804, -4740, -4676,
+  -4612, -4547, -4483, -4419, -4354, -4290, -4227, -4163,
+  -4099, -4035, -3972, -3908, -3844, -3780, -3715, -3651,
+  -3587, -3522, -3458, -3394, -3330, -3266, -3202, -3138,
+  -3074, -3011, -2947, -2883, -2819, -2755, -2691, -2626,
+  -2562, -2498, -2433, -2369, -2305, -2241, -2177, -2113,
+  -2050, -1986, -1922, -1858, -1794, -1730, -1666, -1602,
+  -1537, -1473, -1408, -1344, -1280, -1216, -1152, -1089,
+  -1025, -961, -897, -833, -769, -705, -641, -577,
+  -512, -448, -384, -319, -255, -191, -128, -64,
+  0
+};
+
+static const int16_t hifi_wavetable_triangle_3[1025] =
+{
+  0, 127, 254, 381, 509, 637, 766, 895,
+  1025, 1154, 1283, 1412, 1540, 1668, 1796, 1923,
+  2050, 2176, 2303, 2431, 2559, 2687, 2816, 2945,
+  3074, 3204, 3333, 3462, 3590, 3718, 3845, 3972,
+  4099, 4226, 4353, 4480, 4608, 4737, 4865, 4995,
+  5124, 5253, 5382, 5511, 5640, 5767, 5895, 6022,
+  6149, 6275, 6402, 6530, 6658, 6786, 6915, 7044,
+  7173, 7303, 7432, 7561, 7689, 7817, 7944, 8071,
+  8198, 8325, 8452, 8579, 8707, 8835, 8964, 9094,
+  9223, 9353, 9482, 9611, 9739, 9867, 9994, 10121,
+  10248, 10374, 10501, 10629, 10756, 10885, 11014, 11143,
+  11273, 11402, 11532, 11660, 11789, 11917, 12044, 12171,
+  12297, 12424, 12551, 12678, 12806, 12934, 13063, 13193,
+  13322, 13452, 13581, 13710, 13839, 13966, 14094, 14220,
+  14347, 14473, 14600, 14727, 14855, 14983, 15113, 15242,
+  15372, 15502, 15631, 15760, 15889, 16016, 16143, 16270,
+  16396, 16523, 16649, 16776, 16904, 17033, 17162, 17291,
+  17421, 17551, 17681, 17810, 17939, 18066, 18193, 18320,
+  18446, 18572, 18698, 18825, 18953, 19082, 19211, 19341,
+  19471, 19601, 19731, 19860, 19989, 20116, 20243, 20369,
+  20495, 20621, 20747, 20874, 21002, 21131, 21260, 21390,
+  21521, 21651, 21781, 21911, 22039, 22167, 22293, 22419,
+  22545, 22670, 22796, 22923, 23050, 23179, 23309, 23439,
+  23570, 23701, 23832, 23962, 24090, 24218, 24344, 24469,
+  24594, 24719, 24844, 24971, 25098, 25227, 25357, 25489,
+  25620, 25752, 25883, 26013, 26142, 26269, 26395, 26519,
+  26643, 26767, 26892, 27017, 27145, 27274, 27405, 27537,
+  27671, 27804, 27936, 28067, 28196, 28322, 28447, 28570,
+  28691, 28813, 28936, 29061, 29188, 29318, 29451, 29586,
+  29723, 29859, 29994, 30127, 30255, 30380, 30501, 30619,
+  30735, 30851, 30969, 31091, 31219, 31354, 31495, 31642,
+  31792, 31943, 32089, 32225, 32346, 32447, 32522, 32569,
+  32585, 32569, 32522, 32447, 32346, 32225, 32089, 31943,
+  31792, 31642, 31495, 31354, 31219, 31091, 30969, 30851,
+  30735, 30619, 30501, 30380, 30255, 30127, 29994, 29859,
+  29723, 29586, 29451, 29318, 29188, 29061, 28936, 28813,
+  28691, 28570, 28447, 28322, 28196, 28067, 27936, 27804,
+  27671, 27537, 27405, 27274, 27145, 27017, 26892, 26767,
+  26643, 26519, 26395, 26269, 26142, 26013, 25883, 25752,
+  25620, 25489, 25357, 25227, 25098, 24971, 24844, 24719,
+  24594, 24469, 24344, 24218, 24090, 23962, 23832, 23701,
+  23570, 23439, 23309, 23179, 23050, 22923, 22796, 22670,
+  22545, 22419, 22293, 22167, 22039, 21911, 21781, 21651,
+  21521, 21390, 21260, 21131, 21002, 20874, 20747, 20621,
+  20495, 20369, 20243, 20116, 19989, 19860, 19731, 19601,
+  19471, 19341, 19211, 19082, 18953, 18825, 18698, 18572,
+  18446, 18320, 18193, 18066, 17939, 17810, 17681, 17551,
+  17421, 17291, 17162, 17033, 16904, 16776, 16649, 16523,
+  16396, 16270, 16143, 16016, 15889, 15760, 15631, 15502,
+  15372, 15242, 15113, 14983, 14855, 14727, 14600, 14473,
+  14347, 14220, 14094, 13966, 13839, 13710, 13581, 13452,
+  13322, 13193, 13063, 12934, 12806, 12678, 12551, 12424,
+  12297, 12171, 12044, 11917, 11789, 11660, 11532, 11402,
+  11273, 11143, 11014, 10885, 10756, 10629, 10501, 10374,
+  10248, 10121, 9994, 9867, 9739, 9611, 9482, 9353,
+  9223, 9094, 8964, 8835, 8707, 8579, 8452, 8325,
+  8198, 8071, 7944, 7817, 7689, 7561, 7432, 7303,
+  7173, 7044, 6915, 6786, 6658, 6530, 6402, 6275,
+  6149, 6022, 5895, 5767, 5640, 5511, 5382, 5253,
+  5124, 4995, 4865, 4737, 4608, 4480, 4353, 4226,
+  4099, 3972, 3845, 3718, 3590, 3462, 3333, 3204,
+  3074, 2945, 2816, 2687, 2559, 2431, 2303, 2176,
+  2050, 1923, 1796, 1668, 1540, 1412, 1283, 1154,
+  1025, 895, 766, 637, 509, 381, 254, 127,
+  0, -127, -254, -381, -509, -637, -766, -895,
+  -1025, -1154, -1283, -1412, -1540, -1668, -1796, -1923,
+  -2050, -2176, -2303, -2431, -2559, -2687, -2816, -2945,
+  -3074, -3204, -3333, -3462, -3590, -3718, -3845, -3972,
+  -4099, -4226, -4353, -4480, -4608, -4737, -4865, -4995,
+  -5124, -5253, -5382, -5511, -5640, -5767, -5895, -6022,
+  -6149, -6275, -6402, -6530, -6658, -6786, -6915, -7044,
+  -7173, -7303, -7432, -7561, -7689, -7817, -7944, -8071,
+  -8198, -8325, -8452, -8579, -8707, -8835, -8964, -9094,
+  -9223, -9353, -9482, -9611, -9739, -9867, -9994, -10121,
+  -10248, -10374, -10501, -10629, -10756, -10885, -11014, -11143,
+  -11273, -11402, -11532, -11660, -11789, -11917, -12044, -12171,
+  -12297, -12424, -12551, -12678, -12806, -12934, -13063, -13193,
+  -13322, -13452, -13581, -13710, -13839, -13966, -14094, -14220,
+  -14347, -14473, -14600, -14727, -14855, -14983, -15113, -15242,
+  -15372, -15502, -15631, -15760, -15889, -16016, -16143, -16270,
+  -16396, -16523, -16649, -16776, -16904, -17033, -17162, -17291,
+  -17421, -17551, -17681, -17810, -17939, -18066, -18193, -18320,
+  -18446, -18572, -18698, -18825, -18953, -19082, -19211, -19341,
+  -19471, -19601, -19731, -19860, -19989, -20116, -20243, -20369,
+  -20495, -20621, -20747, -20874, -21002, -21131, -21260, -21390,
+  -21521, -21651, -21781, -21911, -22039, -22167, -22293, -22419,
+  -22545, -22670, -22796, -22923, -23050, -23179, -23309, -23439,
+  -23570, -23701, -23832, -23962, -24090, -24218, -24344, -24469,
+  -24594, -24719, -24844, -24971, -25098, -25227, -25357, -25489,
+  -25620, -25752, -25883, -26013, -26142, -26269, -26395, -26519,
+  -26643, -26767, -26892, -27017, -27145, -27274, -27405, -27537,
+  -27671, -27804, -27936, -28067, -28196, -28322, -28447, -28570,
+  -28691, -28813, -28936, -29061, -29188, -29318, -29451, -29586,
+  -29723, -29859, -29994, -30127, -30255, -30380, -30501, -30619,
+  -30735, -30851, -30969, -31091, -31219, -31354, -31495, -31642,
+  -31792, -31943, -32089, -32225, -32346, -32447, -32522, -32569,
+  -32585, -32569, -32522, -32447, -32346, -32225, -32089, -31943,
+  -31792, -31642, -31495, -31354, -31219, -31091, -30969, -30851,
+  -30735, -30619, -30501, -30380, -30255, -30127, -29994, -29859,
+  -29723, -29586, -29451, -29318, -29188, -29061, -28936, -28813,
+  -28691, -28570, -28447, -28322, -28196, -28067, -27936, -27804,
+  -27671, -27537, -27405, -27274, -27145, -27017, -26892, -26767,
+  -26643, -26519, -26395, -26269, -26142, -26013, -25883, -25752,
+  -25620, -25489, -25357, -25227, -25098, -24971, -24844, -24719,
+  -24594, -24469, -24344, -24218, -24090, -23962, -23832, -23701,
+  -23570, -23439, -23309, -23179, -23050, -22923, -22796, -22670,
+  -22545, -22419, -22293, -22167, -22039, -21911, -21781, -21651,
+  -21521, -21390, -21260, -21131, -21002, -20874, -20747, -20621,
+  -20495, -20369, -20243, -20116, -19989, -19860, -19731, -19601,
+  -19471, -19341, -19211, -19082, -18953, -18825, -18698, -18572,
+  -18446, -18320, -18193, -18066, -17939, -17810, -17681, -17551,
+  -17421, -17291, -17162, -17033, -16904, -16776, -16649, -16523,
+  -16396, -16270, -16143, -16016, -15889, -15760, -15631, -15502,
+  -15372, -15242, -15113, -14983, -14855, -14727, -14600, -14473,
+  -14347, -14220, -14094, -13966, -13839, -13710, -13581, -13452,
+  -13322, -13193, -13063, -12934, -12806, -12678, -12551, -12424,
+  -12297, -12171, -12044, -11917, -11789, -11660, -11532, -11402,
+  -11273, -11143, -11014, -10885, -10756, -10629, -10501, -10374,
+  -10248, -10121, -9994, -9867, -9739, -9611, -9482, -9353,
+  -9223, -9094, -8964, -8835, -8707, -8579, -8452, -8325,
+  -8198, -8071, -7944, -7817, -7689, -7561, -7432, -7303,
+  -7173, -7044, -6915, -6786, -6658, -6530, -6402, -6275,
+  -6149, -6022, -5895, -5767, -5640, -5511, -5382, -5253,
+  -5124, -4995, -4865, -4737, -4608, -4480, -4353, -4226,
+  -4099, -3972, -3845, -3718, -3590, -3462, -3333, -3204,
+  -3074, -2945, -2816, -2687, -2559, -2431, -2303, -2176,
+  -2050, -1923, -1796, -1668, -1540, -1412, -1283, -1154,
+  -1025, -895, -766, -637, -509, -381, -254, -127,
+  0
+};
+
+static const int16_t hifi_wavetable_triangle_4[1025] =
+{
+  0, 126, 251, 377, 503, 630, 757, 884,
+  1012, 1140, 1269, 1398, 1528, 1658, 1788, 1919,
+  2050, 2180, 2311, 2441, 2571, 2701, 2830, 2959,
+  3087, 3215, 3343, 3469, 3596, 3722, 3848, 3973,
+  4099, 4224, 4350, 4476, 4602, 4728, 4855, 4983,
+  5111, 5239, 5368, 5497, 5627, 5757, 5888, 6018,
+  6149, 6280, 6410, 6541, 6671, 6801, 6930, 7059,
+  7187, 7315, 7442, 7569, 7695, 7821, 7947, 8073,
+  8198, 8323, 8449, 8574, 8700, 8827, 8954, 9081,
+  9209, 9337, 9466, 9596, 9725, 9856, 9986, 10117,
+  10248, 10379, 10510, 10641, 10771, 10901, 11030, 11159,
+  11288, 11415, 11543, 11669, 11795, 11921, 12046, 12172,
+  12297, 12422, 12547, 12672, 12798, 12924, 13051, 13178,
+  13306, 13435, 13564, 13693, 13824, 13954, 14085, 14216,
+  14348, 14479, 14610, 14741, 14872, 15002, 15132, 15261,
+  15389, 15517, 15644, 15770, 15896, 16021, 16146, 16271,
+  16395, 16520, 16645, 16769, 16895, 17021, 17147, 17274,
+  17402, 17531, 17660, 17790, 17921, 18052, 18184, 18315,
+  18448, 18580, 18712, 18843, 18974, 19105, 19235, 19364,
+  19492, 19620, 19746, 19872, 19998, 20122, 20246, 20370,
+  20493, 20617, 20741, 20865, 20989, 21115, 21241, 21368,
+  21496, 21624, 21754, 21885, 22016, 22149, 22282, 22415,
+  22548, 22682, 22815, 22948, 23080, 23211, 23342, 23471,
+  23599, 23727, 23853, 23977, 24101, 24224, 24347, 24468,
+  24590, 24712, 24833, 24956, 25079, 25203, 25328, 25455,
+  25583, 25712, 25843, 25975, 26109, 26244, 26380, 26516,
+  26653, 26789, 26925, 27061, 27196, 27329, 27461, 27590,
+  27718, 27844, 27968, 28090, 28210, 28328, 28445, 28561,
+  28677, 28793, 28909, 29026, 29145, 29266, 29389, 29515,
+  29645, 29778, 29914, 30054, 30197, 30343, 30491, 30641,
+  30792, 30943, 31092, 31240, 31384, 31523, 31657, 31782,
+  31899, 32005, 32100, 32183, 32252, 32306, 32346, 32370,
+  32378, 32370, 32346, 32306, 32252, 32183, 32100, 32005,
+  31899, 31782, 31657, 31523, 31384, 31240, 31092, 30943,
+  30792, 30641, 30491, 30343, 30197, 30054, 29914, 29778,
+  29645, 29515, 29389, 29266, 29145, 29026, 28909, 28793,
+  28677, 28561, 28445, 28328, 28210, 28090, 27968, 27844,
+  27718, 27590, 27461, 27329, 27196, 27061, 26925, 26789,
+  26653, 26516, 26380, 26244, 26109, 25975, 25843, 25712,
+  25583, 25455, 25328, 25203, 25079, 24956, 24833, 24712,
+  24590, 24468, 24347, 24224, 24101, 23977, 23853, 23727,
+  23599, 23471, 23342, 23211, 23080, 22948, 22815, 22682,
+  22548, 22415, 22282, 22149, 22016, 21885, 21754, 21624,
+  21496, 21368, 21241, 21115, 20989, 20865, 20741, 20617,
+  20493, 20370, 20246, 20122, 19998, 19872, 19746, 19620,
+  19492, 19364, 19235, 19105, 18974, 18843, 18712, 18580,
+  18448, 18315, 18184, 18052, 17921, 17790, 17660, 17531,
+  17402, 17274, 17147, 17021, 16895, 16769, 16645, 16520,
+  16395, 16271, 16146, 16021, 15896, 15770, 15644, 15517,
+  15389, 15261, 15132, 15002, 14872, 14741, 14610, 14479,
+  14348, 14216, 14085, 13954, 13824, 13693, 13564, 13435,
+  13306, 13178, 13051, 12924, 12798, 12672, 12547, 12422,
+  12297, 12172, 12046, 11921, 11795, 11669, 11543, 11415,
+  11288, 11159, 11030, 10901, 10771, 10641, 10510, 10379,
+  10248, 10117, 9986, 9856, 9725, 9596, 9466, 9337,
+  9209, 9081, 8954, 8827, 8700, 8574, 8449, 8323,
+  8198, 8073, 7947, 7821, 7695, 7569, 7442, 7315,
+  7187, 7059, 6930, 6801, 6671, 6541, 6410, 6280,
+  6149, 6018, 5888, 5757, 5627, 5497, 5368, 5239,
+  5111, 4983, 4855, 4728, 4602, 4476, 4350, 4224,
+  4099, 3973, 3848, 3722, 3596, 3469, 3343, 3215,
+  3087, 2959, 2830, 2701, 2571, 2441, 2311, 2180,
+  2050, 1919, 1788, 1658, 1528, 1398, 1269, 1140,
+  1012, 884, 757, 630, 503, 377, 251, 126,
+  0, -126, -251, -377, -503, -630, -757, -884,
+  -1012, -1140, -1269, -1398, -1528, -1658, -1788, -1919,
+  -2050, -2180, -2311, -2441, -2571, -2701, -2830, -2959,
+  -3087, -3215, -3343, -3469, -3596, -3722, -3848, -3973,
+  -4099, -4224, -4350, -4476, -4602, -4728, -4855, -4983,
+  -5111, -5239, -5368, -5497, -5627, -5757, -5888, -6018,
+  -6149, -6280, -6410, -6541, -6671, -6801, -6930, -7059,
+  -7187, -7315, -7442, -7569, -7695, -7821, -7947, -8073,
+  -8198, -8323, -8449, -8574, -8700, -8827, -8954, -9081,
+  -9209, -9337, -9466, -9596, -9725, -9856, -9986, -10117,
+  -10248, -10379, -10510, -10641, -10771, -10901, -11030, -11159,
+  -11288, -11415, -11543, -11669, -11795, -11921, -12046, -12172,
+  -12297, -12422, -12547, -12672, -12798, -12924, -13051, -13178,
+  -13306, -13435, -13564, -13693, -13824, -13954, -14085, -14216,
+  -14348, -14479, -14610, -14741, -14872, -15002, -15132, -15261,
+  -15389, -15517, -15644, -15770, -15896, -16021, -16146, -16271,
+  -16395, -16520, -16645, -16769, -16895, -17021, -17147, -17274,
+  -17402, -17531, -17660, -17790, -17921, -18052, -18184, -18315,
+  -18448, -18580, -18712, -18843, -18974, -19105, -19235, -19364,
+  -19492, -19620, -19746, -19872, -19998, -20122, -20246, -20370,
+  -20493, -20617, -20741, -20865, -20989, -21115, -21241, -21368,
+  -21496, -21624, -21754, -21885, -22016, -22149, -22282, -22415,
+  -22548, -22682, -22815, -22948, -23080, -23211, -23342, -23471,
+  -23599, -23727, -23853, -23977, -24101, -24224, -24347, -24468,
+  -24590, -24712, -24833, -24956, -25079, -25203, -25328, -25455,
+  -25583, -25712, -25843, -25975, -26109, -26244, -26380, -26516,
+  -26653, -26789, -26925, -27061, -27196, -27329, -27461, -27590,
+  -27718, -27844, -27968, -28090, -28210, -28328, -28445, -28561,
+  -28677, -28793, -28909, -29026, -29145, -29266, -29389, -29515,
+  -29645, -29778, -29914, -30054, -30197, -30343, -30491, -30641,
+  -30792, -30943, -31092, -31240, -31384, -31523, -31657, -31782,
+  -31899, -32005, -32100, -32183, -32252, -32306, -32346, -32370,
+  -32378, -32370, -32346, -32306, -32252, -32183, -32100, -32005,
+  -31899, -31782, -31657, -31523, -31384, -31240, -31092, -30943,
+  -30792, -30641, -30491, -30343, -30197, -30054, -29914, -29778,
+  -29645, -29515, -29389, -29266, -29145, -29026, -28909, -28793,
+  -28677, -28561, -28445, -28328, -28210, -28090, -27968, -27844,
+  -27718, -27590, -27461, -27329, -27196, -27061, -26925, -26789,
+  -26653, -26516, -26380, -26244, -26109, -25975, -25843, -25712,
+  -25583, -25455, -25328, -25203, -25079, -24956, -24833, -24712,
+  -24590, -24468, -24347, -24224, -24101, -23977, -23853, -23727,
+  -23599, -23471, -23342, -23211, -23080, -22948, -22815, -22682,
+  -22548, -22415, -22282, -22149, -22016, -21885, -21754, -21624,
+  -21496, -21368, -21241, -21115, -20989, -20865, -20741, -20617,
+  -20493, -20370, -20246, -20122, -19998, -19872, -19746, -19620,
+  -19492, -19364, -19235, -19105, -18974, -18843, -18712, -18580,
+  -18448, -18315, -18184, -18052, -17921, -17790, -17660, -17531,
+  -17402, -17274, -17147, -17021, -16895, -16769, -16645, -16520,
+  -16395, -16271, -16146, -16021, -15896, -15770, -15644, -15517,
+  -15389, -15261, -15132, -15002, -14872, -14741, -14610, -14479,
+  -14348, -14216, -14085, -13954, -13824, -13693, -13564, -13435,
+  -13306, -13178, -13051, -12924, -12798, -12672, -12547, -12422,
+  -12297, -12172, -12046, -11921, -11795, -11669, -11543, -11415,
+  -11288, -11159, -11030, -10901, -10771, -10641, -10510, -10379,
+  -10248, -10117, -9986, -9856, -9725, -9596, -9466, -9337,
+  -9209, -9081, -8954, -8827, -8700, -8574, -8449, -8323,
+  -8198, -8073, -7947, -7821, -7695, -7569, -7442, -7315,
+  -7187, -7059, -6930, -6801, -6671, -6541, -6410, -6280,
+  -6149, -6018, -5888, -5757, -5627, -5497, -5368, -5239,
+  -5111, -4983, -4855, -4728, -4602, -4476, -4350, -4224,
+  -4099, -3973, -3848, -3722, -3596, -3469, -3343, -3215,
+  -3087, -2959, -2830, -2701, -2571, -2441, -2311, -2180,
+  -2050, -1919, -1788, -1658, -1528, -1398, -1269, -1140,
+  -1012, -884, -757, -630, -503, -377, -251, -126,
+  0
+};
+
+static const int16_t hifi_wavetable_triangle_5[1025] =
+{
+  0, 123, 246, 369, 493, 616, 740, 864,
+  988, 1113, 1238, 1364, 1489, 1616, 1743, 1870,
+  1998, 2126, 2255, 2385, 2514, 2645, 2776, 2907,
+  3038, 3170, 3303, 3435, 3568, 3701, 3834, 3967,
+  4100, 4234, 4367, 4500, 4633, 4766, 4898, 5030,
+  5162, 5294, 5425, 5556, 5686, 5816, 5945, 6074,
+  6202, 6330, 6457, 6584, 6710, 6836, 6961, 7086,
+  7210, 7334, 7458, 7581, 7704, 7827, 7950, 8073,
+  8195, 8318, 8441, 8564, 8686, 8810, 8933, 9057,
+  9181, 9305, 9430, 9555, 9681, 9808, 9935, 10062,
+  10190, 10319, 10448, 10577, 10708, 10838, 10970, 11101,
+  11234, 11366, 11499, 11633, 11766, 11900, 12034, 12168,
+  12302, 12436, 12571, 12705, 12838, 12972, 13105, 13238,
+  13371, 13503, 13635, 13766, 13896, 14026, 14156, 14284,
+  14412, 14540, 14667, 14793, 14918, 15043, 15168, 15291,
+  15415, 15537, 15660, 15782, 15903, 16025, 16146, 16267,
+  16388, 16509, 16630, 16751, 16873, 16994, 17116, 17239,
+  17362, 17485, 17609, 17734, 17859, 17985, 18112, 18239,
+  18368, 18497, 18626, 18757, 18889, 19021, 19154, 19287,
+  19421, 19556, 19692, 19827, 19964, 20100, 20237, 20374,
+  20511, 20648, 20785, 20922, 21059, 21195, 21330, 21466,
+  21600, 21734, 21867, 22000, 22131, 22262, 22391, 22520,
+  22647, 22774, 22899, 23023, 23146, 23269, 23390, 23510,
+  23629, 23748, 23866, 23983, 24099, 24215, 24331, 24447,
+  24562, 24677, 24793, 24908, 25025, 25141, 25258, 25377,
+  25496, 25616, 25737, 25860, 25983, 26109, 26236, 26364,
+  26495, 26627, 26760, 26896, 27033, 27172, 27313, 27455,
+  27599, 27744, 27891, 28039, 28187, 28337, 28488, 28639,
+  28790, 28941, 29092, 29242, 29392, 29540, 29687, 29832,
+  29975, 30116, 30254, 30389, 30521, 30648, 30772, 30891,
+  31005, 31114, 31218, 31316, 31408, 31494, 31574, 31646,
+  31712, 31770, 31821, 31864, 31900, 31927, 31947, 31959,
+  31963, 31959, 31947, 31927, 31900, 31864, 31821, 31770,
+  31712, 31646, 31574, 31494, 31408, 31316, 31218, 31114,
+  31005, 30891, 30772, 30648, 30521, 30389, 30254, 30116,
+  29975, 29832, 29687, 29540, 29392, 29242, 29092, 28941,
+  28790, 28639, 28488, 28337, 28187, 28039, 27891, 27744,
+  27599, 27455, 27313, 27172, 27033, 26896, 26760, 26627,
+  26495, 26364, 26236, 26109, 25983, 25860, 25737, 25616,
+  25496, 25377, 25258, 25141, 25025, 24908, 24793, 24677,
+  24562, 24447, 24331, 24215, 24099, 23983, 23866, 23748,
+  23629, 23510, 23390, 23269, 23146, 23023, 22899, 22774,
+  22647, 22520, 22391, 22262, 22131, 22000, 21867, 21734,
+  21600, 21466, 21330, 21195, 21059, 20922, 20785, 20648,
+  20511, 20374, 20237, 20100, 19964, 19827, 19692, 19556,
+  19421, 19287, 19154, 19021, 18889, 18757, 18626, 18497,
+  18368, 18239, 18112, 17985, 17859, 17734, 17609, 17485,
+  17362, 17239, 17116, 16994, 16873, 16751, 16630, 16509,
+  16388, 16267, 16146, 16025, 15903, 15782, 15660, 15537,
+  15415, 15291, 15168, 15043, 14918, 14793, 14667, 14540,
+  14412, 14284, 14156, 14026, 13896, 13766, 13635, 13503,
+  13371, 13238, 13105, 12972, 12838, 12705, 12571, 12436,
+  12302, 12168, 12034, 11900, 11766, 11633, 11499, 11366,
+  11234, 11101, 10970, 10838, 10708, 10577, 10448, 10319,
+  10190, 10062, 9935, 9808, 9681, 9555, 9430, 9305,
+  9181, 9057, 8933, 8810, 8686, 8564, 8441, 8318,
+  8195, 8073, 7950, 7827, 7704, 7581, 7458, 7334,
+  7210, 7086, 6961, 6836, 6710, 6584, 6457, 6330,
+  6202, 6074, 5945, 5816, 5686, 5556, 5425, 5294,
+  5162, 5030, 4898, 4766, 4633, 4500, 4367, 4234,
+  4100, 3967, 3834, 3701, 3568, 3435, 3303, 3170,
+  3038, 2907, 2776, 2645, 2514, 2385, 2255, 2126,
+  1998, 1870, 1743, 1616, 1489, 1364, 1238, 1113,
+  988, 864, 740, 616, 493, 369, 246, 123,
+  0, -123, -246, -369, -493, -616, -740, -864,
+  -988, -1113, -1238, -1364, -1489, -1616, -1743, -1870,
+  -1998, -2126, -2255, -2385, -2514, -2645, -2776, -2907,
+  -3038, -3170, -3303, -3435, -3568, -3701, -3834, -3967,
+  -4100, -4234, -4367, -4500, -4633, -4766, -4898, -5030,
+  -5162, -5294, -5425, -5556, -5686, -5816, -5945, -6074,
+  -6202, -6330, -6457, -6584, -6710, -6836, -6961, -7086,
+  -7210, -7334, -7458, -7581, -7704, -7827, -7950, -8073,
+  -8195, -8318, -8441, -8564, -8686, -8810, -8933, -9057,
+  -9181, -9305, -9430, -9555, -9681, -9808, -9935, -10062,
+  -10190, -10319, -10448, -10577, -10708, -10838, -10970, -11101,
+  -11234, -11366, -11499, -11633, -11766, -11900, -12034, -12168,
+  -12302, -12436, -12571, -12705, -12838, -12972, -13105, -13238,
+  -13371, -13503, -13635, -13766, -13896, -14026, -14156, -14284,
+  -14412, -14540, -14667, -14793, -14918, -15043, -15168, -15291,
+  -15415, -15537, -15660, -15782, -15903, -16025, -16146, -16267,
+  -16388, -16509, -16630, -16751, -16873, -16994, -17116, -17239,
+  -17362, -17485, -17609, -17734, -17859, -17985, -18112, -18239,
+  -18368, -18497, -18626, -18757, -18889, -19021, -19154, -19287,
+  -19421, -19556, -19692, -19827, -19964, -20100, -20237, -20374,
+  -20511, -20648, -20785, -20922, -21059, -21195, -21330, -21466,
+  -21600, -21734, -21867, -22000, -22131, -22262, -22391, -22520,
+  -22647, -22774, -22899, -23023, -23146, -23269, -23390, -23510,
+  -23629, -23748, -23866, -23983, -24099, -24215, -24331, -24447,
+  -24562, -24677, -24793, -24908, -25025, -25141, -25258, -25377,
+  -25496, -25616, -25737, -25860, -25983, -26109, -26236, -26364,
+  -26495, -26627, -26760, -26896, -27033, -27172, -27313, -27455,
+  -27599, -27744, -27891, -28039, -28187, -28337, -28488, -28639,
+  -28790, -28941, -29092, -29242, -29392, -29540, -29687, -29832,
+  -29975, -30116, -30254, -30389, -30521, -30648, -30772, -30891,
+  -31005, -31114, -31218, -31316, -31408, -31494, -31574, -31646,
+  -31712, -31770, -31821, -31864, -31900, -31927, -31947, -31959,
+  -31963, -31959, -31947, -31927, -31900, -31864, -31821, -31770,
+  -31712, -31646, -31574, -31494, -31408, -31316, -31218, -31114,
+  -31005, -30891, -30772, -30648, -30521, -30389, -30254, -30116,
+  -29975, -29832, -29687, -29540, -29392, -29242, -29092, -28941,
+  -28790, -28639, -28488, -28337, -28187, -28039, -27891, -27744,
+  -27599, -27455, -27313, -27172, -27033, -26896, -26760, -26627,
+  -26495, -26364, -26236, -26109, -25983, -25860, -25737, -25616,
+  -25496, -25377, -25258, -25141, -25025, -24908, -24793, -24677,
+  -24562, -24447, -24331, -24215, -24099, -23983, -23866, -23748,
+  -23629, -23510, -23390, -23269, -23146, -23023, -22899, -22774,
+  -22647, -22520, -22391, -22262, -22131, -22000, -21867, -21734,
+  -21600, -21466, -21330, -21195, -21059, -20922, -20785, -20648,
+  -20511, -20374, -20237, -20100, -19964, -19827, -19692, -19556,
+  -19421, -19287, -19154, -19021, -18889, -18757, -18626, -18497,
+  -18368, -18239, -18112, -17985, -17859, -17734, -17609, -17485,
+  -17362, -17239, -17116, -16994, -16873, -16751, -16630, -16509,
+  -16388, -16267, -16146, -16025, -15903, -15782, -15660, -15537,
+  -15415, -15291, -15168, -15043, -14918, -14793, -14667, -14540,
+  -14412, -14284, -14156, -14026, -13896, -13766, -13635, -13503,
+  -13371, -13238, -13105, -12972, -12838, -12705, -12571, -12436,
+  -12302, -12168, -12034, -11900, -11766, -11633, -11499, -11366,
+  -11234, -11101, -10970, -10838, -10708, -10577, -10448, -10319,
+  -10190, -10062, -9935, -9808, -9681, -9555, -9430, -9305,
+  -9181, -9057, -8933, -8810, -8686, -8564, -8441, -8318,
+  -8195, -8073, -7950, -7827, -7704, -7581, -7458, -7334,
+  -7210, -7086, -6961, -6836, -6710, -6584, -6457, -6330,
+  -6202, -6074, -5945, -5816, -5686, -5556, -5425, -5294,
+  -5162, -5030, -4898, -4766, -4633, -4500, -4367, -4234,
+  -4100, -3967, -3834, -3701, -3568, -3435, -3303, -3170,
+  -3038, -2907, -2776, -2645, -2514, -2385, -2255, -2126,
+  -1998, -1870, -1743, -1616, -1489, -1364, -1238, -1113,
+  -988, -864, -740, -616, -493, -369, -246, -123,
+  0
+};
+
+static const int16_t hifi_wavetable_triangle_6[1025] =
+{
+  0, 118, 236, 354, 472, 591, 709, 828,
+  947, 1065, 1185, 1304, 1424, 1544, 1664, 1784,
+  1905, 2026, 2148, 2270, 2392, 2515, 2638, 2762,
+  2886, 3011, 3136, 3261, 3388, 3514, 3641, 3769,
+  3897, 4025, 4155, 4284, 4414, 4545, 4676, 4808,
+  4940, 5072, 5205, 5339, 5473, 5607, 5742, 5877,
+  6013, 6149, 6285, 6422, 6559, 6696, 6833, 6971,
+  7109, 7247, 7386, 7524, 7663, 7802, 7940, 8079,
+  8218, 8357, 8496, 8635, 8774, 8912, 9051, 9189,
+  9327, 9465, 9603, 9740, 9878, 10014, 10151, 10287,
+  10423, 10558, 10693, 10828, 10962, 11095, 11229, 11361,
+  11493, 11625, 11756, 11886, 12016, 12145, 12274, 12402,
+  12529, 12656, 12783, 12908, 13033, 13158, 13282, 13405,
+  13528, 13650, 13771, 13892, 14013, 14133, 14252, 14371,
+  14489, 14607, 14725, 14842, 14959, 15075, 15191, 15307,
+  15422, 15537, 15652, 15767, 15882, 15996, 16110, 16225,
+  16339, 16453, 16567, 16682, 16796, 16911, 17026, 17141,
+  17256, 17371, 17487, 17603, 17720, 17837, 17954, 18072,
+  18191, 18310, 18430, 18550, 18671, 18792, 18915, 19038,
+  19161, 19286, 19411, 19537, 19664, 19792, 19921, 20050,
+  20181, 20312, 20445, 20578, 20712, 20847, 20983, 21120,
+  21257, 21396, 21536, 21676, 21817, 21960, 22103, 22246,
+  22391, 22536, 22682, 22829, 22976, 23124, 23273, 23422,
+  23571, 23721, 23872, 24023, 24174, 24325, 24476, 24628,
+  24780, 24931, 25083, 25235, 25386, 25537, 25688, 25838,
+  25988, 26137, 26285, 26433, 26580, 26726, 26871, 27016,
+  27159, 27300, 27441, 27580, 27717, 27853, 27988, 28120,
+  28251, 28380, 28507, 28632, 28755, 28875, 28993, 29109,
+  29222, 29333, 29441, 29547, 29649, 29749, 29845, 29939,
+  30030, 30117, 30202, 30283, 30360, 30434, 30505, 30573,
+  30636, 30696, 30753, 30806, 30855, 30900, 30941, 30979,
+  31013, 31042, 31068, 31090, 31108, 31122, 31132, 31138,
+  31140, 31138, 31132, 31122, 31108, 31090, 31068, 31042,
+  31013, 30979, 30941, 30900, 30855, 30806, 30753, 30696,
+  30636, 30573, 30505, 30434, 30360, 30283, 30202, 30117,
+  30030, 29939, 29845, 29749, 29649, 29547, 29441, 29333,
+  29222, 29109, 28993, 28875, 28755, 28632, 28507, 28380,
+  28251, 28120, 27988, 27853, 27717, 27580, 27441, 27300,
+  27159, 27016, 26871, 26726, 26580, 26433, 26285, 26137,
+  25988, 25838, 25688, 25537, 25386, 25235, 25083, 24931,
+  24780, 24628, 24476, 24325, 24174, 24023, 23872, 23721,
+  23571, 23422, 23273, 23124, 22976, 22829, 22682, 22536,
+  22391, 22246, 22103, 21960, 21817, 21676, 21536, 21396,
+  21257, 21120, 20983, 20847, 20712, 20578, 20445, 20312,
+  20181, 20050, 19921, 19792, 19664, 19537, 19411, 19286,
+  19161, 19038, 18915, 18792, 18671, 18550, 18430, 18310,
+  18191, 18072, 17954, 17837, 17720, 17603, 17487, 17371,
+  17256, 17141, 17026, 16911, 16796, 16682, 16567, 16453,
+  16339, 16225, 16110, 15996, 15882, 15767, 15652, 15537,
+  15422, 15307, 15191, 15075, 14959, 14842, 14725, 14607,
+  14489, 14371, 14252, 14133, 14013, 13892, 13771, 13650,
+  13528, 13405, 13282, 13158, 13033, 12908, 12783, 12656,
+  12529, 12402, 12274, 12145, 12016, 11886, 11756, 11625,
+  11493, 11361, 11229, 11095, 10962, 10828, 10693, 10558,
+  10423, 10287, 10151, 10014, 9878, 9740, 9603, 9465,
+  9327, 9189, 9051, 8912, 8774, 8635, 8496, 8357,
+  8218, 8079, 7940, 7802, 7663, 7524, 7386, 7247,
+  7109, 6971, 6833, 6696, 6559, 6422, 6285, 6149,
+  6013, 5877, 5742, 5607, 5473, 5339, 5205, 5072,
+  4940, 4808, 4676, 4545, 4414, 4284, 4155, 4025,
+  3897, 3769, 3641, 3514, 3388, 3261, 3136, 3011,
+  2886, 2762, 2638, 2515, 2392, 2270, 2148, 2026,
+  1905, 1784, 1664, 1544, 1424, 1304, 1185, 1065,
+  947, 828, 709, 591, 472, 354, 236, 118,
+  0, -118, -236, -354, -472, -591, -709, -828,
+  -947, -1065, -1185, -1304, -1424, -1544, -1664, -1784,
+  -1905, -2026, -2148, -2270, -2392, -2515, -2638, -2762,
+  -2886, -3011, -3136, -3261, -3388, -3514, -3641, -3769,
+  -3897, -4025, -4155, -4284, -4414, -4545, -4676, -4808,
+  -4940, -5072, -5205, -5339, -5473, -5607, -5742, -5877,
+  -6013, -6149, -6285, -6422, -6559, -6696, -6833, -6971,
+  -7109, -7247, -7386, -7524, -7663, -7802, -7940, -8079,
+  -8218, -8357, -8496, -8635, -8774, -8912, -9051, -9189,
+  -9327, -9465, -9603, -9740, -9878, -10014, -10151, -10287,
+  -10423, -10558, -10693, -10828, -10962, -11095, -11229, -11361,
+  -11493, -11625, -11756, -11886, -12016, -12145, -12274, -12402,
+  -12529, -12656, -12783, -12908, -13033, -13158, -13282, -13405,
+  -13528, -13650, -13771, -13892, -14013, -14133, -14252, -14371,
+  -14489, -14607, -14725, -14842, -14959, -15075, -15191, -15307,
+  -15422, -15537, -15652, -15767, -15882, -15996, -16110, -16225,
+  -16339, -16453, -16567, -16682, -16796, -16911, -17026, -17141,
+  -17256, -17371, -17487, -17603, -17720, -17837, -17954, -18072,
+  -18191, -18310, -18430, -18550, -18671, -18792, -18915, -19038,
+  -19161, -19286, -19411, -19537, -19664, -19792, -19921, -20050,
+  -20181, -20312, -20445, -20578, -20712, -20847, -20983, -21120,
+  -21257, -21396, -21536, -21676, -21817, -21960, -22103, -22246,
+  -22391, -22536, -22682, -22829, -22976, -23124, -23273, -23422,
+  -23571, -23721, -23872, -24023, -24174, -24325, -24476, -24628,
+  -24780, -24931, -25083, -25235, -25386, -25537, -25688, -25838,
+  -25988, -26137, -26285, -26433, -26580, -26726, -26871, -27016,
+  -27159, -27300, -27441, -27580, -27717, -27853, -27988, -28120,
+  -28251, -28380, -28507, -28632, -28755, -28875, -28993, -29109,
+  -29222, -29333, -29441, -29547, -29649, -29749, -29845, -29939,
+  -30030, -30117, -30202, -30283, -30360, -30434, -30505, -30573,
+  -30636, -30696, -30753, -30806, -30855, -30900, -30941, -30979,
+  -31013, -31042, -31068, -31090, -31108, -31122, -31132, -31138,
+  -31140, -31138, -31132, -31122, -31108, -31090, -31068, -31042,
+  -31013, -30979, -30941, -30900, -30855, -30806, -30753, -30696,
+  -30636, -30573, -30505, -30434, -30360, -30283, -30202, -30117,
+  -30030, -29939, -29845, -29749, -29649, -29547, -29441, -29333,
+  -29222, -29109, -28993, -28875, -28755, -28632, -28507, -28380,
+  -28251, -28120, -27988, -27853, -27717, -27580, -27441, -27300,
+  -27159, -27016, -26871, -26726, -26580, -26433, -26285, -26137,
+  -25988, -25838, -25688, -25537, -25386, -25235, -25083, -24931,
+  -24780, -24628, -24476, -24325, -24174, -24023, -23872, -23721,
+  -23571, -23422, -23273, -23124, -22976, -22829, -22682, -22536,
+  -22391, -22246, -22103, -21960, -21817, -21676, -21536, -21396,
+  -21257, -21120, -20983, -20847, -20712, -20578, -20445, -20312,
+  -20181, -20050, -19921, -19792, -19664, -19537, -19411, -19286,
+  -19161, -19038, -18915, -18792, -18671, -18550, -18430, -18310,
+  -18191, -18072, -17954, -17837, -17720, -17603, -17487, -17371,
+  -17256, -17141, -17026, -16911, -16796, -16682, -16567, -16453,
+  -16339, -16225, -16110, -15996, -15882, -15767, -15652, -15537,
+  -15422, -15307, -15191, -15075, -14959, -14842, -14725, -14607,
+  -14489, -14371, -14252, -14133, -14013, -13892, -13771, -13650,
+  -13528, -13405, -13282, -13158, -13033, -12908, -12783, -12656,
+  -12529, -12402, -12274, -12145, -12016, -11886, -11756, -11625,
+  -11493, -11361, -11229, -11095, -10962, -10828, -10693, -10558,
+  -10423, -10287, -10151, -10014, -9878, -9740, -9603, -9465,
+  -9327, -9189, -9051, -8912, -8774, -8635, -8496, -8357,
+  -8218, -8079, -7940, -7802, -7663, -7524, -7386, -7247,
+  -7109, -6971, -6833, -6696, -6559, -6422, -6285, -6149,
+  -6013, -5877, -5742, -5607, -5473, -5339, -5205, -5072,
+  -4940, -4808, -4676, -4545, -4414, -4284, -4155, -4025,
+  -3897, -3769, -3641, -3514, -3388, -3261, -3136, -3011,
+  -2886, -2762, -2638, -2515, -2392, -2270, -2148, -2026,
+  -1905, -1784, -1664, -1544, -1424, -1304, -1185, -1065,
+  -947, -828, -709, -591, -472, -354, -236, -118,
+  0
+};
+
+static const int16_t hifi_wavetable_triangle_7[1025] =
+{
+  0, 109, 217, 326, 435, 544, 653, 762,
+  871, 980, 1089, 1199, 1308, 1418, 1528, 1638,
+  1748, 1858, 1969, 2080, 2191, 2302, 2414, 2525,
+  2637, 2750, 2862, 2975, 3089, 3202, 3316, 3430,
+  3545, 3660, 3775, 3891, 4007, 4123, 4240, 4358,
+  4475, 4593, 4712, 4831, 4950, 5070, 5191, 5312,
+  5433, 5555, 5677, 5800, 5923, 6047, 6171, 6296,
+  6422, 6547, 6674, 6801, 6928, 7056, 7185, 7314,
+  7443, 7574, 7704, 7836, 7967, 8100, 8233, 8366,
+  8500, 8634, 8769, 8905, 9041, 9178, 9315, 9453,
+  9591, 9730, 9869, 10009, 10149, 10290, 10431, 10573,
+  10715, 10858, 11002, 11145, 11290, 11434, 11579, 11725,
+  11871, 12017, 12164, 12311, 12459, 12607, 12756, 12904,
+  13053, 13203, 13353, 13503, 13653, 13804, 13955, 14107,
+  14258, 14410, 14562, 14714, 14867, 15019, 15172, 15325,
+  15478, 15632, 15785, 15939, 16092, 16246, 16400, 16553,
+  16707, 16861, 17015, 17168, 17322, 17476, 17629, 17783,
+  17936, 18089, 18242, 18395, 18547, 18700, 18852, 19004,
+  19155, 19306, 19457, 19608, 19758, 19908, 20057, 20206,
+  20355, 20503, 20651, 20798, 20944, 21091, 21236, 21381,
+  21525, 21669, 21812, 21954, 22095, 22236, 22376, 22516,
+  22654, 22792, 22929, 23065, 23200, 23335, 23468, 23600,
+  23732, 23862, 23992, 24120, 24248, 24374, 24499, 24623,
+  24747, 24868, 24989, 25109, 25227, 25344, 25460, 25575,
+  25688, 25800, 25910, 26020, 26128, 26234, 26339, 26443,
+  26546, 26646, 26746, 26844, 26940, 27035, 27128, 27220,
+  27310, 27399, 27486, 27571, 27655, 27737, 27817, 27896,
+  27973, 28048, 28122, 28193, 28263, 28332, 28398, 28463,
+  28526, 28587, 28646, 28704, 28759, 28813, 28865, 28915,
+  28963, 29009, 29054, 29096, 29137, 29175, 29212, 29246,
+  29279, 29310, 29339, 29366, 29391, 29414, 29434, 29453,
+  29470, 29485, 29498, 29509, 29518, 29525, 29530, 29533,
+  29534, 29533, 29530, 29525, 29518, 29509, 29498, 29485,
+  29470, 29453, 29434, 29414, 29391, 29366, 29339, 29310,
+  29279, 29246, 29212, 29175, 29137, 29096, 29054, 29009,
+  28963, 28915, 28865, 28813, 28759, 28704, 28646, 28587,
+  28526, 28463, 28398, 28332, 28263, 28193, 28122, 28048,
+  27973, 27896, 27817, 27737, 27655, 27571, 27486, 27399,
+  27310, 27220, 27128, 27035, 26940, 26844, 26746, 26646,
+  26546, 26443, 26339, 26234, 26128, 26020, 25910, 25800,
+  25688, 25575, 25460, 25344, 25227, 25109, 24989, 24868,
+  24747, 24623, 24499, 24374, 24248, 24120, 23992, 23862,
+  23732, 23600, 23468, 23335, 23200, 23065, 22929, 22792,
+  22654, 22516, 22376, 22236, 22095, 21954, 21812, 21669,
+  21525, 21381, 21236, 21091, 20944, 20798, 20651, 20503,
+  20355, 20206, 20057, 19908, 19758, 19608, 19457, 19306,
+  19155, 19004, 18852, 18700, 18547, 18395, 18242, 18089,
+  17936, 17783, 17629, 17476, 17322, 17168, 17015, 16861,
+  16707, 16553, 16400, 16246, 16092, 15939, 15785, 15632,
+  15478, 15325, 15172, 15019, 14867, 14714, 14562, 14410,
+  14258, 14107, 13955, 13804, 13653, 13503, 13353, 13203,
+  13053, 12904, 12756, 12607, 12459, 12311, 12164, 12017,
+  11871, 11725, 11579, 11434, 11290, 11145, 11002, 10858,
+  10715, 10573, 10431, 10290, 10149, 10009, 9869, 9730,
+  9591, 9453, 9315, 9178, 9041, 8905, 8769, 8634,
+  8500, 8366, 8233, 8100, 7967, 7836, 7704, 7574,
+  7443, 7314, 7185, 7056, 6928, 6801, 6674, 6547,
+  6422, 6296, 6171, 6047, 5923, 5800, 5677, 5555,
+  5433, 5312, 5191, 5070, 4950, 4831, 4712, 4593,
+  4475, 4358, 4240, 4123, 4007, 3891, 3775, 3660,
+  3545, 3430, 3316, 3202, 3089, 2975, 2862, 2750,
+  2637, 2525, 2414, 2302, 2191, 2080, 1969, 1858,
+  1748, 1638, 1528, 1418, 1308, 1199, 1089, 980,
+  871, 762, 653, 544, 435, 326, 217, 109,
+  0, -109, -217, -326, -435, -544, -653, -762,
+  -871, -980, -1089, -1199, -1308, -1418, -1528, -1638,
+  -1748, -1858, -1969, -2080, -2191, -2302, -2414, -2525,
+  -2637, -2750, -2862, -2975, -3089, -3202, -3316, -3430,
+  -3545, -3660, -3775, -3891, -4007, -4123, -4240, -4358,
+  -4475, -4593, -4712, -4831, -4950, -5070, -5191, -5312,
+  -5433, -5555, -5677, -5800, -5923, -6047, -6171, -6296,
+  -6422, -6547, -6674, -6801, -6928, -7056, -7185, -7314,
+  -7443, -7574, -7704, -7836, -7967, -8100, -8233, -8366,
+  -8500, -8634, -8769, -8905, -9041, -9178, -9315, -9453,
+  -9591, -9730, -9869, -10009, -10149, -10290, -10431, -10573,
+  -10715, -10858, -11002, -11145, -11290, -11434, -11579, -11725,
+  -11871, -12017, -12164, -12311, -12459, -12607, -12756, -12904,
+  -13053, -13203, -13353, -13503, -13653, -13804, -13955, -14107,
+  -14258, -14410, -14562, -14714, -14867, -15019, -15172, -15325,
+  -15478, -15632, -15785, -15939, -16092, -16246, -16400, -16553,
+  -16707, -16861, -17015, -17168, -17322, -17476, -17629, -17783,
+  -17936, -18089, -18242, -18395, -18547, -18700, -18852, -19004,
+  -19155, -19306, -19457, -19608, -19758, -19908, -20057, -20206,
+  -20355, -20503, -20651, -20798, -20944, -21091, -21236, -21381,
+  -21525, -21669, -21812, -21954, -22095, -22236, -22376, -22516,
+  -22654, -22792, -22929, -23065, -23200, -23335, -23468, -23600,
+  -23732, -23862, -23992, -24120, -24248, -24374, -24499, -24623,
+  -24747, -24868, -24989, -25109, -25227, -25344, -25460, -25575,
+  -25688, -25800, -25910, -26020, -26128, -26234, -26339, -26443,
+  -26546, -26646, -26746, -26844, -26940, -27035, -27128, -27220,
+  -27310, -27399, -27486, -27571, -27655, -27737, -27817, -27896,
+  -27973, -28048, -28122, -28193, -28263, -28332, -28398, -28463,
+  -28526, -28587, -28646, -28704, -28759, -28813, -28865, -28915,
+  -28963, -29009, -29054, -29096, -29137, -29175, -29212, -29246,
+  -29279, -29310, -29339, -29366, -29391, -29414, -29434, -29453,
+  -29470, -29485, -29498, -29509, -29518, -29525, -29530, -29533,
+  -29534, -29533, -29530, -29525, -29518, -29509, -29498, -29485,
+  -29470, -29453, -29434, -29414, -29391, -29366, -29339, -29310,
+  -29279, -29246, -29212, -29175, -29137, -29096, -29054, -29009,
+  -28963, -28915, -28865, -28813, -28759, -28704, -28646, -28587,
+  -28526, -28463, -28398, -28332, -28263, -28193, -28122, -28048,
+  -27973, -27896, -27817, -27737, -27655, -27571, -27486, -27399,
+  -27310, -27220, -27128, -27035, -26940, -26844, -26746, -26646,
+  -26546, -26443, -26339, -26234, -26128, -26020, -25910, -25800,
+  -25688, -25575, -25460, -25344, -25227, -25109, -24989, -24868,
+  -24747, -24623, -24499, -24374, -24248, -24120, -23992, -23862,
+  -23732, -23600, -23468, -23335, -23200, -23065, -22929, -22792,
+  -22654, -22516, -22376, -22236, -22095, -21954, -21812, -21669,
+  -21525, -21381, -21236, -21091, -20944, -20798, -20651, -20503,
+  -20355, -20206, -20057, -19908, -19758, -19608, -19457, -19306,
+  -19155, -19004, -18852, -18700, -18547, -18395, -18242, -18089,
+  -17936, -17783, -17629, -17476, -17322, -17168, -17015, -16861,
+  -16707, -16553, -16400, -16246, -16092, -15939, -15785, -15632,
+  -15478, -15325, -15172, -15019, -14867, -14714, -14562, -14410,
+  -14258, -14107, -13955, -13804, -13653, -13503, -13353, -13203,
+  -13053, -12904, -12756, -12607, -12459, -12311, -12164, -12017,
+  -11871, -11725, -11579, -11434, -11290, -11145, -11002, -10858,
+  -10715, -10573, -10431, -10290, -10149, -10009, -9869, -9730,
+  -9591, -9453, -9315, -9178, -9041, -8905, -8769, -8634,
+  -8500, -8366, -8233, -8100, -7967, -7836, -7704, -7574,
+  -7443, -7314, -7185, -7056, -6928, -6801, -6674, -6547,
+  -6422, -6296, -6171, -6047, -5923, -5800, -5677, -5555,
+  -5433, -5312, -5191, -5070, -4950, -4831, -4712, -4593,
+  -4475, -4358, -4240, -4123, -4007, -3891, -3775, -3660,
+  -3545, -3430, -3316, -3202, -3089, -2975, -2862, -2750,
+  -2637, -2525, -2414, -2302, -2191, -2080, -1969, -1858,
+  -1748, -1638, -1528, -1418, -1308, -1199, -1089, -980,
+  -871, -762, -653, -544, -435, -326, -217, -109,
+  0
+};
+
+static const int16_t hifi_wavetable_triangle_8[1025] =
+{
+  0, 163, 326, 489, 652, 815, 978, 1141,
+  1304, 1467, 1630, 1793, 1955, 2118, 2281, 2443,
+  2605, 2768, 2930, 3092, 3254, 3416, 3577, 3739,
+  3900, 4061, 4223, 4384, 4544, 4705, 4865, 5026,
+  5186, 5346, 5505, 5665, 5824, 5983, 6142, 6300,
+  6459, 6617, 6775, 6932, 7089, 7247, 7403, 7560,
+  7716, 7872, 8028, 8183, 8338, 8493, 8647, 8801,
+  8955, 9108, 9261, 9414, 9566, 9718, 9870, 10021,
+  10172, 10323, 10473, 10622, 10772, 10921, 11069, 11217,
+  11365, 11512, 11659, 11805, 11951, 12097, 12242, 12386,
+  12530, 12674, 12817, 12960, 13102, 13243, 13385, 13525,
+  13665, 13805, 13944, 14083, 14221, 14358, 14495, 14632,
+  14768, 14903, 15038, 15172, 15306, 15439, 15571, 15703,
+  15834, 15965, 16095, 16225, 16353, 16482, 16609, 16736,
+  16863, 16989, 17114, 17238, 17362, 17485, 17608, 17730,
+  17851, 17971, 18091, 18210, 18329, 18446, 18564, 18680,
+  18796, 18911, 19025, 19138, 19251, 19363, 19475, 19585,
+  19695, 19804, 19913, 20020, 20127, 20233, 20339, 20444,
+  20547, 20650, 20753, 20854, 20955, 21055, 21154, 21252,
+  21350, 21447, 21543, 21638, 21732, 21826, 21918, 22010,
+  22101, 22191, 22281, 22369, 22457, 22544, 22630, 22715,
+  22799, 22883, 22965, 23047, 23128, 23208, 23287, 23365,
+  23442, 23519, 23594, 23669, 23743, 23816, 23888, 23959,
+  24029, 24098, 24167, 24234, 24301, 24366, 24431, 24495,
+  24558, 24620, 24681, 24741, 24800, 24858, 24915, 24972,
+  25027, 25082, 25135, 25188, 25239, 25290, 25340, 25389,
+  25436, 25483, 25529, 25574, 25618, 25661, 25703, 25744,
+  25784, 25824, 25862, 25899, 25935, 25970, 26005, 26038,
+  26070, 26102, 26132, 26161, 26190, 26217, 26243, 26269,
+  26293, 26317, 26339, 26361, 26381, 26401, 26419, 26436,
+  26453, 26468, 26483, 26496, 26509, 26520, 26531, 26540,
+  26549, 26556, 26563, 26568, 26573, 26576, 26579, 26580,
+  26581, 26580, 26579, 26576, 26573, 26568, 26563, 26556,
+  26549, 26540, 26531, 26520, 26509, 26496, 26483, 26468,
+  26453, 26436, 26419, 26401, 26381, 26361, 26339, 26317,
+  26293, 26269, 26243, 26217, 26190, 26161, 26132, 26102,
+  26070, 26038, 26005, 25970, 25935, 25899, 25862, 25824,
+  25784, 25744, 25703, 25661, 25618, 25574, 25529, 25483,
+  25436, 25389, 25340, 25290, 25239, 25188, 25135, 25082,
+  25027, 24972, 24915, 24858, 24800, 24741, 24681, 24620,
+  24558, 24495, 24431, 24366, 24301, 24234, 24167, 24098,
+  24029, 23959, 23888, 23816, 23743, 23669, 23594, 23519,
+  23442, 23365, 23287, 23208, 23128, 23047, 22965, 22883,
+  22799, 22715, 22630, 22544, 22457, 22369, 22281, 22191,
+  22101, 22010, 21918, 21826, 21732, 21638, 21543, 21447,
+  21350, 21252, 21154, 21055, 20955, 20854, 20753, 20650,
+  20547, 20444, 20339, 20233, 20127, 20020, 19913, 19804,
+  19695, 19585, 19475, 19363, 19251, 19138, 19025, 18911,
+  18796, 18680, 18564, 18446, 18329, 18210, 18091, 17971,
+  17851, 17730, 17608, 17485, 17362, 17238, 17114, 16989,
+  16863, 16736, 16609, 16482, 16353, 16225, 16095, 15965,
+  15834, 15703, 15571, 15439, 15306, 15172, 15038, 14903,
+  14768, 14632, 14495, 14358, 14221, 14083, 13944, 13805,
+  13665, 13525, 13385, 13243, 13102, 12960, 12817, 12674,
+  12530, 12386, 12242, 12097, 11951, 11805, 11659, 11512,
+  11365, 11217, 11069, 10921, 10772, 10622, 10473, 10323,
+  10172, 10021, 9870, 9718, 9566, 9414, 9261, 9108,
+  8955, 8801, 8647, 8493, 8338, 8183, 8028, 7872,
+  7716, 7560, 7403, 7247, 7089, 6932, 6775, 6617,
+  6459, 6300, 6142, 5983, 5824, 5665, 5505, 5346,
+  5186, 5026, 4865, 4705, 4544, 4384, 4223, 4061,
+  3900, 3739, 3577, 3416, 3254, 3092, 2930, 2768,
+  2605, 2443, 2281, 2118, 1955, 1793, 1630, 1467,
+  1304, 1141, 978, 815, 652, 489, 326, 163,
+  0, -163, -326, -489, -652, -815, -978, -1141,
+  -1304, -1467, -1630, -1793, -1955, -2118, -2281, -2443,
+  -2605, -2768, -2930, -3092, -3254, -3416, -3577, -3739,
+  -3900, -4061, -4223, -4384, -4544, -4705, -4865, -5026,
+  -5186, -5346, -5505, -5665, -5824, -5983, -6142, -6300,
+  -6459, -6617, -6775, -6932, -7089, -7247, -7403, -7560,
+  -7716, -7872, -8028, -8183, -8338, -8493, -8647, -8801,
+  -8955, -9108, -9261, -9414, -9566, -9718, -9870, -10021,
+  -10172, -10323, -10473, -10622, -10772, -10921, -11069, -11217,
+  -11365, -11512, -11659, -11805, -11951, -12097, -12242, -12386,
+  -12530, -12674, -12817, -12960, -13102, -13243, -13385, -13525,
+  -13665, -13805, -13944, -14083, -14221, -14358, -14495, -14632,
+  -14768, -14903, -15038, -15172, -15306, -15439, -15571, -15703,
+  -15834, -15965, -16095, -16225, -16353, -16482, -16609, -16736,
+  -16863, -16989, -17114, -17238, -17362, -17485, -17608, -17730,
+  -17851, -17971, -18091, -18210, -18329, -18446, -18564, -18680,
+  -18796, -18911, -19025, -19138, -19251, -19363, -19475, -19585,
+  -19695, -19804, -19913, -20020, -20127, -20233, -20339, -20444,
+  -20547, -20650, -20753, -20854, -20955, -21055, -21154, -21252,
+  -21350, -21447, -21543, -21638, -21732, -21826, -21918, -22010,
+  -22101, -22191, -22281, -22369, -22457, -22544, -22630, -22715,
+  -22799, -22883, -22965, -23047, -23128, -23208, -23287, -23365,
+  -23442, -23519, -23594, -23669, -23743, -23816, -23888, -23959,
+  -24029, -24098, -24167, -24234, -24301, -24366, -24431, -24495,
+  -24558, -24620, -24681, -24741, -24800, -24858, -24915, -24972,
+  -25027, -25082, -25135, -25188, -25239, -25290, -25340, -25389,
+  -25436, -25483, -25529, -25574, -25618, -25661, -25703, -25744,
+  -25784, -25824, -25862, -25899, -25935, -25970, -26005, -26038,
+  -26070, -26102, -26132, -26161, -26190, -26217, -26243, -26269,
+  -26293, -26317, -26339, -26361, -26381, -26401, -26419, -26436,
+  -26453, -26468, -26483, -26496, -26509, -26520, -26531, -26540,
+  -26549, -26556, -26563, -26568, -26573, -26576, -26579, -26580,
+  -26581, -26580, -26579, -26576, -26573, -26568, -26563, -26556,
+  -26549, -26540, -26531, -26520, -26509, -26496, -26483, -26468,
+  -26453, -26436, -26419, -26401, -26381, -26361, -26339, -26317,
+  -26293, -26269, -26243, -26217, -26190, -26161, -26132, -26102,
+  -26070, -26038, -26005, -25970, -25935, -25899, -25862, -25824,
+  -25784, -25744, -25703, -25661, -25618, -25574, -25529, -25483,
+  -25436, -25389, -25340, -25290, -25239, -25188, -25135, -25082,
+  -25027, -24972, -24915, -24858, -24800, -24741, -24681, -24620,
+  -24558, -24495, -24431, -24366, -24301, -24234, -24167, -24098,
+  -24029, -23959, -23888, -23816, -23743, -23669, -23594, -23519,
+  -23442, -23365, -23287, -23208, -23128, -23047, -22965, -22883,
+  -22799, -22715, -22630, -22544, -22457, -22369, -22281, -22191,
+  -22101, -22010, -21918, -21826, -21732, -21638, -21543, -21447,
+  -21350, -21252, -21154, -21055, -20955, -20854, -20753, -20650,
+  -20547, -20444, -20339, -20233, -20127, -20020, -19913, -19804,
+  -19695, -19585, -19475, -19363, -19251, -19138, -19025, -18911,
+  -18796, -18680, -18564, -18446, -18329, -18210, -18091, -17971,
+  -17851, -17730, -17608, -17485, -17362, -17238, -17114, -16989,
+  -16863, -16736, -16609, -16482, -16353, -16225, -16095, -15965,
+  -15834, -15703, -15571, -15439, -15306, -15172, -15038, -14903,
+  -14768, -14632, -14495, -14358, -14221, -14083, -13944, -13805,
+  -13665, -13525, -13385, -13243, -13102, -12960, -12817, -12674,
+  -12530, -12386, -12242, -12097, -11951, -11805, -11659, -11512,
+  -11365, -11217, -11069, -10921, -10772, -10622, -10473, -10323,
+  -10172, -10021, -9870, -9718, -9566, -9414, -9261, -9108,
+  -8955, -8801, -8647, -8493, -8338, -8183, -8028, -7872,
+  -7716, -7560, -7403, -7247, -7089, -6932, -6775, -6617,
+  -6459, -6300, -6142, -5983, -5824, -5665, -5505, -5346,
+  -5186, -5026, -4865, -4705, -4544, -4384, -4223, -4061,
+  -3900, -3739, -3577, -3416, -3254, -3092, -2930, -2768,
+  -2605, -2443, -2281, -2118, -1955, -1793, -1630, -1467,
+  -1304, -1141, -978, -815, -652, -489, -326, -163,
+  0
+};
+
+static const int16_t hifi_wavetable_saw_0[2049] =
+{
+  0, 24284, 32767, 28406, 25025, 27455, 29518, 27771,
+  26228, 27525, 28686, 27581, 26578, 27461, 28261, 27445,
+  26701, 27369, 27975, 27325, 26732, 27269, 27753, 27210,
+  26717, 27165, 27565, 27097, 26675, 27059, 27399, 26986,
+  26617, 26952, 27246, 26876, 26547, 26845, 27102, 26766,
+  26470, 26737, 26965, 26656, 26387, 26629, 26833, 26547,
+  26299, 26521, 26705, 26438, 26209, 26413, 26579, 26329,
+  26115, 26304, 26456, 26220, 26020, 26196, 26335, 26111,
+  25923, 26087, 26215, 26002, 25825, 25979, 26096, 25893,
+  25725, 25870, 25979, 25784, 25625, 25762, 25862, 25675,
+  25524, 25653, 25746, 25566, 25422, 25544, 25631, 25457,
+  25319, 25436, 25517, 25348, 25216, 25327, 25402, 25240,
+  25112, 25218, 25289, 25131, 25008, 25110, 25176, 25022,
+  24904, 25001, 25063, 24913, 24799, 24892, 24950, 24804,
+  24694, 24783, 24838, 24696, 24589, 24675, 24725, 24587,
+  24483, 24566, 24613, 24478, 24378, 24457, 24502, 24369,
+  24272, 24349, 24390, 24261, 24166, 24240, 24279, 24152,
+  24060, 24131, 24168, 24043, 23953, 24022, 24057, 23934,
+  23847, 23914, 23946, 23825, 23740, 23805, 23835, 23717,
+  23634, 23696, 23724, 23608, 23527, 23588, 23613, 23499,
+  23420, 23479, 23503, 23390, 23313, 23370, 23392, 23282,
+  23206, 23261, 23282, 23173, 23099, 23153, 23172, 23064,
+  22991, 23044, 23061, 22955, 22884, 22935, 22951, 22847,
+  22777, 22826, 22841, 22738, 22669, 22718, 22731, 22629,
+  22562, 22609, 22621, 22520, 22454, 22500, 22511, 22412,
+  22347, 22391, 22401, 22303, 22239, 22283, 22291, 22194,
+  22132, 22174, 22182, 22085, 22024, 22065, 22072, 21977,
+  21916, 21957, 21962, 21868, 21808, 21848, 21852, 21759,
+  21701, 21739, 21743, 21650, 21593, 21630, 21633, 21542,
+  21485, 21522, 21523, 21433, 21377, 21413, 21414, 21324,
+  21269, 21304, 21304, 21215, 21161, 21195, 21195, 21107,
+  21053, 21087, 21085, 20998, 20945, 20978, 20976, 20889,
+  20837, 20869, 20866, 20780, 20729, 20760, 20757, 20672,
+  20621, 20652, 20647, 20563, 20513, 20543, 20538, 20454,
+  20405, 20434, 20428, 20345, 20297, 20325, 20319, 20237,
+  20189, 20217, 20210, 20128, 20081, 20108, 20100, 20019,
+  19973, 19999, 19991, 19910, 19864, 19890, 19882, 19802,
+  19756, 19782, 19772, 19693, 19648, 19673, 19663, 19584,
+  19540, 19564, 19554, 19475, 19432, 19455, 19445, 19367,
+  19323, 19347, 19335, 19258, 19215, 19238, 19226, 19149,
+  19107, 19129, 19117, 19040, 18999, 19020, 19008, 18932,
+  18890, 18912, 18899, 18823, 18782, 18803, 18789, 18714,
+  18674, 18694, 18680, 18605, 18565, 18586, 18571, 18497,
+  18457, 18477, 18462, 18388, 18349, 18368, 18353, 18279,
+  18240, 18259, 18244, 18170, 18132, 18151, 18134, 18062,
+  18024, 18042, 18025, 17953, 17915, 17933, 17916, 17844,
+  17807, 17824, 17807, 17735, 17699, 17716, 17698, 17627,
+  17590, 17607, 17589, 17518, 17482, 17498, 17480, 17409,
+  17373, 17389, 17371, 17300, 17265, 17281, 17262, 17192,
+  17157, 17172, 17152, 17083, 17048, 17063, 17043, 16974,
+  16940, 16954, 16934, 16865, 16831, 16846, 16825, 16757,
+  16723, 16737, 16716, 16648, 16614, 16628, 16607, 16539,
+  16506, 16519, 16498, 16430, 16398, 16411, 16389, 16322,
+  16289, 16302, 16280, 16213, 16181, 16193, 16171, 16104,
+  16072, 16084, 16062, 15995, 15964, 15976, 15953, 15887,
+  15855, 15867, 15844, 15778, 15747, 15758, 15735, 15669,
+  15638, 15649, 15626, 15561, 15530, 15541, 15517, 15452,
+  15421, 15432, 15408, 15343, 15313, 15323, 15299, 15234,
+  15204, 15214, 15190, 15126, 15096, 15106, 15081, 15017,
+  14987, 14997, 14972, 14908, 14879, 14888, 14863, 14799,
+  14770, 14779, 14754, 14691, 14662, 14671, 14645, 14582,
+  14553, 14562, 14536, 14473, 14445, 14453, 14427, 14364,
+  14336, 14344, 14318, 14256, 14228, 14236, 14209, 14147,
+  14119, 14127, 14100, 14038, 14011, 14018, 13991, 13929,
+  13902, 13909, 13882, 13821, 13794, 13801, 13773, 13712,
+  13685, 13692, 13664, 13603, 13576, 13583, 13555, 13494,
+  13468, 13475, 13446, 13386, 13359, 13366, 13337, 13277,
+  13251, 13257, 13229, 13168, 13142, 13148, 13120, 13059,
+  13034, 13040, 13011, 12951, 12925, 12931, 12902, 12842,
+  12817, 12822, 12793, 12733, 12708, 12713, 12684, 12624,
+  12600, 12605, 12575, 12516, 12491, 12496, 12466, 12407,
+  12382, 12387, 12357, 12298, 12274, 12278, 12248, 12189,
+  12165, 12170, 12139, 12081, 12057, 12061, 12030, 11972,
+  11948, 11952, 11921, 11863, 11840, 11843, 11812, 11754,
+  11731, 11735, 11704, 11646, 11622, 11626, 11595, 11537,
+  11514, 11517, 11486, 11428, 11405, 11408, 11377, 11319,
+  11297, 11300, 11268, 11211, 11188, 11191, 11159, 11102,
+  11080, 11082, 11050, 10993, 10971, 10973, 10941, 10884,
+  10862, 10865, 10832, 10776, 10754, 10756, 10723, 10667,
+  10645, 10647, 10614, 10558, 10537, 10538, 10506, 10449,
+  10428, 10430, 10397, 10341, 10319, 10321, 10288, 10232,
+  10211, 10212, 10179, 10123, 10102, 10103, 10070, 10014,
+  9994, 9995, 9961, 9906, 9885, 9886, 9852, 9797,
+  9776, 9777, 9743, 9688, 9668, 9668, 9634, 9579,
+  9559, 9560, 9526, 9471, 9451, 9451, 9417, 9362,
+  9342, 9342, 9308, 9253, 9233, 9233, 9199, 9145,
+  9125, 9125, 9090, 9036, 9016, 9016, 8981, 8927,
+  8908, 8907, 8872, 8818, 8799, 8798, 8763, 8710,
+  8690, 8690, 8654, 8601, 8582, 8581, 8546, 8492,
+  8473, 8472, 8437, 8383, 8365, 8363, 8328, 8275,
+  8256, 8255, 8219, 8166, 8147, 8146, 8110, 8057,
+  8039, 8037, 8001, 7948, 7930, 7929, 7892, 7840,
+  7821, 7820, 7783, 7731, 7713, 7711, 7675, 7622,
+  7604, 7602, 7566, 7513, 7496, 7494, 7457, 7405,
+  7387, 7385, 7348, 7296, 7278, 7276, 7239, 7187,
+  7170, 7167, 7130, 7078, 7061, 7059, 7021, 6970,
+  6953, 6950, 6912, 6861, 6844, 6841, 6804, 6752,
+  6735, 6732, 6695, 6643, 6627, 6624, 6586, 6535,
+  6518, 6515, 6477, 6426, 6409, 6406, 6368, 6317,
+  6301, 6297, 6259, 6208, 6192, 6189, 6150, 6100,
+  6084, 6080, 6041, 5991, 5975, 5971, 5933, 5882,
+  5866, 5862, 5824, 5773, 5758, 5754, 5715, 5665,
+  5649, 5645, 5606, 5556, 5540, 5536, 5497, 5447,
+  5432, 5427, 5388, 5338, 5323, 5319, 5279, 5230,
+  5215, 5210, 5171, 5121, 5106, 5101, 5062, 5012,
+  4997, 4992, 4953, 4903, 4889, 4884, 4844, 4795,
+  4780, 4775, 4735, 4686, 4671, 4666, 4626, 4577,
+  4563, 4557, 4517, 4468, 4454, 4449, 4409, 4360,
+  4345, 4340, 4300, 4251, 4237, 4231, 4191, 4142,
+  4128, 4122, 4082, 4033, 4020, 4014, 3973, 3925,
+  3911, 3905, 3864, 3816, 3802, 3796, 3755, 3707,
+  3694, 3687, 3647, 3598, 3585, 3579, 3538, 3490,
+  3476, 3470, 3429, 3381, 3368, 3361, 3320, 3272,
+  3259, 3252, 3211, 3164, 3151, 3144, 3102, 3055,
+  3042, 3035, 2993, 2946, 2933, 2926, 2885, 2837,
+  2825, 2817, 2776, 2729, 2716, 2709, 2667, 2620,
+  2607, 2600, 2558, 2511, 2499, 2491, 2449, 2402,
+  2390, 2383, 2340, 2294, 2281, 2274, 2231, 2185,
+  2173, 2165, 2123, 2076, 2064, 2056, 2014, 1967,
+  1955, 1948, 1905, 1859, 1847, 1839, 1796, 1750,
+  1738, 1730, 1687, 1641, 1630, 1621, 1578, 1532,
+  1521, 1513, 1469, 1424, 1412, 1404, 1361, 1315,
+  1304, 1295, 1252, 1206, 1195, 1186, 1143, 1097,
+  1086, 1078, 1034, 989, 978, 969, 925, 880,
+  869, 860, 816, 771, 760, 751, 708, 662,
+  652, 643, 599, 554, 543, 534, 490, 445,
+  435, 425, 381, 336, 326, 316, 272, 227,
+  217, 208, 163, 119, 109, 99, 54, 10,
+  0, -10, -54, -99, -109, -119, -163, -208,
+  -217, -227, -272, -316, -326, -336, -381, -425,
+  -435, -445, -490, -534, -543, -554, -599, -643,
+  -652, -662, -708, -751, -760, -771, -816, -860,
+  -869, -880, -925, -969, -978, -989, -1034, -1078,
+  -1086, -1097, -1143, -1186, -1195, -1206, -1252, -1295,
+  -1304, -1315, -1361, -1404, -1412, -1424, -1469, -1513,
+  -1521, -1532, -1578, -1621, -1630, -1641, -1687, -1730,
+  -1738, -1750, -1796, -1839, -1847, -1859, -1905, -1948,
+  -1955, -1967, -2014, -2056, -2064, -2076, -2123, -2165,
+  -2173, -2185, -2231, -2274, -2281, -2294, -2340, -2383,
+  -2390, -2402, -2449, -2491, -2499, -2511, -2558, -2600,
+  -2607, -2620, -2667, -2709, -2716, -2729, -2776, -2817,
+  -2825, -2837, -2885, -2926, -2933, -2946, -2993, -3035,
+  -3042, -3055, -3102, -3144, -3151, -3164, -3211, -3252,
+  -3259, -3272, -3320, -3361, -3368, -3381, -3429, -3470,
+  -3476, -3490, -3538, -3579, -3585, -3598, -3647, -3687,
+  -3694, -3707, -3755, -3796, -3802, -3816, -3864, -3905,
+  -3911, -3925, -3973, -4014, -4020, -4033, -4082, -4122,
+  -4128, -4142, -4191, -4231, -4237, -4251, -4300, -4340,
+  -4345, -4360, -4409, -4449, -4454, -4468, -4517, -4557,
+  -4563, -4577, -4626, -4666, -4671, -4686, -4735, -4775,
+  -4780, -4795, -4844, -4884, -4889, -4903, -4953, -4992,
+  -4997, -5012, -5062, -5101, -5106, -5121, -5171, -5210,
+  -5215, -5230, -5279, -5319, -5323, -5338, -5388, -5427,
+  -5432, -5447, -5497, -5536, -5540, -5556, -5606, -5645,
+  -5649, -5665, -5715, -5754, -5758, -5773, -5824, -5862,
+  -5866, -5882, -5933, -5971, -5975, -5991, -6041, -6080,
+  -6084, -6100, -6150, -6189, -6192, -6208, -6259, -6297,
+  -6301, -6317, -6368, -6406, -6409, -6426, -6477, -6515,
+  -6518, -6535, -6586, -6624, -6627, -6643, -6695, -6732,
+  -6735, -6752, -6804, -6841, -6844, -6861, -6912, -6950,
+  -6953, -6970, -7021, -7059, -7061, -7078, -7130, -7167,
+  -7170, -7187, -7239, -7276, -7278, -7296, -7348, -7385,
+  -7387, -7405, -7457, -7494, -7496, -7513, -7566, -7602,
+  -7604, -7622, -7675, -7711, -7713, -7731, -7783, -7820,
+  -7821, -7840, -7892, -7929, -7930, -7948, -8001, -8037,
+  -8039, -8057, -8110, -8146, -8147, -8166, -8219, -8255,
+  -8256, -8275, -8328, -8363, -8365, -8383, -8437, -8472,
+  -8473, -8492, -8546, -8581, -8582, -8601, -8654, -8690,
+  -8690, -8710, -8763, -8798, -8799, -8818, -8872, -8907,
+  -8908, -8927, -8981, -9016, -9016, -9036, -9090, -9125,
+  -9125, -9145, -9199, -9233, -9233, -9253, -9308, -9342,
+  -9342, -9362, -9417, -9451, -9451, -9471, -9526, -9560,
+  -9559, -9579, -9634, -9668, -9668, -9688, -9743, -9777,
+  -9776, -9797, -9852, -9886, -9885, -9906, -9961, -9995,
+  -9994, -10014, -10070, -10103, -10102, -10123, -10179, -10212,
+  -10211, -10232, -10288, -10321, -10319, -10341, -10397, -10430,
+  -10428, -10449, -10506, -10538, -10537, -10558, -10614, -10647,
+  -10645, -10667, -10723, -10756, -10754, -10776, -10832, -10865,
+  -10862, -10884, -10941, -10973, -10971, -10993, -11050, -11082,
+  -11080, -11102, -11159, -11191, -11188, -11211, -11268, -11300,
+  -11297, -11319, -11377, -11408, -11405, -11428, -11486, -11517,
+  -11514, -11537, -11595, -11626, -11622, -11646, -11704, -11735,
+  -11731, -11754, -11812, -11843, -11840, -11863, -11921, -11952,
+  -11948, -11972, -12030, -12061, -12057, -12081, -12139, -12170,
+  -12165, -12189, -12248, -12278, -12274, -12298, -12357, -12387,
+  -12382, -12407, -12466, -12496, -12491, -12516, -12575, -12605,
+  -12600, -12624, -12684, -12713, -12708, -12733, -12793, -12822,
+  -12817, -12842, -12902, -12931, -12925, -12951, -13011, -13040,
+  -13034, -13059, -13120, -13148, -13142, -13168, -13229, -13257,
+  -13251, -13277, -13337, -13366, -13359, -13386, -13446, -13475,
+  -13468, -13494, -13555, -13583, -13576, -13603, -13664, -13692,
+  -13685, -13712, -13773, -13801, -13794, -13821, -13882, -13909,
+  -13902, -13929, -13991, -14018, -14011, -14038, -14100, -14127,
+  -14119, -14147, -14209, -14236, -14228, -14256, -14318, -14344,
+  -14336, -14364, -14427, -14453, -14445, -14473, -14536, -14562,
+  -14553, -14582, -14645, -14671, -14662, -14691, -14754, -14779,
+  -14770, -14799, -14863, -14888, -14879, -14908, -14972, -14997,
+  -14987, -15017, -15081, -15106, -15096, -15126, -15190, -15214,
+  -15204, -15234, -15299, -15323, -15313, -15343, -15408, -15432,
+  -15421, -15452, -15517, -15541, -15530, -15561, -15626, -15649,
+  -15638, -15669, -15735, -15758, -15747, -15778, -15844, -15867,
+  -15855, -15887, -15953, -15976, -15964, -15995, -16062, -16084,
+  -16072, -16104, -16171, -16193, -16181, -16213, -16280, -16302,
+  -16289, -16322, -16389, -16411, -16398, -16430, -16498, -16519,
+  -16506, -16539, -16607, -16628, -16614, -16648, -16716, -16737,
+  -16723, -16757, -16825, -16846, -16831, -16865, -16934, -16954,
+  -16940, -16974, -17043, -17063, -17048, -17083, -17152, -17172,
+  -17157, -17192, -17262, -17281, -17265, -17300, -17371, -17389,
+  -17373, -17409, -17480, -17498, -17482, -17518, -17589, -17607,
+  -17590, -17627, -17698, -17716, -17699, -17735, -17807, -17824,
+  -17807, -17844, -17916, -17933, -17915, -17953, -18025, -18042,
+  -18024, -18062, -18134, -18151, -18132, -18170, -18244, -18259,
+  -18240, -18279, -18353, -18368, -18349, -18388, -18462, -18477,
+  -18457, -18497, -18571, -18586, -18565, -18605, -18680, -18694,
+  -18674, -18714, -18789, -18803, -18782, -18823, -18899, -18912,
+  -18890, -18932, -19008, -19020, -18999, -19040, -19117, -19129,
+  -19107, -19149, -19226, -19238, -19215, -19258, -19335, -19347,
+  -19323, -19367, -19445, -19455, -19432, -19475, -19554, -19564,
+  -19540, -19584, -19663, -19673, -19648, -19693, -19772, -19782,
+  -19756, -19802, -19882, -19890, -19864, -19910, -19991, -19999,
+  -19973, -20019, -20100, -20108, -20081, -20128, -20210, -20217,
+  -20189, -20237, -20319, -20325, -20297, -20345, -20428, -20434,
+  -20405, -20454, -20538, -20543, -20513, -20563, -20647, -20652,
+  -20621, -20672, -20757, -20760, -20729, -20780, -20866, -20869,
+  -20837, -20889, -20976, -20978, -20945, -20998, -21085, -21087,
+  -21053, -21107, -21195, -21195, -21161, -21215, -21304, -21304,
+  -21269, -21324, -21414, -21413, -21377, -21433, -21523, -21522,
+  -21485, -21542, -21633, -21630, -21593, -21650, -21743, -21739,
+  -21701, -21759, -21852, -21848, -21808, -21868, -21962, -21957,
+  -21916, -21977, -22072, -22065, -22024, -22085, -22182, -22174,
+  -22132, -22194, -22291, -22283, -22239, -22303, -22401, -22391,
+  -22347, -22412, -22511, -22500, -22454, -22520, -22621, -22609,
+  -22562, -22629, -22731, -22718, -22669, -22738, -22841, -22826,
+  -22777, -22847, -22951, -22935, -22884, -22955, -23061, -23044,
+  -22991, -23064, -23172, -23153, -23099, -23173, -23282, -23261,
+  -23206, -23282, -23392, -23370, -23313, -23390, -23503, -23479,
+  -23420, -23499, -23613, -23588, -23527, -23608, -23724, -23696,
+  -23634, -23717, -23835, -23805, -23740, -23825, -23946, -23914,
+  -23847, -23934, -24057, -24022, -23953, -24043, -24168, -24131,
+  -24060, -24152, -24279, -24240, -24166, -24261, -24390, -24349,
+  -24272, -24369, -24502, -24457, -24378, -24478, -24613, -24566,
+  -24483, -24587, -24725, -24675, -24589, -24696, -24838, -24783,
+  -24694, -24804, -24950, -24892, -24799, -24913, -25063, -25001,
+  -24904, -25022, -25176, -25110, -25008, -25131, -25289, -25218,
+  -25112, -25240, -25402, -25327, -25216, -25348, -25517, -25436,
+  -25319, -25457, -25631, -25544, -25422, -25566, -25746, -25653,
+  -25524, -25675, -25862, -25762, -25625, -25784, -25979, -25870,
+  -25725, -25893, -26096, -25979, -25825, -26002, -26215, -26087,
+  -25923, -26111, -26335, -26196, -26020, -26220, -26456, -26304,
+  -26115, -26329, -26579, -26413, -26209, -26438, -26705, -26521,
+  -26299, -26547, -26833, -26629, -26387, -26656, -26965, -26737,
+  -26470, -26766, -27102, -26845, -26547, -26876, -27246, -26952,
+  -26617, -26986, -27399, -27059, -26675, -27097, -27565, -27165,
+  -26717, -27210, -27753, -27269, -26732, -27325, -27975, -27369,
+  -26701, -27445, -28261, -27461, -26578, -27581, -28686, -27525,
+  -26228, -27771, -29518, -27455, -25025, -28406, -32767, -24284,
+  0
+};
+
+static const int16_t hifi_wavetable_saw_1[2049] =
+{
+  0, 13448, 24274, 30776, 32713, 31239, 28307, 25820,
+  24916, 25677, 27336, 28824, 29355, 28781, 27564, 26444,
+  26010, 26404, 27298, 28124, 28414, 28043, 27264, 26537,
+  26252, 26517, 27125, 27690, 27880, 27598, 27020, 26480,
+  26266, 26466, 26924, 27350, 27485, 27253, 26791, 26360,
+  26189, 26349, 26715, 27053, 27154, 26954, 26567, 26207,
+  26065, 26198, 26503, 26781, 26858, 26681, 26346, 26037,
+  25915, 26028, 26288, 26523, 26582, 26422, 26126, 25854,
+  25748, 25847, 26073, 26274, 26321, 26173, 25907, 25664,
+  25569, 25657, 25856, 26032, 26068, 25931, 25688, 25469,
+  25383, 25462, 25640, 25795, 25822, 25693, 25470, 25270,
+  25192, 25263, 25423, 25561, 25581, 25459, 25252, 25067,
+  24996, 25061, 25206, 25330, 25344, 25227, 25034, 24862,
+  24796, 24856, 24989, 25100, 25110, 24998, 24816, 24656,
+  24595, 24650, 24772, 24873, 24878, 24770, 24598, 24448,
+  24391, 24442, 24555, 24646, 24647, 24543, 24381, 24239,
+  24185, 24233, 24337, 24421, 24419, 24318, 24163, 24029,
+  23978, 24023, 24120, 24196, 24191, 24093, 23945, 23818,
+  23770, 23812, 23903, 23973, 23965, 23870, 23728, 23606,
+  23561, 23601, 23685, 23750, 23740, 23647, 23510, 23394,
+  23351, 23388, 23468, 23527, 23515, 23424, 23292, 23182,
+  23140, 23176, 23251, 23305, 23291, 23202, 23075, 22968,
+  22929, 22963, 23033, 23083, 23067, 22980, 22857, 22755,
+  22717, 22749, 22816, 22862, 22844, 22759, 22640, 22541,
+  22505, 22536, 22598, 22641, 22622, 22538, 22422, 22327,
+  22292, 22321, 22381, 22420, 22400, 22317, 22205, 22113,
+  22079, 22107, 22164, 22199, 22178, 22096, 21987, 21898,
+  21866, 21893, 21946, 21979, 21956, 21876, 21769, 21683,
+  21652, 21678, 21729, 21759, 21735, 21656, 21552, 21469,
+  21438, 21463, 21511, 21539, 21514, 21436, 21334, 21253,
+  21224, 21248, 21294, 21319, 21293, 21216, 21117, 21038,
+  21010, 21033, 21076, 21100, 21073, 20996, 20899, 20823,
+  20796, 20817, 20859, 20880, 20852, 20777, 20682, 20607,
+  20581, 20602, 20641, 20661, 20632, 20557, 20464, 20392,
+  20366, 20386, 20424, 20441, 20412, 20338, 20247, 20176,
+  20151, 20170, 20206, 20222, 20192, 20119, 20029, 19960,
+  19936, 19955, 19989, 20003, 19972, 19900, 19812, 19744,
+  19721, 19739, 19772, 19784, 19753, 19681, 19594, 19528,
+  19505, 19523, 19554, 19565, 19533, 19462, 19377, 19312,
+  19290, 19307, 19337, 19346, 19314, 19243, 19159, 19096,
+  19074, 19091, 19119, 19127, 19094, 19024, 18942, 18880,
+  18859, 18874, 18902, 18908, 18875, 18805, 18724, 18664,
+  18643, 18658, 18684, 18690, 18656, 18586, 18507, 18447,
+  18427, 18442, 18467, 18471, 18437, 18368, 18289, 18231,
+  18211, 18226, 18249, 18252, 18217, 18149, 18072, 18015,
+  17996, 18009, 18032, 18034, 17998, 17931, 17854, 17798,
+  17780, 17793, 17814, 17815, 17779, 17712, 17637, 17582,
+  17564, 17576, 17597, 17597, 17560, 17493, 17419, 17365,
+  17347, 17360, 17379, 17378, 17342, 17275, 17202, 17149,
+  17131, 17143, 17162, 17160, 17123, 17057, 16984, 16932,
+  16915, 16927, 16944, 16941, 16904, 16838, 16767, 16716,
+  16699, 16710, 16727, 16723, 16685, 16620, 16549, 16499,
+  16483, 16494, 16509, 16505, 16467, 16401, 16332, 16282,
+  16266, 16277, 16292, 16286, 16248, 16183, 16114, 16066,
+  16050, 16060, 16074, 16068, 16029, 15965, 15897, 15849,
+  15834, 15844, 15857, 15850, 15811, 15747, 15679, 15632,
+  15617, 15627, 15639, 15632, 15592, 15528, 15462, 15415,
+  15401, 15410, 15422, 15413, 15374, 15310, 15244, 15199,
+  15184, 15193, 15204, 15195, 15155, 15092, 15027, 14982,
+  14968, 14976, 14987, 14977, 14937, 14874, 14809, 14765,
+  14751, 14760, 14769, 14759, 14718, 14656, 14592, 14548,
+  14535, 14543, 14552, 14541, 14500, 14438, 14374, 14331,
+  14318, 14326, 14334, 14323, 14282, 14219, 14157, 14115,
+  14101, 14109, 14117, 14105, 14063, 14001, 13939, 13898,
+  13885, 13892, 13900, 13886, 13845, 13783, 13722, 13681,
+  13668, 13675, 13682, 13668, 13627, 13565, 13504, 13464,
+  13451, 13458, 13465, 13450, 13408, 13347, 13287, 13247,
+  13235, 13241, 13247, 13232, 13190, 13129, 13069, 13030,
+  13018, 13025, 13030, 13014, 12972, 12911, 12852, 12813,
+  12801, 12808, 12812, 12796, 12753, 12693, 12634, 12596,
+  12585, 12591, 12595, 12578, 12535, 12475, 12417, 12379,
+  12368, 12374, 12377, 12360, 12317, 12257, 12199, 12162,
+  12151, 12157, 12160, 12142, 12099, 12039, 11982, 11945,
+  11934, 11940, 11942, 11924, 11881, 11821, 11764, 11728,
+  11717, 11723, 11725, 11706, 11662, 11603, 11547, 11511,
+  11501, 11506, 11507, 11488, 11444, 11385, 11329, 11294,
+  11284, 11289, 11290, 11270, 11226, 11167, 11112, 11077,
+  11067, 11072, 11072, 11052, 11008, 10949, 10894, 10860,
+  10850, 10855, 10855, 10834, 10790, 10731, 10677, 10643,
+  10633, 10638, 10637, 10617, 10572, 10513, 10459, 10426,
+  10416, 10420, 10420, 10399, 10354, 10295, 10242, 10209,
+  10200, 10203, 10202, 10181, 10136, 10077, 10024, 9992,
+  9983, 9986, 9985, 9963, 9917, 9859, 9807, 9775,
+  9766, 9769, 9767, 9745, 9699, 9642, 9589, 9558,
+  9549, 9552, 9550, 9527, 9481, 9424, 9372, 9341,
+  9332, 9335, 9332, 9309, 9263, 9206, 9154, 9123,
+  9115, 9118, 9115, 9091, 9045, 8988, 8937, 8906,
+  8898, 8901, 8897, 8873, 8827, 8770, 8719, 8689,
+  8681, 8684, 8680, 8655, 8609, 8552, 8502, 8472,
+  8464, 8467, 8462, 8438, 8391, 8334, 8284, 8255,
+  8247, 8250, 8245, 8220, 8173, 8116, 8067, 8038,
+  8030, 8032, 8027, 8002, 7955, 7899, 7850, 7821,
+  7813, 7815, 7810, 7784, 7737, 7681, 7632, 7604,
+  7596, 7598, 7592, 7566, 7519, 7463, 7415, 7387,
+  7379, 7381, 7375, 7348, 7301, 7245, 7197, 7169,
+  7162, 7164, 7157, 7130, 7083, 7027, 6980, 6952,
+  6945, 6947, 6940, 6913, 6865, 6809, 6762, 6735,
+  6728, 6730, 6722, 6695, 6647, 6591, 6545, 6518,
+  6511, 6513, 6505, 6477, 6429, 6374, 6327, 6301,
+  6294, 6295, 6287, 6259, 6211, 6156, 6110, 6084,
+  6077, 6078, 6070, 6041, 5993, 5938, 5892, 5867,
+  5860, 5861, 5852, 5823, 5775, 5720, 5675, 5649,
+  5643, 5644, 5635, 5606, 5557, 5502, 5457, 5432,
+  5426, 5427, 5417, 5388, 5339, 5284, 5240, 5215,
+  5209, 5210, 5200, 5170, 5121, 5067, 5022, 4998,
+  4992, 4992, 4982, 4952, 4903, 4849, 4805, 4781,
+  4775, 4775, 4765, 4734, 4685, 4631, 4587, 4564,
+  4558, 4558, 4547, 4517, 4467, 4413, 4370, 4346,
+  4341, 4341, 4330, 4299, 4250, 4195, 4152, 4129,
+  4124, 4124, 4112, 4081, 4032, 3978, 3935, 3912,
+  3907, 3907, 3895, 3863, 3814, 3760, 3717, 3695,
+  3690, 3689, 3678, 3645, 3596, 3542, 3500, 3478,
+  3473, 3472, 3460, 3427, 3378, 3324, 3282, 3261,
+  3256, 3255, 3243, 3210, 3160, 3106, 3065, 3043,
+  3039, 3038, 3025, 2992, 2942, 2889, 2847, 2826,
+  2822, 2821, 2808, 2774, 2724, 2671, 2630, 2609,
+  2605, 2604, 2590, 2556, 2506, 2453, 2412, 2392,
+  2388, 2386, 2373, 2338, 2288, 2235, 2195, 2175,
+  2171, 2169, 2155, 2121, 2070, 2017, 1977, 1957,
+  1954, 1952, 1938, 1903, 1852, 1800, 1760, 1740,
+  1737, 1735, 1720, 1685, 1634, 1582, 1542, 1523,
+  1519, 1518, 1503, 1467, 1416, 1364, 1325, 1306,
+  1302, 1300, 1285, 1250, 1199, 1146, 1107, 1089,
+  1085, 1083, 1068, 1032, 981, 928, 890, 871,
+  868, 866, 850, 814, 763, 711, 672, 654,
+  651, 649, 633, 596, 545, 493, 455, 437,
+  434, 432, 415, 378, 327, 275, 237, 220,
+  217, 214, 198, 161, 109, 57, 20, 3,
+  0, -3, -20, -57, -109, -161, -198, -214,
+  -217, -220, -237, -275, -327, -378, -415, -432,
+  -434, -437, -455, -493, -545, -596, -633, -649,
+  -651, -654, -672, -711, -763, -814, -850, -866,
+  -868, -871, -890, -928, -981, -1032, -1068, -1083,
+  -1085, -1089, -1107, -1146, -1199, -1250, -1285, -1300,
+  -1302, -1306, -1325, -1364, -1416, -1467, -1503, -1518,
+  -1519, -1523, -1542, -1582, -1634, -1685, -1720, -1735,
+  -1737, -1740, -1760, -1800, -1852, -1903, -1938, -1952,
+  -1954, -1957, -1977, -2017, -2070, -2121, -2155, -2169,
+  -2171, -2175, -2195, -2235, -2288, -2338, -2373, -2386,
+  -2388, -2392, -2412, -2453, -2506, -2556, -2590, -2604,
+  -2605, -2609, -2630, -2671, -2724, -2774, -2808, -2821,
+  -2822, -2826, -2847, -2889, -2942, -2992, -3025, -3038,
+  -3039, -3043, -3065, -3106, -3160, -3210, -3243, -3255,
+  -3256, -3261, -3282, -3324, -3378, -3427, -3460, -3472,
+  -3473, -3478, -3500, -3542, -3596, -3645, -3678, -3689,
+  -3690, -3695, -3717, -3760, -3814, -3863, -3895, -3907,
+  -3907, -3912, -3935, -3978, -4032, -4081, -4112, -4124,
+  -4124, -4129, -4152, -4195, -4250, -4299, -4330, -4341,
+  -4341, -4346, -4370, -4413, -4467, -4517, -4547, -4558,
+  -4558, -4564, -4587, -4631, -4685, -4734, -4765, -4775,
+  -4775, -4781, -4805, -4849, -4903, -4952, -4982, -4992,
+  -4992, -4998, -5022, -5067, -5121, -5170, -5200, -5210,
+  -5209, -5215, -5240, -5284, -5339, -5388, -5417, -5427,
+  -5426, -5432, -5457, -5502, -5557, -5606, -5635, -5644,
+  -5643, -5649, -5675, -5720, -5775, -5823, -5852, -5861,
+  -5860, -5867, -5892, -5938, -5993, -6041, -6070, -6078,
+  -6077, -6084, -6110, -6156, -6211, -6259, -6287, -6295,
+  -6294, -6301, -6327, -6374, -6429, -6477, -6505, -6513,
+  -6511, -6518, -6545, -6591, -6647, -6695, -6722, -6730,
+  -6728, -6735, -6762, -6809, -6865, -6913, -6940, -6947,
+  -6945, -6952, -6980, -7027, -7083, -7130, -7157, -7164,
+  -7162, -7169, -7197, -7245, -7301, -7348, -7375, -7381,
+  -7379, -7387, -7415, -7463, -7519, -7566, -7592, -7598,
+  -7596, -7604, -7632, -7681, -7737, -7784, -7810, -7815,
+  -7813, -7821, -7850, -7899, -7955, -8002, -8027, -8032,
+  -8030, -8038, -8067, -8116, -8173, -8220, -8245, -8250,
+  -8247, -8255, -8284, -8334, -8391, -8438, -8462, -8467,
+  -8464, -8472, -8502, -8552, -8609, -8655, -8680, -8684,
+  -8681, -8689, -8719, -8770, -8827, -8873, -8897, -8901,
+  -8898, -8906, -8937, -8988, -9045, -9091, -9115, -9118,
+  -9115, -9123, -9154, -9206, -9263, -9309, -9332, -9335,
+  -9332, -9341, -9372, -9424, -9481, -9527, -9550, -9552,
+  -9549, -9558, -9589, -9642, -9699, -9745, -9767, -9769,
+  -9766, -9775, -9807, -9859, -9917, -9963, -9985, -9986,
+  -9983, -9992, -10024, -10077, -10136, -10181, -10202, -10203,
+  -10200, -10209, -10242, -10295, -10354, -10399, -10420, -10420,
+  -10416, -10426, -10459, -10513, -10572, -10617, -10637, -10638,
+  -10633, -10643, -10677, -10731, -10790, -10834, -10855, -10855,
+  -10850, -10860, -10894, -10949, -11008, -11052, -11072, -11072,
+  -11067, -11077, -11112, -11167, -11226, -11270, -11290, -11289,
+  -11284, -11294, -11329, -11385, -11444, -11488, -11507, -11506,
+  -11501, -11511, -11547, -11603, -11662, -11706, -11725, -11723,
+  -11717, -11728, -11764, -11821, -11881, -11924, -11942, -11940,
+  -11934, -11945, -11982, -12039, -12099, -12142, -12160, -12157,
+  -12151, -12162, -12199, -12257, -12317, -12360, -12377, -12374,
+  -12368, -12379, -12417, -12475, -12535, -12578, -12595, -12591,
+  -12585, -12596, -12634, -12693, -12753, -12796, -12812, -12808,
+  -12801, -12813, -12852, -12911, -12972, -13014, -13030, -13025,
+  -13018, -13030, -13069, -13129, -13190, -13232, -13247, -13241,
+  -13235, -13247, -13287, -13347, -13408, -13450, -13465, -13458,
+  -13451, -13464, -13504, -13565, -13627, -13668, -13682, -13675,
+  -13668, -13681, -13722, -13783, -13845, -13886, -13900, -13892,
+  -13885, -13898, -13939, -14001, -14063, -14105, -14117, -14109,
+  -14101, -14115, -14157, -14219, -14282, -14323, -14334, -14326,
+  -14318, -14331, -14374, -14438, -14500, -14541, -14552, -14543,
+  -14535, -14548, -14592, -14656, -14718, -14759, -14769, -14760,
+  -14751, -14765, -14809, -14874, -14937, -14977, -14987, -14976,
+  -14968, -14982, -15027, -15092, -15155, -15195, -15204, -15193,
+  -15184, -15199, -15244, -15310, -15374, -15413, -15422, -15410,
+  -15401, -15415, -15462, -15528, -15592, -15632, -15639, -15627,
+  -15617, -15632, -15679, -15747, -15811, -15850, -15857, -15844,
+  -15834, -15849, -15897, -15965, -16029, -16068, -16074, -16060,
+  -16050, -16066, -16114, -16183, -16248, -16286, -16292, -16277,
+  -16266, -16282, -16332, -16401, -16467, -16505, -16509, -16494,
+  -16483, -16499, -16549, -16620, -16685, -16723, -16727, -16710,
+  -16699, -16716, -16767, -16838, -16904, -16941, -16944, -16927,
+  -16915, -16932, -16984, -17057, -17123, -17160, -17162, -17143,
+  -17131, -17149, -17202, -17275, -17342, -17378, -17379, -17360,
+  -17347, -17365, -17419, -17493, -17560, -17597, -17597, -17576,
+  -17564, -17582, -17637, -17712, -17779, -17815, -17814, -17793,
+  -17780, -17798, -17854, -17931, -17998, -18034, -18032, -18009,
+  -17996, -18015, -18072, -18149, -18217, -18252, -18249, -18226,
+  -18211, -18231, -18289, -18368, -18437, -18471, -18467, -18442,
+  -18427, -18447, -18507, -18586, -18656, -18690, -18684, -18658,
+  -18643, -18664, -18724, -18805, -18875, -18908, -18902, -18874,
+  -18859, -18880, -18942, -19024, -19094, -19127, -19119, -19091,
+  -19074, -19096, -19159, -19243, -19314, -19346, -19337, -19307,
+  -19290, -19312, -19377, -19462, -19533, -19565, -19554, -19523,
+  -19505, -19528, -19594, -19681, -19753, -19784, -19772, -19739,
+  -19721, -19744, -19812, -19900, -19972, -20003, -19989, -19955,
+  -19936, -19960, -20029, -20119, -20192, -20222, -20206, -20170,
+  -20151, -20176, -20247, -20338, -20412, -20441, -20424, -20386,
+  -20366, -20392, -20464, -20557, -20632, -20661, -20641, -20602,
+  -20581, -20607, -20682, -20777, -20852, -20880, -20859, -20817,
+  -20796, -20823, -20899, -20996, -21073, -21100, -21076, -21033,
+  -21010, -21038, -21117, -21216, -21293, -21319, -21294, -21248,
+  -21224, -21253, -21334, -21436, -21514, -21539, -21511, -21463,
+  -21438, -21469, -21552, -21656, -21735, -21759, -21729, -21678,
+  -21652, -21683, -21769, -21876, -21956, -21979, -21946, -21893,
+  -21866, -21898, -21987, -22096, -22178, -22199, -22164, -22107,
+  -22079, -22113, -22205, -22317, -22400, -22420, -22381, -22321,
+  -22292, -22327, -22422, -22538, -22622, -22641, -22598, -22536,
+  -22505, -22541, -22640, -22759, -22844, -22862, -22816, -22749,
+  -22717, -22755, -22857, -22980, -23067, -23083, -23033, -22963,
+  -22929, -22968, -23075, -23202, -23291, -23305, -23251, -23176,
+  -23140, -23182, -23292, -23424, -23515, -23527, -23468, -23388,
+  -23351, -23394, -23510, -23647, -23740, -23750, -23685, -23601,
+  -23561, -23606, -23728, -23870, -23965, -23973, -23903, -23812,
+  -23770, -23818, -23945, -24093, -24191, -24196, -24120, -24023,
+  -23978, -24029, -24163, -24318, -24419, -24421, -24337, -24233,
+  -24185, -24239, -24381, -24543, -24647, -24646, -24555, -24442,
+  -24391, -24448, -24598, -24770, -24878, -24873, -24772, -24650,
+  -24595, -24656, -24816, -24998, -25110, -25100, -24989, -24856,
+  -24796, -24862, -25034, -25227, -25344, -25330, -25206, -25061,
+  -24996, -25067, -25252, -25459, -25581, -25561, -25423, -25263,
+  -25192, -25270, -25470, -25693, -25822, -25795, -25640, -25462,
+  -25383, -25469, -25688, -25931, -26068, -26032, -25856, -25657,
+  -25569, -25664, -25907, -26173, -26321, -26274, -26073, -25847,
+  -25748, -25854, -26126, -26422, -26582, -26523, -26288, -26028,
+  -25915, -26037, -26346, -26681, -26858, -26781, -26503, -26198,
+  -26065, -26207, -26567, -26954, -27154, -27053, -26715, -26349,
+  -26189, -26360, -26791, -27253, -27485, -27350, -26924, -26466,
+  -26266, -26480, -27020, -27598, -27880, -27690, -27125, -26517,
+  -26252, -26537, -27264, -28043, -28414, -28124, -27298, -26404,
+  -26010, -26444, -27564, -28781, -29355, -28824, -27336, -25677,
+  -24916, -25820, -28307, -31239, -32713, -30776, -24274, -13448,
+  0
+};
+
+static const int16_t hifi_wavetable_saw_2[2049] =
+{
+  0, 6900, 13446, 19317, 24254, 28081, 30719, 32188,
+  32604, 32153, 31078, 29644, 28109, 26705, 25606, 24924,
+  24699, 24905, 25457, 26236, 27099, 27909, 28549, 28935,
+  29028, 28835, 28403, 27809, 27149, 26521, 26012, 25687,
+  25576, 25681, 25967, 26379, 26843, 27283, 27631, 27836,
+  27869, 27731, 27447, 27061, 26632, 26222, 25889, 25674,
+  25600, 25670, 25863, 26140, 26452, 26748, 26979, 27109,
+  27117, 27003, 26784, 26492, 26170, 25863, 25614, 25453,
+  25398, 25450, 25594, 25802, 26035, 26253, 26421, 26510,
+  26504, 26403, 26221, 25983, 25723, 25477, 25276, 25148,
+  25104, 25145, 25260, 25424, 25608, 25779, 25907, 25970,
+  25955, 25863, 25705, 25502, 25282, 25075, 24907, 24799,
+  24763, 24797, 24892, 25028, 25178, 25316, 25417, 25462,
+  25441, 25355, 25213, 25035, 24843, 24664, 24519, 24427,
+  24395, 24425, 24505, 24620, 24746, 24860, 24941, 24973,
+  24948, 24866, 24737, 24577, 24406, 24247, 24120, 24039,
+  24011, 24037, 24107, 24205, 24313, 24409, 24475, 24497,
+  24468, 24390, 24270, 24124, 23969, 23826, 23712, 23640,
+  23616, 23639, 23700, 23786, 23879, 23961, 24015, 24029,
+  23998, 23922, 23810, 23675, 23533, 23403, 23300, 23235,
+  23213, 23233, 23288, 23364, 23445, 23515, 23560, 23568,
+  23534, 23460, 23354, 23228, 23097, 22978, 22883, 22824,
+  22804, 22822, 22871, 22939, 23011, 23072, 23108, 23111,
+  23075, 23003, 22902, 22784, 22662, 22551, 22464, 22409,
+  22391, 22408, 22452, 22513, 22576, 22629, 22659, 22657,
+  22620, 22550, 22453, 22341, 22226, 22123, 22042, 21991,
+  21975, 21990, 22030, 22085, 22142, 22188, 22212, 22206,
+  22168, 22099, 22006, 21899, 21791, 21694, 21618, 21571,
+  21556, 21570, 21607, 21656, 21707, 21747, 21766, 21757,
+  21718, 21650, 21560, 21458, 21356, 21264, 21193, 21149,
+  21135, 21148, 21181, 21227, 21273, 21307, 21322, 21310,
+  21270, 21203, 21116, 21018, 20921, 20834, 20767, 20725,
+  20712, 20724, 20755, 20797, 20838, 20868, 20879, 20864,
+  20823, 20757, 20673, 20579, 20485, 20403, 20339, 20301,
+  20288, 20299, 20328, 20366, 20403, 20429, 20437, 20420,
+  20378, 20313, 20230, 20140, 20050, 19971, 19911, 19875,
+  19863, 19873, 19900, 19935, 19968, 19991, 19995, 19976,
+  19933, 19869, 19789, 19701, 19615, 19540, 19483, 19448,
+  19437, 19446, 19471, 19503, 19533, 19553, 19554, 19534,
+  19490, 19426, 19348, 19263, 19180, 19108, 19053, 19020,
+  19010, 19019, 19042, 19071, 19098, 19115, 19114, 19092,
+  19047, 18984, 18907, 18825, 18745, 18676, 18623, 18592,
+  18582, 18591, 18612, 18639, 18664, 18677, 18674, 18650,
+  18605, 18543, 18468, 18387, 18310, 18243, 18193, 18163,
+  18154, 18162, 18182, 18207, 18229, 18240, 18234, 18209,
+  18164, 18102, 18028, 17950, 17875, 17810, 17763, 17734,
+  17725, 17733, 17751, 17774, 17794, 17803, 17795, 17769,
+  17723, 17661, 17589, 17512, 17440, 17378, 17332, 17304,
+  17296, 17303, 17320, 17342, 17359, 17365, 17356, 17329,
+  17283, 17221, 17150, 17075, 17005, 16945, 16900, 16874,
+  16866, 16873, 16889, 16909, 16924, 16929, 16918, 16889,
+  16843, 16782, 16711, 16638, 16570, 16512, 16469, 16444,
+  16436, 16442, 16458, 16476, 16489, 16492, 16479, 16450,
+  16403, 16342, 16273, 16201, 16135, 16078, 16037, 16013,
+  16006, 16012, 16026, 16042, 16054, 16055, 16041, 16010,
+  15963, 15903, 15835, 15765, 15700, 15645, 15605, 15582,
+  15575, 15581, 15594, 15609, 15619, 15619, 15603, 15572,
+  15524, 15464, 15397, 15328, 15265, 15212, 15173, 15151,
+  15144, 15150, 15162, 15176, 15184, 15182, 15165, 15133,
+  15085, 15026, 14959, 14892, 14829, 14778, 14741, 14720,
+  14713, 14718, 14730, 14742, 14749, 14746, 14728, 14694,
+  14646, 14587, 14521, 14455, 14394, 14344, 14308, 14288,
+  14282, 14287, 14297, 14309, 14314, 14309, 14290, 14256,
+  14208, 14149, 14084, 14019, 13959, 13911, 13876, 13856,
+  13850, 13855, 13865, 13875, 13879, 13873, 13853, 13818,
+  13769, 13711, 13646, 13582, 13524, 13477, 13443, 13424,
+  13419, 13423, 13432, 13441, 13444, 13437, 13416, 13380,
+  13331, 13273, 13209, 13146, 13089, 13043, 13011, 12992,
+  12987, 12991, 13000, 13008, 13009, 13001, 12978, 12942,
+  12893, 12835, 12772, 12710, 12654, 12609, 12578, 12560,
+  12555, 12559, 12567, 12574, 12574, 12565, 12541, 12504,
+  12455, 12397, 12335, 12274, 12219, 12176, 12145, 12128,
+  12123, 12126, 12134, 12140, 12140, 12128, 12104, 12067,
+  12017, 11960, 11898, 11838, 11784, 11742, 11712, 11695,
+  11690, 11694, 11701, 11706, 11705, 11692, 11668, 11629,
+  11580, 11522, 11461, 11402, 11349, 11308, 11279, 11263,
+  11258, 11261, 11268, 11272, 11270, 11256, 11231, 11192,
+  11142, 11085, 11024, 10966, 10914, 10874, 10846, 10830,
+  10826, 10829, 10835, 10838, 10835, 10821, 10794, 10755,
+  10705, 10647, 10587, 10530, 10479, 10440, 10412, 10398,
+  10393, 10396, 10401, 10404, 10400, 10385, 10357, 10317,
+  10267, 10210, 10151, 10094, 10044, 10006, 9979, 9965,
+  9961, 9963, 9968, 9970, 9965, 9949, 9921, 9880,
+  9830, 9773, 9714, 9658, 9609, 9571, 9546, 9532,
+  9528, 9531, 9535, 9536, 9530, 9513, 9484, 9443,
+  9392, 9336, 9277, 9222, 9174, 9137, 9112, 9099,
+  9095, 9098, 9101, 9102, 9095, 9077, 9047, 9006,
+  8955, 8899, 8841, 8786, 8739, 8703, 8679, 8666,
+  8663, 8665, 8668, 8668, 8660, 8641, 8611, 8569,
+  8518, 8462, 8404, 8351, 8305, 8269, 8245, 8233,
+  8230, 8232, 8235, 8234, 8225, 8205, 8174, 8132,
+  8081, 8025, 7968, 7915, 7870, 7835, 7812, 7800,
+  7797, 7799, 7801, 7799, 7790, 7770, 7738, 7695,
+  7644, 7588, 7531, 7479, 7435, 7401, 7378, 7367,
+  7364, 7366, 7368, 7365, 7355, 7334, 7301, 7258,
+  7207, 7151, 7095, 7043, 7000, 6966, 6945, 6934,
+  6931, 6933, 6934, 6931, 6920, 6898, 6865, 6821,
+  6770, 6714, 6659, 6607, 6565, 6532, 6511, 6501,
+  6498, 6499, 6500, 6497, 6485, 6462, 6429, 6385,
+  6333, 6277, 6222, 6172, 6130, 6098, 6078, 6068,
+  6065, 6066, 6067, 6063, 6050, 6027, 5992, 5948,
+  5896, 5841, 5786, 5736, 5695, 5664, 5644, 5634,
+  5632, 5633, 5633, 5628, 5615, 5591, 5556, 5511,
+  5459, 5404, 5349, 5300, 5260, 5229, 5210, 5201,
+  5199, 5200, 5199, 5194, 5180, 5155, 5120, 5075,
+  5022, 4967, 4913, 4865, 4825, 4795, 4777, 4768,
+  4766, 4766, 4766, 4760, 4745, 4720, 4683, 4638,
+  4586, 4530, 4477, 4429, 4390, 4361, 4343, 4334,
+  4332, 4333, 4332, 4325, 4310, 4284, 4247, 4201,
+  4149, 4094, 4041, 3993, 3955, 3927, 3909, 3901,
+  3899, 3900, 3898, 3891, 3875, 3848, 3811, 3765,
+  3712, 3657, 3604, 3558, 3520, 3492, 3476, 3468,
+  3466, 3466, 3465, 3457, 3440, 3413, 3375, 3328,
+  3275, 3221, 3168, 3122, 3085, 3058, 3042, 3034,
+  3033, 3033, 3031, 3023, 3005, 2977, 2939, 2891,
+  2839, 2784, 2732, 2686, 2650, 2624, 2608, 2601,
+  2600, 2600, 2597, 2588, 2570, 2541, 2502, 2455,
+  2402, 2347, 2296, 2251, 2215, 2189, 2174, 2168,
+  2166, 2166, 2163, 2154, 2135, 2106, 2066, 2018,
+  1965, 1911, 1860, 1815, 1780, 1755, 1741, 1734,
+  1733, 1733, 1730, 1720, 1700, 1670, 1630, 1582,
+  1528, 1474, 1423, 1379, 1345, 1321, 1307, 1301,
+  1300, 1300, 1296, 1285, 1265, 1234, 1194, 1145,
+  1092, 1038, 987, 944, 910, 886, 873, 868,
+  867, 866, 862, 851, 830, 799, 758, 709,
+  655, 601, 551, 508, 475, 452, 439, 434,
+  433, 433, 428, 417, 395, 363, 321, 272,
+  218, 165, 115, 72, 40, 18, 5, 1,
+  0, -1, -5, -18, -40, -72, -115, -165,
+  -218, -272, -321, -363, -395, -417, -428, -433,
+  -433, -434, -439, -452, -475, -508, -551, -601,
+  -655, -709, -758, -799, -830, -851, -862, -866,
+  -867, -868, -873, -886, -910, -944, -987, -1038,
+  -1092, -1145, -1194, -1234, -1265, -1285, -1296, -1300,
+  -1300, -1301, -1307, -1321, -1345, -1379, -1423, -1474,
+  -1528, -1582, -1630, -1670, -1700, -1720, -1730, -1733,
+  -1733, -1734, -1741, -1755, -1780, -1815, -1860, -1911,
+  -1965, -2018, -2066, -2106, -2135, -2154, -2163, -2166,
+  -2166, -2168, -2174, -2189, -2215, -2251, -2296, -2347,
+  -2402, -2455, -2502, -2541, -2570, -2588, -2597, -2600,
+  -2600, -2601, -2608, -2624, -2650, -2686, -2732, -2784,
+  -2839, -2891, -2939, -2977, -3005, -3023, -3031, -3033,
+  -3033, -3034, -3042, -3058, -3085, -3122, -3168, -3221,
+  -3275, -3328, -3375, -3413, -3440, -3457, -3465, -3466,
+  -3466, -3468, -3476, -3492, -3520, -3558, -3604, -3657,
+  -3712, -3765, -3811, -3848, -3875, -3891, -3898, -3900,
+  -3899, -3901, -3909, -3927, -3955, -3993, -4041, -4094,
+  -4149, -4201, -4247, -4284, -4310, -4325, -4332, -4333,
+  -4332, -4334, -4343, -4361, -4390, -4429, -4477, -4530,
+  -4586, -4638, -4683, -4720, -4745, -4760, -4766, -4766,
+  -4766, -4768, -4777, -4795, -4825, -4865, -4913, -4967,
+  -5022, -5075, -5120, -5155, -5180, -5194, -5199, -5200,
+  -5199, -5201, -5210, -5229, -5260, -5300, -5349, -5404,
+  -5459, -5511, -5556, -5591, -5615, -5628, -5633, -5633,
+  -5632, -5634, -5644, -5664, -5695, -5736, -5786, -5841,
+  -5896, -5948, -5992, -6027, -6050, -6063, -6067, -6066,
+  -6065, -6068, -6078, -6098, -6130, -6172, -6222, -6277,
+  -6333, -6385, -6429, -6462, -6485, -6497, -6500, -6499,
+  -6498, -6501, -6511, -6532, -6565, -6607, -6659, -6714,
+  -6770, -6821, -6865, -6898, -6920, -6931, -6934, -6933,
+  -6931, -6934, -6945, -6966, -7000, -7043, -7095, -7151,
+  -7207, -7258, -7301, -7334, -7355, -7365, -7368, -7366,
+  -7364, -7367, -7378, -7401, -7435, -7479, -7531, -7588,
+  -7644, -7695, -7738, -7770, -7790, -7799, -7801, -7799,
+  -7797, -7800, -7812, -7835, -7870, -7915, -7968, -8025,
+  -8081, -8132, -8174, -8205, -8225, -8234, -8235, -8232,
+  -8230, -8233, -8245, -8269, -8305, -8351, -8404, -8462,
+  -8518, -8569, -8611, -8641, -8660, -8668, -8668, -8665,
+  -8663, -8666, -8679, -8703, -8739, -8786, -8841, -8899,
+  -8955, -9006, -9047, -9077, -9095, -9102, -9101, -9098,
+  -9095, -9099, -9112, -9137, -9174, -9222, -9277, -9336,
+  -9392, -9443, -9484, -9513, -9530, -9536, -9535, -9531,
+  -9528, -9532, -9546, -9571, -9609, -9658, -9714, -9773,
+  -9830, -9880, -9921, -9949, -9965, -9970, -9968, -9963,
+  -9961, -9965, -9979, -10006, -10044, -10094, -10151, -10210,
+  -10267, -10317, -10357, -10385, -10400, -10404, -10401, -10396,
+  -10393, -10398, -10412, -10440, -10479, -10530, -10587, -10647,
+  -10705, -10755, -10794, -10821, -10835, -10838, -10835, -10829,
+  -10826, -10830, -10846, -10874, -10914, -10966, -11024, -11085,
+  -11142, -11192, -11231, -11256, -11270, -11272, -11268, -11261,
+  -11258, -11263, -11279, -11308, -11349, -11402, -11461, -11522,
+  -11580, -11629, -11668, -11692, -11705, -11706, -11701, -11694,
+  -11690, -11695, -11712, -11742, -11784, -11838, -11898, -11960,
+  -12017, -12067, -12104, -12128, -12140, -12140, -12134, -12126,
+  -12123, -12128, -12145, -12176, -12219, -12274, -12335, -12397,
+  -12455, -12504, -12541, -12565, -12574, -12574, -12567, -12559,
+  -12555, -12560, -12578, -12609, -12654, -12710, -12772, -12835,
+  -12893, -12942, -12978, -13001, -13009, -13008, -13000, -12991,
+  -12987, -12992, -13011, -13043, -13089, -13146, -13209, -13273,
+  -13331, -13380, -13416, -13437, -13444, -13441, -13432, -13423,
+  -13419, -13424, -13443, -13477, -13524, -13582, -13646, -13711,
+  -13769, -13818, -13853, -13873, -13879, -13875, -13865, -13855,
+  -13850, -13856, -13876, -13911, -13959, -14019, -14084, -14149,
+  -14208, -14256, -14290, -14309, -14314, -14309, -14297, -14287,
+  -14282, -14288, -14308, -14344, -14394, -14455, -14521, -14587,
+  -14646, -14694, -14728, -14746, -14749, -14742, -14730, -14718,
+  -14713, -14720, -14741, -14778, -14829, -14892, -14959, -15026,
+  -15085, -15133, -15165, -15182, -15184, -15176, -15162, -15150,
+  -15144, -15151, -15173, -15212, -15265, -15328, -15397, -15464,
+  -15524, -15572, -15603, -15619, -15619, -15609, -15594, -15581,
+  -15575, -15582, -15605, -15645, -15700, -15765, -15835, -15903,
+  -15963, -16010, -16041, -16055, -16054, -16042, -16026, -16012,
+  -16006, -16013, -16037, -16078, -16135, -16201, -16273, -16342,
+  -16403, -16450, -16479, -16492, -16489, -16476, -16458, -16442,
+  -16436, -16444, -16469, -16512, -16570, -16638, -16711, -16782,
+  -16843, -16889, -16918, -16929, -16924, -16909, -16889, -16873,
+  -16866, -16874, -16900, -16945, -17005, -17075, -17150, -17221,
+  -17283, -17329, -17356, -17365, -17359, -17342, -17320, -17303,
+  -17296, -17304, -17332, -17378, -17440, -17512, -17589, -17661,
+  -17723, -17769, -17795, -17803, -17794, -17774, -17751, -17733,
+  -17725, -17734, -17763, -17810, -17875, -17950, -18028, -18102,
+  -18164, -18209, -18234, -18240, -18229, -18207, -18182, -18162,
+  -18154, -18163, -18193, -18243, -18310, -18387, -18468, -18543,
+  -18605, -18650, -18674, -18677, -18664, -18639, -18612, -18591,
+  -18582, -18592, -18623, -18676, -18745, -18825, -18907, -18984,
+  -19047, -19092, -19114, -19115, -19098, -19071, -19042, -19019,
+  -19010, -19020, -19053, -19108, -19180, -19263, -19348, -19426,
+  -19490, -19534, -19554, -19553, -19533, -19503, -19471, -19446,
+  -19437, -19448, -19483, -19540, -19615, -19701, -19789, -19869,
+  -19933, -19976, -19995, -19991, -19968, -19935, -19900, -19873,
+  -19863, -19875, -19911, -19971, -20050, -20140, -20230, -20313,
+  -20378, -20420, -20437, -20429, -20403, -20366, -20328, -20299,
+  -20288, -20301, -20339, -20403, -20485, -20579, -20673, -20757,
+  -20823, -20864, -20879, -20868, -20838, -20797, -20755, -20724,
+  -20712, -20725, -20767, -20834, -20921, -21018, -21116, -21203,
+  -21270, -21310, -21322, -21307, -21273, -21227, -21181, -21148,
+  -21135, -21149, -21193, -21264, -21356, -21458, -21560, -21650,
+  -21718, -21757, -21766, -21747, -21707, -21656, -21607, -21570,
+  -21556, -21571, -21618, -21694, -21791, -21899, -22006, -22099,
+  -22168, -22206, -22212, -22188, -22142, -22085, -22030, -21990,
+  -21975, -21991, -22042, -22123, -22226, -22341, -22453, -22550,
+  -22620, -22657, -22659, -22629, -22576, -22513, -22452, -22408,
+  -22391, -22409, -22464, -22551, -22662, -22784, -22902, -23003,
+  -23075, -23111, -23108, -23072, -23011, -22939, -22871, -22822,
+  -22804, -22824, -22883, -22978, -23097, -23228, -23354, -23460,
+  -23534, -23568, -23560, -23515, -23445, -23364, -23288, -23233,
+  -23213, -23235, -23300, -23403, -23533, -23675, -23810, -23922,
+  -23998, -24029, -24015, -23961, -23879, -23786, -23700, -23639,
+  -23616, -23640, -23712, -23826, -23969, -24124, -24270, -24390,
+  -24468, -24497, -24475, -24409, -24313, -24205, -24107, -24037,
+  -24011, -24039, -24120, -24247, -24406, -24577, -24737, -24866,
+  -24948, -24973, -24941, -24860, -24746, -24620, -24505, -24425,
+  -24395, -24427, -24519, -24664, -24843, -25035, -25213, -25355,
+  -25441, -25462, -25417, -25316, -25178, -25028, -24892, -24797,
+  -24763, -24799, -24907, -25075, -25282, -25502, -25705, -25863,
+  -25955, -25970, -25907, -25779, -25608, -25424, -25260, -25145,
+  -25104, -25148, -25276, -25477, -25723, -25983, -26221, -26403,
+  -26504, -26510, -26421, -26253, -26035, -25802, -25594, -25450,
+  -25398, -25453, -25614, -25863, -26170, -26492, -26784, -27003,
+  -27117, -27109, -26979, -26748, -26452, -26140, -25863, -25670,
+  -25600, -25674, -25889, -26222, -26632, -27061, -27447, -27731,
+  -27869, -27836, -27631, -27283, -26843, -26379, -25967, -25681,
+  -25576, -25687, -26012, -26521, -27149, -27809, -28403, -28835,
+  -29028, -28935, -28549, -27909, -27099, -26236, -25457, -24905,
+  -24699, -24924, -25606, -26705, -28109, -29644, -31078, -32153,
+  -32604, -32188, -30719, -28081, -24254, -19317, -13446, -6900,
+  0
+};
+
+static const int16_t hifi_wavetable_saw_3[1025] =
+{
+  0, 6899, 13440, 19299, 24214, 28008, 30604, 32024,
+  32385, 31881, 30757, 29280, 27714, 26288, 25177, 24491,
+  24266, 24470, 25018, 25784, 26624, 27401, 27998, 28333,
+  28373, 28127, 27645, 27010, 26319, 25670, 25150, 24820,
+  24710, 24813, 25094, 25493, 25933, 26340, 26644, 26798,
+  26778, 26586, 26253, 25826, 25367, 24937, 24593, 24374,
+  24301, 24369, 24556, 24819, 25108, 25369, 25556, 25635,
+  25589, 25421, 25154, 24822, 24470, 24144, 23884, 23720,
+  23665, 23716, 23854, 24047, 24255, 24438, 24562, 24599,
+  24539, 24385, 24155, 23878, 23588, 23323, 23113, 22981,
+  22937, 22978, 23086, 23235, 23393, 23528, 23611, 23622,
+  23553, 23408, 23203, 22961, 22712, 22486, 22310, 22200,
+  22163, 22196, 22284, 22404, 22528, 22630, 22685, 22678,
+  22603, 22464, 22275, 22058, 21838, 21641, 21488, 21394,
+  21363, 21390, 21464, 21562, 21661, 21738, 21773, 21753,
+  21673, 21538, 21362, 21164, 20966, 20790, 20655, 20572,
+  20545, 20569, 20631, 20713, 20793, 20851, 20870, 20840,
+  20756, 20625, 20459, 20275, 20094, 19935, 19814, 19740,
+  19717, 19737, 19791, 19859, 19924, 19968, 19974, 19935,
+  19849, 19721, 19563, 19391, 19223, 19078, 18968, 18901,
+  18880, 18899, 18945, 19003, 19056, 19087, 19083, 19037,
+  18948, 18823, 18671, 18509, 18353, 18218, 18117, 18057,
+  18038, 18054, 18095, 18144, 18186, 18207, 18195, 18143,
+  18053, 17929, 17783, 17629, 17482, 17357, 17264, 17209,
+  17192, 17206, 17241, 17283, 17317, 17329, 17309, 17253,
+  17161, 17039, 16897, 16750, 16611, 16495, 16409, 16358,
+  16343, 16355, 16386, 16421, 16447, 16452, 16426, 16365,
+  16272, 16151, 16013, 15872, 15741, 15631, 15551, 15505,
+  15491, 15502, 15529, 15558, 15578, 15576, 15544, 15480,
+  15385, 15265, 15132, 14996, 14871, 14767, 14693, 14650,
+  14637, 14647, 14670, 14695, 14708, 14700, 14663, 14596,
+  14500, 14381, 14251, 14120, 14001, 13903, 13833, 13793,
+  13781, 13790, 13810, 13830, 13838, 13825, 13784, 13713,
+  13616, 13499, 13371, 13245, 13130, 13038, 12972, 12935,
+  12924, 12932, 12950, 12965, 12968, 12950, 12905, 12832,
+  12734, 12617, 12493, 12370, 12260, 12172, 12110, 12076,
+  12066, 12073, 12088, 12100, 12099, 12076, 12027, 11952,
+  11853, 11737, 11614, 11496, 11390, 11306, 11248, 11216,
+  11207, 11213, 11226, 11234, 11229, 11202, 11150, 11072,
+  10972, 10857, 10737, 10622, 10520, 10440, 10385, 10356,
+  10347, 10353, 10363, 10368, 10359, 10328, 10273, 10193,
+  10092, 9978, 9860, 9748, 9650, 9574, 9522, 9494,
+  9487, 9492, 9500, 9502, 9489, 9455, 9396, 9314,
+  9213, 9100, 8984, 8874, 8780, 8707, 8658, 8633,
+  8626, 8630, 8636, 8635, 8619, 8582, 8520, 8436,
+  8334, 8222, 8107, 8001, 7910, 7840, 7794, 7771,
+  7764, 7768, 7772, 7769, 7749, 7709, 7645, 7559,
+  7456, 7344, 7232, 7128, 7040, 6974, 6930, 6908,
+  6902, 6905, 6908, 6902, 6879, 6836, 6769, 6681,
+  6578, 6467, 6356, 6255, 6170, 6107, 6066, 6045,
+  6040, 6043, 6044, 6035, 6009, 5963, 5894, 5804,
+  5700, 5590, 5481, 5382, 5300, 5239, 5201, 5182,
+  5178, 5180, 5179, 5168, 5140, 5090, 5018, 4928,
+  4823, 4713, 4605, 4509, 4430, 4372, 4336, 4319,
+  4315, 4316, 4314, 4301, 4270, 4217, 4143, 4051,
+  3946, 3836, 3730, 3636, 3560, 3505, 3471, 3456,
+  3452, 3453, 3449, 3434, 3400, 3345, 3268, 3174,
+  3069, 2960, 2855, 2764, 2690, 2638, 2606, 2592,
+  2589, 2590, 2584, 2566, 2530, 2472, 2393, 2298,
+  2192, 2083, 1980, 1891, 1820, 1770, 1741, 1729,
+  1726, 1726, 1719, 1699, 1660, 1599, 1519, 1422,
+  1315, 1207, 1106, 1018, 950, 903, 876, 865,
+  863, 862, 854, 832, 790, 727, 644, 545,
+  438, 331, 231, 146, 80, 36, 11, 1,
+  0, -1, -11, -36, -80, -146, -231, -331,
+  -438, -545, -644, -727, -790, -832, -854, -862,
+  -863, -865, -876, -903, -950, -1018, -1106, -1207,
+  -1315, -1422, -1519, -1599, -1660, -1699, -1719, -1726,
+  -1726, -1729, -1741, -1770, -1820, -1891, -1980, -2083,
+  -2192, -2298, -2393, -2472, -2530, -2566, -2584, -2590,
+  -2589, -2592, -2606, -2638, -2690, -2764, -2855, -2960,
+  -3069, -3174, -3268, -3345, -3400, -3434, -3449, -3453,
+  -3452, -3456, -3471, -3505, -3560, -3636, -3730, -3836,
+  -3946, -4051, -4143, -4217, -4270, -4301, -4314, -4316,
+  -4315, -4319, -4336, -4372, -4430, -4509, -4605, -4713,
+  -4823, -4928, -5018, -5090, -5140, -5168, -5179, -5180,
+  -5178, -5182, -5201, -5239, -5300, -5382, -5481, -5590,
+  -5700, -5804, -5894, -5963, -6009, -6035, -6044, -6043,
+  -6040, -6045, -6066, -6107, -6170, -6255, -6356, -6467,
+  -6578, -6681, -6769, -6836, -6879, -6902, -6908, -6905,
+  -6902, -6908, -6930, -6974, -7040, -7128, -7232, -7344,
+  -7456, -7559, -7645, -7709, -7749, -7769, -7772, -7768,
+  -7764, -7771, -7794, -7840, -7910, -8001, -8107, -8222,
+  -8334, -8436, -8520, -8582, -8619, -8635, -8636, -8630,
+  -8626, -8633, -8658, -8707, -8780, -8874, -8984, -9100,
+  -9213, -9314, -9396, -9455, -9489, -9502, -9500, -9492,
+  -9487, -9494, -9522, -9574, -9650, -9748, -9860, -9978,
+  -10092, -10193, -10273, -10328, -10359, -10368, -10363, -10353,
+  -10347, -10356, -10385, -10440, -10520, -10622, -10737, -10857,
+  -10972, -11072, -11150, -11202, -11229, -11234, -11226, -11213,
+  -11207, -11216, -11248, -11306, -11390, -11496, -11614, -11737,
+  -11853, -11952, -12027, -12076, -12099, -12100, -12088, -12073,
+  -12066, -12076, -12110, -12172, -12260, -12370, -12493, -12617,
+  -12734, -12832, -12905, -12950, -12968, -12965, -12950, -12932,
+  -12924, -12935, -12972, -13038, -13130, -13245, -13371, -13499,
+  -13616, -13713, -13784, -13825, -13838, -13830, -13810, -13790,
+  -13781, -13793, -13833, -13903, -14001, -14120, -14251, -14381,
+  -14500, -14596, -14663, -14700, -14708, -14695, -14670, -14647,
+  -14637, -14650, -14693, -14767, -14871, -14996, -15132, -15265,
+  -15385, -15480, -15544, -15576, -15578, -15558, -15529, -15502,
+  -15491, -15505, -15551, -15631, -15741, -15872, -16013, -16151,
+  -16272, -16365, -16426, -16452, -16447, -16421, -16386, -16355,
+  -16343, -16358, -16409, -16495, -16611, -16750, -16897, -17039,
+  -17161, -17253, -17309, -17329, -17317, -17283, -17241, -17206,
+  -17192, -17209, -17264, -17357, -17482, -17629, -17783, -17929,
+  -18053, -18143, -18195, -18207, -18186, -18144, -18095, -18054,
+  -18038, -18057, -18117, -18218, -18353, -18509, -18671, -18823,
+  -18948, -19037, -19083, -19087, -19056, -19003, -18945, -18899,
+  -18880, -18901, -18968, -19078, -19223, -19391, -19563, -19721,
+  -19849, -19935, -19974, -19968, -19924, -19859, -19791, -19737,
+  -19717, -19740, -19814, -19935, -20094, -20275, -20459, -20625,
+  -20756, -20840, -20870, -20851, -20793, -20713, -20631, -20569,
+  -20545, -20572, -20655, -20790, -20966, -21164, -21362, -21538,
+  -21673, -21753, -21773, -21738, -21661, -21562, -21464, -21390,
+  -21363, -21394, -21488, -21641, -21838, -22058, -22275, -22464,
+  -22603, -22678, -22685, -22630, -22528, -22404, -22284, -22196,
+  -22163, -22200, -22310, -22486, -22712, -22961, -23203, -23408,
+  -23553, -23622, -23611, -23528, -23393, -23235, -23086, -22978,
+  -22937, -22981, -23113, -23323, -23588, -23878, -24155, -24385,
+  -24539, -24599, -24562, -24438, -24255, -24047, -23854, -23716,
+  -23665, -23720, -23884, -24144, -24470, -24822, -25154, -25421,
+  -25589, -25635, -25556, -25369, -25108, -24819, -24556, -24369,
+  -24301, -24374, -24593, -24937, -25367, -25826, -26253, -26586,
+  -26778, -26798, -26644, -26340, -25933, -25493, -25094, -24813,
+  -24710, -24820, -25150, -25670, -26319, -27010, -27645, -28127,
+  -28373, -28333, -27998, -27401, -26624, -25784, -25018, -24470,
+  -24266, -24491, -25177, -26288, -27714, -29280, -30757, -31881,
+  -32385, -32024, -30604, -28008, -24214, -19299, -13440, -6899,
+  0
+};
+
+static const int16_t hifi_wavetable_saw_4[1025] =
+{
+  0, 3472, 6898, 10231, 13429, 16452, 19264, 21833,
+  24134, 26148, 27863, 29271, 30373, 31176, 31693, 31942,
+  31947, 31735, 31336, 30784, 30113, 29358, 28554, 27732,
+  26924, 26158, 25456, 24840, 24323, 23918, 23629, 23458,
+  23403, 23455, 23605, 23840, 24142, 24495, 24880, 25280,
+  25674, 26047, 26383, 26668, 26892, 27046, 27126, 27130,
+  27058, 26914, 26705, 26439, 26127, 25779, 25411, 25033,
+  24659, 24301, 23971, 23678, 23431, 23235, 23095, 23011,
+  22983, 23010, 23084, 23202, 23353, 23530, 23722, 23920,
+  24113, 24292, 24449, 24575, 24664, 24711, 24715, 24673,
+  24586, 24456, 24288, 24087, 23859, 23612, 23354, 23093,
+  22837, 22594, 22371, 22174, 22008, 21878, 21785, 21729,
+  21711, 21728, 21777, 21853, 21949, 22061, 22181, 22302,
+  22418, 22521, 22605, 22667, 22700, 22704, 22675, 22613,
+  22520, 22397, 22247, 22075, 21885, 21684, 21477, 21271,
+  21070, 20882, 20710, 20560, 20435, 20337, 20267, 20226,
+  20213, 20225, 20260, 20314, 20382, 20460, 20542, 20622,
+  20695, 20757, 20802, 20828, 20831, 20810, 20763, 20690,
+  20593, 20474, 20334, 20179, 20012, 19837, 19660, 19486,
+  19319, 19163, 19022, 18900, 18799, 18720, 18665, 18633,
+  18622, 18632, 18659, 18699, 18749, 18805, 18863, 18917,
+  18963, 18999, 19019, 19022, 19006, 18968, 18910, 18830,
+  18730, 18613, 18481, 18337, 18184, 18028, 17871, 17718,
+  17572, 17438, 17318, 17215, 17131, 17066, 17020, 16994,
+  16985, 16993, 17014, 17045, 17083, 17124, 17164, 17200,
+  17228, 17245, 17248, 17235, 17204, 17155, 17088, 17003,
+  16902, 16787, 16659, 16523, 16381, 16238, 16095, 15958,
+  15829, 15711, 15606, 15517, 15444, 15389, 15351, 15329,
+  15322, 15328, 15345, 15369, 15398, 15428, 15455, 15477,
+  15491, 15494, 15483, 15458, 15417, 15359, 15286, 15197,
+  15095, 14980, 14857, 14727, 14593, 14459, 14328, 14203,
+  14087, 13981, 13888, 13810, 13747, 13699, 13667, 13648,
+  13643, 13648, 13661, 13680, 13701, 13722, 13739, 13751,
+  13753, 13745, 13724, 13688, 13639, 13574, 13496, 13404,
+  13300, 13187, 13067, 12941, 12815, 12689, 12567, 12452,
+  12345, 12250, 12167, 12097, 12042, 12000, 11973, 11957,
+  11952, 11956, 11967, 11981, 11996, 12010, 12019, 12021,
+  12014, 11997, 11967, 11924, 11867, 11797, 11714, 11619,
+  11515, 11402, 11285, 11164, 11042, 10923, 10809, 10702,
+  10604, 10517, 10442, 10380, 10331, 10296, 10272, 10259,
+  10255, 10258, 10266, 10276, 10286, 10293, 10296, 10290,
+  10275, 10250, 10212, 10162, 10099, 10024, 9937, 9841,
+  9735, 9624, 9508, 9391, 9274, 9161, 9054, 8954,
+  8863, 8784, 8716, 8661, 8618, 8586, 8566, 8555,
+  8552, 8554, 8560, 8567, 8573, 8574, 8570, 8558,
+  8536, 8504, 8459, 8403, 8335, 8255, 8165, 8066,
+  7961, 7850, 7736, 7622, 7510, 7402, 7300, 7207,
+  7123, 7050, 6989, 6939, 6901, 6874, 6857, 6848,
+  6845, 6847, 6851, 6855, 6856, 6853, 6843, 6825,
+  6797, 6758, 6707, 6645, 6572, 6489, 6396, 6295,
+  6189, 6078, 5967, 5855, 5747, 5644, 5548, 5460,
+  5383, 5316, 5260, 5216, 5183, 5160, 5145, 5138,
+  5136, 5137, 5139, 5140, 5138, 5130, 5115, 5091,
+  5057, 5012, 4956, 4889, 4811, 4724, 4628, 4526,
+  4419, 4309, 4199, 4091, 3986, 3888, 3796, 3714,
+  3642, 3581, 3531, 3492, 3463, 3444, 3432, 3426,
+  3425, 3425, 3426, 3425, 3419, 3406, 3386, 3357,
+  3317, 3267, 3206, 3134, 3052, 2961, 2862, 2759,
+  2651, 2542, 2433, 2327, 2226, 2132, 2046, 1969,
+  1902, 1847, 1802, 1768, 1743, 1727, 1718, 1714,
+  1713, 1713, 1712, 1708, 1698, 1682, 1657, 1622,
+  1578, 1522, 1455, 1378, 1292, 1198, 1097, 992,
+  884, 775, 668, 565, 467, 377, 295, 223,
+  162, 112, 72, 43, 22, 10, 3, 0,
+  0, 0, -3, -10, -22, -43, -72, -112,
+  -162, -223, -295, -377, -467, -565, -668, -775,
+  -884, -992, -1097, -1198, -1292, -1378, -1455, -1522,
+  -1578, -1622, -1657, -1682, -1698, -1708, -1712, -1713,
+  -1713, -1714, -1718, -1727, -1743, -1768, -1802, -1847,
+  -1902, -1969, -2046, -2132, -2226, -2327, -2433, -2542,
+  -2651, -2759, -2862, -2961, -3052, -3134, -3206, -3267,
+  -3317, -3357, -3386, -3406, -3419, -3425, -3426, -3425,
+  -3425, -3426, -3432, -3444, -3463, -3492, -3531, -3581,
+  -3642, -3714, -3796, -3888, -3986, -4091, -4199, -4309,
+  -4419, -4526, -4628, -4724, -4811, -4889, -4956, -5012,
+  -5057, -5091, -5115, -5130, -5138, -5140, -5139, -5137,
+  -5136, -5138, -5145, -5160, -5183, -5216, -5260, -5316,
+  -5383, -5460, -5548, -5644, -5747, -5855, -5967, -6078,
+  -6189, -6295, -6396, -6489, -6572, -6645, -6707, -6758,
+  -6797, -6825, -6843, -6853, -6856, -6855, -6851, -6847,
+  -6845, -6848, -6857, -6874, -6901, -6939, -6989, -7050,
+  -7123, -7207, -7300, -7402, -7510, -7622, -7736, -7850,
+  -7961, -8066, -8165, -8255, -8335, -8403, -8459, -8504,
+  -8536, -8558, -8570, -8574, -8573, -8567, -8560, -8554,
+  -8552, -8555, -8566, -8586, -8618, -8661, -8716, -8784,
+  -8863, -8954, -9054, -9161, -9274, -9391, -9508, -9624,
+  -9735, -9841, -9937, -10024, -10099, -10162, -10212, -10250,
+  -10275, -10290, -10296, -10293, -10286, -10276, -10266, -10258,
+  -10255, -10259, -10272, -10296, -10331, -10380, -10442, -10517,
+  -10604, -10702, -10809, -10923, -11042, -11164, -11285, -11402,
+  -11515, -11619, -11714, -11797, -11867, -11924, -11967, -11997,
+  -12014, -12021, -12019, -12010, -11996, -11981, -11967, -11956,
+  -11952, -11957, -11973, -12000, -12042, -12097, -12167, -12250,
+  -12345, -12452, -12567, -12689, -12815, -12941, -13067, -13187,
+  -13300, -13404, -13496, -13574, -13639, -13688, -13724, -13745,
+  -13753, -13751, -13739, -13722, -13701, -13680, -13661, -13648,
+  -13643, -13648, -13667, -13699, -13747, -13810, -13888, -13981,
+  -14087, -14203, -14328, -14459, -14593, -14727, -14857, -14980,
+  -15095, -15197, -15286, -15359, -15417, -15458, -15483, -15494,
+  -15491, -15477, -15455, -15428, -15398, -15369, -15345, -15328,
+  -15322, -15329, -15351, -15389, -15444, -15517, -15606, -15711,
+  -15829, -15958, -16095, -16238, -16381, -16523, -16659, -16787,
+  -16902, -17003, -17088, -17155, -17204, -17235, -17248, -17245,
+  -17228, -17200, -17164, -17124, -17083, -17045, -17014, -16993,
+  -16985, -16994, -17020, -17066, -17131, -17215, -17318, -17438,
+  -17572, -17718, -17871, -18028, -18184, -18337, -18481, -18613,
+  -18730, -18830, -18910, -18968, -19006, -19022, -19019, -18999,
+  -18963, -18917, -18863, -18805, -18749, -18699, -18659, -18632,
+  -18622, -18633, -18665, -18720, -18799, -18900, -19022, -19163,
+  -19319, -19486, -19660, -19837, -20012, -20179, -20334, -20474,
+  -20593, -20690, -20763, -20810, -20831, -20828, -20802, -20757,
+  -20695, -20622, -20542, -20460, -20382, -20314, -20260, -20225,
+  -20213, -20226, -20267, -20337, -20435, -20560, -20710, -20882,
+  -21070, -21271, -21477, -21684, -21885, -22075, -22247, -22397,
+  -22520, -22613, -22675, -22704, -22700, -22667, -22605, -22521,
+  -22418, -22302, -22181, -22061, -21949, -21853, -21777, -21728,
+  -21711, -21729, -21785, -21878, -22008, -22174, -22371, -22594,
+  -22837, -23093, -23354, -23612, -23859, -24087, -24288, -24456,
+  -24586, -24673, -24715, -24711, -24664, -24575, -24449, -24292,
+  -24113, -23920, -23722, -23530, -23353, -23202, -23084, -23010,
+  -22983, -23011, -23095, -23235, -23431, -23678, -23971, -24301,
+  -24659, -25033, -25411, -25779, -26127, -26439, -26705, -26914,
+  -27058, -27130, -27126, -27046, -26892, -26668, -26383, -26047,
+  -25674, -25280, -24880, -24495, -24142, -23840, -23605, -23455,
+  -23403, -23458, -23629, -23918, -24323, -24840, -25456, -26158,
+  -26924, -27732, -28554, -29358, -30113, -30784, -31336, -31735,
+  -31947, -31942, -31693, -31176, -30373, -29271, -27863, -26148,
+  -24134, -21833, -19264, -16452, -13429, -10231, -6898, -3472,
+  0
+};
+
+static const int16_t hifi_wavetable_saw_5[1025] =
+{
+  0, 1739, 3472, 5192, 6895, 8573, 10221, 11835,
+  13407, 14933, 16409, 17830, 19191, 20489, 21721, 22882,
+  23972, 24987, 25925, 26786, 27568, 28270, 28894, 29439,
+  29906, 30296, 30612, 30854, 31025, 31129, 31167, 31144,
+  31063, 30928, 30743, 30512, 30239, 29929, 29586, 29215,
+  28821, 28407, 27980, 27542, 27098, 26653, 26210, 25774,
+  25347, 24933, 24535, 24157, 23799, 23466, 23158, 22877,
+  22625, 22402, 22210, 22048, 21917, 21816, 21745, 21704,
+  21690, 21703, 21742, 21804, 21888, 21991, 22113, 22249,
+  22399, 22559, 22727, 22901, 23079, 23256, 23433, 23605,
+  23772, 23930, 24078, 24214, 24337, 24445, 24536, 24610,
+  24666, 24702, 24719, 24716, 24693, 24650, 24588, 24507,
+  24407, 24290, 24156, 24006, 23842, 23666, 23478, 23281,
+  23075, 22863, 22646, 22426, 22205, 21984, 21766, 21551,
+  21341, 21139, 20944, 20759, 20585, 20422, 20272, 20135,
+  20012, 19904, 19811, 19732, 19668, 19620, 19585, 19565,
+  19559, 19565, 19583, 19613, 19653, 19701, 19758, 19821,
+  19890, 19962, 20038, 20114, 20191, 20266, 20339, 20407,
+  20471, 20528, 20578, 20620, 20652, 20675, 20687, 20688,
+  20678, 20655, 20621, 20574, 20516, 20445, 20363, 20270,
+  20167, 20053, 19930, 19799, 19660, 19514, 19363, 19207,
+  19048, 18886, 18723, 18560, 18398, 18238, 18081, 17928,
+  17780, 17638, 17503, 17375, 17256, 17145, 17044, 16952,
+  16870, 16799, 16737, 16686, 16645, 16614, 16592, 16580,
+  16575, 16579, 16591, 16608, 16632, 16660, 16693, 16729,
+  16767, 16806, 16845, 16884, 16921, 16955, 16986, 17013,
+  17035, 17051, 17060, 17063, 17057, 17044, 17023, 16992,
+  16953, 16905, 16848, 16783, 16708, 16625, 16535, 16436,
+  16331, 16219, 16101, 15978, 15851, 15720, 15586, 15450,
+  15313, 15176, 15039, 14903, 14770, 14640, 14513, 14391,
+  14274, 14162, 14057, 13959, 13867, 13783, 13707, 13639,
+  13579, 13526, 13482, 13445, 13416, 13394, 13379, 13370,
+  13368, 13370, 13378, 13389, 13404, 13421, 13440, 13461,
+  13481, 13502, 13521, 13538, 13553, 13564, 13572, 13574,
+  13572, 13564, 13550, 13529, 13502, 13468, 13426, 13378,
+  13322, 13258, 13188, 13111, 13027, 12937, 12841, 12739,
+  12633, 12522, 12407, 12289, 12169, 12047, 11924, 11800,
+  11677, 11555, 11434, 11316, 11201, 11090, 10982, 10880,
+  10782, 10691, 10605, 10525, 10452, 10385, 10325, 10272,
+  10226, 10186, 10153, 10126, 10105, 10089, 10078, 10072,
+  10071, 10072, 10077, 10084, 10093, 10102, 10113, 10123,
+  10132, 10139, 10145, 10147, 10147, 10142, 10133, 10119,
+  10100, 10075, 10045, 10008, 9966, 9917, 9861, 9799,
+  9731, 9657, 9577, 9492, 9401, 9306, 9206, 9102,
+  8995, 8885, 8772, 8658, 8543, 8428, 8313, 8198,
+  8085, 7974, 7865, 7760, 7658, 7561, 7468, 7380,
+  7297, 7220, 7148, 7083, 7023, 6969, 6922, 6880,
+  6844, 6814, 6789, 6769, 6754, 6743, 6736, 6732,
+  6731, 6732, 6734, 6738, 6742, 6746, 6750, 6752,
+  6752, 6749, 6744, 6735, 6722, 6705, 6683, 6656,
+  6624, 6586, 6543, 6494, 6439, 6378, 6312, 6239,
+  6162, 6079, 5992, 5900, 5804, 5704, 5601, 5495,
+  5387, 5278, 5167, 5056, 4946, 4835, 4726, 4619,
+  4514, 4413, 4314, 4219, 4128, 4042, 3961, 3885,
+  3814, 3749, 3690, 3636, 3587, 3545, 3507, 3475,
+  3448, 3426, 3408, 3394, 3384, 3377, 3373, 3371,
+  3370, 3370, 3371, 3372, 3372, 3371, 3369, 3364,
+  3356, 3345, 3331, 3312, 3289, 3261, 3228, 3190,
+  3146, 3097, 3042, 2982, 2917, 2846, 2769, 2688,
+  2602, 2512, 2418, 2320, 2219, 2116, 2010, 1903,
+  1794, 1685, 1577, 1468, 1361, 1256, 1152, 1052,
+  954, 861, 771, 685, 605, 529, 458, 393,
+  333, 279, 230, 187, 149, 116, 88, 65,
+  46, 31, 20, 11, 6, 2, 1, 0,
+  0, 0, -1, -2, -6, -11, -20, -31,
+  -46, -65, -88, -116, -149, -187, -230, -279,
+  -333, -393, -458, -529, -605, -685, -771, -861,
+  -954, -1052, -1152, -1256, -1361, -1468, -1577, -1685,
+  -1794, -1903, -2010, -2116, -2219, -2320, -2418, -2512,
+  -2602, -2688, -2769, -2846, -2917, -2982, -3042, -3097,
+  -3146, -3190, -3228, -3261, -3289, -3312, -3331, -3345,
+  -3356, -3364, -3369, -3371, -3372, -3372, -3371, -3370,
+  -3370, -3371, -3373, -3377, -3384, -3394, -3408, -3426,
+  -3448, -3475, -3507, -3545, -3587, -3636, -3690, -3749,
+  -3814, -3885, -3961, -4042, -4128, -4219, -4314, -4413,
+  -4514, -4619, -4726, -4835, -4946, -5056, -5167, -5278,
+  -5387, -5495, -5601, -5704, -5804, -5900, -5992, -6079,
+  -6162, -6239, -6312, -6378, -6439, -6494, -6543, -6586,
+  -6624, -6656, -6683, -6705, -6722, -6735, -6744, -6749,
+  -6752, -6752, -6750, -6746, -6742, -6738, -6734, -6732,
+  -6731, -6732, -6736, -6743, -6754, -6769, -6789, -6814,
+  -6844, -6880, -6922, -6969, -7023, -7083, -7148, -7220,
+  -7297, -7380, -7468, -7561, -7658, -7760, -7865, -7974,
+  -8085, -8198, -8313, -8428, -8543, -8658, -8772, -8885,
+  -8995, -9102, -9206, -9306, -9401, -9492, -9577, -9657,
+  -9731, -9799, -9861, -9917, -9966, -10008, -10045, -10075,
+  -10100, -10119, -10133, -10142, -10147, -10147, -10145, -10139,
+  -10132, -10123, -10113, -10102, -10093, -10084, -10077, -10072,
+  -10071, -10072, -10078, -10089, -10105, -10126, -10153, -10186,
+  -10226, -10272, -10325, -10385, -10452, -10525, -10605, -10691,
+  -10782, -10880, -10982, -11090, -11201, -11316, -11434, -11555,
+  -11677, -11800, -11924, -12047, -12169, -12289, -12407, -12522,
+  -12633, -12739, -12841, -12937, -13027, -13111, -13188, -13258,
+  -13322, -13378, -13426, -13468, -13502, -13529, -13550, -13564,
+  -13572, -13574, -13572, -13564, -13553, -13538, -13521, -13502,
+  -13481, -13461, -13440, -13421, -13404, -13389, -13378, -13370,
+  -13368, -13370, -13379, -13394, -13416, -13445, -13482, -13526,
+  -13579, -13639, -13707, -13783, -13867, -13959, -14057, -14162,
+  -14274, -14391, -14513, -14640, -14770, -14903, -15039, -15176,
+  -15313, -15450, -15586, -15720, -15851, -15978, -16101, -16219,
+  -16331, -16436, -16535, -16625, -16708, -16783, -16848, -16905,
+  -16953, -16992, -17023, -17044, -17057, -17063, -17060, -17051,
+  -17035, -17013, -16986, -16955, -16921, -16884, -16845, -16806,
+  -16767, -16729, -16693, -16660, -16632, -16608, -16591, -16579,
+  -16575, -16580, -16592, -16614, -16645, -16686, -16737, -16799,
+  -16870, -16952, -17044, -17145, -17256, -17375, -17503, -17638,
+  -17780, -17928, -18081, -18238, -18398, -18560, -18723, -18886,
+  -19048, -19207, -19363, -19514, -19660, -19799, -19930, -20053,
+  -20167, -20270, -20363, -20445, -20516, -20574, -20621, -20655,
+  -20678, -20688, -20687, -20675, -20652, -20620, -20578, -20528,
+  -20471, -20407, -20339, -20266, -20191, -20114, -20038, -19962,
+  -19890, -19821, -19758, -19701, -19653, -19613, -19583, -19565,
+  -19559, -19565, -19585, -19620, -19668, -19732, -19811, -19904,
+  -20012, -20135, -20272, -20422, -20585, -20759, -20944, -21139,
+  -21341, -21551, -21766, -21984, -22205, -22426, -22646, -22863,
+  -23075, -23281, -23478, -23666, -23842, -24006, -24156, -24290,
+  -24407, -24507, -24588, -24650, -24693, -24716, -24719, -24702,
+  -24666, -24610, -24536, -24445, -24337, -24214, -24078, -23930,
+  -23772, -23605, -23433, -23256, -23079, -22901, -22727, -22559,
+  -22399, -22249, -22113, -21991, -21888, -21804, -21742, -21703,
+  -21690, -21704, -21745, -21816, -21917, -22048, -22210, -22402,
+  -22625, -22877, -23158, -23466, -23799, -24157, -24535, -24933,
+  -25347, -25774, -26210, -26653, -27098, -27542, -27980, -28407,
+  -28821, -29215, -29586, -29929, -30239, -30512, -30743, -30928,
+  -31063, -31144, -31167, -31129, -31025, -30854, -30612, -30296,
+  -29906, -29439, -28894, -28270, -27568, -26786, -25925, -24987,
+  -23972, -22882, -21721, -20489, -19191, -17830, -16409, -14933,
+  -13407, -11835, -10221, -8573, -6895, -5192, -3472, -1739,
+  0
+};
+
+static const int16_t hifi_wavetable_saw_6[1025] =
+{
+  0, 870, 1739, 2606, 3471, 4332, 5190, 6042,
+  6889, 7729, 8562, 9386, 10202, 11008, 11804, 12588,
+  13361, 14121, 14868, 15602, 16321, 17025, 17714, 18386,
+  19042, 19681, 20302, 20905, 21490, 22056, 22603, 23131,
+  23638, 24126, 24593, 25040, 25466, 25872, 26257, 26620,
+  26963, 27284, 27585, 27865, 28123, 28361, 28578, 28775,
+  28952, 29108, 29245, 29361, 29459, 29538, 29598, 29640,
+  29664, 29671, 29660, 29634, 29591, 29532, 29459, 29371,
+  29269, 29154, 29025, 28885, 28733, 28570, 28396, 28212,
+  28019, 27818, 27608, 27392, 27168, 26938, 26703, 26463,
+  26218, 25970, 25719, 25466, 25210, 24954, 24696, 24439,
+  24182, 23926, 23671, 23418, 23168, 22921, 22677, 22437,
+  22201, 21970, 21743, 21523, 21307, 21098, 20896, 20700,
+  20511, 20329, 20154, 19987, 19827, 19676, 19532, 19396,
+  19269, 19150, 19039, 18936, 18841, 18755, 18677, 18607,
+  18545, 18490, 18444, 18405, 18374, 18350, 18333, 18323,
+  18320, 18323, 18333, 18348, 18369, 18395, 18427, 18463,
+  18504, 18548, 18597, 18649, 18705, 18763, 18823, 18886,
+  18951, 19017, 19084, 19152, 19220, 19289, 19357, 19424,
+  19491, 19557, 19621, 19683, 19743, 19801, 19856, 19908,
+  19957, 20003, 20045, 20083, 20117, 20147, 20172, 20193,
+  20209, 20220, 20226, 20227, 20222, 20213, 20198, 20177,
+  20151, 20120, 20083, 20040, 19993, 19939, 19881, 19817,
+  19748, 19673, 19594, 19510, 19421, 19327, 19229, 19126,
+  19019, 18909, 18794, 18676, 18555, 18430, 18302, 18172,
+  18039, 17904, 17766, 17627, 17486, 17344, 17201, 17057,
+  16913, 16768, 16623, 16479, 16334, 16191, 16048, 15906,
+  15766, 15627, 15490, 15355, 15223, 15092, 14964, 14839,
+  14717, 14598, 14482, 14370, 14261, 14156, 14054, 13956,
+  13863, 13773, 13687, 13606, 13528, 13455, 13386, 13321,
+  13261, 13205, 13153, 13105, 13061, 13021, 12986, 12954,
+  12926, 12902, 12881, 12864, 12851, 12841, 12833, 12829,
+  12828, 12829, 12833, 12839, 12847, 12858, 12870, 12883,
+  12898, 12915, 12932, 12950, 12969, 12988, 13007, 13026,
+  13045, 13064, 13082, 13099, 13116, 13131, 13145, 13157,
+  13168, 13177, 13183, 13188, 13190, 13190, 13188, 13182,
+  13174, 13163, 13148, 13131, 13110, 13086, 13059, 13028,
+  12994, 12956, 12915, 12870, 12822, 12770, 12714, 12655,
+  12593, 12527, 12457, 12384, 12308, 12229, 12146, 12061,
+  11972, 11881, 11787, 11690, 11591, 11489, 11385, 11280,
+  11172, 11062, 10951, 10838, 10724, 10609, 10493, 10376,
+  10258, 10140, 10022, 9904, 9786, 9668, 9550, 9433,
+  9317, 9201, 9087, 8974, 8862, 8752, 8644, 8537,
+  8432, 8330, 8229, 8131, 8036, 7943, 7852, 7765,
+  7680, 7598, 7519, 7443, 7370, 7300, 7233, 7169,
+  7109, 7052, 6998, 6947, 6899, 6854, 6813, 6774,
+  6739, 6706, 6676, 6649, 6625, 6603, 6584, 6567,
+  6553, 6540, 6530, 6522, 6515, 6511, 6507, 6506,
+  6505, 6505, 6507, 6509, 6512, 6516, 6519, 6523,
+  6527, 6531, 6534, 6537, 6540, 6542, 6542, 6542,
+  6540, 6538, 6533, 6527, 6520, 6510, 6498, 6485,
+  6469, 6451, 6430, 6407, 6382, 6354, 6323, 6289,
+  6253, 6213, 6171, 6126, 6078, 6027, 5973, 5916,
+  5856, 5794, 5728, 5659, 5588, 5514, 5437, 5358,
+  5276, 5192, 5105, 5016, 4924, 4831, 4736, 4638,
+  4539, 4438, 4336, 4232, 4128, 4022, 3915, 3807,
+  3698, 3589, 3480, 3370, 3261, 3151, 3042, 2933,
+  2824, 2716, 2609, 2503, 2398, 2294, 2192, 2091,
+  1992, 1894, 1798, 1704, 1612, 1523, 1435, 1350,
+  1268, 1188, 1110, 1035, 963, 893, 827, 763,
+  702, 643, 588, 535, 485, 439, 394, 353,
+  314, 278, 245, 214, 186, 161, 137, 116,
+  97, 80, 66, 53, 42, 32, 24, 18,
+  12, 8, 5, 3, 2, 1, 0, 0,
+  0, 0, 0, -1, -2, -3, -5, -8,
+  -12, -18, -24, -32, -42, -53, -66, -80,
+  -97, -116, -137, -161, -186, -214, -245, -278,
+  -314, -353, -394, -439, -485, -535, -588, -643,
+  -702, -763, -827, -893, -963, -1035, -1110, -1188,
+  -1268, -1350, -1435, -1523, -1612, -1704, -1798, -1894,
+  -1992, -2091, -2192, -2294, -2398, -2503, -2609, -2716,
+  -2824, -2933, -3042, -3151, -3261, -3370, -3480, -3589,
+  -3698, -3807, -3915, -4022, -4128, -4232, -4336, -4438,
+  -4539, -4638, -4736, -4831, -4924, -5016, -5105, -5192,
+  -5276, -5358, -5437, -5514, -5588, -5659, -5728, -5794,
+  -5856, -5916, -5973, -6027, -6078, -6126, -6171, -6213,
+  -6253, -6289, -6323, -6354, -6382, -6407, -6430, -6451,
+  -6469, -6485, -6498, -6510, -6520, -6527, -6533, -6538,
+  -6540, -6542, -6542, -6542, -6540, -6537, -6534, -6531,
+  -6527, -6523, -6519, -6516, -6512, -6509, -6507, -6505,
+  -6505, -6506, -6507, -6511, -6515, -6522, -6530, -6540,
+  -6553, -6567, -6584, -6603, -6625, -6649, -6676, -6706,
+  -6739, -6774, -6813, -6854, -6899, -6947, -6998, -7052,
+  -7109, -7169, -7233, -7300, -7370, -7443, -7519, -7598,
+  -7680, -7765, -7852, -7943, -8036, -8131, -8229, -8330,
+  -8432, -8537, -8644, -8752, -8862, -8974, -9087, -9201,
+  -9317, -9433, -9550, -9668, -9786, -9904, -10022, -10140,
+  -10258, -10376, -10493, -10609, -10724, -10838, -10951, -11062,
+  -11172, -11280, -11385, -11489, -11591, -11690, -11787, -11881,
+  -11972, -12061, -12146, -12229, -12308, -12384, -12457, -12527,
+  -12593, -12655, -12714, -12770, -12822, -12870, -12915, -12956,
+  -12994, -13028, -13059, -13086, -13110, -13131, -13148, -13163,
+  -13174, -13182, -13188, -13190, -13190, -13188, -13183, -13177,
+  -13168, -13157, -13145, -13131, -13116, -13099, -13082, -13064,
+  -13045, -13026, -13007, -12988, -12969, -12950, -12932, -12915,
+  -12898, -12883, -12870, -12858, -12847, -12839, -12833, -12829,
+  -12828, -12829, -12833, -12841, -12851, -12864, -12881, -12902,
+  -12926, -12954, -12986, -13021, -13061, -13105, -13153, -13205,
+  -13261, -13321, -13386, -13455, -13528, -13606, -13687, -13773,
+  -13863, -13956, -14054, -14156, -14261, -14370, -14482, -14598,
+  -14717, -14839, -14964, -15092, -15223, -15355, -15490, -15627,
+  -15766, -15906, -16048, -16191, -16334, -16479, -16623, -16768,
+  -16913, -17057, -17201, -17344, -17486, -17627, -17766, -17904,
+  -18039, -18172, -18302, -18430, -18555, -18676, -18794, -18909,
+  -19019, -19126, -19229, -19327, -19421, -19510, -19594, -19673,
+  -19748, -19817, -19881, -19939, -19993, -20040, -20083, -20120,
+  -20151, -20177, -20198, -20213, -20222, -20227, -20226, -20220,
+  -20209, -20193, -20172, -20147, -20117, -20083, -20045, -20003,
+  -19957, -19908, -19856, -19801, -19743, -19683, -19621, -19557,
+  -19491, -19424, -19357, -19289, -19220, -19152, -19084, -19017,
+  -18951, -18886, -18823, -18763, -18705, -18649, -18597, -18548,
+  -18504, -18463, -18427, -18395, -18369, -18348, -18333, -18323,
+  -18320, -18323, -18333, -18350, -18374, -18405, -18444, -18490,
+  -18545, -18607, -18677, -18755, -18841, -18936, -19039, -19150,
+  -19269, -19396, -19532, -19676, -19827, -19987, -20154, -20329,
+  -20511, -20700, -20896, -21098, -21307, -21523, -21743, -21970,
+  -22201, -22437, -22677, -22921, -23168, -23418, -23671, -23926,
+  -24182, -24439, -24696, -24954, -25210, -25466, -25719, -25970,
+  -26218, -26463, -26703, -26938, -27168, -27392, -27608, -27818,
+  -28019, -28212, -28396, -28570, -28733, -28885, -29025, -29154,
+  -29269, -29371, -29459, -29532, -29591, -29634, -29660, -29671,
+  -29664, -29640, -29598, -29538, -29459, -29361, -29245, -29108,
+  -28952, -28775, -28578, -28361, -28123, -27865, -27585, -27284,
+  -26963, -26620, -26257, -25872, -25466, -25040, -24593, -24126,
+  -23638, -23131, -22603, -22056, -21490, -20905, -20302, -19681,
+  -19042, -18386, -17714, -17025, -16321, -15602, -14868, -14121,
+  -13361, -12588, -11804, -11008, -10202, -9386, -8562, -7729,
+  -6889, -6042, -5190, -4332, -3471, -2606, -1739, -870,
+  0
+};
+
+static const int16_t hifi_wavetable_saw_7[1025] =
+{
+  0, 435, 870, 1304, 1739, 2172, 2605, 3038,
+  3469, 3900, 4329, 4758, 5185, 5610, 6034, 6456,
+  6876, 7295, 7711, 8125, 8537, 8947, 9354, 9758,
+  10160, 10559, 10955, 11348, 11738, 12124, 12508, 12887,
+  13264, 13636, 14005, 14370, 14731, 15088, 15441, 15790,
+  16135, 16475, 16811, 17142, 17469, 17791, 18108, 18420,
+  18728, 19030, 19328, 19620, 19908, 20190, 20467, 20739,
+  21005, 21266, 21521, 21771, 22015, 22254, 22487, 22715,
+  22937, 23153, 23363, 23568, 23767, 23960, 24147, 24328,
+  24503, 24673, 24837, 24994, 25146, 25292, 25432, 25567,
+  25695, 25817, 25934, 26045, 26149, 26248, 26342, 26429,
+  26511, 26587, 26657, 26721, 26780, 26834, 26881, 26923,
+  26960, 26991, 27017, 27038, 27053, 27062, 27067, 27067,
+  27061, 27050, 27035, 27014, 26989, 26959, 26924, 26884,
+  26840, 26791, 26738, 26680, 26619, 26553, 26482, 26408,
+  26330, 26248, 26162, 26072, 25979, 25882, 25781, 25678,
+  25571, 25460, 25347, 25230, 25111, 24988, 24863, 24736,
+  24605, 24472, 24337, 24199, 24060, 23918, 23774, 23628,
+  23480, 23331, 23180, 23027, 22873, 22717, 22561, 22403,
+  22243, 22083, 21922, 21761, 21598, 21435, 21271, 21107,
+  20942, 20777, 20612, 20447, 20282, 20117, 19952, 19787,
+  19622, 19458, 19294, 19131, 18968, 18807, 18645, 18485,
+  18326, 18167, 18010, 17853, 17698, 17544, 17391, 17240,
+  17090, 16942, 16795, 16649, 16506, 16364, 16223, 16085,
+  15948, 15813, 15681, 15550, 15421, 15294, 15169, 15046,
+  14926, 14807, 14691, 14577, 14465, 14356, 14249, 14144,
+  14042, 13941, 13844, 13748, 13655, 13565, 13477, 13391,
+  13308, 13227, 13148, 13072, 12999, 12927, 12859, 12792,
+  12728, 12667, 12608, 12551, 12496, 12444, 12394, 12347,
+  12301, 12258, 12217, 12179, 12142, 12108, 12076, 12046,
+  12017, 11991, 11967, 11945, 11925, 11906, 11890, 11875,
+  11862, 11851, 11841, 11833, 11826, 11821, 11818, 11816,
+  11815, 11816, 11818, 11821, 11825, 11831, 11837, 11845,
+  11854, 11863, 11873, 11885, 11897, 11909, 11923, 11937,
+  11951, 11966, 11981, 11997, 12013, 12030, 12046, 12063,
+  12080, 12097, 12114, 12130, 12147, 12164, 12180, 12196,
+  12212, 12228, 12243, 12257, 12271, 12285, 12297, 12310,
+  12321, 12332, 12342, 12351, 12359, 12366, 12373, 12378,
+  12382, 12385, 12387, 12388, 12388, 12386, 12383, 12379,
+  12374, 12367, 12358, 12349, 12337, 12325, 12311, 12295,
+  12278, 12259, 12238, 12216, 12193, 12167, 12140, 12112,
+  12081, 12049, 12016, 11980, 11943, 11904, 11863, 11821,
+  11776, 11731, 11683, 11633, 11582, 11529, 11475, 11418,
+  11360, 11300, 11239, 11176, 11111, 11044, 10976, 10906,
+  10835, 10761, 10687, 10611, 10533, 10454, 10373, 10291,
+  10207, 10122, 10035, 9948, 9858, 9768, 9676, 9583,
+  9489, 9394, 9297, 9200, 9101, 9001, 8901, 8799,
+  8697, 8593, 8489, 8384, 8278, 8171, 8064, 7956,
+  7848, 7739, 7629, 7519, 7409, 7298, 7187, 7075,
+  6964, 6852, 6740, 6628, 6515, 6403, 6291, 6179,
+  6067, 5955, 5843, 5731, 5620, 5509, 5398, 5288,
+  5178, 5069, 4960, 4852, 4744, 4637, 4531, 4425,
+  4320, 4216, 4113, 4011, 3909, 3809, 3709, 3610,
+  3513, 3416, 3321, 3226, 3133, 3041, 2950, 2861,
+  2772, 2685, 2599, 2515, 2432, 2350, 2269, 2190,
+  2113, 2036, 1961, 1888, 1816, 1746, 1677, 1609,
+  1543, 1479, 1416, 1355, 1295, 1236, 1180, 1124,
+  1071, 1018, 968, 918, 871, 824, 780, 736,
+  695, 654, 616, 578, 542, 508, 475, 443,
+  412, 383, 356, 329, 304, 280, 257, 236,
+  216, 196, 178, 161, 146, 131, 117, 104,
+  92, 81, 71, 62, 54, 46, 39, 33,
+  28, 23, 19, 15, 12, 9, 7, 5,
+  3, 2, 1, 1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, -1, -1, -2,
+  -3, -5, -7, -9, -12, -15, -19, -23,
+  -28, -33, -39, -46, -54, -62, -71, -81,
+  -92, -104, -117, -131, -146, -161, -178, -196,
+  -216, -236, -257, -280, -304, -329, -356, -383,
+  -412, -443, -475, -508, -542, -578, -616, -654,
+  -695, -736, -780, -824, -871, -918, -968, -1018,
+  -1071, -1124, -1180, -1236, -1295, -1355, -1416, -1479,
+  -1543, -1609, -1677, -1746, -1816, -1888, -1961, -2036,
+  -2113, -2190, -2269, -2350, -2432, -2515, -2599, -2685,
+  -2772, -2861, -2950, -3041, -3133, -3226, -3321, -3416,
+  -3513, -3610, -3709, -3809, -3909, -4011, -4113, -4216,
+  -4320, -4425, -4531, -4637, -4744, -4852, -4960, -5069,
+  -5178, -5288, -5398, -5509, -5620, -5731, -5843, -5955,
+  -6067, -6179, -6291, -6403, -6515, -6628, -6740, -6852,
+  -6964, -7075, -7187, -7298, -7409, -7519, -7629, -7739,
+  -7848, -7956, -8064, -8171, -8278, -8384, -8489, -8593,
+  -8697, -8799, -8901, -9001, -9101, -9200, -9297, -9394,
+  -9489, -9583, -9676, -9768, -9858, -9948, -10035, -10122,
+  -10207, -10291, -10373, -10454, -10533, -10611, -10687, -10761,
+  -10835, -10906, -10976, -11044, -11111, -11176, -11239, -11300,
+  -11360, -11418, -11475, -11529, -11582, -11633, -11683, -11731,
+  -11776, -11821, -11863, -11904, -11943, -11980, -12016, -12049,
+  -12081, -12112, -12140, -12167, -12193, -12216, -12238, -12259,
+  -12278, -12295, -12311, -12325, -12337, -12349, -12358, -12367,
+  -12374, -12379, -12383, -12386, -12388, -12388, -12387, -12385,
+  -12382, -12378, -12373, -12366, -12359, -12351, -12342, -12332,
+  -12321, -12310, -12297, -12285, -12271, -12257, -12243, -12228,
+  -12212, -12196, -12180, -12164, -12147, -12130, -12114, -12097,
+  -12080, -12063, -12046, -12030, -12013, -11997, -11981, -11966,
+  -11951, -11937, -11923, -11909, -11897, -11885, -11873, -11863,
+  -11854, -11845, -11837, -11831, -11825, -11821, -11818, -11816,
+  -11815, -11816, -11818, -11821, -11826, -11833, -11841, -11851,
+  -11862, -11875, -11890, -11906, -11925, -11945, -11967, -11991,
+  -12017, -12046, -12076, -12108, -12142, -12179, -12217, -12258,
+  -12301, -12347, -12394, -12444, -12496, -12551, -12608, -12667,
+  -12728, -12792, -12859, -12927, -12999, -13072, -13148, -13227,
+  -13308, -13391, -13477, -13565, -13655, -13748, -13844, -13941,
+  -14042, -14144, -14249, -14356, -14465, -14577, -14691, -14807,
+  -14926, -15046, -15169, -15294, -15421, -15550, -15681, -15813,
+  -15948, -16085, -16223, -16364, -16506, -16649, -16795, -16942,
+  -17090, -17240, -17391, -17544, -17698, -17853, -18010, -18167,
+  -18326, -18485, -18645, -18807, -18968, -19131, -19294, -19458,
+  -19622, -19787, -19952, -20117, -20282, -20447, -20612, -20777,
+  -20942, -21107, -21271, -21435, -21598, -21761, -21922, -22083,
+  -22243, -22403, -22561, -22717, -22873, -23027, -23180, -23331,
+  -23480, -23628, -23774, -23918, -24060, -24199, -24337, -24472,
+  -24605, -24736, -24863, -24988, -25111, -25230, -25347, -25460,
+  -25571, -25678, -25781, -25882, -25979, -26072, -26162, -26248,
+  -26330, -26408, -26482, -26553, -26619, -26680, -26738, -26791,
+  -26840, -26884, -26924, -26959, -26989, -27014, -27035, -27050,
+  -27061, -27067, -27067, -27062, -27053, -27038, -27017, -26991,
+  -26960, -26923, -26881, -26834, -26780, -26721, -26657, -26587,
+  -26511, -26429, -26342, -26248, -26149, -26045, -25934, -25817,
+  -25695, -25567, -25432, -25292, -25146, -24994, -24837, -24673,
+  -24503, -24328, -24147, -23960, -23767, -23568, -23363, -23153,
+  -22937, -22715, -22487, -22254, -22015, -21771, -21521, -21266,
+  -21005, -20739, -20467, -20190, -19908, -19620, -19328, -19030,
+  -18728, -18420, -18108, -17791, -17469, -17142, -16811, -16475,
+  -16135, -15790, -15441, -15088, -14731, -14370, -14005, -13636,
+  -13264, -12887, -12508, -12124, -11738, -11348, -10955, -10559,
+  -10160, -9758, -9354, -8947, -8537, -8125, -7711, -7295,
+  -6876, -6456, -6034, -5610, -5185, -4758, -4329, -3900,
+  -3469, -3038, -2605, -2172, -1739, -1304, -870, -435,
+  0
+};
+
+static const int16_t hifi_wavetable_saw_8[1025] =
+{
+  0, 217, 435, 652, 870, 1087, 1304, 1521,
+  1738, 1955, 2171, 2388, 2604, 2820, 3036, 3251,
+  3466, 3681, 3895, 4109, 4323, 4536, 4749, 4961,
+  5173, 5384, 5595, 5805, 6015, 6224, 6433, 6641,
+  6849, 7055, 7262, 7467, 7672, 7876, 8079, 8282,
+  8483, 8684, 8885, 9084, 9283, 9480, 9677, 9873,
+  10068, 10262, 10455, 10647, 10838, 11028, 11217, 11405,
+  11592, 11778, 11963, 12147, 12329, 12511, 12691, 12870,
+  13048, 13225, 13400, 13575, 13748, 13920, 14090, 14259,
+  14427, 14594, 14759, 14923, 15086, 15247, 15407, 15565,
+  15722, 15878, 16032, 16185, 16336, 16486, 16634, 16781,
+  16926, 17070, 17212, 17353, 17492, 17630, 17766, 17900,
+  18033, 18164, 18294, 18422, 18548, 18673, 18796, 18917,
+  19037, 19155, 19272, 19386, 19499, 19611, 19720, 19828,
+  19934, 20039, 20141, 20242, 20341, 20439, 20535, 20628,
+  20721, 20811, 20899, 20986, 21071, 21154, 21236, 21315,
+  21393, 21469, 21543, 21616, 21686, 21755, 21822, 21887,
+  21950, 22012, 22071, 22129, 22185, 22239, 22292, 22342,
+  22391, 22438, 22483, 22526, 22567, 22607, 22645, 22681,
+  22715, 22747, 22778, 22806, 22833, 22858, 22882, 22903,
+  22923, 22941, 22957, 22971, 22984, 22994, 23004, 23011,
+  23016, 23020, 23022, 23022, 23021, 23018, 23013, 23006,
+  22998, 22988, 22976, 22963, 22948, 22931, 22913, 22893,
+  22871, 22848, 22823, 22796, 22768, 22738, 22707, 22674,
+  22640, 22604, 22566, 22527, 22486, 22444, 22400, 22355,
+  22308, 22260, 22211, 22159, 22107, 22053, 21998, 21941,
+  21883, 21823, 21762, 21700, 21636, 21571, 21505, 21438,
+  21369, 21299, 21227, 21155, 21081, 21006, 20929, 20852,
+  20773, 20693, 20612, 20530, 20447, 20363, 20277, 20191,
+  20103, 20015, 19925, 19834, 19743, 19650, 19556, 19462,
+  19366, 19270, 19172, 19074, 18975, 18875, 18774, 18672,
+  18570, 18467, 18363, 18258, 18152, 18046, 17939, 17831,
+  17723, 17614, 17504, 17394, 17283, 17171, 17059, 16946,
+  16833, 16719, 16605, 16490, 16374, 16259, 16142, 16026,
+  15909, 15791, 15673, 15555, 15436, 15317, 15198, 15078,
+  14959, 14838, 14718, 14597, 14477, 14355, 14234, 14113,
+  13991, 13869, 13747, 13625, 13503, 13381, 13259, 13137,
+  13014, 12892, 12770, 12647, 12525, 12403, 12281, 12159,
+  12036, 11915, 11793, 11671, 11550, 11428, 11307, 11186,
+  11065, 10945, 10824, 10704, 10584, 10465, 10345, 10226,
+  10108, 9989, 9871, 9754, 9636, 9520, 9403, 9287,
+  9171, 9056, 8941, 8827, 8713, 8599, 8486, 8374,
+  8262, 8151, 8040, 7929, 7820, 7710, 7602, 7494,
+  7386, 7279, 7173, 7068, 6963, 6858, 6754, 6651,
+  6549, 6447, 6346, 6246, 6146, 6048, 5949, 5852,
+  5755, 5659, 5564, 5470, 5376, 5283, 5191, 5099,
+  5009, 4919, 4830, 4742, 4654, 4568, 4482, 4397,
+  4313, 4230, 4147, 4066, 3985, 3905, 3826, 3748,
+  3670, 3594, 3518, 3444, 3370, 3297, 3225, 3154,
+  3083, 3014, 2945, 2877, 2811, 2745, 2680, 2615,
+  2552, 2490, 2428, 2368, 2308, 2249, 2191, 2134,
+  2078, 2022, 1968, 1914, 1862, 1810, 1759, 1709,
+  1659, 1611, 1564, 1517, 1471, 1426, 1382, 1339,
+  1296, 1255, 1214, 1174, 1135, 1097, 1059, 1022,
+  986, 951, 917, 884, 851, 819, 788, 757,
+  728, 699, 670, 643, 616, 590, 565, 540,
+  516, 493, 470, 449, 427, 407, 387, 368,
+  349, 331, 314, 297, 281, 265, 250, 235,
+  222, 208, 195, 183, 171, 160, 149, 139,
+  129, 120, 111, 102, 94, 87, 80, 73,
+  66, 60, 55, 50, 45, 40, 36, 32,
+  28, 25, 22, 19, 16, 14, 12, 10,
+  8, 7, 6, 4, 4, 3, 2, 1,
+  1, 1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, -1,
+  -1, -1, -2, -3, -4, -4, -6, -7,
+  -8, -10, -12, -14, -16, -19, -22, -25,
+  -28, -32, -36, -40, -45, -50, -55, -60,
+  -66, -73, -80, -87, -94, -102, -111, -120,
+  -129, -139, -149, -160, -171, -183, -195, -208,
+  -222, -235, -250, -265, -281, -297, -314, -331,
+  -349, -368, -387, -407, -427, -449, -470, -493,
+  -516, -540, -565, -590, -616, -643, -670, -699,
+  -728, -757, -788, -819, -851, -884, -917, -951,
+  -986, -1022, -1059, -1097, -1135, -1174, -1214, -1255,
+  -1296, -1339, -1382, -1426, -1471, -1517, -1564, -1611,
+  -1659, -1709, -1759, -1810, -1862, -1914, -1968, -2022,
+  -2078, -2134, -2191, -2249, -2308, -2368, -2428, -2490,
+  -2552, -2615, -2680, -2745, -2811, -2877, -2945, -3014,
+  -3083, -3154, -3225, -3297, -3370, -3444, -3518, -3594,
+  -3670, -3748, -3826, -3905, -3985, -4066, -4147, -4230,
+  -4313, -4397, -4482, -4568, -4654, -4742, -4830, -4919,
+  -5009, -5099, -5191, -5283, -5376, -5470, -5564, -5659,
+  -5755, -5852, -5949, -6048, -6146, -6246, -6346, -6447,
+  -6549, -6651, -6754, -6858, -6963, -7068, -7173, -7279,
+  -7386, -7494, -7602, -7710, -7820, -7929, -8040, -8151,
+  -8262, -8374, -8486, -8599, -8713, -8827, -8941, -9056,
+  -9171, -9287, -9403, -9520, -9636, -9754, -9871, -9989,
+  -10108, -10226, -10345, -10465, -10584, -10704, -10824, -10945,
+  -11065, -11186, -11307, -11428, -11550, -11671, -11793, -11915,
+  -12036, -12159, -12281, -12403, -12525, -12647, -12770, -12892,
+  -13014, -13137, -13259, -13381, -13503, -13625, -13747, -13869,
+  -13991, -14113, -14234, -14355, -14477, -14597, -14718, -14838,
+  -14959, -15078, -15198, -15317, -15436, -15555, -15673, -15791,
+  -15909, -16026, -16142, -16259, -16374, -16490, -16605, -16719,
+  -16833, -16946, -17059, -17171, -17283, -17394, -17504, -17614,
+  -17723, -17831, -17939, -18046, -18152, -18258, -18363, -18467,
+  -18570, -18672, -18774, -18875, -18975, -19074, -19172, -19270,
+  -19366, -19462, -19556, -19650, -19743, -19834, -19925, -20015,
+  -20103, -20191, -20277, -20363, -20447, -20530, -20612, -20693,
+  -20773, -20852, -20929, -21006, -21081, -21155, -21227, -21299,
+  -21369, -21438, -21505, -21571, -21636, -21700, -21762, -21823,
+  -21883, -21941, -21998, -22053, -22107, -22159, -22211, -22260,
+  -22308, -22355, -22400, -22444, -22486, -22527, -22566, -22604,
+  -22640, -22674, -22707, -22738, -22768, -22796, -22823, -22848,
+  -22871, -22893, -22913, -22931, -22948, -22963, -22976, -22988,
+  -22998, -23006, -23013, -23018, -23021, -23022, -23022, -23020,
+  -23016, -23011, -23004, -22994, -22984, -22971, -22957, -22941,
+  -22923, -22903, -22882, -22858, -22833, -22806, -22778, -22747,
+  -22715, -22681, -22645, -22607, -22567, -22526, -22483, -22438,
+  -22391, -22342, -22292, -22239, -22185, -22129, -22071, -22012,
+  -21950, -21887, -21822, -21755, -21686, -21616, -21543, -21469,
+  -21393, -21315, -21236, -21154, -21071, -20986, -20899, -20811,
+  -20721, -20628, -20535, -20439, -20341, -20242, -20141, -20039,
+  -19934, -19828, -19720, -19611, -19499, -19386, -19272, -19155,
+  -19037, -18917, -18796, -18673, -18548, -18422, -18294, -18164,
+  -18033, -17900, -17766, -17630, -17492, -17353, -17212, -17070,
+  -16926, -16781, -16634, -16486, -16336, -16185, -16032, -15878,
+  -15722, -15565, -15407, -15247, -15086, -14923, -14759, -14594,
+  -14427, -14259, -14090, -13920, -13748, -13575, -13400, -13225,
+  -13048, -12870, -12691, -12511, -12329, -12147, -11963, -11778,
+  -11592, -11405, -11217, -11028, -10838, -10647, -10455, -10262,
+  -10068, -9873, -9677, -9480, -9283, -9084, -8885, -8684,
+  -8483, -8282, -8079, -7876, -7672, -7467, -7262, -7055,
+  -6849, -6641, -6433, -6224, -6015, -5805, -5595, -5384,
+  -5173, -4961, -4749, -4536, -4323, -4109, -3895, -3681,
+  -3466, -3251, -3036, -2820, -2604, -2388, -2171, -1955,
+  -1738, -1521, -1304, -1087, -870, -652, -435, -217,
+  0
+};
+
+static const int16_t hifi_wavetable_saw_9[1025] =
+{
+  0, 109, 217, 326, 435, 544, 652, 761,
+  870, 978, 1087, 1195, 1304, 1412, 1521, 1629,
+  1737, 1845, 1953, 2061, 2169, 2277, 2385, 2493,
+  2600, 2708, 2815, 2923, 3030, 3137, 3244, 3351,
+  3458, 3564, 3671, 3777, 3883, 3989, 4095, 4201,
+  4306, 4412, 4517, 4622, 4727, 4832, 4936, 5040,
+  5145, 5249, 5352, 5456, 5559, 5662, 5765, 5868,
+  5971, 6073, 6175, 6277, 6378, 6480, 6581, 6682,
+  6782, 6883, 6983, 7082, 7182, 7281, 7380, 7479,
+  7577, 7676, 7773, 7871, 7968, 8065, 8162, 8258,
+  8354, 8450, 8546, 8641, 8736, 8830, 8924, 9018,
+  9111, 9204, 9297, 9390, 9482, 9573, 9665, 9756,
+  9846, 9936, 10026, 10116, 10205, 10294, 10382, 10470,
+  10557, 10645, 10731, 10818, 10904, 10989, 11074, 11159,
+  11243, 11327, 11410, 11493, 11576, 11658, 11740, 11821,
+  11902, 11982, 12062, 12142, 12221, 12299, 12377, 12455,
+  12532, 12609, 12685, 12760, 12836, 12910, 12985, 13058,
+  13132, 13204, 13277, 13349, 13420, 13491, 13561, 13631,
+  13700, 13769, 13837, 13904, 13972, 14038, 14104, 14170,
+  14235, 14300, 14364, 14427, 14490, 14552, 14614, 14675,
+  14736, 14796, 14856, 14915, 14973, 15031, 15088, 15145,
+  15201, 15257, 15312, 15366, 15420, 15474, 15526, 15579,
+  15630, 15681, 15731, 15781, 15830, 15879, 15927, 15974,
+  16021, 16067, 16113, 16158, 16202, 16246, 16289, 16332,
+  16374, 16415, 16456, 16496, 16535, 16574, 16612, 16650,
+  16687, 16723, 16759, 16794, 16828, 16862, 16895, 16928,
+  16960, 16991, 17021, 17051, 17081, 17109, 17137, 17165,
+  17192, 17218, 17243, 17268, 17292, 17316, 17338, 17361,
+  17382, 17403, 17423, 17443, 17462, 17480, 17498, 17515,
+  17531, 17547, 17562, 17576, 17589, 17602, 17615, 17626,
+  17637, 17648, 17657, 17666, 17675, 17682, 17689, 17696,
+  17701, 17706, 17711, 17714, 17717, 17720, 17721, 17722,
+  17723, 17722, 17721, 17720, 17717, 17714, 17711, 17706,
+  17701, 17696, 17689, 17682, 17675, 17666, 17657, 17648,
+  17637, 17626, 17615, 17602, 17589, 17576, 17562, 17547,
+  17531, 17515, 17498, 17480, 17462, 17443, 17423, 17403,
+  17382, 17361, 17338, 17316, 17292, 17268, 17243, 17218,
+  17192, 17165, 17137, 17109, 17081, 17051, 17021, 16991,
+  16960, 16928, 16895, 16862, 16828, 16794, 16759, 16723,
+  16687, 16650, 16612, 16574, 16535, 16496, 16456, 16415,
+  16374, 16332, 16289, 16246, 16202, 16158, 16113, 16067,
+  16021, 15974, 15927, 15879, 15830, 15781, 15731, 15681,
+  15630, 15579, 15526, 15474, 15420, 15366, 15312, 15257,
+  15201, 15145, 15088, 15031, 14973, 14915, 14856, 14796,
+  14736, 14675, 14614, 14552, 14490, 14427, 14364, 14300,
+  14235, 14170, 14104, 14038, 13972, 13904, 13837, 13769,
+  13700, 13631, 13561, 13491, 13420, 13349, 13277, 13204,
+  13132, 13058, 12985, 12910, 12836, 12760, 12685, 12609,
+  12532, 12455, 12377, 12299, 12221, 12142, 12062, 11982,
+  11902, 11821, 11740, 11658, 11576, 11493, 11410, 11327,
+  11243, 11159, 11074, 10989, 10904, 10818, 10731, 10645,
+  10557, 10470, 10382, 10294, 10205, 10116, 10026, 9936,
+  9846, 9756, 9665, 9573, 9482, 9390, 9297, 9204,
+  9111, 9018, 8924, 8830, 8736, 8641, 8546, 8450,
+  8354, 8258, 8162, 8065, 7968, 7871, 7773, 7676,
+  7577, 7479, 7380, 7281, 7182, 7082, 6983, 6883,
+  6782, 6682, 6581, 6480, 6378, 6277, 6175, 6073,
+  5971, 5868, 5765, 5662, 5559, 5456, 5352, 5249,
+  5145, 5040, 4936, 4832, 4727, 4622, 4517, 4412,
+  4306, 4201, 4095, 3989, 3883, 3777, 3671, 3564,
+  3458, 3351, 3244, 3137, 3030, 2923, 2815, 2708,
+  2600, 2493, 2385, 2277, 2169, 2061, 1953, 1845,
+  1737, 1629, 1521, 1412, 1304, 1195, 1087, 978,
+  870, 761, 652, 544, 435, 326, 217, 109,
+  0, -109, -217, -326, -435, -544, -652, -761,
+  -870, -978, -1087, -1195, -1304, -1412, -1521, -1629,
+  -1737, -1845, -1953, -2061, -2169, -2277, -2385, -2493,
+  -2600, -2708, -2815, -2923, -3030, -3137, -3244, -3351,
+  -3458, -3564, -3671, -3777, -3883, -3989, -4095, -4201,
+  -4306, -4412, -4517, -4622, -4727, -4832, -4936, -5040,
+  -5145, -5249, -5352, -5456, -5559, -5662, -5765, -5868,
+  -5971, -6073, -6175, -6277, -6378, -6480, -6581, -6682,
+  -6782, -6883, -6983, -7082, -7182, -7281, -7380, -7479,
+  -7577, -7676, -7773, -7871, -7968, -8065, -8162, -8258,
+  -8354, -8450, -8546, -8641, -8736, -8830, -8924, -9018,
+  -9111, -9204, -9297, -9390, -9482, -9573, -9665, -9756,
+  -9846, -9936, -10026, -10116, -10205, -10294, -10382, -10470,
+  -10557, -10645, -10731, -10818, -10904, -10989, -11074, -11159,
+  -11243, -11327, -11410, -11493, -11576, -11658, -11740, -11821,
+  -11902, -11982, -12062, -12142, -12221, -12299, -12377, -12455,
+  -12532, -12609, -12685, -12760, -12836, -12910, -12985, -13058,
+  -13132, -13204, -13277, -13349, -13420, -13491, -13561, -13631,
+  -13700, -13769, -13837, -13904, -13972, -14038, -14104, -14170,
+  -14235, -14300, -14364, -14427, -14490, -14552, -14614, -14675,
+  -14736, -14796, -14856, -14915, -14973, -15031, -15088, -15145,
+  -15201, -15257, -15312, -15366, -15420, -15474, -15526, -15579,
+  -15630, -15681, -15731, -15781, -15830, -15879, -15927, -15974,
+  -16021, -16067, -16113, -16158, -16202, -16246, -16289, -16332,
+  -16374, -16415, -16456, -16496, -16535, -16574, -16612, -16650,
+  -16687, -16723, -16759, -16794, -16828, -16862, -16895, -16928,
+  -16960, -16991, -17021, -17051, -17081, -17109, -17137, -17165,
+  -17192, -17218, -17243, -17268, -17292, -17316, -17338, -17361,
+  -17382, -17403, -17423, -17443, -17462, -17480, -17498, -17515,
+  -17531, -17547, -17562, -17576, -17589, -17602, -17615, -17626,
+  -17637, -17648, -17657, -17666, -17675, -17682, -17689, -17696,
+  -17701, -17706, -17711, -17714, -17717, -17720, -17721, -17722,
+  -17723, -17722, -17721, -17720, -17717, -17714, -17711, -17706,
+  -17701, -17696, -17689, -17682, -17675, -17666, -17657, -17648,
+  -17637, -17626, -17615, -17602, -17589, -17576, -17562, -17547,
+  -17531, -17515, -17498, -17480, -17462, -17443, -17423, -17403,
+  -17382, -17361, -17338, -17316, -17292, -17268, -17243, -17218,
+  -17192, -17165, -17137, -17109, -17081, -17051, -17021, -16991,
+  -16960, -16928, -16895, -16862, -16828, -16794, -16759, -16723,
+  -16687, -16650, -16612, -16574, -16535, -16496, -16456, -16415,
+  -16374, -16332, -16289, -16246, -16202, -16158, -16113, -16067,
+  -16021, -15974, -15927, -15879, -15830, -15781, -15731, -15681,
+  -15630, -15579, -15526, -15474, -15420, -15366, -15312, -15257,
+  -15201, -15145, -15088, -15031, -14973, -14915, -14856, -14796,
+  -14736, -14675, -14614, -14552, -14490, -14427, -14364, -14300,
+  -14235, -14170, -14104, -14038, -13972, -13904, -13837, -13769,
+  -13700, -13631, -13561, -13491, -13420, -13349, -13277, -13204,
+  -13132, -13058, -12985, -12910, -12836, -12760, -12685, -12609,
+  -12532, -12455, -12377, -12299, -12221, -12142, -12062, -11982,
+  -11902, -11821, -11740, -11658, -11576, -11493, -11410, -11327,
+  -11243, -11159, -11074, -10989, -10904, -10818, -10731, -10645,
+  -10557, -10470, -10382, -10294, -10205, -10116, -10026, -9936,
+  -9846, -9756, -9665, -9573, -9482, -9390, -9297, -9204,
+  -9111, -9018, -8924, -8830, -8736, -8641, -8546, -8450,
+  -8354, -8258, -8162, -8065, -7968, -7871, -7773, -7676,
+  -7577, -7479, -7380, -7281, -7182, -7082, -6983, -6883,
+  -6782, -6682, -6581, -6480, -6378, -6277, -6175, -6073,
+  -5971, -5868, -5765, -5662, -5559, -5456, -5352, -5249,
+  -5145, -5040, -4936, -4832, -4727, -4622, -4517, -4412,
+  -4306, -4201, -4095, -3989, -3883, -3777, -3671, -3564,
+  -3458, -3351, -3244, -3137, -3030, -2923, -2815, -2708,
+  -2600, -2493, -2385, -2277, -2169, -2061, -1953, -1845,
+  -1737, -1629, -1521, -1412, -1304, -1195, -1087, -978,
+  -870, -761, -652, -544, -435, -326, -217, -109,
+  0
+};
+
+static const int16_t hifi_wavetable_square_0[2049] =
+{
+  0, 22458, 30341, 26351, 23234, 25490, 27439, 25865,
+  24447, 25655, 26770, 25789, 24871, 25696, 26477, 25764,
+  25085, 25712, 26313, 25753, 25214, 25720, 26209, 25748,
+  25301, 25725, 26136, 25744, 25363, 25727, 26083, 25742,
+  25409, 25729, 26042, 25741, 25445, 25730, 26010, 25739,
+  25474, 25731, 25984, 25739, 25497, 25732, 25963, 25738,
+  25517, 25732, 25944, 25738, 25534, 25733, 25929, 25737,
+  25548, 25733, 25916, 25737, 25560, 25733, 25904, 25737,
+  25571, 25734, 25894, 25737, 25581, 25734, 25885, 25736,
+  25589, 25734, 25877, 25736, 25597, 25734, 25870, 25736,
+  25603, 25734, 25864, 25736, 25610, 25734, 25858, 25736,
+  25615, 25734, 25853, 25736, 25620, 25734, 25848, 25736,
+  25625, 25734, 25843, 25736, 25629, 25735, 25839, 25736,
+  25633, 25735, 25835, 25736, 25637, 25735, 25832, 25736,
+  25640, 25735, 25829, 25736, 25643, 25735, 25825, 25736,
+  25646, 25735, 25823, 25736, 25649, 25735, 25820, 25736,
+  25652, 25735, 25818, 25736, 25654, 25735, 25815, 25735,
+  25656, 25735, 25813, 25735, 25658, 25735, 25811, 25735,
+  25660, 25735, 25809, 25735, 25662, 25735, 25807, 25735,
+  25664, 25735, 25805, 25735, 25666, 25735, 25804, 25735,
+  25667, 25735, 25802, 25735, 25669, 25735, 25801, 25735,
+  25670, 25735, 25799, 25735, 25672, 25735, 25798, 25735,
+  25673, 25735, 25797, 25735, 25674, 25735, 25796, 25735,
+  25675, 25735, 25794, 25735, 25676, 25735, 25793, 25735,
+  25678, 25735, 25792, 25735, 25679, 25735, 25791, 25735,
+  25680, 25735, 25790, 25735, 25681, 25735, 25789, 25735,
+  25681, 25735, 25788, 25735, 25682, 25735, 25788, 25735,
+  25683, 25735, 25787, 25735, 25684, 25735, 25786, 25735,
+  25685, 25735, 25785, 25735, 25685, 25735, 25784, 25735,
+  25686, 25735, 25784, 25735, 25687, 25735, 25783, 25735,
+  25687, 25735, 25782, 25735, 25688, 25735, 25782, 25735,
+  25689, 25735, 25781, 25735, 25689, 25735, 25781, 25735,
+  25690, 25735, 25780, 25735, 25690, 25735, 25780, 25735,
+  25691, 25735, 25779, 25735, 25691, 25735, 25779, 25735,
+  25692, 25735, 25778, 25735, 25692, 25735, 25778, 25735,
+  25693, 25735, 25777, 25735, 25693, 25735, 25777, 25735,
+  25694, 25735, 25776, 25735, 25694, 25735, 25776, 25735,
+  25695, 25735, 25776, 25735, 25695, 25735, 25775, 25735,
+  25695, 25735, 25775, 25735, 25696, 25735, 25774, 25735,
+  25696, 25735, 25774, 25735, 25696, 25735, 25774, 25735,
+  25697, 25735, 25773, 25735, 25697, 25735, 25773, 25735,
+  25697, 25735, 25773, 25735, 25698, 25735, 25773, 25735,
+  25698, 25735, 25772, 25735, 25698, 25735, 25772, 25735,
+  25698, 25735, 25772, 25735, 25699, 25735, 25772, 25735,
+  25699, 25735, 25771, 25735, 25699, 25735, 25771, 25735,
+  25699, 25735, 25771, 25735, 25700, 25735, 25771, 25735,
+  25700, 25735, 25770, 25735, 25700, 25735, 25770, 25735,
+  25700, 25735, 25770, 25735, 25700, 25735, 25770, 25735,
+  25701, 25735, 25770, 25735, 25701, 25735, 25770, 25735,
+  25701, 25735, 25769, 25735, 25701, 25735, 25769, 25735,
+  25701, 25735, 25769, 25735, 25701, 25735, 25769, 25735,
+  25701, 25735, 25769, 25735, 25702, 25735, 25769, 25735,
+  25702, 25735, 25769, 25735, 25702, 25735, 25768, 25735,
+  25702, 25735, 25768, 25735, 25702, 25735, 25768, 25735,
+  25702, 25735, 25768, 25735, 25702, 25735, 25768, 25735,
+  25702, 25735, 25768, 25735, 25702, 25735, 25768, 25735,
+  25703, 25735, 25768, 25735, 25703, 25735, 25768, 25735,
+  25703, 25735, 25768, 25735, 25703, 25735, 25768, 25735,
+  25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+  25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+  25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+  25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+  25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+  25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+  25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+  25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+  25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+  25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+  25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+  25703, 25735, 25767, 25735, 25703, 25735, 25767, 25735,
+  25703, 25735, 25768, 25735, 25703, 25735, 25768, 25735,
+  25703, 25735, 25768, 25735, 25703, 25735, 25768, 25735,
+  25703, 25735, 25768, 25735, 25702, 25735, 25768, 25735,
+  25702, 25735, 25768, 25735, 25702, 25735, 25768, 25735,
+  25702, 25735, 25768, 25735, 25702, 25735, 25768, 25735,
+  25702, 25735, 25768, 25735, 25702, 25735, 25769, 25735,
+  25702, 25735, 25769, 25735, 25702, 25735, 25769, 25735,
+  25701, 25735, 25769, 25735, 25701, 25735, 25769, 25735,
+  25701, 25735, 25769, 25735, 25701, 25735, 25769, 25735,
+  25701, 25735, 25770, 25735, 25701, 25735, 25770, 25735,
+  25701, 25735, 25770, 25735, 25700, 25735, 25770, 25735,
+  25700, 25735, 25770, 25735, 25700, 25735, 25770, 25735,
+  25700, 25735, 25771, 25735, 25700, 25735, 25771, 25735,
+  25699, 25735, 25771, 25735, 25699, 25735, 25771, 25735,
+  25699, 25735, 25772, 25735, 25699, 25735, 25772, 25735,
+  25698, 25735, 25772, 25735, 25698, 25735, 25772, 25735,
+  25698, 25735, 25773, 25735, 25698, 25735, 25773, 25735,
+  25697, 25735, 25773, 25735, 25697, 25735, 25773, 25735,
+  25697, 25735, 25774, 25735, 25696, 25735, 25774, 25735,
+  25696, 25735, 25774, 25735, 25696, 25735, 25775, 25735,
+  25695, 25735, 25775, 25735, 25695, 25735, 25776, 25735,
+  25695, 25735, 25776, 25735, 25694, 25735, 25776, 25735,
+  25694, 25735, 25777, 25735, 25693, 25735, 25777, 25735,
+  25693, 25735, 25778, 25735, 25692, 25735, 25778, 25735,
+  25692, 25735, 25779, 25735, 25691, 25735, 25779, 25735,
+  25691, 25735, 25780, 25735, 25690, 25735, 25780, 25735,
+  25690, 25735, 25781, 25735, 25689, 25735, 25781, 25735,
+  25689, 25735, 25782, 25735, 25688, 25735, 25782, 25735,
+  25687, 25735, 25783, 25735, 25687, 25735, 25784, 25735,
+  25686, 25735, 25784, 25735, 25685, 25735, 25785, 25735,
+  25685, 25735, 25786, 25735, 25684, 25735, 25787, 25735,
+  25683, 25735, 25788, 25735, 25682, 25735, 25788, 25735,
+  25681, 25735, 25789, 25735, 25681, 25735, 25790, 25735,
+  25680, 25735, 25791, 25735, 25679, 25735, 25792, 25735,
+  25678, 25735, 25793, 25735, 25676, 25735, 25794, 25735,
+  25675, 25735, 25796, 25735, 25674, 25735, 25797, 25735,
+  25673, 25735, 25798, 25735, 25672, 25735, 25799, 25735,
+  25670, 25735, 25801, 25735, 25669, 25735, 25802, 25735,
+  25667, 25735, 25804, 25735, 25666, 25735, 25805, 25735,
+  25664, 25735, 25807, 25735, 25662, 25735, 25809, 25735,
+  25660, 25735, 25811, 25735, 25658, 25735, 25813, 25735,
+  25656, 25735, 25815, 25735, 25654, 25736, 25818, 25735,
+  25652, 25736, 25820, 25735, 25649, 25736, 25823, 25735,
+  25646, 25736, 25825, 25735, 25643, 25736, 25829, 25735,
+  25640, 25736, 25832, 25735, 25637, 25736, 25835, 25735,
+  25633, 25736, 25839, 25735, 25629, 25736, 25843, 25734,
+  25625, 25736, 25848, 25734, 25620, 25736, 25853, 25734,
+  25615, 25736, 25858, 25734, 25610, 25736, 25864, 25734,
+  25603, 25736, 25870, 25734, 25597, 25736, 25877, 25734,
+  25589, 25736, 25885, 25734, 25581, 25737, 25894, 25734,
+  25571, 25737, 25904, 25733, 25560, 25737, 25916, 25733,
+  25548, 25737, 25929, 25733, 25534, 25738, 25944, 25732,
+  25517, 25738, 25963, 25732, 25497, 25739, 25984, 25731,
+  25474, 25739, 26010, 25730, 25445, 25741, 26042, 25729,
+  25409, 25742, 26083, 25727, 25363, 25744, 26136, 25725,
+  25301, 25748, 26209, 25720, 25214, 25753, 26313, 25712,
+  25085, 25764, 26477, 25696, 24871, 25789, 26770, 25655,
+  24447, 25865, 27439, 25490, 23234, 26351, 30341, 22458,
+  0, -22458, -30341, -26351, -23234, -25490, -27439, -25865,
+  -24447, -25655, -26770, -25789, -24871, -25696, -26477, -25764,
+  -25085, -25712, -26313, -25753, -25214, -25720, -26209, -25748,
+  -25301, -25725, -26136, -25744, -25363, -25727, -26083, -25742,
+  -25409, -25729, -26042, -25741, -25445, -25730, -26010, -25739,
+  -25474, -25731, -25984, -25739, -25497, -25732, -25963, -25738,
+  -25517, -25732, -25944, -25738, -25534, -25733, -25929, -25737,
+  -25548, -25733, -25916, -25737, -25560, -25733, -25904, -25737,
+  -25571, -25734, -25894, -25737, -25581, -25734, -25885, -25736,
+  -25589, -25734, -25877, -25736, -25597, -25734, -25870, -25736,
+  -25603, -25734, -25864, -25736, -25610, -25734, -25858, -25736,
+  -25615, -25734, -25853, -25736, -25620, -25734, -25848, -25736,
+  -25625, -25734, -25843, -25736, -25629, -25735, -25839, -25736,
+  -25633, -25735, -25835, -25736, -25637, -25735, -25832, -25736,
+  -25640, -25735, -25829, -25736, -25643, -25735, -25825, -25736,
+  -25646, -25735, -25823, -25736, -25649, -25735, -25820, -25736,
+  -25652, -25735, -25818, -25736, -25654, -25735, -25815, -25735,
+  -25656, -25735, -25813, -25735, -25658, -25735, -25811, -25735,
+  -25660, -25735, -25809, -25735, -25662, -25735, -25807, -25735,
+  -25664, -25735, -25805, -25735, -25666, -25735, -25804, -25735,
+  -25667, -25735, -25802, -25735, -25669, -25735, -25801, -25735,
+  -25670, -25735, -25799, -25735, -25672, -25735, -25798, -25735,
+  -25673, -25735, -25797, -25735, -25674, -25735, -25796, -25735,
+  -25675, -25735, -25794, -25735, -25676, -25735, -25793, -25735,
+  -25678, -25735, -25792, -25735, -25679, -25735, -25791, -25735,
+  -25680, -25735, -25790, -25735, -25681, -25735, -25789, -25735,
+  -25681, -25735, -25788, -25735, -25682, -25735, -25788, -25735,
+  -25683, -25735, -25787, -25735, -25684, -25735, -25786, -25735,
+  -25685, -25735, -25785, -25735, -25685, -25735, -25784, -25735,
+  -25686, -25735, -25784, -25735, -25687, -25735, -25783, -25735,
+  -25687, -25735, -25782, -25735, -25688, -25735, -25782, -25735,
+  -25689, -25735, -25781, -25735, -25689, -25735, -25781, -25735,
+  -25690, -25735, -25780, -25735, -25690, -25735, -25780, -25735,
+  -25691, -25735, -25779, -25735, -25691, -25735, -25779, -25735,
+  -25692, -25735, -25778, -25735, -25692, -25735, -25778, -25735,
+  -25693, -25735, -25777, -25735, -25693, -25735, -25777, -25735,
+  -25694, -25735, -25776, -25735, -25694, -25735, -25776, -25735,
+  -25695, -25735, -25776, -25735, -25695, -25735, -25775, -25735,
+  -25695, -25735, -25775, -25735, -25696, -25735, -25774, -25735,
+  -25696, -25735, -25774, -25735, -25696, -25735, -25774, -25735,
+  -25697, -25735, -25773, -25735, -25697, -25735, -25773, -25735,
+  -25697, -25735, -25773, -25735, -25698, -25735, -25773, -25735,
+  -25698, -25735, -25772, -25735, -25698, -25735, -25772, -25735,
+  -25698, -25735, -25772, -25735, -25699, -25735, -25772, -25735,
+  -25699, -25735, -25771, -25735, -25699, -25735, -25771, -25735,
+  -25699, -25735, -25771, -25735, -25700, -25735, -25771, -25735,
+  -25700, -25735, -25770, -25735, -25700, -25735, -25770, -25735,
+  -25700, -25735, -25770, -25735, -25700, -25735, -25770, -25735,
+  -25701, -25735, -25770, -25735, -25701, -25735, -25770, -25735,
+  -25701, -25735, -25769, -25735, -25701, -25735, -25769, -25735,
+  -25701, -25735, -25769, -25735, -25701, -25735, -25769, -25735,
+  -25701, -25735, -25769, -25735, -25702, -25735, -25769, -25735,
+  -25702, -25735, -25769, -25735, -25702, -25735, -25768, -25735,
+  -25702, -25735, -25768, -25735, -25702, -25735, -25768, -25735,
+  -25702, -25735, -25768, -25735, -25702, -25735, -25768, -25735,
+  -25702, -25735, -25768, -25735, -25702, -25735, -25768, -25735,
+  -25703, -25735, -25768, -25735, -25703, -25735, -25768, -25735,
+  -25703, -25735, -25768, -25735, -25703, -25735, -25768, -25735,
+  -25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+  -25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+  -25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+  -25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+  -25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+  -25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+  -25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+  -25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+  -25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+  -25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+  -25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+  -25703, -25735, -25767, -25735, -25703, -25735, -25767, -25735,
+  -25703, -25735, -25768, -25735, -25703, -25735, -25768, -25735,
+  -25703, -25735, -25768, -25735, -25703, -25735, -25768, -25735,
+  -25703, -25735, -25768, -25735, -25702, -25735, -25768, -25735,
+  -25702, -25735, -25768, -25735, -25702, -25735, -25768, -25735,
+  -25702, -25735, -25768, -25735, -25702, -25735, -25768, -25735,
+  -25702, -25735, -25768, -25735, -25702, -25735, -25769, -25735,
+  -25702, -25735, -25769, -25735, -25702, -25735, -25769, -25735,
+  -25701, -25735, -25769, -25735, -25701, -25735, -25769, -25735,
+  -25701, -25735, -25769, -25735, -25701, -25735, -25769, -25735,
+  -25701, -25735, -25770, -25735, -25701, -25735, -25770, -25735,
+  -25701, -25735, -25770, -25735, -25700, -25735, -25770, -25735,
+  -25700, -25735, -25770, -25735, -25700, -25735, -25770, -25735,
+  -25700, -25735, -25771, -25735, -25700, -25735, -25771, -25735,
+  -25699, -25735, -25771, -25735, -25699, -25735, -25771, -25735,
+  -25699, -25735, -25772, -25735, -25699, -25735, -25772, -25735,
+  -25698, -25735, -25772, -25735, -25698, -25735, -25772, -25735,
+  -25698, -25735, -25773, -25735, -25698, -25735, -25773, -25735,
+  -25697, -25735, -25773, -25735, -25697, -25735, -25773, -25735,
+  -25697, -25735, -25774, -25735, -25696, -25735, -25774, -25735,
+  -25696, -25735, -25774, -25735, -25696, -25735, -25775, -25735,
+  -25695, -25735, -25775, -25735, -25695, -25735, -25776, -25735,
+  -25695, -25735, -25776, -25735, -25694, -25735, -25776, -25735,
+  -25694, -25735, -25777, -25735, -25693, -25735, -25777, -25735,
+  -25693, -25735, -25778, -25735, -25692, -25735, -25778, -25735,
+  -25692, -25735, -25779, -25735, -25691, -25735, -25779, -25735,
+  -25691, -25735, -25780, -25735, -25690, -25735, -25780, -25735,
+  -25690, -25735, -25781, -25735, -25689, -25735, -25781, -25735,
+  -25689, -25735, -25782, -25735, -25688, -25735, -25782, -25735,
+  -25687, -25735, -25783, -25735, -25687, -25735, -25784, -25735,
+  -25686, -25735, -25784, -25735, -25685, -25735, -25785, -25735,
+  -25685, -25735, -25786, -25735, -25684, -25735, -25787, -25735,
+  -25683, -25735, -25788, -25735, -25682, -25735, -25788, -25735,
+  -25681, -25735, -25789, -25735, -25681, -25735, -25790, -25735,
+  -25680, -25735, -25791, -25735, -25679, -25735, -25792, -25735,
+  -25678, -25735, -25793, -25735, -25676, -25735, -25794, -25735,
+  -25675, -25735, -25796, -25735, -25674, -25735, -25797, -25735,
+  -25673, -25735, -25798, -25735, -25672, -25735, -25799, -25735,
+  -25670, -25735, -25801, -25735, -25669, -25735, -25802, -25735,
+  -25667, -25735, -25804, -25735, -25666, -25735, -25805, -25735,
+  -25664, -25735, -25807, -25735, -25662, -25735, -25809, -25735,
+  -25660, -25735, -25811, -25735, -25658, -25735, -25813, -25735,
+  -25656, -25735, -25815, -25735, -25654, -25736, -25818, -25735,
+  -25652, -25736, -25820, -25735, -25649, -25736, -25823, -25735,
+  -25646, -25736, -25825, -25735, -25643, -25736, -25829, -25735,
+  -25640, -25736, -25832, -25735, -25637, -25736, -25835, -25735,
+  -25633, -25736, -25839, -25735, -25629, -25736, -25843, -25734,
+  -25625, -25736, -25848, -25734, -25620, -25736, -25853, -25734,
+  -25615, -25736, -25858, -25734, -25610, -25736, -25864, -25734,
+  -25603, -25736, -25870, -25734, -25597, -25736, -25877, -25734,
+  -25589, -25736, -25885, -25734, -25581, -25737, -25894, -25734,
+  -25571, -25737, -25904, -25733, -25560, -25737, -25916, -25733,
+  -25548, -25737, -25929, -25733, -25534, -25738, -25944, -25732,
+  -25517, -25738, -25963, -25732, -25497, -25739, -25984, -25731,
+  -25474, -25739, -26010, -25730, -25445, -25741, -26042, -25729,
+  -25409, -25742, -26083, -25727, -25363, -25744, -26136, -25725,
+  -25301, -25748, -26209, -25720, -25214, -25753, -26313, -25712,
+  -25085, -25764, -26477, -25696, -24871, -25789, -26770, -25655,
+  -24447, -25865, -27439, -25490, -23234, -26351, -30341, -22458,
+  0
+};
+
+static const int16_t hifi_wavetable_square_1[2049] =
+{
+  0, 12435, 22458, 28503, 30341, 29027, 26351, 24067,
+  23234, 23940, 25490, 26900, 27439, 26956, 25865, 24845,
+  24446, 24813, 25655, 26455, 26771, 26475, 25789, 25132,
+  24870, 25118, 25696, 26254, 26478, 26265, 25764, 25280,
+  25084, 25272, 25712, 26141, 26314, 26147, 25753, 25369,
+  25213, 25364, 25720, 26068, 26210, 26073, 25748, 25429,
+  25300, 25426, 25725, 26018, 26138, 26021, 25744, 25472,
+  25361, 25470, 25727, 25981, 26084, 25983, 25742, 25504,
+  25407, 25502, 25729, 25953, 26044, 25954, 25741, 25530,
+  25443, 25528, 25730, 25930, 26012, 25932, 25739, 25550,
+  25472, 25548, 25731, 25912, 25986, 25913, 25739, 25566,
+  25495, 25565, 25732, 25897, 25965, 25898, 25738, 25580,
+  25515, 25579, 25732, 25885, 25947, 25885, 25738, 25591,
+  25531, 25591, 25733, 25874, 25932, 25875, 25737, 25601,
+  25545, 25601, 25733, 25865, 25919, 25865, 25737, 25610,
+  25557, 25609, 25733, 25857, 25907, 25857, 25737, 25617,
+  25568, 25617, 25734, 25850, 25898, 25850, 25737, 25624,
+  25577, 25623, 25734, 25844, 25889, 25844, 25736, 25630,
+  25585, 25629, 25734, 25838, 25881, 25838, 25736, 25635,
+  25593, 25634, 25734, 25833, 25874, 25834, 25736, 25639,
+  25599, 25639, 25734, 25829, 25868, 25829, 25736, 25643,
+  25605, 25643, 25734, 25825, 25862, 25825, 25736, 25647,
+  25611, 25647, 25734, 25821, 25857, 25822, 25736, 25651,
+  25616, 25650, 25734, 25818, 25852, 25818, 25736, 25654,
+  25620, 25654, 25734, 25815, 25848, 25815, 25736, 25657,
+  25624, 25656, 25735, 25812, 25844, 25812, 25736, 25659,
+  25628, 25659, 25735, 25810, 25841, 25810, 25736, 25662,
+  25631, 25662, 25735, 25807, 25838, 25808, 25736, 25664,
+  25634, 25664, 25735, 25805, 25835, 25805, 25736, 25666,
+  25637, 25666, 25735, 25803, 25832, 25804, 25736, 25668,
+  25640, 25668, 25735, 25802, 25829, 25802, 25736, 25670,
+  25642, 25669, 25735, 25800, 25827, 25800, 25736, 25671,
+  25645, 25671, 25735, 25798, 25825, 25798, 25735, 25673,
+  25647, 25673, 25735, 25797, 25822, 25797, 25735, 25674,
+  25649, 25674, 25735, 25796, 25821, 25796, 25735, 25675,
+  25651, 25675, 25735, 25794, 25819, 25794, 25735, 25677,
+  25652, 25677, 25735, 25793, 25817, 25793, 25735, 25678,
+  25654, 25678, 25735, 25792, 25816, 25792, 25735, 25679,
+  25655, 25679, 25735, 25791, 25814, 25791, 25735, 25680,
+  25657, 25680, 25735, 25790, 25813, 25790, 25735, 25681,
+  25658, 25681, 25735, 25789, 25811, 25789, 25735, 25682,
+  25659, 25682, 25735, 25788, 25810, 25788, 25735, 25682,
+  25661, 25682, 25735, 25787, 25809, 25788, 25735, 25683,
+  25662, 25683, 25735, 25787, 25808, 25787, 25735, 25684,
+  25663, 25684, 25735, 25786, 25807, 25786, 25735, 25685,
+  25663, 25684, 25735, 25785, 25806, 25786, 25735, 25685,
+  25664, 25685, 25735, 25785, 25806, 25785, 25735, 25686,
+  25665, 25686, 25735, 25784, 25805, 25784, 25735, 25686,
+  25666, 25686, 25735, 25784, 25804, 25784, 25735, 25687,
+  25667, 25687, 25735, 25783, 25803, 25783, 25735, 25687,
+  25667, 25687, 25735, 25783, 25803, 25783, 25735, 25687,
+  25668, 25687, 25735, 25783, 25802, 25783, 25735, 25688,
+  25668, 25688, 25735, 25782, 25802, 25782, 25735, 25688,
+  25669, 25688, 25735, 25782, 25801, 25782, 25735, 25689,
+  25669, 25688, 25735, 25782, 25801, 25782, 25735, 25689,
+  25670, 25689, 25735, 25781, 25801, 25781, 25735, 25689,
+  25670, 25689, 25735, 25781, 25800, 25781, 25735, 25689,
+  25670, 25689, 25735, 25781, 25800, 25781, 25735, 25689,
+  25670, 25689, 25735, 25781, 25800, 25781, 25735, 25690,
+  25671, 25690, 25735, 25781, 25800, 25781, 25735, 25690,
+  25671, 25690, 25735, 25781, 25799, 25781, 25735, 25690,
+  25671, 25690, 25735, 25780, 25799, 25780, 25735, 25690,
+  25671, 25690, 25735, 25780, 25799, 25780, 25735, 25690,
+  25671, 25690, 25735, 25780, 25799, 25780, 25735, 25690,
+  25671, 25690, 25735, 25780, 25799, 25780, 25735, 25690,
+  25671, 25690, 25735, 25780, 25799, 25780, 25735, 25690,
+  25671, 25690, 25735, 25780, 25799, 25780, 25735, 25690,
+  25671, 25690, 25735, 25781, 25799, 25781, 25735, 25690,
+  25671, 25690, 25735, 25781, 25800, 25781, 25735, 25690,
+  25671, 25690, 25735, 25781, 25800, 25781, 25735, 25689,
+  25670, 25689, 25735, 25781, 25800, 25781, 25735, 25689,
+  25670, 25689, 25735, 25781, 25800, 25781, 25735, 25689,
+  25670, 25689, 25735, 25781, 25801, 25781, 25735, 25689,
+  25670, 25689, 25735, 25782, 25801, 25782, 25735, 25688,
+  25669, 25689, 25735, 25782, 25801, 25782, 25735, 25688,
+  25669, 25688, 25735, 25782, 25802, 25782, 25735, 25688,
+  25668, 25688, 25735, 25783, 25802, 25783, 25735, 25687,
+  25668, 25687, 25735, 25783, 25803, 25783, 25735, 25687,
+  25667, 25687, 25735, 25783, 25803, 25783, 25735, 25687,
+  25667, 25687, 25735, 25784, 25804, 25784, 25735, 25686,
+  25666, 25686, 25735, 25784, 25805, 25784, 25735, 25686,
+  25665, 25686, 25735, 25785, 25806, 25785, 25735, 25685,
+  25664, 25685, 25735, 25786, 25806, 25785, 25735, 25684,
+  25663, 25685, 25735, 25786, 25807, 25786, 25735, 25684,
+  25663, 25684, 25735, 25787, 25808, 25787, 25735, 25683,
+  25662, 25683, 25735, 25788, 25809, 25787, 25735, 25682,
+  25661, 25682, 25735, 25788, 25810, 25788, 25735, 25682,
+  25659, 25682, 25735, 25789, 25811, 25789, 25735, 25681,
+  25658, 25681, 25735, 25790, 25813, 25790, 25735, 25680,
+  25657, 25680, 25735, 25791, 25814, 25791, 25735, 25679,
+  25655, 25679, 25735, 25792, 25816, 25792, 25735, 25678,
+  25654, 25678, 25735, 25793, 25817, 25793, 25735, 25677,
+  25652, 25677, 25735, 25794, 25819, 25794, 25735, 25675,
+  25651, 25675, 25735, 25796, 25821, 25796, 25735, 25674,
+  25649, 25674, 25735, 25797, 25822, 25797, 25735, 25673,
+  25647, 25673, 25735, 25798, 25825, 25798, 25735, 25671,
+  25645, 25671, 25736, 25800, 25827, 25800, 25735, 25669,
+  25642, 25670, 25736, 25802, 25829, 25802, 25735, 25668,
+  25640, 25668, 25736, 25804, 25832, 25803, 25735, 25666,
+  25637, 25666, 25736, 25805, 25835, 25805, 25735, 25664,
+  25634, 25664, 25736, 25808, 25838, 25807, 25735, 25662,
+  25631, 25662, 25736, 25810, 25841, 25810, 25735, 25659,
+  25628, 25659, 25736, 25812, 25844, 25812, 25735, 25656,
+  25624, 25657, 25736, 25815, 25848, 25815, 25734, 25654,
+  25620, 25654, 25736, 25818, 25852, 25818, 25734, 25650,
+  25616, 25651, 25736, 25822, 25857, 25821, 25734, 25647,
+  25611, 25647, 25736, 25825, 25862, 25825, 25734, 25643,
+  25605, 25643, 25736, 25829, 25868, 25829, 25734, 25639,
+  25599, 25639, 25736, 25834, 25874, 25833, 25734, 25634,
+  25593, 25635, 25736, 25838, 25881, 25838, 25734, 25629,
+  25585, 25630, 25736, 25844, 25889, 25844, 25734, 25623,
+  25577, 25624, 25737, 25850, 25898, 25850, 25734, 25617,
+  25568, 25617, 25737, 25857, 25907, 25857, 25733, 25609,
+  25557, 25610, 25737, 25865, 25919, 25865, 25733, 25601,
+  25545, 25601, 25737, 25875, 25932, 25874, 25733, 25591,
+  25531, 25591, 25738, 25885, 25947, 25885, 25732, 25579,
+  25515, 25580, 25738, 25898, 25965, 25897, 25732, 25565,
+  25495, 25566, 25739, 25913, 25986, 25912, 25731, 25548,
+  25472, 25550, 25739, 25932, 26012, 25930, 25730, 25528,
+  25443, 25530, 25741, 25954, 26044, 25953, 25729, 25502,
+  25407, 25504, 25742, 25983, 26084, 25981, 25727, 25470,
+  25361, 25472, 25744, 26021, 26138, 26018, 25725, 25426,
+  25300, 25429, 25748, 26073, 26210, 26068, 25720, 25364,
+  25213, 25369, 25753, 26147, 26314, 26141, 25712, 25272,
+  25084, 25280, 25764, 26265, 26478, 26254, 25696, 25118,
+  24870, 25132, 25789, 26475, 26771, 26455, 25655, 24813,
+  24446, 24845, 25865, 26956, 27439, 26900, 25490, 23940,
+  23234, 24067, 26351, 29027, 30341, 28503, 22458, 12435,
+  0, -12435, -22458, -28503, -30341, -29027, -26351, -24067,
+  -23234, -23940, -25490, -26900, -27439, -26956, -25865, -24845,
+  -24446, -24813, -25655, -26455, -26771, -26475, -25789, -25132,
+  -24870, -25118, -25696, -26254, -26478, -26265, -25764, -25280,
+  -25084, -25272, -25712, -26141, -26314, -26147, -25753, -25369,
+  -25213, -25364, -25720, -26068, -26210, -26073, -25748, -25429,
+  -25300, -25426, -25725, -26018, -26138, -26021, -25744, -25472,
+  -25361, -25470, -25727, -25981, -26084, -25983, -25742, -25504,
+  -25407, -25502, -25729, -25953, -26044, -25954, -25741, -25530,
+  -25443, -25528, -25730, -25930, -26012, -25932, -25739, -25550,
+  -25472, -25548, -25731, -25912, -25986, -25913, -25739, -25566,
+  -25495, -25565, -25732, -25897, -25965, -25898, -25738, -25580,
+  -25515, -25579, -25732, -25885, -25947, -25885, -25738, -25591,
+  -25531, -25591, -25733, -25874, -25932, -25875, -25737, -25601,
+  -25545, -25601, -25733, -25865, -25919, -25865, -25737, -25610,
+  -25557, -25609, -25733, -25857, -25907, -25857, -25737, -25617,
+  -25568, -25617, -25734, -25850, -25898, -25850, -25737, -25624,
+  -25577, -25623, -25734, -25844, -25889, -25844, -25736, -25630,
+  -25585, -25629, -25734, -25838, -25881, -25838, -25736, -25635,
+  -25593, -25634, -25734, -25833, -25874, -25834, -25736, -25639,
+  -25599, -25639, -25734, -25829, -25868, -25829, -25736, -25643,
+  -25605, -25643, -25734, -25825, -25862, -25825, -25736, -25647,
+  -25611, -25647, -25734, -25821, -25857, -25822, -25736, -25651,
+  -25616, -25650, -25734, -25818, -25852, -25818, -25736, -25654,
+  -25620, -25654, -25734, -25815, -25848, -25815, -25736, -25657,
+  -25624, -25656, -25735, -25812, -25844, -25812, -25736, -25659,
+  -25628, -25659, -25735, -25810, -25841, -25810, -25736, -25662,
+  -25631, -25662, -25735, -25807, -25838, -25808, -25736, -25664,
+  -25634, -25664, -25735, -25805, -25835, -25805, -25736, -25666,
+  -25637, -25666, -25735, -25803, -25832, -25804, -25736, -25668,
+  -25640, -25668, -25735, -25802, -25829, -25802, -25736, -25670,
+  -25642, -25669, -25735, -25800, -25827, -25800, -25736, -25671,
+  -25645, -25671, -25735, -25798, -25825, -25798, -25735, -25673,
+  -25647, -25673, -25735, -25797, -25822, -25797, -25735, -25674,
+  -25649, -25674, -25735, -25796, -25821, -25796, -25735, -25675,
+  -25651, -25675, -25735, -25794, -25819, -25794, -25735, -25677,
+  -25652, -25677, -25735, -25793, -25817, -25793, -25735, -25678,
+  -25654, -25678, -25735, -25792, -25816, -25792, -25735, -25679,
+  -25655, -25679, -25735, -25791, -25814, -25791, -25735, -25680,
+  -25657, -25680, -25735, -25790, -25813, -25790, -25735, -25681,
+  -25658, -25681, -25735, -25789, -25811, -25789, -25735, -25682,
+  -25659, -25682, -25735, -25788, -25810, -25788, -25735, -25682,
+  -25661, -25682, -25735, -25787, -25809, -25788, -25735, -25683,
+  -25662, -25683, -25735, -25787, -25808, -25787, -25735, -25684,
+  -25663, -25684, -25735, -25786, -25807, -25786, -25735, -25685,
+  -25663, -25684, -25735, -25785, -25806, -25786, -25735, -25685,
+  -25664, -25685, -25735, -25785, -25806, -25785, -25735, -25686,
+  -25665, -25686, -25735, -25784, -25805, -25784, -25735, -25686,
+  -25666, -25686, -25735, -25784, -25804, -25784, -25735, -25687,
+  -25667, -25687, -25735, -25783, -25803, -25783, -25735, -25687,
+  -25667, -25687, -25735, -25783, -25803, -25783, -25735, -25687,
+  -25668, -25687, -25735, -25783, -25802, -25783, -25735, -25688,
+  -25668, -25688, -25735, -25782, -25802, -25782, -25735, -25688,
+  -25669, -25688, -25735, -25782, -25801, -25782, -25735, -25689,
+  -25669, -25688, -25735, -25782, -25801, -25782, -25735, -25689,
+  -25670, -25689, -25735, -25781, -25801, -25781, -25735, -25689,
+  -25670, -25689, -25735, -25781, -25800, -25781, -25735, -25689,
+  -25670, -25689, -25735, -25781, -25800, -25781, -25735, -25689,
+  -25670, -25689, -25735, -25781, -25800, -25781, -25735, -25690,
+  -25671, -25690, -25735, -25781, -25800, -25781, -25735, -25690,
+  -25671, -25690, -25735, -25781, -25799, -25781, -25735, -25690,
+  -25671, -25690, -25735, -25780, -25799, -25780, -25735, -25690,
+  -25671, -25690, -25735, -25780, -25799, -25780, -25735, -25690,
+  -25671, -25690, -25735, -25780, -25799, -25780, -25735, -25690,
+  -25671, -25690, -25735, -25780, -25799, -25780, -25735, -25690,
+  -25671, -25690, -25735, -25780, -25799, -25780, -25735, -25690,
+  -25671, -25690, -25735, -25780, -25799, -25780, -25735, -25690,
+  -25671, -25690, -25735, -25781, -25799, -25781, -25735, -25690,
+  -25671, -25690, -25735, -25781, -25800, -25781, -25735, -25690,
+  -25671, -25690, -25735, -25781, -25800, -25781, -25735, -25689,
+  -25670, -25689, -25735, -25781, -25800, -25781, -25735, -25689,
+  -25670, -25689, -25735, -25781, -25800, -25781, -25735, -25689,
+  -25670, -25689, -25735, -25781, -25801, -25781, -25735, -25689,
+  -25670, -25689, -25735, -25782, -25801, -25782, -25735, -25688,
+  -25669, -25689, -25735, -25782, -25801, -25782, -25735, -25688,
+  -25669, -25688, -25735, -25782, -25802, -25782, -25735, -25688,
+  -25668, -25688, -25735, -25783, -25802, -25783, -25735, -25687,
+  -25668, -25687, -25735, -25783, -25803, -25783, -25735, -25687,
+  -25667, -25687, -25735, -25783, -25803, -25783, -25735, -25687,
+  -25667, -25687, -25735, -25784, -25804, -25784, -25735, -25686,
+  -25666, -25686, -25735, -25784, -25805, -25784, -25735, -25686,
+  -25665, -25686, -25735, -25785, -25806, -25785, -25735, -25685,
+  -25664, -25685, -25735, -25786, -25806, -25785, -25735, -25684,
+  -25663, -25685, -25735, -25786, -25807, -25786, -25735, -25684,
+  -25663, -25684, -25735, -25787, -25808, -25787, -25735, -25683,
+  -25662, -25683, -25735, -25788, -25809, -25787, -25735, -25682,
+  -25661, -25682, -25735, -25788, -25810, -25788, -25735, -25682,
+  -25659, -25682, -25735, -25789, -25811, -25789, -25735, -25681,
+  -25658, -25681, -25735, -25790, -25813, -25790, -25735, -25680,
+  -25657, -25680, -25735, -25791, -25814, -25791, -25735, -25679,
+  -25655, -25679, -25735, -25792, -25816, -25792, -25735, -25678,
+  -25654, -25678, -25735, -25793, -25817, -25793, -25735, -25677,
+  -25652, -25677, -25735, -25794, -25819, -25794, -25735, -25675,
+  -25651, -25675, -25735, -25796, -25821, -25796, -25735, -25674,
+  -25649, -25674, -25735, -25797, -25822, -25797, -25735, -25673,
+  -25647, -25673, -25735, -25798, -25825, -25798, -25735, -25671,
+  -25645, -25671, -25736, -25800, -25827, -25800, -25735, -25669,
+  -25642, -25670, -25736, -25802, -25829, -25802, -25735, -25668,
+  -25640, -25668, -25736, -25804, -25832, -25803, -25735, -25666,
+  -25637, -25666, -25736, -25805, -25835, -25805, -25735, -25664,
+  -25634, -25664, -25736, -25808, -25838, -25807, -25735, -25662,
+  -25631, -25662, -25736, -25810, -25841, -25810, -25735, -25659,
+  -25628, -25659, -25736, -25812, -25844, -25812, -25735, -25656,
+  -25624, -25657, -25736, -25815, -25848, -25815, -25734, -25654,
+  -25620, -25654, -25736, -25818, -25852, -25818, -25734, -25650,
+  -25616, -25651, -25736, -25822, -25857, -25821, -25734, -25647,
+  -25611, -25647, -25736, -25825, -25862, -25825, -25734, -25643,
+  -25605, -25643, -25736, -25829, -25868, -25829, -25734, -25639,
+  -25599, -25639, -25736, -25834, -25874, -25833, -25734, -25634,
+  -25593, -25635, -25736, -25838, -25881, -25838, -25734, -25629,
+  -25585, -25630, -25736, -25844, -25889, -25844, -25734, -25623,
+  -25577, -25624, -25737, -25850, -25898, -25850, -25734, -25617,
+  -25568, -25617, -25737, -25857, -25907, -25857, -25733, -25609,
+  -25557, -25610, -25737, -25865, -25919, -25865, -25733, -25601,
+  -25545, -25601, -25737, -25875, -25932, -25874, -25733, -25591,
+  -25531, -25591, -25738, -25885, -25947, -25885, -25732, -25579,
+  -25515, -25580, -25738, -25898, -25965, -25897, -25732, -25565,
+  -25495, -25566, -25739, -25913, -25986, -25912, -25731, -25548,
+  -25472, -25550, -25739, -25932, -26012, -25930, -25730, -25528,
+  -25443, -25530, -25741, -25954, -26044, -25953, -25729, -25502,
+  -25407, -25504, -25742, -25983, -26084, -25981, -25727, -25470,
+  -25361, -25472, -25744, -26021, -26138, -26018, -25725, -25426,
+  -25300, -25429, -25748, -26073, -26210, -26068, -25720, -25364,
+  -25213, -25369, -25753, -26147, -26314, -26141, -25712, -25272,
+  -25084, -25280, -25764, -26265, -26478, -26254, -25696, -25118,
+  -24870, -25132, -25789, -26475, -26771, -26455, -25655, -24813,
+  -24446, -24845, -25865, -26956, -27439, -26900, -25490, -23940,
+  -23234, -24067, -26351, -29027, -30341, -28503, -22458, -12435,
+  0
+};
+
+static const int16_t hifi_wavetable_square_2[2049] =
+{
+  0, 6379, 12435, 17874, 22458, 26026, 28504, 29908,
+  30342, 29975, 29027, 27739, 26351, 25072, 24067, 23440,
+  23233, 23424, 23940, 24671, 25490, 26270, 26901, 27304,
+  27440, 27311, 26957, 26446, 25865, 25304, 24844, 24546,
+  24445, 24542, 24812, 25205, 25656, 26094, 26456, 26692,
+  26773, 26694, 26476, 26157, 25789, 25429, 25130, 24935,
+  24868, 24933, 25116, 25385, 25697, 26002, 26256, 26423,
+  26481, 26424, 26267, 26034, 25764, 25499, 25277, 25132,
+  25081, 25131, 25269, 25474, 25713, 25947, 26144, 26273,
+  26318, 26274, 26150, 25967, 25753, 25543, 25366, 25250,
+  25209, 25249, 25361, 25527, 25720, 25911, 26072, 26177,
+  26214, 26178, 26076, 25924, 25747, 25573, 25426, 25329,
+  25295, 25328, 25422, 25562, 25725, 25886, 26022, 26111,
+  26143, 26112, 26025, 25895, 25744, 25594, 25468, 25385,
+  25356, 25384, 25466, 25586, 25727, 25867, 25985, 26063,
+  26090, 26064, 25987, 25874, 25742, 25610, 25500, 25427,
+  25401, 25426, 25498, 25604, 25729, 25853, 25957, 26027,
+  26051, 26027, 25959, 25858, 25740, 25623, 25524, 25459,
+  25436, 25459, 25523, 25618, 25730, 25842, 25936, 25998,
+  26020, 25998, 25937, 25846, 25739, 25633, 25544, 25484,
+  25464, 25484, 25543, 25630, 25731, 25833, 25918, 25975,
+  25995, 25975, 25919, 25836, 25739, 25642, 25560, 25505,
+  25486, 25505, 25559, 25638, 25732, 25825, 25904, 25956,
+  25974, 25956, 25905, 25828, 25738, 25648, 25573, 25522,
+  25505, 25522, 25572, 25646, 25733, 25819, 25892, 25940,
+  25957, 25940, 25893, 25821, 25738, 25654, 25584, 25537,
+  25520, 25537, 25583, 25652, 25733, 25814, 25882, 25927,
+  25943, 25927, 25883, 25816, 25737, 25659, 25593, 25549,
+  25533, 25549, 25592, 25657, 25733, 25809, 25873, 25916,
+  25931, 25916, 25874, 25811, 25737, 25663, 25601, 25559,
+  25545, 25559, 25600, 25661, 25734, 25805, 25866, 25907,
+  25921, 25907, 25867, 25807, 25737, 25667, 25607, 25568,
+  25554, 25568, 25607, 25665, 25734, 25802, 25860, 25898,
+  25912, 25898, 25860, 25803, 25736, 25670, 25613, 25576,
+  25562, 25576, 25613, 25668, 25734, 25799, 25854, 25891,
+  25904, 25891, 25855, 25800, 25736, 25672, 25618, 25582,
+  25570, 25582, 25618, 25671, 25734, 25797, 25850, 25885,
+  25897, 25885, 25850, 25798, 25736, 25675, 25623, 25588,
+  25576, 25588, 25622, 25674, 25734, 25795, 25846, 25880,
+  25892, 25880, 25846, 25795, 25736, 25677, 25626, 25593,
+  25581, 25593, 25626, 25676, 25734, 25793, 25842, 25875,
+  25887, 25875, 25842, 25793, 25736, 25678, 25630, 25597,
+  25586, 25597, 25630, 25678, 25734, 25791, 25839, 25871,
+  25882, 25871, 25839, 25792, 25736, 25680, 25633, 25601,
+  25590, 25601, 25632, 25679, 25735, 25790, 25836, 25868,
+  25878, 25868, 25837, 25790, 25736, 25681, 25635, 25604,
+  25594, 25604, 25635, 25681, 25735, 25788, 25834, 25864,
+  25875, 25864, 25834, 25789, 25736, 25682, 25637, 25607,
+  25597, 25607, 25637, 25682, 25735, 25787, 25832, 25862,
+  25872, 25862, 25832, 25788, 25736, 25683, 25639, 25610,
+  25599, 25610, 25639, 25683, 25735, 25787, 25830, 25860,
+  25870, 25860, 25831, 25787, 25735, 25684, 25641, 25612,
+  25601, 25612, 25641, 25684, 25735, 25786, 25829, 25858,
+  25868, 25858, 25829, 25786, 25735, 25685, 25642, 25613,
+  25603, 25613, 25642, 25685, 25735, 25785, 25828, 25856,
+  25866, 25856, 25828, 25785, 25735, 25685, 25643, 25615,
+  25605, 25615, 25643, 25685, 25735, 25785, 25827, 25855,
+  25865, 25855, 25827, 25785, 25735, 25686, 25644, 25616,
+  25606, 25616, 25644, 25686, 25735, 25784, 25826, 25854,
+  25864, 25854, 25826, 25785, 25735, 25686, 25644, 25616,
+  25607, 25616, 25644, 25686, 25735, 25784, 25826, 25854,
+  25863, 25854, 25826, 25784, 25735, 25686, 25645, 25617,
+  25607, 25617, 25645, 25686, 25735, 25784, 25826, 25853,
+  25863, 25853, 25826, 25784, 25735, 25686, 25645, 25617,
+  25607, 25617, 25645, 25686, 25735, 25784, 25826, 25853,
+  25863, 25853, 25826, 25784, 25735, 25686, 25645, 25617,
+  25607, 25617, 25645, 25686, 25735, 25784, 25826, 25854,
+  25863, 25854, 25826, 25784, 25735, 25686, 25644, 25616,
+  25607, 25616, 25644, 25686, 25735, 25785, 25826, 25854,
+  25864, 25854, 25826, 25784, 25735, 25686, 25644, 25616,
+  25606, 25616, 25644, 25686, 25735, 25785, 25827, 25855,
+  25865, 25855, 25827, 25785, 25735, 25685, 25643, 25615,
+  25605, 25615, 25643, 25685, 25735, 25785, 25828, 25856,
+  25866, 25856, 25828, 25785, 25735, 25685, 25642, 25613,
+  25603, 25613, 25642, 25685, 25735, 25786, 25829, 25858,
+  25868, 25858, 25829, 25786, 25735, 25684, 25641, 25612,
+  25601, 25612, 25641, 25684, 25735, 25787, 25831, 25860,
+  25870, 25860, 25830, 25787, 25735, 25683, 25639, 25610,
+  25599, 25610, 25639, 25683, 25736, 25788, 25832, 25862,
+  25872, 25862, 25832, 25787, 25735, 25682, 25637, 25607,
+  25597, 25607, 25637, 25682, 25736, 25789, 25834, 25864,
+  25875, 25864, 25834, 25788, 25735, 25681, 25635, 25604,
+  25594, 25604, 25635, 25681, 25736, 25790, 25837, 25868,
+  25878, 25868, 25836, 25790, 25735, 25679, 25632, 25601,
+  25590, 25601, 25633, 25680, 25736, 25792, 25839, 25871,
+  25882, 25871, 25839, 25791, 25734, 25678, 25630, 25597,
+  25586, 25597, 25630, 25678, 25736, 25793, 25842, 25875,
+  25887, 25875, 25842, 25793, 25734, 25676, 25626, 25593,
+  25581, 25593, 25626, 25677, 25736, 25795, 25846, 25880,
+  25892, 25880, 25846, 25795, 25734, 25674, 25622, 25588,
+  25576, 25588, 25623, 25675, 25736, 25798, 25850, 25885,
+  25897, 25885, 25850, 25797, 25734, 25671, 25618, 25582,
+  25570, 25582, 25618, 25672, 25736, 25800, 25855, 25891,
+  25904, 25891, 25854, 25799, 25734, 25668, 25613, 25576,
+  25562, 25576, 25613, 25670, 25736, 25803, 25860, 25898,
+  25912, 25898, 25860, 25802, 25734, 25665, 25607, 25568,
+  25554, 25568, 25607, 25667, 25737, 25807, 25867, 25907,
+  25921, 25907, 25866, 25805, 25734, 25661, 25600, 25559,
+  25545, 25559, 25601, 25663, 25737, 25811, 25874, 25916,
+  25931, 25916, 25873, 25809, 25733, 25657, 25592, 25549,
+  25533, 25549, 25593, 25659, 25737, 25816, 25883, 25927,
+  25943, 25927, 25882, 25814, 25733, 25652, 25583, 25537,
+  25520, 25537, 25584, 25654, 25738, 25821, 25893, 25940,
+  25957, 25940, 25892, 25819, 25733, 25646, 25572, 25522,
+  25505, 25522, 25573, 25648, 25738, 25828, 25905, 25956,
+  25974, 25956, 25904, 25825, 25732, 25638, 25559, 25505,
+  25486, 25505, 25560, 25642, 25739, 25836, 25919, 25975,
+  25995, 25975, 25918, 25833, 25731, 25630, 25543, 25484,
+  25464, 25484, 25544, 25633, 25739, 25846, 25937, 25998,
+  26020, 25998, 25936, 25842, 25730, 25618, 25523, 25459,
+  25436, 25459, 25524, 25623, 25740, 25858, 25959, 26027,
+  26051, 26027, 25957, 25853, 25729, 25604, 25498, 25426,
+  25401, 25427, 25500, 25610, 25742, 25874, 25987, 26064,
+  26090, 26063, 25985, 25867, 25727, 25586, 25466, 25384,
+  25356, 25385, 25468, 25594, 25744, 25895, 26025, 26112,
+  26143, 26111, 26022, 25886, 25725, 25562, 25422, 25328,
+  25295, 25329, 25426, 25573, 25747, 25924, 26076, 26178,
+  26214, 26177, 26072, 25911, 25720, 25527, 25361, 25249,
+  25209, 25250, 25366, 25543, 25753, 25967, 26150, 26274,
+  26318, 26273, 26144, 25947, 25713, 25474, 25269, 25131,
+  25081, 25132, 25277, 25499, 25764, 26034, 26267, 26424,
+  26481, 26423, 26256, 26002, 25697, 25385, 25116, 24933,
+  24868, 24935, 25130, 25429, 25789, 26157, 26476, 26694,
+  26773, 26692, 26456, 26094, 25656, 25205, 24812, 24542,
+  24445, 24546, 24844, 25304, 25865, 26446, 26957, 27311,
+  27440, 27304, 26901, 26270, 25490, 24671, 23940, 23424,
+  23233, 23440, 24067, 25072, 26351, 27739, 29027, 29975,
+  30342, 29908, 28504, 26026, 22458, 17874, 12435, 6379,
+  0, -6379, -12435, -17874, -22458, -26026, -28504, -29908,
+  -30342, -29975, -29027, -27739, -26351, -25072, -24067, -23440,
+  -23233, -23424, -23940, -24671, -25490, -26270, -26901, -27304,
+  -27440, -27311, -26957, -26446, -25865, -25304, -24844, -24546,
+  -24445, -24542, -24812, -25205, -25656, -26094, -26456, -26692,
+  -26773, -26694, -26476, -26157, -25789, -25429, -25130, -24935,
+  -24868, -24933, -25116, -25385, -25697, -26002, -26256, -26423,
+  -26481, -26424, -26267, -26034, -25764, -25499, -25277, -25132,
+  -25081, -25131, -25269, -25474, -25713, -25947, -26144, -26273,
+  -26318, -26274, -26150, -25967, -25753, -25543, -25366, -25250,
+  -25209, -25249, -25361, -25527, -25720, -25911, -26072, -26177,
+  -26214, -26178, -26076, -25924, -25747, -25573, -25426, -25329,
+  -25295, -25328, -25422, -25562, -25725, -25886, -26022, -26111,
+  -26143, -26112, -26025, -25895, -25744, -25594, -25468, -25385,
+  -25356, -25384, -25466, -25586, -25727, -25867, -25985, -26063,
+  -26090, -26064, -25987, -25874, -25742, -25610, -25500, -25427,
+  -25401, -25426, -25498, -25604, -25729, -25853, -25957, -26027,
+  -26051, -26027, -25959, -25858, -25740, -25623, -25524, -25459,
+  -25436, -25459, -25523, -25618, -25730, -25842, -25936, -25998,
+  -26020, -25998, -25937, -25846, -25739, -25633, -25544, -25484,
+  -25464, -25484, -25543, -25630, -25731, -25833, -25918, -25975,
+  -25995, -25975, -25919, -25836, -25739, -25642, -25560, -25505,
+  -25486, -25505, -25559, -25638, -25732, -25825, -25904, -25956,
+  -25974, -25956, -25905, -25828, -25738, -25648, -25573, -25522,
+  -25505, -25522, -25572, -25646, -25733, -25819, -25892, -25940,
+  -25957, -25940, -25893, -25821, -25738, -25654, -25584, -25537,
+  -25520, -25537, -25583, -25652, -25733, -25814, -25882, -25927,
+  -25943, -25927, -25883, -25816, -25737, -25659, -25593, -25549,
+  -25533, -25549, -25592, -25657, -25733, -25809, -25873, -25916,
+  -25931, -25916, -25874, -25811, -25737, -25663, -25601, -25559,
+  -25545, -25559, -25600, -25661, -25734, -25805, -25866, -25907,
+  -25921, -25907, -25867, -25807, -25737, -25667, -25607, -25568,
+  -25554, -25568, -25607, -25665, -25734, -25802, -25860, -25898,
+  -25912, -25898, -25860, -25803, -25736, -25670, -25613, -25576,
+  -25562, -25576, -25613, -25668, -25734, -25799, -25854, -25891,
+  -25904, -25891, -25855, -25800, -25736, -25672, -25618, -25582,
+  -25570, -25582, -25618, -25671, -25734, -25797, -25850, -25885,
+  -25897, -25885, -25850, -25798, -25736, -25675, -25623, -25588,
+  -25576, -25588, -25622, -25674, -25734, -25795, -25846, -25880,
+  -25892, -25880, -25846, -25795, -25736, -25677, -25626, -25593,
+  -25581, -25593, -25626, -25676, -25734, -25793, -25842, -25875,
+  -25887, -25875, -25842, -25793, -25736, -25678, -25630, -25597,
+  -25586, -25597, -25630, -25678, -25734, -25791, -25839, -25871,
+  -25882, -25871, -25839, -25792, -25736, -25680, -25633, -25601,
+  -25590, -25601, -25632, -25679, -25735, -25790, -25836, -25868,
+  -25878, -25868, -25837, -25790, -25736, -25681, -25635, -25604,
+  -25594, -25604, -25635, -25681, -25735, -25788, -25834, -25864,
+  -25875, -25864, -25834, -25789, -25736, -25682, -25637, -25607,
+  -25597, -25607, -25637, -25682, -25735, -25787, -25832, -25862,
+  -25872, -25862, -25832, -25788, -25736, -25683, -25639, -25610,
+  -25599, -25610, -25639, -25683, -25735, -25787, -25830, -25860,
+  -25870, -25860, -25831, -25787, -25735, -25684, -25641, -25612,
+  -25601, -25612, -25641, -25684, -25735, -25786, -25829, -25858,
+  -25868, -25858, -25829, -25786, -25735, -25685, -25642, -25613,
+  -25603, -25613, -25642, -25685, -25735, -25785, -25828, -25856,
+  -25866, -25856, -25828, -25785, -25735, -25685, -25643, -25615,
+  -25605, -25615, -25643, -25685, -25735, -25785, -25827, -25855,
+  -25865, -25855, -25827, -25785, -25735, -25686, -25644, -25616,
+  -25606, -25616, -25644, -25686, -25735, -25784, -25826, -25854,
+  -25864, -25854, -25826, -25785, -25735, -25686, -25644, -25616,
+  -25607, -25616, -25644, -25686, -25735, -25784, -25826, -25854,
+  -25863, -25854, -25826, -25784, -25735, -25686, -25645, -25617,
+  -25607, -25617, -25645, -25686, -25735, -25784, -25826, -25853,
+  -25863, -25853, -25826, -25784, -25735, -25686, -25645, -25617,
+  -25607, -25617, -25645, -25686, -25735, -25784, -25826, -25853,
+  -25863, -25853, -25826, -25784, -25735, -25686, -25645, -25617,
+  -25607, -25617, -25645, -25686, -25735, -25784, -25826, -25854,
+  -25863, -25854, -25826, -25784, -25735, -25686, -25644, -25616,
+  -25607, -25616, -25644, -25686, -25735, -25785, -25826, -25854,
+  -25864, -25854, -25826, -25784, -25735, -25686, -25644, -25616,
+  -25606, -25616, -25644, -25686, -25735, -25785, -25827, -25855,
+  -25865, -25855, -25827, -25785, -25735, -25685, -25643, -25615,
+  -25605, -25615, -25643, -25685, -25735, -25785, -25828, -25856,
+  -25866, -25856, -25828, -25785, -25735, -25685, -25642, -25613,
+  -25603, -25613, -25642, -25685, -25735, -25786, -25829, -25858,
+  -25868, -25858, -25829, -25786, -25735, -25684, -25641, -25612,
+  -25601, -25612, -25641, -25684, -25735, -25787, -25831, -25860,
+  -25870, -25860, -25830, -25787, -25735, -25683, -25639, -25610,
+  -25599, -25610, -25639, -25683, -25736, -25788, -25832, -25862,
+  -25872, -25862, -25832, -25787, -25735, -25682, -25637, -25607,
+  -25597, -25607, -25637, -25682, -25736, -25789, -25834, -25864,
+  -25875, -25864, -25834, -25788, -25735, -25681, -25635, -25604,
+  -25594, -25604, -25635, -25681, -25736, -25790, -25837, -25868,
+  -25878, -25868, -25836, -25790, -25735, -25679, -25632, -25601,
+  -25590, -25601, -25633, -25680, -25736, -25792, -25839, -25871,
+  -25882, -25871, -25839, -25791, -25734, -25678, -25630, -25597,
+  -25586, -25597, -25630, -25678, -25736, -25793, -25842, -25875,
+  -25887, -25875, -25842, -25793, -25734, -25676, -25626, -25593,
+  -25581, -25593, -25626, -25677, -25736, -25795, -25846, -25880,
+  -25892, -25880, -25846, -25795, -25734, -25674, -25622, -25588,
+  -25576, -25588, -25623, -25675, -25736, -25798, -25850, -25885,
+  -25897, -25885, -25850, -25797, -25734, -25671, -25618, -25582,
+  -25570, -25582, -25618, -25672, -25736, -25800, -25855, -25891,
+  -25904, -25891, -25854, -25799, -25734, -25668, -25613, -25576,
+  -25562, -25576, -25613, -25670, -25736, -25803, -25860, -25898,
+  -25912, -25898, -25860, -25802, -25734, -25665, -25607, -25568,
+  -25554, -25568, -25607, -25667, -25737, -25807, -25867, -25907,
+  -25921, -25907, -25866, -25805, -25734, -25661, -25600, -25559,
+  -25545, -25559, -25601, -25663, -25737, -25811, -25874, -25916,
+  -25931, -25916, -25873, -25809, -25733, -25657, -25592, -25549,
+  -25533, -25549, -25593, -25659, -25737, -25816, -25883, -25927,
+  -25943, -25927, -25882, -25814, -25733, -25652, -25583, -25537,
+  -25520, -25537, -25584, -25654, -25738, -25821, -25893, -25940,
+  -25957, -25940, -25892, -25819, -25733, -25646, -25572, -25522,
+  -25505, -25522, -25573, -25648, -25738, -25828, -25905, -25956,
+  -25974, -25956, -25904, -25825, -25732, -25638, -25559, -25505,
+  -25486, -25505, -25560, -25642, -25739, -25836, -25919, -25975,
+  -25995, -25975, -25918, -25833, -25731, -25630, -25543, -25484,
+  -25464, -25484, -25544, -25633, -25739, -25846, -25937, -25998,
+  -26020, -25998, -25936, -25842, -25730, -25618, -25523, -25459,
+  -25436, -25459, -25524, -25623, -25740, -25858, -25959, -26027,
+  -26051, -26027, -25957, -25853, -25729, -25604, -25498, -25426,
+  -25401, -25427, -25500, -25610, -25742, -25874, -25987, -26064,
+  -26090, -26063, -25985, -25867, -25727, -25586, -25466, -25384,
+  -25356, -25385, -25468, -25594, -25744, -25895, -26025, -26112,
+  -26143, -26111, -26022, -25886, -25725, -25562, -25422, -25328,
+  -25295, -25329, -25426, -25573, -25747, -25924, -26076, -26178,
+  -26214, -26177, -26072, -25911, -25720, -25527, -25361, -25249,
+  -25209, -25250, -25366, -25543, -25753, -25967, -26150, -26274,
+  -26318, -26273, -26144, -25947, -25713, -25474, -25269, -25131,
+  -25081, -25132, -25277, -25499, -25764, -26034, -26267, -26424,
+  -26481, -26423, -26256, -26002, -25697, -25385, -25116, -24933,
+  -24868, -24935, -25130, -25429, -25789, -26157, -26476, -26694,
+  -26773, -26692, -26456, -26094, -25656, -25205, -24812, -24542,
+  -24445, -24546, -24844, -25304, -25865, -26446, -26957, -27311,
+  -27440, -27304, -26901, -26270, -25490, -24671, -23940, -23424,
+  -23233, -23440, -24067, -25072, -26351, -27739, -29027, -29975,
+  -30342, -29908, -28504, -26026, -22458, -17874, -12435, -6379,
+  0
+};
+
+static const int16_t hifi_wavetable_square_3[1025] =
+{
+  0, 6379, 12435, 17874, 22459, 26027, 28505, 29910,
+  30343, 29976, 29028, 27740, 26350, 25070, 24064, 23438,
+  23230, 23421, 23938, 24670, 25491, 26272, 26904, 27308,
+  27445, 27315, 26960, 26447, 25864, 25301, 24839, 24540,
+  24438, 24536, 24808, 25203, 25656, 26097, 26462, 26699,
+  26781, 26702, 26482, 26160, 25788, 25425, 25123, 24926,
+  24858, 24924, 25110, 25382, 25697, 26007, 26264, 26433,
+  26492, 26435, 26274, 26038, 25764, 25494, 25268, 25120,
+  25068, 25119, 25260, 25470, 25713, 25953, 26154, 26286,
+  26332, 26287, 26160, 25972, 25753, 25536, 25355, 25235,
+  25193, 25234, 25350, 25521, 25721, 25919, 26084, 26194,
+  26232, 26195, 26088, 25931, 25747, 25565, 25412, 25310,
+  25275, 25310, 25408, 25554, 25725, 25895, 26037, 26131,
+  26164, 26132, 26040, 25903, 25743, 25585, 25451, 25363,
+  25332, 25363, 25449, 25578, 25728, 25878, 26003, 26087,
+  26116, 26087, 26005, 25884, 25741, 25600, 25480, 25401,
+  25373, 25401, 25479, 25594, 25730, 25865, 25978, 26054,
+  26080, 26054, 25980, 25869, 25740, 25611, 25502, 25429,
+  25404, 25429, 25501, 25607, 25731, 25855, 25960, 26029,
+  26054, 26030, 25961, 25859, 25739, 25619, 25518, 25451,
+  25427, 25451, 25517, 25616, 25732, 25848, 25946, 26011,
+  26033, 26011, 25946, 25851, 25738, 25625, 25530, 25467,
+  25445, 25467, 25530, 25623, 25733, 25842, 25935, 25997,
+  26018, 25997, 25936, 25844, 25737, 25630, 25540, 25479,
+  25458, 25479, 25539, 25628, 25733, 25838, 25927, 25986,
+  26007, 25986, 25928, 25840, 25737, 25633, 25546, 25488,
+  25468, 25488, 25546, 25632, 25734, 25836, 25922, 25979,
+  25999, 25979, 25922, 25837, 25736, 25636, 25551, 25494,
+  25474, 25494, 25551, 25635, 25734, 25834, 25918, 25974,
+  25994, 25974, 25918, 25834, 25736, 25637, 25553, 25498,
+  25478, 25498, 25553, 25637, 25735, 25833, 25916, 25972,
+  25991, 25972, 25916, 25833, 25735, 25637, 25554, 25499,
+  25479, 25499, 25554, 25637, 25735, 25833, 25916, 25972,
+  25991, 25972, 25916, 25833, 25735, 25637, 25553, 25498,
+  25478, 25498, 25553, 25637, 25736, 25834, 25918, 25974,
+  25994, 25974, 25918, 25834, 25734, 25635, 25551, 25494,
+  25474, 25494, 25551, 25636, 25736, 25837, 25922, 25979,
+  25999, 25979, 25922, 25836, 25734, 25632, 25546, 25488,
+  25468, 25488, 25546, 25633, 25737, 25840, 25928, 25986,
+  26007, 25986, 25927, 25838, 25733, 25628, 25539, 25479,
+  25458, 25479, 25540, 25630, 25737, 25844, 25936, 25997,
+  26018, 25997, 25935, 25842, 25733, 25623, 25530, 25467,
+  25445, 25467, 25530, 25625, 25738, 25851, 25946, 26011,
+  26033, 26011, 25946, 25848, 25732, 25616, 25517, 25451,
+  25427, 25451, 25518, 25619, 25739, 25859, 25961, 26030,
+  26054, 26029, 25960, 25855, 25731, 25607, 25501, 25429,
+  25404, 25429, 25502, 25611, 25740, 25869, 25980, 26054,
+  26080, 26054, 25978, 25865, 25730, 25594, 25479, 25401,
+  25373, 25401, 25480, 25600, 25741, 25884, 26005, 26087,
+  26116, 26087, 26003, 25878, 25728, 25578, 25449, 25363,
+  25332, 25363, 25451, 25585, 25743, 25903, 26040, 26132,
+  26164, 26131, 26037, 25895, 25725, 25554, 25408, 25310,
+  25275, 25310, 25412, 25565, 25747, 25931, 26088, 26195,
+  26232, 26194, 26084, 25919, 25721, 25521, 25350, 25234,
+  25193, 25235, 25355, 25536, 25753, 25972, 26160, 26287,
+  26332, 26286, 26154, 25953, 25713, 25470, 25260, 25119,
+  25068, 25120, 25268, 25494, 25764, 26038, 26274, 26435,
+  26492, 26433, 26264, 26007, 25697, 25382, 25110, 24924,
+  24858, 24926, 25123, 25425, 25788, 26160, 26482, 26702,
+  26781, 26699, 26462, 26097, 25656, 25203, 24808, 24536,
+  24438, 24540, 24839, 25301, 25864, 26447, 26960, 27315,
+  27445, 27308, 26904, 26272, 25491, 24670, 23938, 23421,
+  23230, 23438, 24064, 25070, 26350, 27740, 29028, 29976,
+  30343, 29910, 28505, 26027, 22459, 17874, 12435, 6379,
+  0, -6379, -12435, -17874, -22459, -26027, -28505, -29910,
+  -30343, -29976, -29028, -27740, -26350, -25070, -24064, -23438,
+  -23230, -23421, -23938, -24670, -25491, -26272, -26904, -27308,
+  -27445, -27315, -26960, -26447, -25864, -25301, -24839, -24540,
+  -24438, -24536, -24808, -25203, -25656, -26097, -26462, -26699,
+  -26781, -26702, -26482, -26160, -25788, -25425, -25123, -24926,
+  -24858, -24924, -25110, -25382, -25697, -26007, -26264, -26433,
+  -26492, -26435, -26274, -26038, -25764, -25494, -25268, -25120,
+  -25068, -25119, -25260, -25470, -25713, -25953, -26154, -26286,
+  -26332, -26287, -26160, -25972, -25753, -25536, -25355, -25235,
+  -25193, -25234, -25350, -25521, -25721, -25919, -26084, -26194,
+  -26232, -26195, -26088, -25931, -25747, -25565, -25412, -25310,
+  -25275, -25310, -25408, -25554, -25725, -25895, -26037, -26131,
+  -26164, -26132, -26040, -25903, -25743, -25585, -25451, -25363,
+  -25332, -25363, -25449, -25578, -25728, -25878, -26003, -26087,
+  -26116, -26087, -26005, -25884, -25741, -25600, -25480, -25401,
+  -25373, -25401, -25479, -25594, -25730, -25865, -25978, -26054,
+  -26080, -26054, -25980, -25869, -25740, -25611, -25502, -25429,
+  -25404, -25429, -25501, -25607, -25731, -25855, -25960, -26029,
+  -26054, -26030, -25961, -25859, -25739, -25619, -25518, -25451,
+  -25427, -25451, -25517, -25616, -25732, -25848, -25946, -26011,
+  -26033, -26011, -25946, -25851, -25738, -25625, -25530, -25467,
+  -25445, -25467, -25530, -25623, -25733, -25842, -25935, -25997,
+  -26018, -25997, -25936, -25844, -25737, -25630, -25540, -25479,
+  -25458, -25479, -25539, -25628, -25733, -25838, -25927, -25986,
+  -26007, -25986, -25928, -25840, -25737, -25633, -25546, -25488,
+  -25468, -25488, -25546, -25632, -25734, -25836, -25922, -25979,
+  -25999, -25979, -25922, -25837, -25736, -25636, -25551, -25494,
+  -25474, -25494, -25551, -25635, -25734, -25834, -25918, -25974,
+  -25994, -25974, -25918, -25834, -25736, -25637, -25553, -25498,
+  -25478, -25498, -25553, -25637, -25735, -25833, -25916, -25972,
+  -25991, -25972, -25916, -25833, -25735, -25637, -25554, -25499,
+  -25479, -25499, -25554, -25637, -25735, -25833, -25916, -25972,
+  -25991, -25972, -25916, -25833, -25735, -25637, -25553, -25498,
+  -25478, -25498, -25553, -25637, -25736, -25834, -25918, -25974,
+  -25994, -25974, -25918, -25834, -25734, -25635, -25551, -25494,
+  -25474, -25494, -25551, -25636, -25736, -25837, -25922, -25979,
+  -25999, -25979, -25922, -25836, -25734, -25632, -25546, -25488,
+  -25468, -25488, -25546, -25633, -25737, -25840, -25928, -25986,
+  -26007, -25986, -25927, -25838, -25733, -25628, -25539, -25479,
+  -25458, -25479, -25540, -25630, -25737, -25844, -25936, -25997,
+  -26018, -25997, -25935, -25842, -25733, -25623, -25530, -25467,
+  -25445, -25467, -25530, -25625, -25738, -25851, -25946, -26011,
+  -26033, -26011, -25946, -25848, -25732, -25616, -25517, -25451,
+  -25427, -25451, -25518, -25619, -25739, -25859, -25961, -26030,
+  -26054, -26029, -25960, -25855, -25731, -25607, -25501, -25429,
+  -25404, -25429, -25502, -25611, -25740, -25869, -25980, -26054,
+  -26080, -26054, -25978, -25865, -25730, -25594, -25479, -25401,
+  -25373, -25401, -25480, -25600, -25741, -25884, -26005, -26087,
+  -26116, -26087, -26003, -25878, -25728, -25578, -25449, -25363,
+  -25332, -25363, -25451, -25585, -25743, -25903, -26040, -26132,
+  -26164, -26131, -26037, -25895, -25725, -25554, -25408, -25310,
+  -25275, -25310, -25412, -25565, -25747, -25931, -26088, -26195,
+  -26232, -26194, -26084, -25919, -25721, -25521, -25350, -25234,
+  -25193, -25235, -25355, -25536, -25753, -25972, -26160, -26287,
+  -26332, -26286, -26154, -25953, -25713, -25470, -25260, -25119,
+  -25068, -25120, -25268, -25494, -25764, -26038, -26274, -26435,
+  -26492, -26433, -26264, -26007, -25697, -25382, -25110, -24924,
+  -24858, -24926, -25123, -25425, -25788, -26160, -26482, -26702,
+  -26781, -26699, -26462, -26097, -25656, -25203, -24808, -24536,
+  -24438, -24540, -24839, -25301, -25864, -26447, -26960, -27315,
+  -27445, -27308, -26904, -26272, -25491, -24670, -23938, -23421,
+  -23230, -23438, -24064, -25070, -26350, -27740, -29028, -29976,
+  -30343, -29910, -28505, -26027, -22459, -17874, -12435, -6379,
+  0
+};
+
+static const int16_t hifi_wavetable_square_4[1025] =
+{
+  0, 3210, 6379, 9467, 12435, 15248, 17875, 20287,
+  22461, 24379, 26030, 27407, 28509, 29342, 29916, 30245,
+  30350, 30253, 29982, 29565, 29032, 28414, 27741, 27043,
+  26348, 25681, 25064, 24517, 24055, 23689, 23426, 23269,
+  23217, 23267, 23409, 23634, 23929, 24278, 24666, 25076,
+  25493, 25899, 26280, 26624, 26918, 27154, 27326, 27429,
+  27464, 27430, 27333, 27178, 26973, 26728, 26454, 26161,
+  25862, 25568, 25290, 25038, 24821, 24645, 24517, 24439,
+  24413, 24438, 24513, 24632, 24790, 24980, 25194, 25423,
+  25658, 25890, 26111, 26311, 26485, 26626, 26729, 26792,
+  26813, 26792, 26732, 26634, 26504, 26348, 26171, 25981,
+  25786, 25593, 25409, 25241, 25095, 24977, 24889, 24836,
+  24818, 24836, 24888, 24971, 25082, 25216, 25368, 25531,
+  25699, 25866, 26026, 26171, 26298, 26401, 26477, 26524,
+  26539, 26524, 26478, 26405, 26307, 26189, 26055, 25910,
+  25761, 25613, 25471, 25342, 25229, 25137, 25069, 25027,
+  25013, 25027, 25068, 25134, 25222, 25329, 25450, 25581,
+  25716, 25850, 25979, 26097, 26199, 26283, 26345, 26383,
+  26396, 26383, 26346, 26285, 26204, 26106, 25995, 25874,
+  25750, 25626, 25507, 25398, 25303, 25225, 25168, 25132,
+  25121, 25132, 25167, 25223, 25299, 25391, 25495, 25607,
+  25724, 25840, 25952, 26054, 26143, 26216, 26270, 26304,
+  26315, 26304, 26271, 26218, 26146, 26059, 25961, 25854,
+  25743, 25633, 25527, 25430, 25345, 25276, 25224, 25192,
+  25182, 25192, 25224, 25275, 25343, 25426, 25521, 25623,
+  25729, 25835, 25937, 26030, 26112, 26179, 26229, 26259,
+  26270, 26259, 26229, 26180, 26114, 26033, 25942, 25842,
+  25739, 25636, 25538, 25447, 25367, 25302, 25253, 25224,
+  25214, 25224, 25253, 25301, 25366, 25445, 25534, 25632,
+  25733, 25834, 25931, 26020, 26098, 26162, 26210, 26239,
+  26249, 26239, 26210, 26162, 26099, 26021, 25932, 25836,
+  25736, 25636, 25540, 25451, 25374, 25310, 25263, 25233,
+  25224, 25233, 25263, 25310, 25374, 25451, 25540, 25636,
+  25736, 25836, 25932, 26021, 26099, 26162, 26210, 26239,
+  26249, 26239, 26210, 26162, 26098, 26020, 25931, 25834,
+  25733, 25632, 25534, 25445, 25366, 25301, 25253, 25224,
+  25214, 25224, 25253, 25302, 25367, 25447, 25538, 25636,
+  25739, 25842, 25942, 26033, 26114, 26180, 26229, 26259,
+  26270, 26259, 26229, 26179, 26112, 26030, 25937, 25835,
+  25729, 25623, 25521, 25426, 25343, 25275, 25224, 25192,
+  25182, 25192, 25224, 25276, 25345, 25430, 25527, 25633,
+  25743, 25854, 25961, 26059, 26146, 26218, 26271, 26304,
+  26315, 26304, 26270, 26216, 26143, 26054, 25952, 25840,
+  25724, 25607, 25495, 25391, 25299, 25223, 25167, 25132,
+  25121, 25132, 25168, 25225, 25303, 25398, 25507, 25626,
+  25750, 25874, 25995, 26106, 26204, 26285, 26346, 26383,
+  26396, 26383, 26345, 26283, 26199, 26097, 25979, 25850,
+  25716, 25581, 25450, 25329, 25222, 25134, 25068, 25027,
+  25013, 25027, 25069, 25137, 25229, 25342, 25471, 25613,
+  25761, 25910, 26055, 26189, 26307, 26405, 26478, 26524,
+  26539, 26524, 26477, 26401, 26298, 26171, 26026, 25866,
+  25699, 25531, 25368, 25216, 25082, 24971, 24888, 24836,
+  24818, 24836, 24889, 24977, 25095, 25241, 25409, 25593,
+  25786, 25981, 26171, 26348, 26504, 26634, 26732, 26792,
+  26813, 26792, 26729, 26626, 26485, 26311, 26111, 25890,
+  25658, 25423, 25194, 24980, 24790, 24632, 24513, 24438,
+  24413, 24439, 24517, 24645, 24821, 25038, 25290, 25568,
+  25862, 26161, 26454, 26728, 26973, 27178, 27333, 27430,
+  27464, 27429, 27326, 27154, 26918, 26624, 26280, 25899,
+  25493, 25076, 24666, 24278, 23929, 23634, 23409, 23267,
+  23217, 23269, 23426, 23689, 24055, 24517, 25064, 25681,
+  26348, 27043, 27741, 28414, 29032, 29565, 29982, 30253,
+  30350, 30245, 29916, 29342, 28509, 27407, 26030, 24379,
+  22461, 20287, 17875, 15248, 12435, 9467, 6379, 3210,
+  0, -3210, -6379, -9467, -12435, -15248, -17875, -20287,
+  -22461, -24379, -26030, -27407, -28509, -29342, -29916, -30245,
+  -30350, -30253, -29982, -29565, -29032, -28414, -27741, -27043,
+  -26348, -25681, -25064, -24517, -24055, -23689, -23426, -23269,
+  -23217, -23267, -23409, -23634, -23929, -24278, -24666, -25076,
+  -25493, -25899, -26280, -26624, -26918, -27154, -27326, -27429,
+  -27464, -27430, -27333, -27178, -26973, -26728, -26454, -26161,
+  -25862, -25568, -25290, -25038, -24821, -24645, -24517, -24439,
+  -24413, -24438, -24513, -24632, -24790, -24980, -25194, -25423,
+  -25658, -25890, -26111, -26311, -26485, -26626, -26729, -26792,
+  -26813, -26792, -26732, -26634, -26504, -26348, -26171, -25981,
+  -25786, -25593, -25409, -25241, -25095, -24977, -24889, -24836,
+  -24818, -24836, -24888, -24971, -25082, -25216, -25368, -25531,
+  -25699, -25866, -26026, -26171, -26298, -26401, -26477, -26524,
+  -26539, -26524, -26478, -26405, -26307, -26189, -26055, -25910,
+  -25761, -25613, -25471, -25342, -25229, -25137, -25069, -25027,
+  -25013, -25027, -25068, -25134, -25222, -25329, -25450, -25581,
+  -25716, -25850, -25979, -26097, -26199, -26283, -26345, -26383,
+  -26396, -26383, -26346, -26285, -26204, -26106, -25995, -25874,
+  -25750, -25626, -25507, -25398, -25303, -25225, -25168, -25132,
+  -25121, -25132, -25167, -25223, -25299, -25391, -25495, -25607,
+  -25724, -25840, -25952, -26054, -26143, -26216, -26270, -26304,
+  -26315, -26304, -26271, -26218, -26146, -26059, -25961, -25854,
+  -25743, -25633, -25527, -25430, -25345, -25276, -25224, -25192,
+  -25182, -25192, -25224, -25275, -25343, -25426, -25521, -25623,
+  -25729, -25835, -25937, -26030, -26112, -26179, -26229, -26259,
+  -26270, -26259, -26229, -26180, -26114, -26033, -25942, -25842,
+  -25739, -25636, -25538, -25447, -25367, -25302, -25253, -25224,
+  -25214, -25224, -25253, -25301, -25366, -25445, -25534, -25632,
+  -25733, -25834, -25931, -26020, -26098, -26162, -26210, -26239,
+  -26249, -26239, -26210, -26162, -26099, -26021, -25932, -25836,
+  -25736, -25636, -25540, -25451, -25374, -25310, -25263, -25233,
+  -25224, -25233, -25263, -25310, -25374, -25451, -25540, -25636,
+  -25736, -25836, -25932, -26021, -26099, -26162, -26210, -26239,
+  -26249, -26239, -26210, -26162, -26098, -26020, -25931, -25834,
+  -25733, -25632, -25534, -25445, -25366, -25301, -25253, -25224,
+  -25214, -25224, -25253, -25302, -25367, -25447, -25538, -25636,
+  -25739, -25842, -25942, -26033, -26114, -26180, -26229, -26259,
+  -26270, -26259, -26229, -26179, -26112, -26030, -25937, -25835,
+  -25729, -25623, -25521, -25426, -25343, -25275, -25224, -25192,
+  -25182, -25192, -25224, -25276, -25345, -25430, -25527, -25633,
+  -25743, -25854, -25961, -26059, -26146, -26218, -26271, -26304,
+  -26315, -26304, -26270, -26216, -26143, -26054, -25952, -25840,
+  -25724, -25607, -25495, -25391, -25299, -25223, -25167, -25132,
+  -25121, -25132, -25168, -25225, -25303, -25398, -25507, -25626,
+  -25750, -25874, -25995, -26106, -26204, -26285, -26346, -26383,
+  -26396, -26383, -26345, -26283, -26199, -26097, -25979, -25850,
+  -25716, -25581, -25450, -25329, -25222, -25134, -25068, -25027,
+  -25013, -25027, -25069, -25137, -25229, -25342, -25471, -25613,
+  -25761, -25910, -26055, -26189, -26307, -26405, -26478, -26524,
+  -26539, -26524, -26477, -26401, -26298, -26171, -26026, -25866,
+  -25699, -25531, -25368, -25216, -25082, -24971, -24888, -24836,
+  -24818, -24836, -24889, -24977, -25095, -25241, -25409, -25593,
+  -25786, -25981, -26171, -26348, -26504, -26634, -26732, -26792,
+  -26813, -26792, -26729, -26626, -26485, -26311, -26111, -25890,
+  -25658, -25423, -25194, -24980, -24790, -24632, -24513, -24438,
+  -24413, -24439, -24517, -24645, -24821, -25038, -25290, -25568,
+  -25862, -26161, -26454, -26728, -26973, -27178, -27333, -27430,
+  -27464, -27429, -27326, -27154, -26918, -26624, -26280, -25899,
+  -25493, -25076, -24666, -24278, -23929, -23634, -23409, -23267,
+  -23217, -23269, -23426, -23689, -24055, -24517, -25064, -25681,
+  -26348, -27043, -27741, -28414, -29032, -29565, -29982, -30253,
+  -30350, -30245, -29916, -29342, -28509, -27407, -26030, -24379,
+  -22461, -20287, -17875, -15248, -12435, -9467, -6379, -3210,
+  0
+};
+
+static const int16_t hifi_wavetable_square_5[1025] =
+{
+  0, 1608, 3210, 4802, 6379, 7936, 9467, 10969,
+  12436, 13865, 15251, 16590, 17879, 19114, 20292, 21411,
+  22469, 23462, 24390, 25251, 26044, 26768, 27423, 28010,
+  28529, 28979, 29364, 29683, 29939, 30134, 30270, 30349,
+  30375, 30350, 30278, 30162, 30005, 29812, 29585, 29330,
+  29049, 28746, 28425, 28091, 27747, 27396, 27042, 26689,
+  26340, 25998, 25665, 25345, 25041, 24754, 24487, 24241,
+  24018, 23819, 23646, 23499, 23378, 23285, 23219, 23179,
+  23166, 23179, 23217, 23278, 23362, 23468, 23592, 23735,
+  23894, 24067, 24252, 24447, 24651, 24860, 25073, 25287,
+  25502, 25713, 25921, 26122, 26315, 26498, 26670, 26829,
+  26975, 27106, 27220, 27318, 27399, 27462, 27507, 27534,
+  27543, 27534, 27508, 27465, 27406, 27332, 27243, 27141,
+  27028, 26903, 26769, 26628, 26479, 26326, 26170, 26011,
+  25852, 25695, 25540, 25389, 25243, 25105, 24974, 24853,
+  24742, 24641, 24553, 24478, 24415, 24366, 24331, 24310,
+  24303, 24310, 24331, 24365, 24411, 24471, 24541, 24623,
+  24714, 24814, 24922, 25037, 25157, 25282, 25410, 25539,
+  25669, 25799, 25927, 26051, 26171, 26286, 26395, 26496,
+  26589, 26673, 26747, 26810, 26863, 26904, 26934, 26952,
+  26958, 26952, 26934, 26905, 26865, 26814, 26754, 26683,
+  26605, 26518, 26424, 26325, 26220, 26112, 26000, 25887,
+  25773, 25659, 25547, 25438, 25331, 25230, 25134, 25044,
+  24962, 24887, 24821, 24764, 24717, 24680, 24654, 24638,
+  24632, 24638, 24654, 24680, 24716, 24762, 24817, 24881,
+  24953, 25032, 25117, 25208, 25304, 25404, 25506, 25610,
+  25715, 25820, 25924, 26025, 26123, 26217, 26307, 26390,
+  26467, 26536, 26598, 26651, 26695, 26730, 26755, 26770,
+  26775, 26770, 26755, 26730, 26696, 26652, 26600, 26539,
+  26471, 26396, 26314, 26227, 26136, 26040, 25942, 25842,
+  25741, 25641, 25541, 25443, 25348, 25257, 25171, 25090,
+  25015, 24948, 24888, 24836, 24793, 24759, 24735, 24720,
+  24715, 24720, 24735, 24759, 24793, 24836, 24888, 24948,
+  25015, 25090, 25171, 25257, 25348, 25443, 25541, 25641,
+  25741, 25842, 25942, 26040, 26136, 26227, 26314, 26396,
+  26471, 26539, 26600, 26652, 26696, 26730, 26755, 26770,
+  26775, 26770, 26755, 26730, 26695, 26651, 26598, 26536,
+  26467, 26390, 26307, 26217, 26123, 26025, 25924, 25820,
+  25715, 25610, 25506, 25404, 25304, 25208, 25117, 25032,
+  24953, 24881, 24817, 24762, 24716, 24680, 24654, 24638,
+  24632, 24638, 24654, 24680, 24717, 24764, 24821, 24887,
+  24962, 25044, 25134, 25230, 25331, 25438, 25547, 25659,
+  25773, 25887, 26000, 26112, 26220, 26325, 26424, 26518,
+  26605, 26683, 26754, 26814, 26865, 26905, 26934, 26952,
+  26958, 26952, 26934, 26904, 26863, 26810, 26747, 26673,
+  26589, 26496, 26395, 26286, 26171, 26051, 25927, 25799,
+  25669, 25539, 25410, 25282, 25157, 25037, 24922, 24814,
+  24714, 24623, 24541, 24471, 24411, 24365, 24331, 24310,
+  24303, 24310, 24331, 24366, 24415, 24478, 24553, 24641,
+  24742, 24853, 24974, 25105, 25243, 25389, 25540, 25695,
+  25852, 26011, 26170, 26326, 26479, 26628, 26769, 26903,
+  27028, 27141, 27243, 27332, 27406, 27465, 27508, 27534,
+  27543, 27534, 27507, 27462, 27399, 27318, 27220, 27106,
+  26975, 26829, 26670, 26498, 26315, 26122, 25921, 25713,
+  25502, 25287, 25073, 24860, 24651, 24447, 24252, 24067,
+  23894, 23735, 23592, 23468, 23362, 23278, 23217, 23179,
+  23166, 23179, 23219, 23285, 23378, 23499, 23646, 23819,
+  24018, 24241, 24487, 24754, 25041, 25345, 25665, 25998,
+  26340, 26689, 27042, 27396, 27747, 28091, 28425, 28746,
+  29049, 29330, 29585, 29812, 30005, 30162, 30278, 30350,
+  30375, 30349, 30270, 30134, 29939, 29683, 29364, 28979,
+  28529, 28010, 27423, 26768, 26044, 25251, 24390, 23462,
+  22469, 21411, 20292, 19114, 17879, 16590, 15251, 13865,
+  12436, 10969, 9467, 7936, 6379, 4802, 3210, 1608,
+  0, -1608, -3210, -4802, -6379, -7936, -9467, -10969,
+  -12436, -13865, -15251, -16590, -17879, -19114, -20292, -21411,
+  -22469, -23462, -24390, -25251, -26044, -26768, -27423, -28010,
+  -28529, -28979, -29364, -29683, -29939, -30134, -30270, -30349,
+  -30375, -30350, -30278, -30162, -30005, -29812, -29585, -29330,
+  -29049, -28746, -28425, -28091, -27747, -27396, -27042, -26689,
+  -26340, -25998, -25665, -25345, -25041, -24754, -24487, -24241,
+  -24018, -23819, -23646, -23499, -23378, -23285, -23219, -23179,
+  -23166, -23179, -23217, -23278, -23362, -23468, -23592, -23735,
+  -23894, -24067, -24252, -24447, -24651, -24860, -25073, -25287,
+  -25502, -25713, -25921, -26122, -26315, -26498, -26670, -26829,
+  -26975, -27106, -27220, -27318, -27399, -27462, -27507, -27534,
+  -27543, -27534, -27508, -27465, -27406, -27332, -27243, -27141,
+  -27028, -26903, -26769, -26628, -26479, -26326, -26170, -26011,
+  -25852, -25695, -25540, -25389, -25243, -25105, -24974, -24853,
+  -24742, -24641, -24553, -24478, -24415, -24366, -24331, -24310,
+  -24303, -24310, -24331, -24365, -24411, -24471, -24541, -24623,
+  -24714, -24814, -24922, -25037, -25157, -25282, -25410, -25539,
+  -25669, -25799, -25927, -26051, -26171, -26286, -26395, -26496,
+  -26589, -26673, -26747, -26810, -26863, -26904, -26934, -26952,
+  -26958, -26952, -26934, -26905, -26865, -26814, -26754, -26683,
+  -26605, -26518, -26424, -26325, -26220, -26112, -26000, -25887,
+  -25773, -25659, -25547, -25438, -25331, -25230, -25134, -25044,
+  -24962, -24887, -24821, -24764, -24717, -24680, -24654, -24638,
+  -24632, -24638, -24654, -24680, -24716, -24762, -24817, -24881,
+  -24953, -25032, -25117, -25208, -25304, -25404, -25506, -25610,
+  -25715, -25820, -25924, -26025, -26123, -26217, -26307, -26390,
+  -26467, -26536, -26598, -26651, -26695, -26730, -26755, -26770,
+  -26775, -26770, -26755, -26730, -26696, -26652, -26600, -26539,
+  -26471, -26396, -26314, -26227, -26136, -26040, -25942, -25842,
+  -25741, -25641, -25541, -25443, -25348, -25257, -25171, -25090,
+  -25015, -24948, -24888, -24836, -24793, -24759, -24735, -24720,
+  -24715, -24720, -24735, -24759, -24793, -24836, -24888, -24948,
+  -25015, -25090, -25171, -25257, -25348, -25443, -25541, -25641,
+  -25741, -25842, -25942, -26040, -26136, -26227, -26314, -26396,
+  -26471, -26539, -26600, -26652, -26696, -26730, -26755, -26770,
+  -26775, -26770, -26755, -26730, -26695, -26651, -26598, -26536,
+  -26467, -26390, -26307, -26217, -26123, -26025, -25924, -25820,
+  -25715, -25610, -25506, -25404, -25304, -25208, -25117, -25032,
+  -24953, -24881, -24817, -24762, -24716, -24680, -24654, -24638,
+  -24632, -24638, -24654, -24680, -24717, -24764, -24821, -24887,
+  -24962, -25044, -25134, -25230, -25331, -25438, -25547, -25659,
+  -25773, -25887, -26000, -26112, -26220, -26325, -26424, -26518,
+  -26605, -26683, -26754, -26814, -26865, -26905, -26934, -26952,
+  -26958, -26952, -26934, -26904, -26863, -26810, -26747, -26673,
+  -26589, -26496, -26395, -26286, -26171, -26051, -25927, -25799,
+  -25669, -25539, -25410, -25282, -25157, -25037, -24922, -24814,
+  -24714, -24623, -24541, -24471, -24411, -24365, -24331, -24310,
+  -24303, -24310, -24331, -24366, -24415, -24478, -24553, -24641,
+  -24742, -24853, -24974, -25105, -25243, -25389, -25540, -25695,
+  -25852, -26011, -26170, -26326, -26479, -26628, -26769, -26903,
+  -27028, -27141, -27243, -27332, -27406, -27465, -27508, -27534,
+  -27543, -27534, -27507, -27462, -27399, -27318, -27220, -27106,
+  -26975, -26829, -26670, -26498, -26315, -26122, -25921, -25713,
+  -25502, -25287, -25073, -24860, -24651, -24447, -24252, -24067,
+  -23894, -23735, -23592, -23468, -23362, -23278, -23217, -23179,
+  -23166, -23179, -23219, -23285, -23378, -23499, -23646, -23819,
+  -24018, -24241, -24487, -24754, -25041, -25345, -25665, -25998,
+  -26340, -26689, -27042, -27396, -27747, -28091, -28425, -28746,
+  -29049, -29330, -29585, -29812, -30005, -30162, -30278, -30350,
+  -30375, -30349, -30270, -30134, -29939, -29683, -29364, -28979,
+  -28529, -28010, -27423, -26768, -26044, -25251, -24390, -23462,
+  -22469, -21411, -20292, -19114, -17879, -16590, -15251, -13865,
+  -12436, -10969, -9467, -7936, -6379, -4802, -3210, -1608,
+  0
+};
+
+static const int16_t hifi_wavetable_square_6[1025] =
+{
+  0, 804, 1608, 2410, 3210, 4008, 4803, 5593,
+  6380, 7161, 7937, 8707, 9469, 10225, 10972, 11711,
+  12441, 13162, 13872, 14571, 15260, 15937, 16602, 17254,
+  17894, 18520, 19133, 19731, 20315, 20884, 21439, 21977,
+  22501, 23008, 23499, 23974, 24432, 24874, 25299, 25707,
+  26097, 26471, 26827, 27167, 27489, 27794, 28081, 28352,
+  28605, 28841, 29061, 29264, 29450, 29620, 29774, 29911,
+  30033, 30140, 30231, 30307, 30369, 30416, 30450, 30470,
+  30476, 30470, 30451, 30420, 30377, 30323, 30258, 30183,
+  30098, 30003, 29900, 29788, 29667, 29539, 29404, 29262,
+  29115, 28961, 28802, 28639, 28471, 28300, 28125, 27948,
+  27768, 27587, 27404, 27220, 27036, 26852, 26668, 26485,
+  26303, 26123, 25945, 25770, 25597, 25427, 25261, 25099,
+  24941, 24787, 24638, 24494, 24356, 24223, 24096, 23974,
+  23859, 23750, 23648, 23552, 23463, 23381, 23306, 23238,
+  23177, 23123, 23077, 23038, 23006, 22981, 22963, 22953,
+  22949, 22953, 22963, 22980, 23004, 23034, 23071, 23114,
+  23163, 23218, 23278, 23344, 23415, 23491, 23572, 23658,
+  23748, 23842, 23940, 24041, 24145, 24253, 24363, 24476,
+  24590, 24707, 24825, 24944, 25064, 25185, 25306, 25428,
+  25549, 25669, 25789, 25908, 26025, 26141, 26255, 26367,
+  26477, 26584, 26688, 26789, 26887, 26981, 27072, 27158,
+  27241, 27319, 27393, 27463, 27528, 27588, 27643, 27693,
+  27739, 27779, 27813, 27843, 27867, 27886, 27899, 27907,
+  27910, 27907, 27899, 27886, 27867, 27844, 27815, 27782,
+  27743, 27700, 27652, 27600, 27543, 27482, 27417, 27348,
+  27276, 27200, 27121, 27038, 26953, 26865, 26774, 26682,
+  26587, 26490, 26392, 26292, 26192, 26090, 25988, 25886,
+  25783, 25681, 25579, 25478, 25377, 25278, 25179, 25083,
+  24988, 24895, 24804, 24716, 24631, 24548, 24468, 24391,
+  24318, 24249, 24183, 24121, 24063, 24009, 23959, 23914,
+  23873, 23837, 23805, 23778, 23756, 23739, 23727, 23720,
+  23717, 23720, 23727, 23739, 23756, 23778, 23805, 23837,
+  23873, 23914, 23959, 24009, 24063, 24121, 24183, 24249,
+  24318, 24391, 24468, 24548, 24631, 24716, 24804, 24895,
+  24988, 25083, 25179, 25278, 25377, 25478, 25579, 25681,
+  25783, 25886, 25988, 26090, 26192, 26292, 26392, 26490,
+  26587, 26682, 26774, 26865, 26953, 27038, 27121, 27200,
+  27276, 27348, 27417, 27482, 27543, 27600, 27652, 27700,
+  27743, 27782, 27815, 27844, 27867, 27886, 27899, 27907,
+  27910, 27907, 27899, 27886, 27867, 27843, 27813, 27779,
+  27739, 27693, 27643, 27588, 27528, 27463, 27393, 27319,
+  27241, 27158, 27072, 26981, 26887, 26789, 26688, 26584,
+  26477, 26367, 26255, 26141, 26025, 25908, 25789, 25669,
+  25549, 25428, 25306, 25185, 25064, 24944, 24825, 24707,
+  24590, 24476, 24363, 24253, 24145, 24041, 23940, 23842,
+  23748, 23658, 23572, 23491, 23415, 23344, 23278, 23218,
+  23163, 23114, 23071, 23034, 23004, 22980, 22963, 22953,
+  22949, 22953, 22963, 22981, 23006, 23038, 23077, 23123,
+  23177, 23238, 23306, 23381, 23463, 23552, 23648, 23750,
+  23859, 23974, 24096, 24223, 24356, 24494, 24638, 24787,
+  24941, 25099, 25261, 25427, 25597, 25770, 25945, 26123,
+  26303, 26485, 26668, 26852, 27036, 27220, 27404, 27587,
+  27768, 27948, 28125, 28300, 28471, 28639, 28802, 28961,
+  29115, 29262, 29404, 29539, 29667, 29788, 29900, 30003,
+  30098, 30183, 30258, 30323, 30377, 30420, 30451, 30470,
+  30476, 30470, 30450, 30416, 30369, 30307, 30231, 30140,
+  30033, 29911, 29774, 29620, 29450, 29264, 29061, 28841,
+  28605, 28352, 28081, 27794, 27489, 27167, 26827, 26471,
+  26097, 25707, 25299, 24874, 24432, 23974, 23499, 23008,
+  22501, 21977, 21439, 20884, 20315, 19731, 19133, 18520,
+  17894, 17254, 16602, 15937, 15260, 14571, 13872, 13162,
+  12441, 11711, 10972, 10225, 9469, 8707, 7937, 7161,
+  6380, 5593, 4803, 4008, 3210, 2410, 1608, 804,
+  0, -804, -1608, -2410, -3210, -4008, -4803, -5593,
+  -6380, -7161, -7937, -8707, -9469, -10225, -10972, -11711,
+  -12441, -13162, -13872, -14571, -15260, -15937, -16602, -17254,
+  -17894, -18520, -19133, -19731, -20315, -20884, -21439, -21977,
+  -22501, -23008, -23499, -23974, -24432, -24874, -25299, -25707,
+  -26097, -26471, -26827, -27167, -27489, -27794, -28081, -28352,
+  -28605, -28841, -29061, -29264, -29450, -29620, -29774, -29911,
+  -30033, -30140, -30231, -30307, -30369, -30416, -30450, -30470,
+  -30476, -30470, -30451, -30420, -30377, -30323, -30258, -30183,
+  -30098, -30003, -29900, -29788, -29667, -29539, -29404, -29262,
+  -29115, -28961, -28802, -28639, -28471, -28300, -28125, -27948,
+  -27768, -27587, -27404, -27220, -27036, -26852, -26668, -26485,
+  -26303, -26123, -25945, -25770, -25597, -25427, -25261, -25099,
+  -24941, -24787, -24638, -24494, -24356, -24223, -24096, -23974,
+  -23859, -23750, -23648, -23552, -23463, -23381, -23306, -23238,
+  -23177, -23123, -23077, -23038, -23006, -22981, -22963, -22953,
+  -22949, -22953, -22963, -22980, -23004, -23034, -23071, -23114,
+  -23163, -23218, -23278, -23344, -23415, -23491, -23572, -23658,
+  -23748, -23842, -23940, -24041, -24145, -24253, -24363, -24476,
+  -24590, -24707, -24825, -24944, -25064, -25185, -25306, -25428,
+  -25549, -25669, -25789, -25908, -26025, -26141, -26255, -26367,
+  -26477, -26584, -26688, -26789, -26887, -26981, -27072, -27158,
+  -27241, -27319, -27393, -27463, -27528, -27588, -27643, -27693,
+  -27739, -27779, -27813, -27843, -27867, -27886, -27899, -27907,
+  -27910, -27907, -27899, -27886, -27867, -27844, -27815, -27782,
+  -27743, -27700, -27652, -27600, -27543, -27482, -27417, -27348,
+  -27276, -27200, -27121, -27038, -26953, -26865, -26774, -26682,
+  -26587, -26490, -26392, -26292, -26192, -26090, -25988, -25886,
+  -25783, -25681, -25579, -25478, -25377, -25278, -25179, -25083,
+  -24988, -24895, -24804, -24716, -24631, -24548, -24468, -24391,
+  -24318, -24249, -24183, -24121, -24063, -24009, -23959, -23914,
+  -23873, -23837, -23805, -23778, -23756, -23739, -23727, -23720,
+  -23717, -23720, -23727, -23739, -23756, -23778, -23805, -23837,
+  -23873, -23914, -23959, -24009, -24063, -24121, -24183, -24249,
+  -24318, -24391, -24468, -24548, -24631, -24716, -24804, -24895,
+  -24988, -25083, -25179, -25278, -25377, -25478, -25579, -25681,
+  -25783, -25886, -25988, -26090, -26192, -26292, -26392, -26490,
+  -26587, -26682, -26774, -26865, -26953, -27038, -27121, -27200,
+  -27276, -27348, -27417, -27482, -27543, -27600, -27652, -27700,
+  -27743, -27782, -27815, -27844, -27867, -27886, -27899, -27907,
+  -27910, -27907, -27899, -27886, -27867, -27843, -27813, -27779,
+  -27739, -27693, -27643, -27588, -27528, -27463, -27393, -27319,
+  -27241, -27158, -27072, -26981, -26887, -26789, -26688, -26584,
+  -26477, -26367, -26255, -26141, -26025, -25908, -25789, -25669,
+  -25549, -25428, -25306, -25185, -25064, -24944, -24825, -24707,
+  -24590, -24476, -24363, -24253, -24145, -24041, -23940, -23842,
+  -23748, -23658, -23572, -23491, -23415, -23344, -23278, -23218,
+  -23163, -23114, -23071, -23034, -23004, -22980, -22963, -22953,
+  -22949, -22953, -22963, -22981, -23006, -23038, -23077, -23123,
+  -23177, -23238, -23306, -23381, -23463, -23552, -23648, -23750,
+  -23859, -23974, -24096, -24223, -24356, -24494, -24638, -24787,
+  -24941, -25099, -25261, -25427, -25597, -25770, -25945, -26123,
+  -26303, -26485, -26668, -26852, -27036, -27220, -27404, -27587,
+  -27768, -27948, -28125, -28300, -28471, -28639, -28802, -28961,
+  -29115, -29262, -29404, -29539, -29667, -29788, -29900, -30003,
+  -30098, -30183, -30258, -30323, -30377, -30420, -30451, -30470,
+  -30476, -30470, -30450, -30416, -30369, -30307, -30231, -30140,
+  -30033, -29911, -29774, -29620, -29450, -29264, -29061, -28841,
+  -28605, -28352, -28081, -27794, -27489, -27167, -26827, -26471,
+  -26097, -25707, -25299, -24874, -24432, -23974, -23499, -23008,
+  -22501, -21977, -21439, -20884, -20315, -19731, -19133, -18520,
+  -17894, -17254, -16602, -15937, -15260, -14571, -13872, -13162,
+  -12441, -11711, -10972, -10225, -9469, -8707, -7937, -7161,
+  -6380, -5593, -4803, -4008, -3210, -2410, -1608, -804,
+  0
+};
+
+static const int16_t hifi_wavetable_square_7[1025] =
+{
+  0, 402, 804, 1206, 1608, 2009, 2410, 2810,
+  3210, 3610, 4009, 4406, 4804, 5200, 5595, 5989,
+  6382, 6774, 7165, 7554, 7942, 8328, 8713, 9096,
+  9478, 9858, 10235, 10611, 10986, 11358, 11727, 12095,
+  12461, 12824, 13185, 13543, 13899, 14252, 14603, 14951,
+  15297, 15639, 15979, 16316, 16650, 16981, 17309, 17633,
+  17955, 18273, 18588, 18900, 19208, 19513, 19815, 20113,
+  20407, 20698, 20985, 21269, 21549, 21825, 22097, 22366,
+  22630, 22891, 23148, 23401, 23650, 23894, 24135, 24372,
+  24605, 24833, 25058, 25278, 25494, 25706, 25913, 26117,
+  26316, 26511, 26701, 26888, 27070, 27248, 27421, 27590,
+  27755, 27915, 28071, 28223, 28370, 28514, 28652, 28787,
+  28917, 29043, 29164, 29281, 29394, 29503, 29607, 29707,
+  29803, 29895, 29982, 30065, 30145, 30220, 30290, 30357,
+  30420, 30478, 30533, 30584, 30630, 30673, 30712, 30747,
+  30778, 30805, 30829, 30849, 30865, 30877, 30886, 30891,
+  30893, 30891, 30886, 30878, 30866, 30850, 30832, 30810,
+  30785, 30757, 30726, 30692, 30655, 30615, 30572, 30526,
+  30478, 30427, 30373, 30317, 30258, 30197, 30133, 30067,
+  29998, 29928, 29855, 29780, 29703, 29624, 29543, 29460,
+  29376, 29289, 29201, 29112, 29020, 28928, 28833, 28738,
+  28641, 28543, 28444, 28343, 28242, 28140, 28036, 27932,
+  27827, 27722, 27615, 27508, 27401, 27293, 27185, 27076,
+  26967, 26858, 26749, 26639, 26530, 26420, 26311, 26202,
+  26093, 25984, 25876, 25768, 25661, 25554, 25447, 25341,
+  25236, 25132, 25028, 24926, 24824, 24723, 24623, 24525,
+  24427, 24331, 24235, 24141, 24049, 23957, 23867, 23779,
+  23692, 23607, 23523, 23441, 23360, 23281, 23204, 23129,
+  23056, 22984, 22915, 22847, 22781, 22717, 22656, 22596,
+  22539, 22483, 22430, 22379, 22330, 22283, 22239, 22197,
+  22157, 22120, 22085, 22052, 22021, 21993, 21968, 21944,
+  21923, 21905, 21889, 21875, 21864, 21856, 21850, 21846,
+  21845, 21846, 21850, 21856, 21864, 21875, 21889, 21905,
+  21923, 21944, 21968, 21993, 22021, 22052, 22085, 22120,
+  22157, 22197, 22239, 22283, 22330, 22379, 22430, 22483,
+  22539, 22596, 22656, 22717, 22781, 22847, 22915, 22984,
+  23056, 23129, 23204, 23281, 23360, 23441, 23523, 23607,
+  23692, 23779, 23867, 23957, 24049, 24141, 24235, 24331,
+  24427, 24525, 24623, 24723, 24824, 24926, 25028, 25132,
+  25236, 25341, 25447, 25554, 25661, 25768, 25876, 25984,
+  26093, 26202, 26311, 26420, 26530, 26639, 26749, 26858,
+  26967, 27076, 27185, 27293, 27401, 27508, 27615, 27722,
+  27827, 27932, 28036, 28140, 28242, 28343, 28444, 28543,
+  28641, 28738, 28833, 28928, 29020, 29112, 29201, 29289,
+  29376, 29460, 29543, 29624, 29703, 29780, 29855, 29928,
+  29998, 30067, 30133, 30197, 30258, 30317, 30373, 30427,
+  30478, 30526, 30572, 30615, 30655, 30692, 30726, 30757,
+  30785, 30810, 30832, 30850, 30866, 30878, 30886, 30891,
+  30893, 30891, 30886, 30877, 30865, 30849, 30829, 30805,
+  30778, 30747, 30712, 30673, 30630, 30584, 30533, 30478,
+  30420, 30357, 30290, 30220, 30145, 30065, 29982, 29895,
+  29803, 29707, 29607, 29503, 29394, 29281, 29164, 29043,
+  28917, 28787, 28652, 28514, 28370, 28223, 28071, 27915,
+  27755, 27590, 27421, 27248, 27070, 26888, 26701, 26511,
+  26316, 26117, 25913, 25706, 25494, 25278, 25058, 24833,
+  24605, 24372, 24135, 23894, 23650, 23401, 23148, 22891,
+  22630, 22366, 22097, 21825, 21549, 21269, 20985, 20698,
+  20407, 20113, 19815, 19513, 19208, 18900, 18588, 18273,
+  17955, 17633, 17309, 16981, 16650, 16316, 15979, 15639,
+  15297, 14951, 14603, 14252, 13899, 13543, 13185, 12824,
+  12461, 12095, 11727, 11358, 10986, 10611, 10235, 9858,
+  9478, 9096, 8713, 8328, 7942, 7554, 7165, 6774,
+  6382, 5989, 5595, 5200, 4804, 4406, 4009, 3610,
+  3210, 2810, 2410, 2009, 1608, 1206, 804, 402,
+  0, -402, -804, -1206, -1608, -2009, -2410, -2810,
+  -3210, -3610, -4009, -4406, -4804, -5200, -5595, -5989,
+  -6382, -6774, -7165, -7554, -7942, -8328, -8713, -9096,
+  -9478, -9858, -10235, -10611, -10986, -11358, -11727, -12095,
+  -12461, -12824, -13185, -13543, -13899, -14252, -14603, -14951,
+  -15297, -15639, -15979, -16316, -16650, -16981, -17309, -17633,
+  -17955, -18273, -18588, -18900, -19208, -19513, -19815, -20113,
+  -20407, -20698, -20985, -21269, -21549, -21825, -22097, -22366,
+  -22630, -22891, -23148, -23401, -23650, -23894, -24135, -24372,
+  -24605, -24833, -25058, -25278, -25494, -25706, -25913, -26117,
+  -26316, -26511, -26701, -26888, -27070, -27248, -27421, -27590,
+  -27755, -27915, -28071, -28223, -28370, -28514, -28652, -28787,
+  -28917, -29043, -29164, -29281, -29394, -29503, -29607, -29707,
+  -29803, -29895, -29982, -30065, -30145, -30220, -30290, -30357,
+  -30420, -30478, -30533, -30584, -30630, -30673, -30712, -30747,
+  -30778, -30805, -30829, -30849, -30865, -30877, -30886, -30891,
+  -30893, -30891, -30886, -30878, -30866, -30850, -30832, -30810,
+  -30785, -30757, -30726, -30692, -30655, -30615, -30572, -30526,
+  -30478, -30427, -30373, -30317, -30258, -30197, -30133, -30067,
+  -29998, -29928, -29855, -29780, -29703, -29624, -29543, -29460,
+  -29376, -29289, -29201, -29112, -29020, -28928, -28833, -28738,
+  -28641, -28543, -28444, -28343, -28242, -28140, -28036, -27932,
+  -27827, -27722, -27615, -27508, -27401, -27293, -27185, -27076,
+  -26967, -26858, -26749, -26639, -26530, -26420, -26311, -26202,
+  -26093, -25984, -25876, -25768, -25661, -25554, -25447, -25341,
+  -25236, -25132, -25028, -24926, -24824, -24723, -24623, -24525,
+  -24427, -24331, -24235, -24141, -24049, -23957, -23867, -23779,
+  -23692, -23607, -23523, -23441, -23360, -23281, -23204, -23129,
+  -23056, -22984, -22915, -22847, -22781, -22717, -22656, -22596,
+  -22539, -22483, -22430, -22379, -22330, -22283, -22239, -22197,
+  -22157, -22120, -22085, -22052, -22021, -21993, -21968, -21944,
+  -21923, -21905, -21889, -21875, -21864, -21856, -21850, -21846,
+  -21845, -21846, -21850, -21856, -21864, -21875, -21889, -21905,
+  -21923, -21944, -21968, -21993, -22021, -22052, -22085, -22120,
+  -22157, -22197, -22239, -22283, -22330, -22379, -22430, -22483,
+  -22539, -22596, -22656, -22717, -22781, -22847, -22915, -22984,
+  -23056, -23129, -23204, -23281, -23360, -23441, -23523, -23607,
+  -23692, -23779, -23867, -23957, -24049, -24141, -24235, -24331,
+  -24427, -24525, -24623, -24723, -24824, -24926, -25028, -25132,
+  -25236, -25341, -25447, -25554, -25661, -25768, -25876, -25984,
+  -26093, -26202, -26311, -26420, -26530, -26639, -26749, -26858,
+  -26967, -27076, -27185, -27293, -27401, -27508, -27615, -27722,
+  -27827, -27932, -28036, -28140, -28242, -28343, -28444, -28543,
+  -28641, -28738, -28833, -28928, -29020, -29112, -29201, -29289,
+  -29376, -29460, -29543, -29624, -29703, -29780, -29855, -29928,
+  -29998, -30067, -30133, -30197, -30258, -30317, -30373, -30427,
+  -30478, -30526, -30572, -30615, -30655, -30692, -30726, -30757,
+  -30785, -30810, -30832, -30850, -30866, -30878, -30886, -30891,
+  -30893, -30891, -30886, -30877, -30865, -30849, -30829, -30805,
+  -30778, -30747, -30712, -30673, -30630, -30584, -30533, -30478,
+  -30420, -30357, -30290, -30220, -30145, -30065, -29982, -29895,
+  -29803, -29707, -29607, -29503, -29394, -29281, -29164, -29043,
+  -28917, -28787, -28652, -28514, -28370, -28223, -28071, -27915,
+  -27755, -27590, -27421, -27248, -27070, -26888, -26701, -26511,
+  -26316, -26117, -25913, -25706, -25494, -25278, -25058, -24833,
+  -24605, -24372, -24135, -23894, -23650, -23401, -23148, -22891,
+  -22630, -22366, -22097, -21825, -21549, -21269, -20985, -20698,
+  -20407, -20113, -19815, -19513, -19208, -18900, -18588, -18273,
+  -17955, -17633, -17309, -16981, -16650, -16316, -15979, -15639,
+  -15297, -14951, -14603, -14252, -13899, -13543, -13185, -12824,
+  -12461, -12095, -11727, -11358, -10986, -10611, -10235, -9858,
+  -9478, -9096, -8713, -8328, -7942, -7554, -7165, -6774,
+  -6382, -5989, -5595, -5200, -4804, -4406, -4009, -3610,
+  -3210, -2810, -2410, -2009, -1608, -1206, -804, -402,
+  0
+};
+
+const int16_t *const hifi_wavetable[4][10] =
+{
+  {
+    hifi_wavetable_sine_0, hifi_wavetable_sine_0, hifi_wavetable_sine_0,
+    hifi_wavetable_sine_3, hifi_wavetable_sine_3, hifi_wavetable_sine_3,
+    hifi_wavetable_sine_3, hifi_wavetable_sine_3, hifi_wavetable_sine_3,
+    hifi_wavetable_sine_3
+  },
+  {
+    hifi_wavetable_triangle_0, hifi_wavetable_triangle_1, hifi_wavetable_triangle_2,
+    hifi_wavetable_triangle_3, hifi_wavetable_triangle_4, hifi_wavetable_triangle_5,
+    hifi_wavetable_triangle_6, hifi_wavetable_triangle_7, hifi_wavetable_triangle_8,
+    hifi_wavetable_triangle_8
+  },
+  {
+    hifi_wavetable_saw_0, hifi_wavetable_saw_1, hifi_wavetable_saw_2,
+    hifi_wavetable_saw_3, hifi_wavetable_saw_4, hifi_wavetable_saw_5,
+    hifi_wavetable_saw_6, hifi_wavetable_saw_7, hifi_wavetable_saw_8,
+    hifi_wavetable_saw_9
+  },
+  {
+    hifi_wavetable_square_0, hifi_wavetable_square_1, hifi_wavetable_square_2,
+    hifi_wavetable_square_3, hifi_wavetable_square_4, hifi_wavetable_square_5,
+    hifi_wavetable_square_6, hifi_wavetable_square_7, hifi_wavetable_sine_3,
+    hifi_wavetable_sine_3
+  }
+};
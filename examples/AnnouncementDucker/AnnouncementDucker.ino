@@ -0,0 +1,106 @@
+/*
+  This example is a small PA mixer: background music on the right input
+  is turned down automatically whenever someone speaks into a microphone
+  on the left input, and both are mixed to both outputs.  The codec setup
+  is the same as in the StreamFromLoop example.
+
+  The music starts to duck as soon as the microphone goes above -40dBFS
+  and is 15dB down about 100ms later.  It stays down until the microphone
+  has been quiet for half a second and then fades back up over about a
+  second.
+
+  The sketch prints the music gain whenever it changes by a dB or more,
+  and the cycles the ducking took for the last block.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiDucker.h>
+
+#define SAMPLE_RATE   48000
+#define BLOCK_FRAMES  64
+
+static int32_t block[BLOCK_FRAMES * 2];
+static int32_t music[BLOCK_FRAMES];
+
+HiFiDucker ducker;
+float reportedGainDb = 0.0;
+
+void setup() {
+  Serial.begin(115200);
+
+  ducker.begin(SAMPLE_RATE, BLOCK_FRAMES);
+  ducker.configure(-40.0, -15.0, 20.0, 500.0, 800.0);
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.configureRx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_TK_RK_CLK, 32);
+
+  if (!HiFi.beginFrames(4 * BLOCK_FRAMES))
+  {
+    Serial.println("Not enough memory for the rings");
+    while (1);
+  }
+
+  // One block of silence ahead of the first real one
+  memset(block, 0, sizeof(block));
+  HiFi.writeFrames(block, BLOCK_FRAMES, 0);
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableRx(true);
+  HiFi.enableTx(true);
+}
+
+void loop() {
+  if (HiFi.readFrames(block, BLOCK_FRAMES, 100) != BLOCK_FRAMES)
+  {
+    return;
+  }
+
+  // Microphone on the left is the sidechain, music on the right is ducked.
+  for (uint16_t i = 0; i < BLOCK_FRAMES; i++)
+  {
+    music[i] = block[2 * i + 1];
+  }
+  ducker.process(music, BLOCK_FRAMES, 1, block, 2);
+
+  // Mix, half of each so the sum can't clip
+  for (uint16_t i = 0; i < BLOCK_FRAMES; i++)
+  {
+    int32_t mix = (block[2 * i] >> 1) + (music[i] >> 1);
+    block[2 * i] = mix;
+    block[2 * i + 1] = mix;
+  }
+  HiFi.writeFrames(block, BLOCK_FRAMES, 100);
+
+  float gainDb = ducker.getGainDb();
+  if (fabs(gainDb - reportedGainDb) >= 1.0 ||
+      (gainDb == 0.0 && reportedGainDb != 0.0))
+  {
+    reportedGainDb = gainDb;
+    Serial.print(ducker.isTriggered() ? "ducking: " : "releasing: ");
+    Serial.print(gainDb, 1);
+    Serial.print(" dB, ");
+    Serial.print(ducker.getCycleMeter().getCycles());
+    Serial.println(" cycles/block");
+  }
+}
@@ -0,0 +1,111 @@
+/*
+  This example flashes an LED on pin 13 on every beat or note onset in
+  the left input and prints the tempo.  The codec setup is the same as in
+  the Passthrough example; only the receiver is used.
+
+  The receive callback only hands samples to the detector, which
+  averages them down into a small ring.  loop() does the analysis and
+  reads the onset events back, each stamped with the input frame it
+  happened at, so the sketch can tell how long ago each one was as well
+  as whether there was one.
+
+  Every two seconds the sketch prints the tempo, how sure the detector is
+  of it and the cycles the last analysis took.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiOnsetDetector.h>
+
+#define SAMPLE_RATE   48000
+#define LED_PIN       13
+#define FLASH_MS      50
+
+void codecRxReadyInterrupt(HiFiChannelID_t);
+
+HiFiOnsetDetector detector;
+static volatile uint32_t framesIn = 0;
+
+unsigned long ledOff = 0;
+unsigned long lastReport = 0;
+
+void setup() {
+  Serial.begin(115200);
+  pinMode(LED_PIN, OUTPUT);
+
+  if (!detector.begin(SAMPLE_RATE))
+  {
+    Serial.println("Not enough memory for the detector");
+    while (1);
+  }
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureRx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.onRxReady(codecRxReadyInterrupt);
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableRx(true);
+}
+
+void loop() {
+  detector.update();
+
+  HiFiOnsetEvent_t onset;
+  while (detector.readEvent(onset))
+  {
+    digitalWrite(LED_PIN, HIGH);
+    ledOff = millis() + FLASH_MS;
+
+    Serial.print("onset, ");
+    Serial.print((framesIn - onset.frame) * 1000UL / SAMPLE_RATE);
+    Serial.print(" ms ago, strength ");
+    Serial.println(onset.strength >> 16);
+  }
+
+  if ((long)(millis() - ledOff) >= 0)
+  {
+    digitalWrite(LED_PIN, LOW);
+  }
+
+  if (millis() - lastReport >= 2000)
+  {
+    lastReport = millis();
+    Serial.print("tempo ");
+    Serial.print(detector.getTempo(), 1);
+    Serial.print(" BPM, confidence ");
+    Serial.print(detector.getTempoConfidence(), 2);
+    Serial.print(", ");
+    Serial.print(detector.getCycleMeter().getCycles());
+    Serial.println(" cycles");
+  }
+}
+
+void codecRxReadyInterrupt(HiFiChannelID_t channel)
+{
+  int32_t sample = HiFi.read();
+
+  if (channel == HIFI_CHANNEL_ID_1)
+  {
+    detector.write(sample);
+    framesIn++;
+  }
+}
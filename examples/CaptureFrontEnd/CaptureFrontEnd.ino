@@ -0,0 +1,121 @@
+/*
+  This example runs the capture front-end (DC blocker + AGC) on audio
+  received from a codec and sends the result back out of the transmitter.
+  The codec setup is the same as in the Passthrough example.
+
+  Audio is collected into blocks by the interrupt callbacks and processed
+  in loop(), one block behind, using a pair of ping-pong buffers.  The AGC
+  gain and the CPU time spent in the front-end are printed once a second.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiFrontEnd.h>
+
+#define SAMPLE_RATE   48000
+#define BLOCK_FRAMES  64
+
+void codecTxReadyInterrupt(HiFiChannelID_t);
+void codecRxReadyInterrupt(HiFiChannelID_t);
+
+static int32_t rxBlock[2][BLOCK_FRAMES * 2];
+static int32_t txBlock[2][BLOCK_FRAMES * 2];
+static volatile uint8_t activeBlock = 0;
+static volatile bool blockReady = false;
+static uint16_t rxFrame = 0;
+static uint16_t txFrame = 0;
+
+HiFiFrontEnd frontEnd;
+unsigned long lastReport = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  // Stereo, 64 frame blocks.  Remove DC and aim for peaks around -12 dBFS
+  // with up to 30 dB of gain.
+  frontEnd.begin(2, SAMPLE_RATE, BLOCK_FRAMES);
+  frontEnd.enableDcBlock(true);
+  frontEnd.configureAgc(-12.0, 30.0, 10.0, 500.0);
+  frontEnd.enableAgc(true);
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.configureRx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_TK_RK_CLK, 32);
+  HiFi.onTxReady(codecTxReadyInterrupt);
+  HiFi.onRxReady(codecRxReadyInterrupt);
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableRx(true);
+  HiFi.enableTx(true);
+}
+
+void loop() {
+  if (blockReady)
+  {
+    // The interrupts are filling the other buffer pair now.
+    uint8_t block = activeBlock ^ 1;
+    blockReady = false;
+
+    frontEnd.process(rxBlock[block], BLOCK_FRAMES);
+    memcpy(txBlock[block], rxBlock[block], sizeof(rxBlock[block]));
+  }
+
+  if (millis() - lastReport >= 1000)
+  {
+    lastReport = millis();
+    Serial.print("gain ");
+    Serial.print(frontEnd.getGainDb());
+    Serial.print(" dB");
+    if (frontEnd.isAtMaxGain())
+    {
+      Serial.print(" (max)");
+    }
+    Serial.print(", cpu ");
+    Serial.print(frontEnd.getCycleMeter().getLoad(BLOCK_FRAMES, SAMPLE_RATE));
+    Serial.println("%");
+  }
+}
+
+void codecTxReadyInterrupt(HiFiChannelID_t channel)
+{
+  HiFi.write(txBlock[activeBlock][txFrame * 2 + channel]);
+
+  if (channel == HIFI_CHANNEL_ID_2)
+  {
+    txFrame = (txFrame + 1) % BLOCK_FRAMES;
+  }
+}
+
+void codecRxReadyInterrupt(HiFiChannelID_t channel)
+{
+  rxBlock[activeBlock][rxFrame * 2 + channel] = HiFi.read();
+
+  if (channel == HIFI_CHANNEL_ID_2)
+  {
+    if (++rxFrame == BLOCK_FRAMES)
+    {
+      rxFrame = 0;
+      activeBlock ^= 1;
+      blockReady = true;
+    }
+  }
+}
@@ -0,0 +1,99 @@
+/*
+  This example measures the cost of the partitioned convolution engine and
+  works out how long an impulse response the Due can run in real time.
+
+  No codec is needed.  For each partition size the engine is timed with a
+  short and a longer random impulse response; the cost of a block grows
+  linearly with the number of partitions, so two points are enough to
+  estimate the longest response that fits in the CPU budget (and, as a
+  separate limit, in RAM).  Results are printed to the serial monitor.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFiConvolver.h>
+
+#define SAMPLE_RATE     48000
+// Leave some of the CPU for everything else.
+#define CPU_BUDGET      0.8
+#define SHORT_PARTS     2
+#define LONG_PARTS      16
+
+int16_t ir[256 * LONG_PARTS];
+int32_t block[256];
+
+uint32_t timeBlock(HiFiConvolver &conv, uint16_t taps)
+{
+  conv.setImpulseResponse(ir, taps);
+
+  // Run enough blocks to fill the delay line before taking the reading.
+  for (uint16_t i = 0; i < 2 * LONG_PARTS; i++)
+  {
+    for (uint16_t n = 0; n < conv.getPartitionSize(); n++)
+    {
+      block[n] = random(-0x20000000, 0x20000000);
+    }
+    conv.process(block);
+  }
+  return conv.getCycleMeter().getCycles();
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  for (uint16_t i = 0; i < sizeof(ir) / sizeof(ir[0]); i++)
+  {
+    ir[i] = random(-1000, 1000);
+  }
+
+  Serial.println("partition  cycles/block(short)  cycles/block(long)  max taps (cpu)");
+
+  for (uint8_t log2Part = 5; log2Part <= 8; log2Part++)
+  {
+    HiFiConvolver conv;
+    uint16_t part = 1 << log2Part;
+
+    if (!conv.begin(log2Part, part * LONG_PARTS))
+    {
+      Serial.println("out of memory");
+      continue;
+    }
+
+    uint32_t shortCycles = timeBlock(conv, part * SHORT_PARTS);
+    uint32_t longCycles = timeBlock(conv, part * LONG_PARTS);
+    conv.end();
+
+    // cycles = fixed + perPartition * partitions
+    float perPartition = (float)(longCycles - shortCycles) / (LONG_PARTS - SHORT_PARTS);
+    float fixed = shortCycles - perPartition * SHORT_PARTS;
+    float budget = CPU_BUDGET * (F_CPU / (float)SAMPLE_RATE) * part;
+    uint32_t maxParts = (budget - fixed) / perPartition;
+
+    Serial.print(part);
+    Serial.print("        ");
+    Serial.print(shortCycles);
+    Serial.print("                ");
+    Serial.print(longCycles);
+    Serial.print("               ");
+    Serial.println(maxParts * part);
+  }
+
+  // Memory is the other limit: 12 bytes per partition sample.
+  Serial.println("RAM use is about 12 bytes per tap, so ~5000 taps is the practical");
+  Serial.println("ceiling for a single engine on the Due's 96K of SRAM.");
+}
+
+void loop() {
+}
@@ -0,0 +1,161 @@
+/*
+  This example switches the output between the line input and a 1kHz
+  test tone without clicks.  The codec setup is the same as in the
+  Passthrough example, and audio moves from loop() as in the
+  StreamFromLoop example.
+
+  Send 'i' over serial for the input or 't' for the tone.  The switch is
+  queued for an exact frame a quarter of a second ahead (to show the
+  timing, it would normally be as soon as possible) and crossfades over
+  the number of milliseconds last sent (e.g. "200t"), 50 to begin with;
+  'c' makes them hard cuts for comparison until a new time is sent.
+
+  The cycles taken by the switcher are printed once a second: a handful
+  per block until a fade starts, since it just hands back the input.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiMath.h>
+#include <HiFiSwitcher.h>
+
+#define SAMPLE_RATE   48000
+#define BLOCK_FRAMES  64
+#define RING_FRAMES   512
+
+#define SOURCE_INPUT  0
+#define SOURCE_TONE   1
+
+static int32_t input[BLOCK_FRAMES * 2];
+static int32_t tone[BLOCK_FRAMES * 2];
+static int32_t mixed[BLOCK_FRAMES * 2];
+static uint32_t phase = 0;
+static uint32_t fadeMs = 50;
+static uint32_t typedMs = 0;
+
+HiFiSwitcher switcher;
+unsigned long lastReport = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.configureRx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_TK_RK_CLK, 32);
+
+  if (!HiFi.beginFrames(RING_FRAMES))
+  {
+    Serial.println("Not enough memory for the rings");
+    while (1);
+  }
+
+  switcher.begin(2, SOURCE_INPUT);
+
+  // One block of silence ahead of the first real one
+  memset(mixed, 0, sizeof(mixed));
+  HiFi.writeFrames(mixed, BLOCK_FRAMES, 0);
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableRx(true);
+  HiFi.enableTx(true);
+}
+
+void loop() {
+  uint32_t frames = HiFi.readFrames(input, BLOCK_FRAMES, 100);
+
+  // -12dBFS tone on both channels
+  for (uint32_t i = 0; i < frames; i++)
+  {
+    int32_t s = hifi_sin_q31(phase) >> 2;
+    tone[2 * i] = s;
+    tone[2 * i + 1] = s;
+    phase += hifi_angle(1000, SAMPLE_RATE);
+  }
+
+  const int32_t *out = switcher.process(input, tone, mixed, frames);
+  HiFi.writeFrames(out, frames, 100);
+
+  while (Serial.available())
+  {
+    char c = Serial.read();
+    uint8_t source = 0xFF;
+
+    if (c >= '0' && c <= '9')
+    {
+      typedMs = typedMs * 10 + (c - '0');
+      continue;
+    }
+    if (typedMs)
+    {
+      fadeMs = typedMs;
+      typedMs = 0;
+    }
+
+    if (c == 'i')
+    {
+      source = SOURCE_INPUT;
+    }
+    else if (c == 't')
+    {
+      source = SOURCE_TONE;
+    }
+    else if (c == 'c')
+    {
+      fadeMs = 0;
+    }
+
+    if (source != 0xFF)
+    {
+      uint32_t at = switcher.getFrame() + SAMPLE_RATE / 4;
+      uint32_t fade = fadeMs * (SAMPLE_RATE / 1000);
+
+      if (fade > 0xFFFF)
+      {
+        fade = 0xFFFF;
+      }
+      if (switcher.select(source, at, fade))
+      {
+        Serial.print("Switching to the ");
+        Serial.print(source == SOURCE_TONE ? "tone" : "input");
+        Serial.print(" at frame ");
+        Serial.print(at);
+        Serial.print(" over ");
+        Serial.print(fade);
+        Serial.println(" frames");
+      }
+      else
+      {
+        Serial.println("Still fading");
+      }
+    }
+  }
+
+  if (millis() - lastReport >= 1000)
+  {
+    lastReport = millis();
+    Serial.print("Switcher cycles per block: ");
+    Serial.print(switcher.getCycleMeter().getCycles());
+    Serial.print(" (peak ");
+    Serial.print(switcher.getCycleMeter().getPeakCycles());
+    Serial.println(")");
+  }
+}
@@ -0,0 +1,142 @@
+/*
+  This example runs the microphone side of an intercom through a
+  telephony codec and straight back out, so the coded voice can be heard
+  and the cost measured.  In a real product the packets would go over
+  the link between the two ends instead.  The codec setup is the same as
+  in the StreamFromLoop example, with the codec set to a 16kHz sample
+  rate.
+
+  Every 20ms packet of the left input is coded with G.722 (wideband, one
+  byte per two samples) or, with CODEC set to 711, G.711 mu-law (one byte
+  per sample; at 16kHz that is twice the usual 8kHz rate, but the coding
+  is the same), then decoded into both outputs.
+
+  Once a second the sketch prints the link rate against raw 16 bit mono
+  PCM, and the cycles the encoder and decoder took for the last packet
+  with the share of the CPU that amounts to.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiG711.h>
+#include <HiFiG722.h>
+
+#define CODEC           722
+#define SAMPLE_RATE     16000
+#define PACKET_FRAMES   (SAMPLE_RATE / 50)
+
+#if CODEC == 722
+#define PACKET_BYTES    (PACKET_FRAMES / 2)
+#else
+#define PACKET_BYTES    PACKET_FRAMES
+#endif
+
+static int32_t block[PACKET_FRAMES * 2];
+static uint8_t packet[PACKET_BYTES];
+
+HiFiG722Encoder g722Encoder;
+HiFiG722Decoder g722Decoder;
+HiFiG711 g711(HIFI_G711_ULAW);
+
+unsigned long lastReport = 0;
+uint32_t linkBytes = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.configureRx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_TK_RK_CLK, 32);
+
+  if (!HiFi.beginFrames(4 * PACKET_FRAMES))
+  {
+    Serial.println("Not enough memory for the rings");
+    while (1);
+  }
+
+  // One packet of silence ahead of the first real one
+  memset(block, 0, sizeof(block));
+  HiFi.writeFrames(block, PACKET_FRAMES, 0);
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableRx(true);
+  HiFi.enableTx(true);
+}
+
+void loop() {
+  if (HiFi.readFrames(block, PACKET_FRAMES, 100) != PACKET_FRAMES)
+  {
+    return;
+  }
+
+  // Left channel in, one packet out
+#if CODEC == 722
+  g722Encoder.encode(block, packet, PACKET_FRAMES, 2);
+#else
+  g711.encode(block, packet, PACKET_FRAMES, 2);
+#endif
+  linkBytes += PACKET_BYTES;
+
+  // ... and back into the left channel, copied to the right.
+#if CODEC == 722
+  g722Decoder.decode(packet, block, PACKET_BYTES, 2);
+#else
+  g711.decode(packet, block, PACKET_FRAMES, 2);
+#endif
+  for (uint16_t i = 0; i < PACKET_FRAMES; i++)
+  {
+    block[2 * i + 1] = block[2 * i];
+  }
+  HiFi.writeFrames(block, PACKET_FRAMES, 100);
+
+  if (millis() - lastReport >= 1000)
+  {
+    unsigned long seconds = (millis() - lastReport + 500) / 1000;
+    lastReport = millis();
+
+#if CODEC == 722
+    const HiFiCycleMeter &enc = g722Encoder.getCycleMeter();
+    const HiFiCycleMeter &dec = g722Decoder.getCycleMeter();
+#else
+    const HiFiCycleMeter &enc = g711.getEncodeMeter();
+    const HiFiCycleMeter &dec = g711.getDecodeMeter();
+#endif
+
+    Serial.print("G.");
+    Serial.print(CODEC);
+    Serial.print(": ");
+    Serial.print(linkBytes / seconds);
+    Serial.print(" bytes/s on the link (PCM ");
+    Serial.print(SAMPLE_RATE * 2);
+    Serial.print("), encode ");
+    Serial.print(enc.getCycles());
+    Serial.print(" cycles/packet (");
+    Serial.print(enc.getLoad(PACKET_FRAMES, SAMPLE_RATE));
+    Serial.print("%), decode ");
+    Serial.print(dec.getCycles());
+    Serial.print(" cycles/packet (");
+    Serial.print(dec.getLoad(PACKET_FRAMES, SAMPLE_RATE));
+    Serial.print("%), underruns ");
+    Serial.println(HiFi.getUnderruns());
+    linkBytes = 0;
+  }
+}
@@ -0,0 +1,214 @@
+/*
+  This example measures how long the SSC interrupt takes to start after
+  each frame sync edge, with and without background load, and prints a
+  histogram every two seconds.  The codec setup is the same as in the
+  Passthrough example.  Wire the codec's LRCLK to pin 5 as well.
+
+  Type a letter in the serial monitor to change the load:
+
+    n  no extra load
+    t  10kHz timer interrupt, busy for 4us, same priority as the SSC
+    l  the same timer at the lowest priority
+    c  loop() disables interrupts for 10us every millisecond
+    s  loop() floods the serial port
+    p  toggle the SSC priority between 0 (highest) and 1
+
+  The worst case, as a share of the frame period, is the part of every
+  frame the audio path can't count on.  Block processing has to fit in
+  what is left, across as many frames as the block is long.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiLatencyProbe.h>
+
+void codecTxReadyInterrupt(HiFiChannelID_t);
+void codecRxReadyInterrupt(HiFiChannelID_t);
+
+HiFiLatencyProbe probe;
+
+static uint32_t ldata = 0;
+static uint32_t rdata = 0;
+
+char load = 'n';
+uint8_t sscPriority = 0;
+unsigned long lastReport = 0;
+unsigned long lastCritical = 0;
+
+void setLoad(char c)
+{
+  switch (c)
+  {
+    case 'n':
+    case 'c':
+    case 's':
+      probe.setTimerLoad(0, 0, 0);
+      break;
+
+    case 't':
+      probe.setTimerLoad(10000, 4, 0);
+      break;
+
+    case 'l':
+      probe.setTimerLoad(10000, 4, 15);
+      break;
+
+    case 'p':
+      sscPriority ^= 1;
+      NVIC_SetPriority(SSC_IRQn, sscPriority);
+      return;
+
+    default:
+      return;
+  }
+  load = c;
+}
+
+void report()
+{
+  Serial.println();
+  Serial.print("load '");
+  Serial.print(load);
+  Serial.print("', SSC priority ");
+  Serial.print(sscPriority);
+  Serial.print(", ");
+  Serial.print(probe.getFrames());
+  Serial.print(" frames, ");
+  Serial.print(probe.getMissedEdges());
+  Serial.println(" missed");
+
+  uint32_t period = probe.getFramePeriod();
+  Serial.print("latency min ");
+  Serial.print(probe.getMinLatency());
+  Serial.print(" mean ");
+  Serial.print(probe.getMeanLatency());
+  Serial.print(" 99.9% ");
+  Serial.print(probe.getPercentile(99.9));
+  Serial.print(" max ");
+  Serial.print(probe.getMaxLatency());
+  Serial.print(" ns, frame ");
+  Serial.print(period);
+  Serial.print(" ns");
+  if (period)
+  {
+    Serial.print(", worst case ");
+    Serial.print(100.0 * probe.getMaxLatency() / period, 1);
+    Serial.print("% of a frame");
+  }
+  Serial.println();
+
+  const volatile uint32_t *bins = probe.getHistogram();
+  uint32_t most = 1;
+  for (uint8_t i = 0; i < probe.getBinCount(); i++)
+  {
+    if (bins[i] > most)
+    {
+      most = bins[i];
+    }
+  }
+
+  for (uint8_t i = 0; i < probe.getBinCount(); i++)
+  {
+    if (bins[i] == 0)
+    {
+      continue;
+    }
+    Serial.print(i * probe.getBinWidth());
+    Serial.print(i == probe.getBinCount() - 1 ? "+ ns\t" : " ns\t");
+    Serial.print(bins[i]);
+    Serial.print('\t');
+    // Log-ish bars so single outliers still show up
+    uint8_t bar = 1 + (uint8_t)(40.0 * log10((float)bins[i]) /
+                                log10((float)most + 1.0));
+    while (bar--)
+    {
+      Serial.print('#');
+    }
+    Serial.println();
+  }
+  probe.reset();
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.onTxReady(codecTxReadyInterrupt);
+  HiFi.configureRx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_TK_RK_CLK, 32);
+  HiFi.onRxReady(codecRxReadyInterrupt);
+
+  probe.begin(250);
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableRx(true);
+  HiFi.enableTx(true);
+}
+
+void loop() {
+  if (Serial.available())
+  {
+    setLoad(Serial.read());
+  }
+
+  if (load == 'c' && micros() - lastCritical >= 1000)
+  {
+    lastCritical = micros();
+    noInterrupts();
+    delayMicroseconds(10);
+    interrupts();
+  }
+  else if (load == 's')
+  {
+    Serial.println("0123456789abcdefghijklmnopqrstuvwxyz");
+  }
+
+  if (millis() - lastReport >= 2000)
+  {
+    lastReport = millis();
+    report();
+  }
+}
+
+void codecTxReadyInterrupt(HiFiChannelID_t channel)
+{
+  if (channel == HIFI_CHANNEL_ID_1)
+  {
+    HiFi.write(ldata);
+  }
+  else
+  {
+    HiFi.write(rdata);
+  }
+}
+
+void codecRxReadyInterrupt(HiFiChannelID_t channel)
+{
+  if (channel == HIFI_CHANNEL_ID_1)
+  {
+    ldata = HiFi.read();
+  }
+  else
+  {
+    rdata = HiFi.read();
+  }
+}
@@ -0,0 +1,129 @@
+/*
+  This example times the fixed point functions in HiFiMath.h against the
+  float libm calls they replace, on the Due itself.
+
+  No codec is needed.  Each function is called on a few hundred different
+  inputs and the average cost per call is printed in cycles, next to the
+  libm equivalent and the speed-up.  The inputs are worked out before the
+  timing starts so only the calls themselves are measured.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFiMath.h>
+
+#define CALLS   256
+
+uint32_t fixedIn[CALLS];
+float floatIn[CALLS];
+volatile int32_t fixedOut;
+volatile float floatOut;
+HiFiCycleMeter meter;
+
+// Each test makes one call on input i.
+void fixedSin(uint16_t i) { fixedOut = hifi_sin_q31(fixedIn[i]); }
+void floatSin(uint16_t i) { floatOut = sinf(floatIn[i]); }
+void fixedTan(uint16_t i) { fixedOut = hifi_tan_q24(fixedIn[i] >> 2); }
+void floatTan(uint16_t i) { floatOut = tanf(floatIn[i] * 0.25f); }
+void fixedExp2(uint16_t i) { fixedOut = hifi_exp2_q31(fixedIn[i]); }
+void floatExp2(uint16_t i) { floatOut = exp2f(floatIn[i]); }
+void fixedDbToGain(uint16_t i) { fixedOut = hifi_db_to_q31(fixedIn[i]); }
+void floatDbToGain(uint16_t i) { floatOut = powf(10.0f, floatIn[i] / 20.0f); }
+void fixedLog2(uint16_t i) { fixedOut = hifi_log2_q24(fixedIn[i]); }
+void floatLog2(uint16_t i) { floatOut = log2f(floatIn[i]); }
+void fixedGainToDb(uint16_t i) { fixedOut = hifi_q31_to_db_q16(fixedIn[i]); }
+void floatGainToDb(uint16_t i) { floatOut = 20.0f * log10f(floatIn[i]); }
+void fixedSqrt(uint16_t i) { fixedOut = hifi_sqrt_u32(fixedIn[i]); }
+void floatSqrt(uint16_t i) { floatOut = sqrtf(floatIn[i]); }
+void fixedSqrt64(uint16_t i)
+{
+  fixedOut = hifi_sqrt_u64((uint64_t)fixedIn[i] * fixedIn[i]);
+}
+void doubleSqrt(uint16_t i)
+{
+  floatOut = sqrt((double)fixedIn[i] * fixedIn[i]);
+}
+
+// Average cycles per call over all the inputs.
+uint32_t timeCalls(void (*call)(uint16_t))
+{
+  meter.start();
+  for (uint16_t i = 0; i < CALLS; i++)
+  {
+    call(i);
+  }
+  meter.stop();
+  return meter.getCycles() / CALLS;
+}
+
+void report(const char *fixedName, void (*fixedCall)(uint16_t),
+            const char *floatName, void (*floatCall)(uint16_t))
+{
+  uint32_t fixedCycles = timeCalls(fixedCall);
+  uint32_t floatCycles = timeCalls(floatCall);
+  char line[80];
+
+  sprintf(line, "%-20s %5lu   %-16s %6lu   x%lu", fixedName,
+          (unsigned long)fixedCycles, floatName, (unsigned long)floatCycles,
+          (unsigned long)(fixedCycles ? floatCycles / fixedCycles : 0));
+  Serial.println(line);
+}
+
+void setup() {
+  Serial.begin(115200);
+  hifi_cycle_counter_enable();
+
+  Serial.println("cycles per call:");
+  Serial.println("fixed point                  libm (float)");
+
+  // Angles over a full turn
+  for (uint16_t i = 0; i < CALLS; i++)
+  {
+    fixedIn[i] = (uint32_t)random(0, 0x7FFFFFFF) << 1;
+    floatIn[i] = fixedIn[i] * (6.2831853f / 4294967296.0f);
+  }
+  report("hifi_sin_q31", fixedSin, "sinf", floatSin);
+  report("hifi_tan_q24", fixedTan, "tanf", floatTan);
+
+  // Exponents of -16 .. 0
+  for (uint16_t i = 0; i < CALLS; i++)
+  {
+    fixedIn[i] = (uint32_t)-random(0, 16L << 16);
+    floatIn[i] = (int32_t)fixedIn[i] / 65536.0f;
+  }
+  report("hifi_exp2_q31", fixedExp2, "exp2f", floatExp2);
+
+  // dB of -96 .. 0
+  for (uint16_t i = 0; i < CALLS; i++)
+  {
+    fixedIn[i] = (uint32_t)-random(0, 96L << 16);
+    floatIn[i] = (int32_t)fixedIn[i] / 65536.0f;
+  }
+  report("hifi_db_to_q31", fixedDbToGain, "powf(10, dB/20)", floatDbToGain);
+
+  // Levels across the Q31 range
+  for (uint16_t i = 0; i < CALLS; i++)
+  {
+    fixedIn[i] = (uint32_t)random(1, 0x7FFFFFFF) >> random(0, 24);
+    floatIn[i] = fixedIn[i] / 2147483648.0f;
+  }
+  report("hifi_log2_q24", fixedLog2, "log2f", floatLog2);
+  report("hifi_q31_to_db_q16", fixedGainToDb, "20*log10f", floatGainToDb);
+  report("hifi_sqrt_u32", fixedSqrt, "sqrtf", floatSqrt);
+  report("hifi_sqrt_u64", fixedSqrt64, "sqrt (double)", doubleSqrt);
+}
+
+void loop() {
+}
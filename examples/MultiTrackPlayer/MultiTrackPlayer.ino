@@ -0,0 +1,142 @@
+/*
+  This example plays up to eight WAV stems from an SD card in sync and
+  loops them, as for an installation.  Put files named STEM1.WAV,
+  STEM2.WAV, ... on the card (16 or 24 bit, mono or stereo, all at
+  48kHz); as many as are found are played.  The SD card is on the SPI
+  header with its chip select on pin 4 (as on the Ethernet shield).  The
+  codec setup is the same as in the Passthrough example.
+
+  Audio is handed to the transmitter in blocks using a pair of ping-pong
+  buffers; loop() mixes the next block whenever one has gone out and
+  spends the rest of its time reading the card.
+
+  Once a second it prints the read rate the card is giving and how many
+  tracks of each format that would sustain, which is the figure to check
+  a card against before an installation.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <SPI.h>
+#include <SD.h>
+#include <HiFi.h>
+#include <HiFiMultiTrack.h>
+
+#define SAMPLE_RATE   48000
+#define BLOCK_FRAMES  64
+#define SD_CS_PIN     4
+
+void codecTxReadyInterrupt(HiFiChannelID_t);
+
+static int32_t txBlock[2][BLOCK_FRAMES * 2];
+static volatile uint8_t activeBlock = 0;
+static volatile bool blockReady = false;
+static uint16_t txFrame = 0;
+
+HiFiMultiTrack player;
+unsigned long lastReport = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!SD.begin(SD_CS_PIN))
+  {
+    Serial.println("no SD card");
+    while (1);
+  }
+
+  player.begin();
+  for (uint8_t i = 1; i <= HIFI_MULTI_TRACK_MAX_TRACKS; i++)
+  {
+    char name[12];
+    sprintf(name, "STEM%d.WAV", i);
+    if (player.addTrack(name) < 0)
+    {
+      break;
+    }
+    Serial.print("opened ");
+    Serial.println(name);
+  }
+  if (player.getTrackCount() == 0)
+  {
+    Serial.println("no stems found");
+    while (1);
+  }
+
+  // Keep the sum of all the stems from clipping
+  for (uint8_t i = 0; i < player.getTrackCount(); i++)
+  {
+    player.setGain(i, 1.0f / player.getTrackCount());
+  }
+  player.setLoop(true);
+  player.play();
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.onTxReady(codecTxReadyInterrupt);
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableTx(true);
+}
+
+void loop() {
+  if (blockReady)
+  {
+    // The interrupt is sending the other buffer now.
+    uint8_t block = activeBlock ^ 1;
+    blockReady = false;
+
+    memset(txBlock[block], 0, sizeof(txBlock[block]));
+    player.process(txBlock[block], BLOCK_FRAMES);
+  }
+
+  player.service();
+
+  if (millis() - lastReport >= 1000)
+  {
+    lastReport = millis();
+    Serial.print("card ");
+    Serial.print(player.getReadRate() / 1024);
+    Serial.print("K bytes/s, max tracks: mono16 ");
+    Serial.print(player.getMaxTracks(1, 16));
+    Serial.print(" stereo16 ");
+    Serial.print(player.getMaxTracks(2, 16));
+    Serial.print(" stereo24 ");
+    Serial.print(player.getMaxTracks(2, 24));
+    Serial.print(", underruns ");
+    Serial.println(player.getUnderruns());
+  }
+}
+
+void codecTxReadyInterrupt(HiFiChannelID_t channel)
+{
+  HiFi.write(txBlock[activeBlock][txFrame * 2 + channel]);
+
+  if (channel == HIFI_CHANNEL_ID_2)
+  {
+    if (++txFrame == BLOCK_FRAMES)
+    {
+      txFrame = 0;
+      activeBlock ^= 1;
+      blockReady = true;
+    }
+  }
+}
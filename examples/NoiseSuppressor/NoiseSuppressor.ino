@@ -0,0 +1,134 @@
+/*
+  This example takes steady background noise (fans, air conditioning)
+  out of the left input and plays the result on both outputs.  The codec
+  setup is the same as in the StreamFromLoop example.
+
+  Leave a few seconds of just the noise at the start so the suppressor
+  can learn it.  Type in the serial monitor:
+
+    b  bypass on/off, to compare
+    f  freeze the noise estimate / let it track again
+    r  forget the noise estimate and start again
+
+  Once a second the sketch prints the cycles per block, the share of the
+  CPU that amounts to and the delay the suppressor adds, which is what to
+  budget for when adding it to another sketch.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiNoiseSuppressor.h>
+
+#define SAMPLE_RATE   48000
+#define LOG2_SIZE     8
+
+HiFiNoiseSuppressor suppressor;
+
+static int32_t block[(1 << LOG2_SIZE) / 2 * 2];
+uint16_t blockFrames;
+bool bypass = false;
+bool frozen = false;
+unsigned long lastReport = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!suppressor.begin(LOG2_SIZE, SAMPLE_RATE))
+  {
+    Serial.println("Not enough memory for the suppressor");
+    while (1);
+  }
+  blockFrames = suppressor.getBlockSize();
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.configureRx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_TK_RK_CLK, 32);
+
+  if (!HiFi.beginFrames(4 * blockFrames))
+  {
+    Serial.println("Not enough memory for the rings");
+    while (1);
+  }
+
+  // One block of silence ahead of the first real one
+  memset(block, 0, sizeof(block));
+  HiFi.writeFrames(block, blockFrames, 0);
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableRx(true);
+  HiFi.enableTx(true);
+}
+
+void loop() {
+  if (HiFi.readFrames(block, blockFrames, 100) != blockFrames)
+  {
+    return;
+  }
+
+  if (!bypass)
+  {
+    suppressor.process(block, 2);
+  }
+  for (uint16_t i = 0; i < blockFrames; i++)
+  {
+    block[2 * i + 1] = block[2 * i];
+  }
+  HiFi.writeFrames(block, blockFrames, 100);
+
+  while (Serial.available())
+  {
+    switch (Serial.read())
+    {
+      case 'b':
+        bypass = !bypass;
+        break;
+
+      case 'f':
+        frozen = !frozen;
+        suppressor.freezeNoise(frozen);
+        break;
+
+      case 'r':
+        suppressor.reset();
+        break;
+    }
+  }
+
+  if (millis() - lastReport >= 1000)
+  {
+    lastReport = millis();
+
+    const HiFiCycleMeter &meter = suppressor.getCycleMeter();
+    Serial.print(bypass ? "bypassed" : (frozen ? "noise frozen" : "tracking"));
+    Serial.print(": ");
+    Serial.print(meter.getCycles());
+    Serial.print(" cycles/block (peak ");
+    Serial.print(meter.getPeakCycles());
+    Serial.print("), ");
+    Serial.print(meter.getLoad(blockFrames, SAMPLE_RATE));
+    Serial.print("% CPU, latency ");
+    Serial.print(1000.0 * suppressor.getLatency() / SAMPLE_RATE);
+    Serial.print(" ms + ");
+    Serial.print(1000.0 * blockFrames / SAMPLE_RATE);
+    Serial.println(" ms block");
+  }
+}
@@ -0,0 +1,235 @@
+/*
+  This example measures what running from SRAM instead of flash saves on
+  the Due.  No codec is needed; results are printed over serial.
+
+  The first two lines time the same wavetable oscillator kernel (a
+  typical interrupt-time job: table reads, interpolation, a few
+  branches) compiled once into flash reading a table in flash, and once
+  into SRAM reading a copy of the table in SRAM.
+
+  The other lines time library code that HIFI_RUN_FROM_RAM moves: the
+  ring transfers behind readFrames()/writeFrames() (driven by a
+  simulated transport so no codec is needed, so the figure includes the
+  simulation's own overhead) and a 256 point FFT.  Build the sketch once
+  with HIFI_RUN_FROM_RAM set to 0 in HiFiConfig.h and once with it set
+  to 1 to compare them.
+
+  The last two lines time the register reads the SSC interrupt makes to
+  find out what happened: the ssc.c driver calls it used to make
+  (status, then "tx ready?" and "rx ready?", each re-reading the status
+  register) against the single inline read in HiFiSscRegs.h.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiSimTransport.h>
+#include <HiFiFft.h>
+#include <HiFiDsp.h>
+#include <HiFiSscRegs.h>
+#include <ssc.h>
+
+#define BLOCK_FRAMES  64
+#define TABLE_SIZE    512
+#define RUNS          100
+
+// Forced into SRAM whatever HIFI_RUN_FROM_RAM is set to, so both
+// versions of the kernel can be compared in one build.
+#define IN_SRAM       __attribute__((section(".ramfunc"), noinline))
+#define IN_FLASH      __attribute__((noinline))
+
+void oscFlash(int32_t *out, uint16_t frames, const int16_t *table) IN_FLASH;
+void oscRam(int32_t *out, uint16_t frames, const int16_t *table) IN_SRAM;
+uint32_t statusAsf() IN_FLASH;
+uint32_t statusInline() IN_FLASH;
+
+// Interpolating table oscillator writing a stereo block.
+#define OSC_KERNEL                                                    \
+  static uint32_t phase = 0;                                          \
+  const uint32_t increment = 0x01234567;                              \
+                                                                      \
+  for (uint16_t i = 0; i < frames; i++)                               \
+  {                                                                   \
+    uint32_t index = phase >> 23;                                     \
+    int32_t frac = (phase >> 8) & 0x7FFF;                             \
+    int32_t a = table[index];                                         \
+    int32_t b = table[(index + 1) & (TABLE_SIZE - 1)];                \
+    int32_t s = (a + (((b - a) * frac) >> 15)) << 16;                 \
+    out[2 * i] = s;                                                   \
+    out[2 * i + 1] = (s < 0) ? -s : s;                                \
+    phase += increment;                                               \
+  }
+
+void oscFlash(int32_t *out, uint16_t frames, const int16_t *table)
+{
+  OSC_KERNEL
+}
+
+void oscRam(int32_t *out, uint16_t frames, const int16_t *table)
+{
+  OSC_KERNEL
+}
+
+// Only the access time matters, so the flash copy can stay silent.
+static const int16_t flashTable[TABLE_SIZE] = { 0 };
+static int16_t ramTable[TABLE_SIZE];
+static int32_t block[BLOCK_FRAMES * 2];
+static int32_t fftData[256];
+
+HiFiSimTransport sim;
+HiFiClass simHiFi(sim);
+HiFiFft fft;
+
+void report(const char *name, uint32_t cycles, uint32_t frames)
+{
+  Serial.print(name);
+  Serial.print(cycles);
+  Serial.print(" cycles");
+  if (frames)
+  {
+    Serial.print(", ");
+    Serial.print((float)cycles / frames);
+    Serial.print(" per frame");
+  }
+  Serial.println();
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial);
+
+  hifi_cycle_counter_enable();
+
+  for (uint16_t i = 0; i < TABLE_SIZE; i++)
+  {
+    ramTable[i] = (int16_t)(32767.0 * sin(2.0 * PI * i / TABLE_SIZE));
+  }
+
+  simHiFi.begin();
+  simHiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  simHiFi.configureRx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  simHiFi.beginFrames(BLOCK_FRAMES * 2);
+  simHiFi.enableTx(true);
+  simHiFi.enableRx(true);
+
+  fft.begin(8);
+
+  // Clock the SSC so its registers can be read; it stays disabled.
+  pmc_enable_periph_clk(ID_SSC);
+}
+
+// What the SSC interrupt did per word before HiFiSscRegs.h.
+uint32_t statusAsf()
+{
+  uint32_t status = ssc_get_status(SSC);
+  uint32_t events = status & (SSC_SR_TXSYN | SSC_SR_RXSYN);
+
+  if (ssc_is_tx_ready(SSC) == SSC_RC_YES)
+  {
+    events |= 1;
+  }
+  if (ssc_is_rx_ready(SSC) == SSC_RC_YES)
+  {
+    events |= 2;
+  }
+  return events;
+}
+
+uint32_t statusInline()
+{
+  uint32_t status = hifi_ssc_status(SSC);
+  uint32_t events = status & (SSC_SR_TXSYN | SSC_SR_RXSYN);
+
+  if (hifi_ssc_tx_ready(status))
+  {
+    events |= 1;
+  }
+  if (hifi_ssc_rx_ready(status))
+  {
+    events |= 2;
+  }
+  return events;
+}
+
+void loop() {
+  HiFiCycleMeter flashMeter;
+  HiFiCycleMeter ramMeter;
+  HiFiCycleMeter ringMeter;
+  HiFiCycleMeter fftMeter;
+  HiFiCycleMeter asfMeter;
+  HiFiCycleMeter inlineMeter;
+  volatile uint32_t events;
+
+  // Best of several runs, to leave out the odd interrupt.
+  uint32_t best[6] = { 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+                       0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF };
+  HiFiCycleMeter *meters[6] = { &flashMeter, &ramMeter, &ringMeter,
+                                &fftMeter, &asfMeter, &inlineMeter };
+
+  for (uint16_t run = 0; run < RUNS; run++)
+  {
+    flashMeter.start();
+    oscFlash(block, BLOCK_FRAMES, flashTable);
+    flashMeter.stop();
+
+    ramMeter.start();
+    oscRam(block, BLOCK_FRAMES, ramTable);
+    ramMeter.stop();
+
+    simHiFi.writeFrames(block, BLOCK_FRAMES, 0);
+    ringMeter.start();
+    sim.run(BLOCK_FRAMES);
+    ringMeter.stop();
+    simHiFi.readFrames(block, BLOCK_FRAMES, 0);
+
+    for (uint16_t i = 0; i < 256; i++)
+    {
+      fftData[i] = block[i & (BLOCK_FRAMES * 2 - 1)];
+    }
+    fftMeter.start();
+    fft.forwardReal(fftData, true);
+    fftMeter.stop();
+
+    asfMeter.start();
+    events = statusAsf();
+    asfMeter.stop();
+
+    inlineMeter.start();
+    events = statusInline();
+    inlineMeter.stop();
+
+    for (uint8_t m = 0; m < 6; m++)
+    {
+      if (meters[m]->getCycles() < best[m])
+      {
+        best[m] = meters[m]->getCycles();
+      }
+    }
+  }
+
+  Serial.print("HIFI_RUN_FROM_RAM = ");
+  Serial.println(HIFI_RUN_FROM_RAM);
+  report("Oscillator, flash:       ", best[0], BLOCK_FRAMES);
+  report("Oscillator, SRAM:        ", best[1], BLOCK_FRAMES);
+  report("Ring transfers (sim):    ", best[2], BLOCK_FRAMES);
+  report("256 point real FFT:      ", best[3], 0);
+  Serial.print("Saved by SRAM per frame: ");
+  Serial.println(((float)best[0] - best[1]) / BLOCK_FRAMES);
+  report("SSC status, ssc.c:       ", best[4], 0);
+  report("SSC status, inline:      ", best[5], 0);
+  Serial.println();
+
+  delay(2000);
+}
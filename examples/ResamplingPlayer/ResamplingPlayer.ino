@@ -0,0 +1,203 @@
+/*
+  This example plays a WAV file from an SD card through a codec clocked
+  at 48kHz, converting it on the fly if it was recorded at 44.1kHz (as
+  anything ripped from a CD is).  Put a file named PLAY.WAV on the card
+  (16 or 24 bit, mono or stereo, 44.1kHz or 48kHz); it is played in a
+  loop.  The SD card is on the SPI header with its chip select on pin 4
+  and the codec setup is the same as in the StreamFromLoop example.
+
+  Everything happens in loop(): read a chunk of the file, convert it to
+  Q31 frames, run it through the resampler and hand the result to
+  HiFi.writeFrames(), which waits while the transmit ring is full.
+
+  Once a second it prints what the conversion costs, in cycles per
+  output frame and as a share of the CPU, and the transmit underruns,
+  which should stay at zero.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <SPI.h>
+#include <SD.h>
+#include <HiFi.h>
+#include <HiFiWav.h>
+#include <HiFiResampler.h>
+
+#define SAMPLE_RATE   48000
+#define RING_FRAMES   2048
+#define IN_FRAMES     128
+#define OUT_FRAMES    128
+#define SD_CS_PIN     4
+
+File file;
+HiFiWav wav;
+HiFiResampler resampler;
+bool convert;
+
+static uint8_t raw[IN_FRAMES * 6];
+static int32_t inBlock[IN_FRAMES * 2];
+static int32_t outBlock[OUT_FRAMES * 2];
+static uint16_t inFrames = 0;
+static uint16_t inUsed = 0;
+
+uint32_t maxCyclesPerFrame = 0;
+unsigned long lastReport = 0;
+
+// Read the next chunk of the file as stereo Q31 frames, going back to the
+// start at the end.
+uint16_t readChunk()
+{
+  uint32_t left = wav.getDataOffset() + wav.getDataBytes() - file.position();
+  uint16_t frames = IN_FRAMES;
+
+  if (left < (uint32_t)frames * wav.getFrameBytes())
+  {
+    frames = left / wav.getFrameBytes();
+  }
+  if (frames == 0)
+  {
+    file.seek(wav.getDataOffset());
+    return 0;
+  }
+  file.read(raw, frames * wav.getFrameBytes());
+
+  const uint8_t *p = raw;
+  for (uint16_t i = 0; i < frames; i++)
+  {
+    for (uint8_t c = 0; c < wav.getChannels(); c++)
+    {
+      int32_t s;
+      if (wav.getBitsPerSample() == 16)
+      {
+        s = (int32_t)((uint32_t)p[0] << 16 | (uint32_t)p[1] << 24);
+        p += 2;
+      }
+      else
+      {
+        s = (int32_t)((uint32_t)p[0] << 8 | (uint32_t)p[1] << 16 |
+                      (uint32_t)p[2] << 24);
+        p += 3;
+      }
+      inBlock[2 * i + c] = s;
+    }
+    if (wav.getChannels() == 1)
+    {
+      inBlock[2 * i + 1] = inBlock[2 * i];
+    }
+  }
+  return frames;
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!SD.begin(SD_CS_PIN))
+  {
+    Serial.println("no SD card");
+    while (1);
+  }
+  file = SD.open("PLAY.WAV");
+  if (!file || !wav.parse(file))
+  {
+    Serial.println("can't play PLAY.WAV");
+    while (1);
+  }
+  if (wav.getSampleRate() == 44100)
+  {
+    convert = true;
+  }
+  else if (wav.getSampleRate() == SAMPLE_RATE)
+  {
+    convert = false;
+  }
+  else
+  {
+    Serial.println("PLAY.WAV must be 44.1kHz or 48kHz");
+    while (1);
+  }
+  Serial.print(wav.getSampleRate());
+  Serial.print(" Hz, ");
+  Serial.print(wav.getChannels());
+  Serial.print(" channel(s), ");
+  Serial.print(wav.getBitsPerSample());
+  Serial.println(convert ? " bit, converting to 48kHz" : " bit");
+
+  resampler.begin(2);
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+
+  if (!HiFi.beginFrames(RING_FRAMES))
+  {
+    Serial.println("Not enough memory for the rings");
+    while (1);
+  }
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableTx(true);
+}
+
+void loop() {
+  if (inUsed == inFrames)
+  {
+    inFrames = readChunk();
+    inUsed = 0;
+    return;
+  }
+
+  if (!convert)
+  {
+    HiFi.writeFrames(inBlock, inFrames, 100);
+    inUsed = inFrames;
+  }
+  else
+  {
+    uint16_t used;
+    uint16_t frames = resampler.process(inBlock + 2 * inUsed,
+                                        inFrames - inUsed, used,
+                                        outBlock, OUT_FRAMES);
+    inUsed += used;
+    HiFi.writeFrames(outBlock, frames, 100);
+
+    // Only whole blocks are representative of the steady cost.
+    if (frames == OUT_FRAMES &&
+        resampler.getCyclesPerFrame() > maxCyclesPerFrame)
+    {
+      maxCyclesPerFrame = resampler.getCyclesPerFrame();
+    }
+  }
+
+  if (millis() - lastReport >= 1000)
+  {
+    lastReport = millis();
+    if (convert)
+    {
+      Serial.print("resampler: ");
+      Serial.print(maxCyclesPerFrame);
+      Serial.print(" cycles/frame (");
+      Serial.print(100.0 * maxCyclesPerFrame * SAMPLE_RATE / F_CPU, 1);
+      Serial.print("% CPU)  ");
+      maxCyclesPerFrame = 0;
+    }
+    Serial.print("underruns: ");
+    Serial.println(HiFi.getUnderruns());
+  }
+}
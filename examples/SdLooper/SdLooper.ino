@@ -0,0 +1,146 @@
+/*
+  This example is a loop recorder with the loop kept on an SD card, so its
+  length is set by the file rather than by RAM.  The codec setup is the same as in the Passthrough
+  example; the SD card is on the SPI header with its chip select on pin 4
+  (as on the Ethernet shield).
+
+  Control it from the serial monitor:
+
+    r  record a new loop
+    o  end the first pass and start overdubbing / start overdubbing
+    p  end the first pass and play / punch out of an overdub / restart
+    s  stop
+    c  clear
+
+  The looper runs in the receive interrupt, a frame at a time: each
+  frame received goes through looper.process() and is sent back out on
+  the next transmit interrupt.  process() only touches the looper's RAM
+  rings, so it is cheap enough for the interrupt.  loop() does nothing
+  but the SD transfers (looper.service()) and the serial commands, so
+  however long the card takes, the audio keeps going.  If the card
+  can't keep up, the looper waits for it and the underrun count printed
+  once a second goes up.  The sustained rate a given card manages while
+  overdubbing (384K bytes/s at 48kHz) hasn't been measured.
+
+  The first run takes a while to write out the 5 minute loop file
+  (about 58M bytes); after that it is reused.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <SPI.h>
+#include <SD.h>
+#include <HiFi.h>
+#include <HiFiLooper.h>
+
+#define SAMPLE_RATE   48000
+#define SD_CS_PIN     4
+
+void codecTxReadyInterrupt(HiFiChannelID_t);
+void codecRxReadyInterrupt(HiFiChannelID_t);
+
+static int32_t rxFrame[2];
+static int32_t txFrame[2];
+
+HiFiLooper looper;
+unsigned long lastReport = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  if (!SD.begin(SD_CS_PIN))
+  {
+    Serial.println("no SD card");
+    while (1);
+  }
+
+  Serial.println("preparing loop file...");
+  if (!looper.begin("LOOP.RAW", 300, SAMPLE_RATE))
+  {
+    Serial.println("couldn't create loop file");
+    while (1);
+  }
+  Serial.println("ready");
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.configureRx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_TK_RK_CLK, 32);
+  HiFi.onTxReady(codecTxReadyInterrupt);
+  HiFi.onRxReady(codecRxReadyInterrupt);
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableRx(true);
+  HiFi.enableTx(true);
+}
+
+void loop() {
+  looper.service();
+
+  if (Serial.available())
+  {
+    bool ok = true;
+
+    switch (Serial.read())
+    {
+    case 'r': ok = looper.record(); break;
+    case 'o': ok = looper.overdub(); break;
+    case 'p': ok = looper.play(); break;
+    case 's': ok = looper.stop(); break;
+    case 'c': looper.clear(); break;
+    default: break;
+    }
+    if (!ok)
+    {
+      Serial.println("not now");
+    }
+  }
+
+  if (millis() - lastReport >= 1000)
+  {
+    lastReport = millis();
+    Serial.print("state ");
+    Serial.print(looper.getState());
+    Serial.print(", loop ");
+    Serial.print((float)looper.getLoopFrames() / SAMPLE_RATE);
+    Serial.print(" s, at ");
+    Serial.print((float)looper.getPosition() / SAMPLE_RATE);
+    Serial.print(" s, underruns ");
+    Serial.println(looper.getUnderruns());
+  }
+}
+
+void codecTxReadyInterrupt(HiFiChannelID_t channel)
+{
+  HiFi.write(txFrame[channel]);
+}
+
+void codecRxReadyInterrupt(HiFiChannelID_t channel)
+{
+  rxFrame[channel] = HiFi.read();
+
+  if (channel == HIFI_CHANNEL_ID_2)
+  {
+    // A whole frame is in: the output goes out from the next one.
+    looper.process(rxFrame, 1);
+    txFrame[0] = rxFrame[0];
+    txFrame[1] = rxFrame[1];
+  }
+}
@@ -0,0 +1,161 @@
+/*
+  This example captures two analog sensors (A0 and A1) with the on-chip
+  ADC in step with the codec audio.  The codec setup is the same as in
+  the Passthrough example; only the receiver is used.
+
+  The ADC scans both pins every 4 audio frames (12kHz at 48kHz), started
+  by the audio interrupt, and delivers 16 scans per buffer, i.e. one
+  buffer per 64 frame audio block.  Audio blocks are collected by the
+  receive callback and stamped with the frame number of their first
+  frame, ADC buffers come stamped from the capture, so loop() can match
+  each ADC buffer to the audio it was taken alongside.
+
+  Once a second the sketch prints the latest ADC buffer's frame, the
+  audio block that contains it, the audio peak over that block and the
+  mean of each sensor.
+
+  To take the timer out of the picture as well, wire the codec's LRCLK to
+  pin 22 too and change the trigger to HIFI_ADC_TRIGGER_TCLK.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiAdcCapture.h>
+#include <HiFiDsp.h>
+
+#define BLOCK_FRAMES      64
+#define FRAMES_PER_SCAN   4
+#define SCANS_PER_BUFFER  (BLOCK_FRAMES / FRAMES_PER_SCAN)
+
+void codecRxReadyInterrupt(HiFiChannelID_t);
+
+static int32_t rxBlock[2][BLOCK_FRAMES * 2];
+static uint32_t blockFrame[2];
+static volatile uint8_t activeBlock = 0;
+static volatile bool blockReady = false;
+static uint16_t rxFrame = 0;
+
+// The last few audio blocks, to look the ADC buffers up in
+#define HISTORY   4
+static uint32_t historyFrame[HISTORY];
+static uint32_t historyPeak[HISTORY];
+static uint8_t historyNext = 0;
+
+HiFiAdcCapture sensors;
+const uint8_t sensorPins[] = { A0, A1 };
+unsigned long lastReport = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureRx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.onRxReady(codecRxReadyInterrupt);
+
+  if (!sensors.begin(HiFi, sensorPins, 2, SCANS_PER_BUFFER, FRAMES_PER_SCAN,
+                     HIFI_ADC_TRIGGER_FRAME))
+  {
+    Serial.println("ADC capture setup failed");
+    while (1);
+  }
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableRx(true);
+  sensors.start();
+}
+
+void loop() {
+  if (blockReady)
+  {
+    uint8_t block = activeBlock ^ 1;
+    blockReady = false;
+
+    historyFrame[historyNext] = blockFrame[block];
+    historyPeak[historyNext] = hifi_block_peak(rxBlock[block],
+                                               BLOCK_FRAMES * 2, 1);
+    historyNext = (historyNext + 1) % HISTORY;
+  }
+
+  uint32_t frame;
+  const uint16_t *scans = sensors.read(frame);
+
+  if (scans && millis() - lastReport >= 1000)
+  {
+    lastReport = millis();
+
+    uint32_t sum[2] = { 0, 0 };
+    for (uint16_t s = 0; s < SCANS_PER_BUFFER; s++)
+    {
+      sum[0] += scans[s * 2];
+      sum[1] += scans[s * 2 + 1];
+    }
+
+    Serial.print("ADC frame ");
+    Serial.print(frame);
+
+    for (uint8_t i = 0; i < HISTORY; i++)
+    {
+      if (frame - historyFrame[i] < BLOCK_FRAMES)
+      {
+        Serial.print(", audio block ");
+        Serial.print(historyFrame[i]);
+        Serial.print(" (+");
+        Serial.print(frame - historyFrame[i]);
+        Serial.print(") peak ");
+        Serial.print(20.0 * log10((historyPeak[i] + 1) / 2147483648.0));
+        Serial.print(" dBFS");
+      }
+    }
+
+    // Slots are in ADC channel order: A1 comes before A0.
+    for (uint8_t c = 0; c < 2; c++)
+    {
+      Serial.print(", A");
+      Serial.print(sensors.getPin(c) - A0);
+      Serial.print(" ");
+      Serial.print(sum[c] / SCANS_PER_BUFFER);
+    }
+    Serial.print(", dropped ");
+    Serial.println(sensors.getDroppedBuffers());
+  }
+}
+
+void codecRxReadyInterrupt(HiFiChannelID_t channel)
+{
+  if (channel == HIFI_CHANNEL_ID_1 && rxFrame == 0)
+  {
+    // This callback runs after the frame was counted.
+    blockFrame[activeBlock] = HiFi.getFrameCount() - 1;
+  }
+
+  rxBlock[activeBlock][rxFrame * 2 + channel] = HiFi.read();
+
+  if (channel == HIFI_CHANNEL_ID_2)
+  {
+    if (++rxFrame == BLOCK_FRAMES)
+    {
+      rxFrame = 0;
+      activeBlock ^= 1;
+      blockReady = true;
+    }
+  }
+}
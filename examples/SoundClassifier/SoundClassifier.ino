@@ -0,0 +1,201 @@
+/*
+  This example hooks a tiny nearest-template classifier onto the MFCC
+  pipeline.  Audio from the left input channel is passed through to the
+  output and written into an HiFiMfcc, which produces 13 coefficients
+  every 512 samples (~94 frames per second at 48kHz) from 1024 sample
+  frames and 40 mel filters.  The codec setup is the same as in the
+  Passthrough example.
+
+  To train it, open the serial monitor and, while each sound is playing,
+  send its class number:
+
+    0  background / quiet room
+    1  first sound (an alarm, say)
+    2  second sound (glass breaking, say)
+
+  The coefficients are averaged for two seconds to make that class's
+  template.  From then on every frame is matched to the nearest template
+  and the class is printed whenever the majority over the last 16 frames
+  changes.  c0 (overall level) is left out of the distance so the match
+  doesn't depend on how loud the sound is.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiMfcc.h>
+
+#define SAMPLE_RATE     48000
+#define HOP             512
+#define COEFFICIENTS    13
+#define CLASSES         3
+#define TRAIN_FRAMES    (2 * SAMPLE_RATE / HOP)
+#define VOTE_FRAMES     16
+
+void codecTxReadyInterrupt(HiFiChannelID_t);
+void codecRxReadyInterrupt(HiFiChannelID_t);
+void classify(const int16_t *features, uint8_t count);
+
+static volatile int32_t sample[2];
+
+HiFiMfcc mfcc;
+
+int16_t templates[CLASSES][COEFFICIENTS];
+bool trained[CLASSES];
+
+int8_t training = -1;
+int32_t trainSum[COEFFICIENTS];
+uint16_t trainFrames = 0;
+
+uint8_t votes[VOTE_FRAMES];
+uint8_t voteIndex = 0;
+int8_t lastClass = -1;
+
+unsigned long lastReport = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  mfcc.begin(10, HOP, 40, COEFFICIENTS, SAMPLE_RATE);
+  mfcc.onFeatures(classify);
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.configureRx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_TK_RK_CLK, 32);
+  HiFi.onTxReady(codecTxReadyInterrupt);
+  HiFi.onRxReady(codecRxReadyInterrupt);
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableRx(true);
+  HiFi.enableTx(true);
+
+  Serial.println("send 0, 1 or 2 to train a class");
+}
+
+void loop() {
+  if (Serial.available())
+  {
+    char c = Serial.read();
+    if (c >= '0' && c < '0' + CLASSES)
+    {
+      training = c - '0';
+      trainFrames = 0;
+      memset(trainSum, 0, sizeof(trainSum));
+      Serial.print("training class ");
+      Serial.println((int)training);
+    }
+  }
+
+  // At most one frame per pass; the classifier runs from the callback.
+  mfcc.update();
+
+  if (millis() - lastReport >= 5000)
+  {
+    lastReport = millis();
+    Serial.print("mfcc cpu ");
+    Serial.print(mfcc.getCycleMeter().getLoad(HOP, SAMPLE_RATE));
+    Serial.print("%, dropped ");
+    Serial.println(mfcc.getDroppedFrames());
+  }
+}
+
+void classify(const int16_t *features, uint8_t count)
+{
+  if (training >= 0)
+  {
+    for (uint8_t i = 0; i < count; i++)
+    {
+      trainSum[i] += features[i];
+    }
+    if (++trainFrames == TRAIN_FRAMES)
+    {
+      for (uint8_t i = 0; i < count; i++)
+      {
+        templates[training][i] = trainSum[i] / TRAIN_FRAMES;
+      }
+      trained[training] = true;
+      Serial.println("done");
+      training = -1;
+    }
+    return;
+  }
+
+  // Nearest template by L1 distance, ignoring c0
+  int8_t best = -1;
+  uint32_t bestDistance = 0xFFFFFFFF;
+
+  for (uint8_t c = 0; c < CLASSES; c++)
+  {
+    if (!trained[c])
+    {
+      continue;
+    }
+
+    uint32_t distance = 0;
+    for (uint8_t i = 1; i < count; i++)
+    {
+      distance += abs(features[i] - templates[c][i]);
+    }
+    if (distance < bestDistance)
+    {
+      bestDistance = distance;
+      best = c;
+    }
+  }
+  if (best < 0)
+  {
+    return;
+  }
+
+  // Majority vote over the last few frames to stop it flickering
+  uint8_t tally[CLASSES] = { 0 };
+
+  votes[voteIndex] = best;
+  voteIndex = (voteIndex + 1) % VOTE_FRAMES;
+  for (uint8_t v = 0; v < VOTE_FRAMES; v++)
+  {
+    tally[votes[v]]++;
+  }
+  for (uint8_t c = 0; c < CLASSES; c++)
+  {
+    if (tally[c] > VOTE_FRAMES / 2 && c != lastClass)
+    {
+      lastClass = c;
+      Serial.print("class ");
+      Serial.println(c);
+    }
+  }
+}
+
+void codecTxReadyInterrupt(HiFiChannelID_t channel)
+{
+  HiFi.write(sample[channel]);
+}
+
+void codecRxReadyInterrupt(HiFiChannelID_t channel)
+{
+  sample[channel] = HiFi.read();
+
+  if (channel == HIFI_CHANNEL_ID_1)
+  {
+    mfcc.write(sample[channel]);
+  }
+}
@@ -0,0 +1,90 @@
+/*
+  This example streams a live spectrogram of the left input channel to a
+  host over the USB serial port, while passing the audio straight through
+  to the transmitter.  The codec setup is the same as in the Passthrough
+  example.
+
+  The receive interrupt drops each left sample into the spectrogram's
+  ring; loop() computes at most one FFT frame per pass and sends the
+  packet.  Run extras/spectrogram/hifi_spectrogram.py on the host to view
+  it:
+
+    python3 hifi_spectrogram.py /dev/ttyACM0
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiSpectrogram.h>
+
+#define SAMPLE_RATE   48000
+
+void codecTxReadyInterrupt(HiFiChannelID_t);
+void codecRxReadyInterrupt(HiFiChannelID_t);
+
+static volatile int32_t sample[2];
+
+HiFiSpectrogram spectrogram;
+uint8_t packet[HIFI_SPECTROGRAM_MAX_PACKET];
+
+void setup() {
+  // The native USB port isn't limited by the baud rate, but the default
+  // stream (~3.3K bytes/s) also fits the programming port at 115200.
+  SerialUSB.begin(115200);
+
+  // 1024 point FFT every 1024 samples, 64 bands between -120 and 0 dBFS.
+  spectrogram.begin(10, 1024, 64, SAMPLE_RATE);
+  spectrogram.setRange(-120, 0);
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.configureRx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_TK_RK_CLK, 32);
+  HiFi.onTxReady(codecTxReadyInterrupt);
+  HiFi.onRxReady(codecRxReadyInterrupt);
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableRx(true);
+  HiFi.enableTx(true);
+}
+
+void loop() {
+  size_t length = spectrogram.update(packet);
+
+  if (length)
+  {
+    SerialUSB.write(packet, length);
+  }
+}
+
+void codecTxReadyInterrupt(HiFiChannelID_t channel)
+{
+  HiFi.write(sample[channel]);
+}
+
+void codecRxReadyInterrupt(HiFiChannelID_t channel)
+{
+  sample[channel] = HiFi.read();
+
+  if (channel == HIFI_CHANNEL_ID_1)
+  {
+    spectrogram.write(sample[channel]);
+  }
+}
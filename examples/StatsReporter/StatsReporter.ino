@@ -0,0 +1,126 @@
+/*
+  This example passes audio through from loop(), as in the StreamFromLoop
+  example, and publishes its health through HiFiStats for a host to poll
+  over the native USB port:
+
+    hifi.underruns, hifi.overruns   ring xruns (read from HiFi on demand)
+    hifi.frames                     frames since begin()
+    out.queued                      frames waiting in the output ring
+    block.late                      times a full ring of input piled up
+    block.load                      CPU per mille of the last block
+    block.cycles                    histogram of the block processing time
+    in.peak                         left input peak, 0.1 dBFS
+    clock.drift                     codec clock against millis(), ppm
+
+  block.late is counted by a frame hook, i.e. from the audio interrupt.
+  Poll one or more boards with extras/stats/hifi_stats.py:
+
+    python3 hifi_stats.py /dev/ttyACM0 /dev/ttyACM1 --interval 1
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiDsp.h>
+#include <HiFiMath.h>
+#include <HiFiStats.h>
+
+#define SAMPLE_RATE   48000
+#define BLOCK_FRAMES  64
+#define RING_FRAMES   512
+
+static int32_t block[BLOCK_FRAMES * 2];
+static HiFiCycleMeter meter;
+static volatile uint32_t lastRead = 0;
+unsigned long startMs = 0;
+
+HiFiStatFunction underruns("hifi.underruns", HIFI_STAT_COUNTER,
+                           []() { return HiFi.getUnderruns(); });
+HiFiStatFunction overruns("hifi.overruns", HIFI_STAT_COUNTER,
+                          []() { return HiFi.getOverruns(); });
+HiFiStatFunction frames("hifi.frames", HIFI_STAT_COUNTER,
+                        []() { return HiFi.getFrameCount(); });
+HiFiStatFunction queued("out.queued", HIFI_STAT_GAUGE,
+                        []() { return RING_FRAMES - HiFi.getWritableFrames(); });
+HiFiStatCounter late("block.late");
+HiFiStatGauge load("block.load");
+HiFiStatHistogram<16> cycles("block.cycles", 0, 250);
+HiFiStatGauge peak("in.peak");
+HiFiStatGauge drift("clock.drift");
+
+// Runs from the audio interrupt every frame: count the times loop() has
+// let a whole ring's worth of input pile up since it last read a block.
+void frameHook(uint32_t frame, void *)
+{
+  if (frame - lastRead == RING_FRAMES)
+  {
+    late.increment();
+  }
+}
+
+void setup() {
+  SerialUSB.begin(115200);
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.configureRx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_TK_RK_CLK, 32);
+
+  if (!HiFi.beginFrames(RING_FRAMES))
+  {
+    while (1);
+  }
+  HiFi.addFrameHook(frameHook, NULL);
+  hifi_cycle_counter_enable();
+
+  // One block of silence ahead of the first real one
+  memset(block, 0, sizeof(block));
+  HiFi.writeFrames(block, BLOCK_FRAMES, 0);
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableRx(true);
+  HiFi.enableTx(true);
+  startMs = millis();
+}
+
+void loop() {
+  uint32_t n = HiFi.readFrames(block, BLOCK_FRAMES, 100);
+  lastRead = HiFi.getFrameCount();
+
+  meter.start();
+  uint32_t level = hifi_block_peak(block, n * 2, 2);
+  meter.stop();
+  HiFi.writeFrames(block, n, 100);
+
+  cycles.add(meter.getCycles());
+  load.set((int32_t)(10.0f * meter.getLoad(BLOCK_FRAMES, SAMPLE_RATE)));
+  peak.set((int32_t)(((int64_t)hifi_q31_to_db_q16(level) * 10) >> 16));
+
+  // Frames counted against the frames millis() says should have passed
+  uint32_t elapsed = millis() - startMs;
+  if (elapsed >= 1000)
+  {
+    int64_t expected = (int64_t)elapsed * (SAMPLE_RATE / 1000);
+    int64_t counted = HiFi.getFrameCount();
+    drift.set((int32_t)((counted - expected) * 1000000 / expected));
+  }
+
+  HiFiStats.service(SerialUSB);
+}
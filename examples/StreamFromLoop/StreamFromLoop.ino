@@ -0,0 +1,100 @@
+/*
+  This example moves audio entirely from loop() with readFrames() and
+  writeFrames(), with no interrupt callbacks in the sketch.  The codec
+  setup is the same as in the Passthrough example.
+
+  Each pass of loop() waits for a block of input, applies a volume set
+  over serial ('+' / '-') and queues the block for output.  The output
+  ring is primed with a block of silence first so there is one block of
+  slack between input and output.  Underruns and overruns are printed
+  once a second; they should stay at zero unless loop() is held up for
+  longer than the rings can cover.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiDsp.h>
+
+#define BLOCK_FRAMES  64
+#define RING_FRAMES   512
+
+static int32_t block[BLOCK_FRAMES * 2];
+static int32_t volume = HIFI_Q31_ONE / 2;
+unsigned long lastReport = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.configureRx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_TK_RK_CLK, 32);
+
+  if (!HiFi.beginFrames(RING_FRAMES))
+  {
+    Serial.println("Not enough memory for the rings");
+    while (1);
+  }
+
+  // One block of silence ahead of the first real one
+  memset(block, 0, sizeof(block));
+  HiFi.writeFrames(block, BLOCK_FRAMES, 0);
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableRx(true);
+  HiFi.enableTx(true);
+}
+
+void loop() {
+  // Wait up to 100ms for a block; anything less means the codec clocks
+  // have stopped.
+  uint32_t frames = HiFi.readFrames(block, BLOCK_FRAMES, 100);
+
+  for (uint32_t i = 0; i < frames * 2; i++)
+  {
+    block[i] = hifi_mul_q31(block[i], volume);
+  }
+  HiFi.writeFrames(block, frames, 100);
+
+  while (Serial.available())
+  {
+    char c = Serial.read();
+    if (c == '+' && volume < HIFI_Q31_ONE / 2)
+    {
+      volume *= 2;
+    }
+    else if (c == '-' && volume > 0xFFFF)
+    {
+      volume /= 2;
+    }
+  }
+
+  if (millis() - lastReport >= 1000)
+  {
+    lastReport = millis();
+    Serial.print("Underruns: ");
+    Serial.print(HiFi.getUnderruns());
+    Serial.print("  Overruns: ");
+    Serial.print(HiFi.getOverruns());
+    Serial.print("  Queued out: ");
+    Serial.println(RING_FRAMES - HiFi.getWritableFrames());
+  }
+}
@@ -0,0 +1,131 @@
+/*
+  This example plays a 1kHz tone burst every second and raises pin 13 for
+  exactly as long as the burst, e.g. to trigger a scope or strobe a
+  camera.  The codec setup is the same as in the SineWaveOut example.
+
+  loop() picks the frame each burst starts at, well ahead of time, and
+  hands the pin changes to a HiFiGpioScheduler.  The transmit callback
+  starts the tone when it reaches the same frame, so the pin and the
+  audio line up to the frame no matter what loop() was doing.
+
+  Wire the codec's LRCLK to pin 11 as well and the sketch prints how long
+  after the LRCLK edge the pin writes happened, and how much that varied
+  (the jitter), once a second.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiGpioScheduler.h>
+
+#define SAMPLE_RATE     48000
+#define TONE_HZ         1000
+#define BURST_FRAMES    (SAMPLE_RATE / 10)
+#define TRIGGER_PIN     13
+
+void codecTxReadyInterrupt(HiFiChannelID_t);
+
+HiFiGpioScheduler triggers;
+
+// Start of the next burst, shared with the transmit callback
+static volatile uint32_t burstStart;
+static volatile bool burstQueued = false;
+static uint32_t burstLeft = 0;
+static uint32_t phase = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  pinMode(TRIGGER_PIN, OUTPUT);
+  digitalWrite(TRIGGER_PIN, LOW);
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+  HiFi.onTxReady(codecTxReadyInterrupt);
+
+  if (!triggers.begin(HiFi))
+  {
+    Serial.println("No free frame hook");
+    while (1);
+  }
+  triggers.enableJitterMeasurement(true);
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableTx(true);
+}
+
+void loop() {
+  if (!burstQueued && burstLeft == 0)
+  {
+    // A tenth of a second from now leaves plenty of margin.
+    uint32_t start = HiFi.getFrameCount() + SAMPLE_RATE / 10;
+
+    triggers.schedule(TRIGGER_PIN, HIFI_GPIO_HIGH, start);
+    triggers.schedule(TRIGGER_PIN, HIFI_GPIO_LOW, start + BURST_FRAMES);
+    burstStart = start;
+    burstQueued = true;
+
+    Serial.print("latency ");
+    Serial.print(triggers.getMinLatency());
+    Serial.print(" .. ");
+    Serial.print(triggers.getMaxLatency());
+    Serial.print(" ns (mean ");
+    Serial.print(triggers.getMeanLatency());
+    Serial.print("), jitter ");
+    Serial.print(triggers.getJitter());
+    Serial.print(" ns, late events ");
+    Serial.println(triggers.getLateEvents());
+    triggers.resetJitter();
+
+    // One burst a second
+    delay(900);
+  }
+}
+
+void codecTxReadyInterrupt(HiFiChannelID_t channel)
+{
+  static int32_t sample = 0;
+
+  if (channel == HIFI_CHANNEL_ID_1)
+  {
+    // This callback runs after the frame was counted.
+    uint32_t frame = HiFi.getFrameCount() - 1;
+
+    if (burstQueued && frame == burstStart)
+    {
+      burstQueued = false;
+      burstLeft = BURST_FRAMES;
+      phase = 0;
+    }
+
+    sample = 0;
+    if (burstLeft)
+    {
+      // Triangle wave at -6dBFS, the same in both channels
+      int32_t ramp = (int32_t)phase;
+      sample = ((ramp < 0) ? ~ramp : ramp) - 0x40000000;
+
+      phase += (uint32_t)(((uint64_t)TONE_HZ << 32) / SAMPLE_RATE);
+      burstLeft--;
+    }
+  }
+  HiFi.write(sample);
+}
@@ -0,0 +1,164 @@
+/*
+  This example measures how many HiFiWavetable voices the Due can run,
+  then plays a slowly morphing eight voice chord.  The codec setup is the
+  same as in the SineWaveOut example, and audio moves from loop() as in
+  the StreamFromLoop example.
+
+  The benchmark mixes 16 voices into 64 frame blocks in three ways: a
+  single wave, a fixed morph between two waves and a morph that moves
+  every block.  For each it prints the cycles per voice per frame, the
+  CPU used per voice at 48kHz and the number of voices per percent of
+  CPU.  While the chord plays, the load of the voices is printed once a
+  second.
+
+  This sketch is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <HiFi.h>
+#include <HiFiWavetable.h>
+
+#define SAMPLE_RATE     48000
+#define CPU_HZ          84000000UL
+#define BLOCK_FRAMES    64
+#define RING_FRAMES     512
+#define BENCH_VOICES    16
+#define BENCH_BLOCKS    100
+#define CHORD_VOICES    8
+
+static int32_t mono[BLOCK_FRAMES];
+static int32_t block[BLOCK_FRAMES * 2];
+
+HiFiWavetable voices[BENCH_VOICES];
+HiFiCycleMeter meter;
+uint32_t morph = 0;
+int32_t morphStep = 0x10;
+unsigned long lastReport = 0;
+
+// A minor ninth, spread over four octaves
+static const float chord[CHORD_VOICES] = {
+  55.0f, 110.0f, 164.81f, 261.63f, 329.63f, 392.0f, 493.88f, 659.26f
+};
+
+void benchmark(const char *name, uint32_t startMorph, int32_t step)
+{
+  uint32_t cycles = 0;
+
+  for (uint8_t v = 0; v < BENCH_VOICES; v++)
+  {
+    voices[v].setMorph(startMorph);
+    voices[v].setFrequency(100.0f + 37.0f * v);
+    voices[v].setAmplitude(HIFI_Q31_ONE / BENCH_VOICES);
+    voices[v].begin(SAMPLE_RATE);
+  }
+
+  for (uint16_t b = 0; b < BENCH_BLOCKS; b++)
+  {
+    memset(mono, 0, sizeof(mono));
+
+    meter.start();
+    for (uint8_t v = 0; v < BENCH_VOICES; v++)
+    {
+      voices[v].mix(mono, BLOCK_FRAMES);
+    }
+    meter.stop();
+    cycles += meter.getCycles();
+
+    for (uint8_t v = 0; v < BENCH_VOICES; v++)
+    {
+      voices[v].setMorph(startMorph + ((b & 1) ? step : 0));
+    }
+  }
+
+  float perVoiceFrame = (float)cycles / (BENCH_BLOCKS * BENCH_VOICES *
+                                         BLOCK_FRAMES);
+  float percent = 100.0f * perVoiceFrame * SAMPLE_RATE / CPU_HZ;
+
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(perVoiceFrame, 1);
+  Serial.print(" cycles/frame, ");
+  Serial.print(percent, 2);
+  Serial.print("% CPU per voice, ");
+  Serial.print(1.0f / percent, 2);
+  Serial.println(" voices per 1% CPU");
+}
+
+void setup() {
+  Serial.begin(115200);
+  hifi_cycle_counter_enable();
+
+  benchmark("Single wave", (uint32_t)HIFI_WAVE_SAW << 16, 0);
+  benchmark("Fixed morph", 0x18000, 0);
+  benchmark("Moving morph", 0x10000, 0x8000);
+
+  for (uint8_t v = 0; v < CHORD_VOICES; v++)
+  {
+    voices[v].setMorph(0);
+    voices[v].setFrequency(chord[v]);
+    voices[v].setAmplitude(HIFI_Q31_ONE / CHORD_VOICES / 2);
+    voices[v].begin(SAMPLE_RATE);
+  }
+
+  // set codec into reset
+  pinMode(7, OUTPUT);
+  digitalWrite(7, LOW);
+
+  HiFi.begin();
+  HiFi.configureTx(HIFI_AUDIO_MODE_STEREO, HIFI_CLK_MODE_USE_EXT_CLKS, 32);
+
+  if (!HiFi.beginFrames(RING_FRAMES))
+  {
+    Serial.println("Not enough memory for the rings");
+    while (1);
+  }
+
+  // release codec from reset
+  digitalWrite(7, HIGH);
+
+  HiFi.enableTx(true);
+}
+
+void loop() {
+  // Sweep the morph from sine to square in about 16 seconds, and back
+  morph += morphStep;
+  if (morph >= ((uint32_t)(HIFI_WAVETABLE_WAVES - 1) << 16) || morph == 0)
+  {
+    morphStep = -morphStep;
+  }
+
+  memset(mono, 0, sizeof(mono));
+  meter.start();
+  for (uint8_t v = 0; v < CHORD_VOICES; v++)
+  {
+    voices[v].setMorph(morph);
+    voices[v].mix(mono, BLOCK_FRAMES);
+  }
+  meter.stop();
+
+  for (uint16_t i = 0; i < BLOCK_FRAMES; i++)
+  {
+    block[2 * i] = mono[i];
+    block[2 * i + 1] = mono[i];
+  }
+  HiFi.writeFrames(block, BLOCK_FRAMES, HIFI_WAIT_FOREVER);
+
+  if (millis() - lastReport >= 1000)
+  {
+    lastReport = millis();
+    Serial.print("Chord load: ");
+    Serial.print(meter.getLoad(BLOCK_FRAMES, SAMPLE_RATE), 1);
+    Serial.println("%");
+  }
+}
@@ -0,0 +1,125 @@
+/*
+  convolver_bench.cpp
+
+  Host version of the ConvolutionBenchmark example: works out how long an
+  impulse response HiFiConvolver can run in real time at 48kHz on the
+  machine it is built on.  Builds with:
+
+    gcc -c -O2 -I../.. ../../HiFiFftTable.c -o table.o
+    g++ -O2 -I../.. convolver_bench.cpp ../../HiFiConvolver.cpp \
+        ../../HiFiFft.cpp table.o -o convolver_bench -lm
+    ./convolver_bench
+
+  As in the sketch, each partition size is timed with a short and a long
+  response, and the cost of a block is taken as a fixed part plus a part
+  per partition; the longest response is the one whose blocks fit in
+  CPU_BUDGET of the block period.  The share of one core the long
+  response takes is printed too.  The host figures only say how the
+  engine scales: the Due's come from running the sketch on the board.
+  The memory the engine takes for that response (about 12 bytes a tap)
+  is printed alongside, since on the Due that is the tighter limit.  A
+  response can't be longer than 65535 taps (the tap count is 16 bits), so
+  longer estimates are shown as that with a '+'.
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <vector>
+#include "HiFiConvolver.h"
+
+#define SAMPLE_RATE     48000.0
+// Leave some of the CPU for everything else.
+#define CPU_BUDGET      0.8
+#define SHORT_PARTS     2
+#define LONG_PARTS      64
+#define RUNS            2000
+
+static double now()
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Seconds per block, the best of a few rounds.
+static double timeBlock(HiFiConvolver &conv, const std::vector<int16_t> &ir,
+                        uint16_t taps)
+{
+  uint16_t part = conv.getPartitionSize();
+  std::vector<int32_t> block(part);
+  double best = 1e9;
+
+  conv.setImpulseResponse(&ir[0], taps);
+
+  for (int round = 0; round < 5; round++)
+  {
+    double start = now();
+
+    for (int r = 0; r < RUNS; r++)
+    {
+      for (uint16_t n = 0; n < part; n++)
+      {
+        block[n] = (rand() - RAND_MAX / 2) / 4;
+      }
+      conv.process(&block[0]);
+    }
+
+    double t = (now() - start) / RUNS;
+    best = (t < best) ? t : best;
+  }
+  return best;
+}
+
+int main()
+{
+  printf("partition  us/block(short)  us/block(long)  CPU(long)  "
+         "max taps (cpu)  RAM for them\n");
+
+  for (uint8_t log2Part = 5; log2Part <= 8; log2Part++)
+  {
+    HiFiConvolver conv;
+    uint16_t part = 1 << log2Part;
+    std::vector<int16_t> ir(part * LONG_PARTS);
+
+    for (size_t i = 0; i < ir.size(); i++)
+    {
+      ir[i] = rand() % 2000 - 1000;
+    }
+
+    if (!conv.begin(log2Part, part * LONG_PARTS))
+    {
+      printf("%5u      out of memory\n", part);
+      continue;
+    }
+
+    double shortTime = timeBlock(conv, ir, part * SHORT_PARTS);
+    double longTime = timeBlock(conv, ir, part * LONG_PARTS);
+    conv.end();
+
+    // time = fixed + perPartition * partitions
+    double perPartition = (longTime - shortTime) / (LONG_PARTS - SHORT_PARTS);
+    double fixed = shortTime - perPartition * SHORT_PARTS;
+    double budget = CPU_BUDGET * part / SAMPLE_RATE;
+    double maxTaps = (budget - fixed) / perPartition * part;
+    bool capped = (maxTaps > 65535);
+
+    if (capped)
+    {
+      maxTaps = 65535;
+    }
+
+    printf("%5u      %10.2f       %10.2f     %6.2f%%  %11.0f%c    "
+           "%6.1fK bytes\n", part, shortTime * 1e6, longTime * 1e6,
+           100 * longTime * SAMPLE_RATE / part, maxTaps, capped ? '+' : ' ',
+           maxTaps * 12 / 1024);
+  }
+
+  return 0;
+}
@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+#
+# fft_table.py
+#
+# Writes HiFiFftTable.c: the quarter wave sine table behind the twiddle
+# factors of HiFiFft (and the sine and cosine in HiFiMath.h).  Entry k is
+# sin(2*pi*k/4096) rounded to Q31, with the last one (exactly 1.0)
+# clamped to the largest Q31 value.
+#
+# Usage:  fft_table.py > ../../HiFiFftTable.c
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+
+import math
+import sys
+
+MAX_SIZE = 4096
+
+HEADER = '''/*
+  HiFiFftTable.c
+
+  Quarter wave sine table used for the FFT twiddle factors.  Entry k is
+  sin(2*pi*k/%d) in Q31, for k = 0..%d.  Smaller transforms step
+  through the table, the other three quarters come from symmetry.
+
+  Generated by extras/convolver/fft_table.py; don't edit by hand.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdint.h>
+#include "HiFiConfig.h"
+'''
+
+
+def table(out, ctype, name, values, per_line=6):
+    out.write('\nHIFI_RAMDATA const %s %s[%d] =\n{\n' % (ctype, name, len(values)))
+    for i in range(0, len(values), per_line):
+        out.write('  ' + ', '.join('%d' % v for v in values[i:i + per_line]) +
+                  (',\n' if i + per_line < len(values) else '\n'))
+    out.write('};\n')
+
+
+def main():
+    out = sys.stdout
+    quarter = MAX_SIZE // 4
+    out.write(HEADER % (MAX_SIZE, quarter))
+
+    table(out, 'int32_t', 'hifi_fft_sine_q31',
+          [min(2 ** 31 - 1, int(round(math.sin(2 * math.pi * k / MAX_SIZE) *
+                                      2 ** 31)))
+           for k in range(quarter + 1)])
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,253 @@
+/*
+  dma_check.cpp
+
+  Checks the HiFiDma queue on the host.  Builds with:
+
+    g++ -O2 -I../.. dma_check.cpp ../../HiFiDma.cpp ../../HiFiExtMemory.cpp \
+        -o dma_check
+    ./dma_check
+
+  The copies are deferred (setHostDeferred()) and the program calls
+  onService() itself, once per piece, just as the DMA interrupt would on
+  the Due.  It checks:
+    - a full queue: HIFI_DMA_QUEUE - 1 transfers fit, the next is refused
+      without taking a ticket, and there is room again once one finishes,
+    - callback order: copies and fills of different sizes and alignments,
+      some split into several pieces, finish in the order they were
+      queued, each only after its last piece, with the right data,
+    - ticket wraparound: isComplete() and wait() keep working as the
+      counters pass 2^32,
+    - HiFiRamMemory, which moves its data with HiFiDma, with the
+      transfers left to onService() and a latency of a few polls.
+  Prints what failed and exits with 1, or prints "ok".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "HiFiDma.h"
+#include "HiFiExtMemory.h"
+
+static int failures = 0;
+
+#define CHECK(x) \
+  do { if (!(x)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #x); \
+                   failures++; } } while (0)
+
+static int order[64];
+static int finished = 0;
+
+static void done(void *context)
+{
+  order[finished++] = (int)(intptr_t)context;
+}
+
+// Calls onService() until 'dma' is idle; returns the number of calls.
+static int drain(HiFiDmaClass &dma)
+{
+  int calls = 0;
+
+  while (!dma.isIdle() && calls < 1000)
+  {
+    dma.onService();
+    calls++;
+  }
+  return calls;
+}
+
+static void checkQueueFull()
+{
+  HiFiDmaClass dma;
+  static uint8_t src[64], dst[HIFI_DMA_QUEUE][64];
+
+  dma.setHostDeferred(true);
+  finished = 0;
+
+  for (int i = 0; i < HIFI_DMA_QUEUE - 1; i++)
+  {
+    CHECK(dma.copy(dst[i], src, sizeof(src), done, (void *)(intptr_t)i));
+  }
+
+  uint32_t last = dma.getLastTicket();
+  CHECK(!dma.copy(dst[HIFI_DMA_QUEUE - 1], src, sizeof(src)));
+  CHECK(!dma.fill(dst[HIFI_DMA_QUEUE - 1], 0, sizeof(src)));
+  CHECK(dma.getLastTicket() == last);
+  CHECK(!dma.isIdle());
+
+  // One piece each: the first service finishes the first copy.
+  dma.onService();
+  CHECK(finished == 1);
+  CHECK(dma.isComplete(last - (HIFI_DMA_QUEUE - 2)));
+  CHECK(!dma.isComplete(last - (HIFI_DMA_QUEUE - 3)));
+  CHECK(dma.copy(dst[HIFI_DMA_QUEUE - 1], src, sizeof(src), done,
+                 (void *)(intptr_t)(HIFI_DMA_QUEUE - 1)));
+  CHECK(!dma.copy(dst[0], src, sizeof(src)));
+
+  drain(dma);
+  CHECK(finished == HIFI_DMA_QUEUE);
+  for (int i = 0; i < finished; i++)
+  {
+    CHECK(order[i] == i);
+  }
+}
+
+static void checkOrder()
+{
+  HiFiDmaClass dma;
+  static uint8_t src[40000], dst[4][40000];
+
+  for (uint32_t i = 0; i < sizeof(src); i++)
+  {
+    src[i] = (uint8_t)(i * 7 + 3);
+  }
+  memset(dst, 0, sizeof(dst));
+
+  dma.setHostDeferred(true);
+  finished = 0;
+
+  // Pieces: 20000 bytes of words is 2, an odd length runs as bytes in
+  // 5, an odd address as bytes in 3, 100 half words is 1.
+  CHECK(dma.copy(dst[0], src, 20000, done, (void *)0));
+  CHECK(dma.copy(dst[1], src, 19999, done, (void *)1));
+  CHECK(dma.fill(dst[2] + 1, 0x5A, 12000, done, (void *)2));
+  CHECK(dma.copy(dst[3] + 2, src + 2, 200, done, (void *)3));
+
+  // Each call to onService() ends one piece and starts the next.
+  int pieces[] = { 2, 5, 3, 1 };
+  for (int r = 0; r < 4; r++)
+  {
+    for (int p = 0; p < pieces[r]; p++)
+    {
+      CHECK(finished == r);
+      dma.onService();
+    }
+    CHECK(finished == r + 1);
+  }
+  CHECK(dma.isIdle());
+
+  for (int i = 0; i < 4; i++)
+  {
+    CHECK(order[i] == i);
+  }
+  CHECK(memcmp(dst[0], src, 20000) == 0 && dst[0][20000] == 0);
+  CHECK(memcmp(dst[1], src, 19999) == 0 && dst[1][19999] == 0);
+  CHECK(dst[2][0] == 0 && dst[2][1] == 0x5A && dst[2][12000] == 0x5A &&
+        dst[2][12001] == 0);
+  CHECK(memcmp(dst[3] + 2, src + 2, 200) == 0 && dst[3][202] == 0);
+
+  // Nothing to move: done as it is queued when the queue is empty, or
+  // along with the request ahead of it.
+  finished = 0;
+  CHECK(dma.copy(dst[3], src, 0, done, (void *)10));
+  CHECK(finished == 1 && dma.isIdle());
+  CHECK(dma.copy(dst[3], src, 4, done, (void *)11));
+  CHECK(dma.copy(dst[3], src, 0, done, (void *)12));
+  dma.onService();
+  CHECK(finished == 3 && dma.isIdle());
+
+  // Overlapping requests run in queue order, so the fill lands on top of
+  // the copy queued before it; 10000 words take three pieces.
+  finished = 0;
+  CHECK(dma.copy(dst[0], src, 40000, done, (void *)20));
+  CHECK(dma.fill(dst[0], 0, 4, done, (void *)21));
+  CHECK(drain(dma) == 4);
+  CHECK(finished == 2 && order[0] == 20 && order[1] == 21);
+  CHECK(dst[0][3] == 0 && dst[0][4] == src[4]);
+}
+
+// Friend of HiFiDmaClass, so it can start the ticket counters near the
+// top rather than queue 2^32 transfers to get there.
+class HiFiDmaCheck {
+public:
+  static void setTickets(HiFiDmaClass &dma, uint32_t ticket)
+  {
+    dma._queued = ticket;
+    dma._completed = ticket;
+  }
+};
+
+static void checkWraparound()
+{
+  HiFiDmaClass dma;
+  static uint8_t src[16], dst[16];
+  uint32_t tickets[8];
+
+  HiFiDmaCheck::setTickets(dma, 0xFFFFFFFC);
+  dma.setHostDeferred(true);
+
+  for (int i = 0; i < 7; i++)
+  {
+    CHECK(dma.copy(dst, src, sizeof(src)));
+    tickets[i] = dma.getLastTicket();
+  }
+  CHECK(tickets[3] == 0 && tickets[4] == 1);
+
+  for (int i = 0; i < 7; i++)
+  {
+    CHECK(!dma.isComplete(tickets[i]));
+  }
+
+  dma.wait(tickets[4]);
+  for (int i = 0; i < 7; i++)
+  {
+    CHECK(dma.isComplete(tickets[i]) == (i <= 4));
+  }
+
+  dma.flush();
+  CHECK(dma.isIdle() && dma.isComplete(tickets[6]));
+}
+
+static void checkRamMemory()
+{
+  HiFiRamMemory mem;
+  static uint8_t out[3000], in[3000];
+
+  for (uint32_t i = 0; i < sizeof(out); i++)
+  {
+    out[i] = (uint8_t)(i * 13);
+  }
+  memset(in, 0, sizeof(in));
+
+  HiFiDma.setHostDeferred(true);
+  CHECK(mem.begin(8192, 1024));
+  mem.setLatency(2);
+
+  CHECK(mem.queueWrite(100, out, sizeof(out)));
+  uint32_t written = mem.getLastTicket();
+  CHECK(mem.queueRead(100, in, sizeof(in)));
+  uint32_t read = mem.getLastTicket();
+
+  int polls = 0;
+  while (!mem.isComplete(read) && polls < 1000)
+  {
+    mem.poll();
+    HiFiDma.onService();
+    polls++;
+  }
+  CHECK(mem.isComplete(written) && mem.isComplete(read));
+  CHECK(memcmp(in, out, sizeof(in)) == 0);
+
+  mem.end();
+  HiFiDma.setHostDeferred(false);
+}
+
+int main()
+{
+  checkQueueFull();
+  checkOrder();
+  checkWraparound();
+  checkRamMemory();
+
+  if (failures)
+  {
+    printf("%d failed\n", failures);
+    return 1;
+  }
+  printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,221 @@
+/*
+  ext_buffers_check.cpp
+
+  Runs HiFiExtDelay and HiFiExtRing against HiFiRamMemory on the host.
+  Builds with:
+
+    g++ -O2 -I../.. ext_buffers_check.cpp ../../HiFiExtBuffers.cpp \
+        ../../HiFiExtMemory.cpp ../../HiFiDma.cpp -o ext_buffers_check
+    ./ext_buffers_check
+
+  The memory takes a few polls per transfer, as a device would.  It
+  checks:
+    - splitting: transfers cut at the maximum size and at device
+      boundaries read back what was written, a transfer needing more
+      pieces than the queue holds is refused (including one needing 256
+      or more, which must not wrap the count round) and one that just
+      fits is taken,
+    - HiFiExtRing: blocks come back in order, with the ring filled and
+      emptied several times so the addresses wrap, and write()/read()
+      refuse a full and an empty ring,
+    - HiFiExtDelay: mono and stereo, with a delay that isn't a whole
+      number of blocks (so fetches wrap round the end of the line in two
+      pieces), the output matches the input read back that many frames
+      later, with and without feedback.
+  Prints what failed and exits with 1, or prints "ok".
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "HiFiExtBuffers.h"
+
+#define LATENCY         3
+
+static int failures = 0;
+
+#define CHECK(x) \
+  do { if (!(x)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #x); \
+                   failures++; } } while (0)
+
+static uint32_t seed = 1;
+
+static uint32_t random32()
+{
+  seed = seed * 1664525 + 1013904223;
+  return seed;
+}
+
+static void checkPieces()
+{
+  HiFiRamMemory mem;
+  static uint8_t out[1000], in[1000];
+
+  for (uint32_t i = 0; i < sizeof(out); i++)
+  {
+    out[i] = (uint8_t)random32();
+  }
+
+  // 64 byte pieces, cut again at every 100 bytes.
+  CHECK(mem.begin(4096, 64, 100));
+  mem.setLatency(LATENCY);
+
+  // 14 pieces each, so the read has to wait for the write to drain.
+  CHECK(mem.queueWrite(1037, out, 700));
+  CHECK(!mem.queueRead(1037, in, 700));
+  mem.flush();
+  CHECK(mem.queueRead(1037, in, 700));
+  mem.flush();
+  CHECK(memcmp(in, out, 700) == 0);
+
+  // Only HIFI_EXT_MEMORY_QUEUE - 1 pieces fit in an empty queue.
+  uint32_t last = mem.getLastTicket();
+  CHECK(!mem.queueWrite(0, out, 64 * HIFI_EXT_MEMORY_QUEUE));
+  CHECK(mem.getLastTicket() == last && mem.isIdle());
+  CHECK(mem.begin(4096, 1));
+  CHECK(!mem.queueWrite(0, out, 256 + 5));
+  CHECK(mem.isIdle());
+  CHECK(mem.queueWrite(0, out, HIFI_EXT_MEMORY_QUEUE - 1));
+  CHECK(!mem.queueWrite(100, out, 1));
+  mem.flush();
+  CHECK(mem.queueRead(0, in, HIFI_EXT_MEMORY_QUEUE - 1));
+  mem.flush();
+  CHECK(memcmp(in, out, HIFI_EXT_MEMORY_QUEUE - 1) == 0);
+
+  // Nothing past the end
+  CHECK(!mem.queueRead(4000, in, 97));
+}
+
+static void checkRing()
+{
+  HiFiRamMemory mem;
+  HiFiExtRing ring;
+  const uint16_t blockBytes = 300;
+  const uint32_t blocks = 5;
+  uint8_t block[blockBytes];
+  uint32_t written = 0, read = 0;
+
+  // 100 bytes to spare, and pieces short enough that a block splits.
+  CHECK(mem.begin(blocks * blockBytes + 100, 128));
+  mem.setLatency(LATENCY);
+  CHECK(ring.begin(mem, 100, blocks, blockBytes));
+  CHECK(!ring.read(block));
+
+  // Write a few, read fewer, so the fill level and the addresses move
+  // round the ring.
+  for (uint32_t round = 0; round < 40; round++)
+  {
+    uint32_t writes = 1 + round % blocks;
+
+    for (uint32_t w = 0; w < writes; w++)
+    {
+      memset(block, (int)(written * 37 + 1), blockBytes);
+      block[0] = (uint8_t)written;
+      block[blockBytes - 1] = (uint8_t)~written;
+      if (ring.getSpace() == 0)
+      {
+        CHECK(!ring.write(block));
+        break;
+      }
+      CHECK(ring.write(block));
+      written++;
+    }
+
+    uint32_t reads = (round & 1) ? ring.getAvailable() : 2;
+    for (uint32_t r = 0; r < reads && ring.getAvailable(); r++)
+    {
+      CHECK(ring.read(block));
+      CHECK(block[0] == (uint8_t)read && block[blockBytes - 1] ==
+            (uint8_t)~read && block[blockBytes / 2] ==
+            (uint8_t)(read * 37 + 1));
+      read++;
+    }
+  }
+  CHECK(written > 4 * blocks && read == written - ring.getAvailable());
+  ring.end();
+}
+
+static int16_t sat16(int32_t x)
+{
+  return (int16_t)((x > 32767) ? 32767 : ((x < -32768) ? -32768 : x));
+}
+
+static void checkDelay(uint8_t channels, uint32_t delay, float feedback)
+{
+  HiFiRamMemory mem;
+  HiFiExtDelay line;
+  const uint16_t blockFrames = 64;
+  const uint32_t blockCount = 60;
+  uint32_t samples = blockFrames * channels;
+
+  CHECK(mem.begin(64 * 1024, 256));
+  mem.setLatency(LATENCY);
+  CHECK(line.begin(mem, 0, delay, channels, blockFrames));
+  line.setDelay(delay);
+  line.setFeedback(feedback);
+  line.setMix(1.0f);
+
+  // What the line holds, worked out the way HiFiExtDelay does it, with
+  // the gains as it quantises them.
+  int32_t fb = (int32_t)(feedback * 32767.0f);
+  std::vector<int16_t> model((size_t)blockCount * samples, 0);
+  std::vector<int32_t> buf(samples);
+  uint32_t mismatches = 0;
+
+  for (uint32_t b = 0; b < blockCount; b++)
+  {
+    for (uint32_t i = 0; i < samples; i++)
+    {
+      int16_t x = (int16_t)(random32() >> 16);
+      uint32_t n = b * samples + i;
+      int32_t wet = (n >= delay * channels) ? model[n - delay * channels] : 0;
+
+      model[n] = sat16(x + ((wet * fb) >> 15));
+      buf[i] = (int32_t)x * 65536;
+    }
+
+    line.process(&buf[0]);
+
+    for (uint32_t i = 0; i < samples; i++)
+    {
+      uint32_t n = b * samples + i;
+      int32_t wet = (n >= delay * channels) ? model[n - delay * channels] : 0;
+
+      if (buf[i] != wet * 32767 * 2)
+      {
+        mismatches++;
+      }
+    }
+  }
+  CHECK(mismatches == 0);
+  if (mismatches)
+  {
+    printf("  %u channel(s), delay %u, feedback %.2f: %u samples wrong\n",
+           channels, delay, feedback, mismatches);
+  }
+  line.end();
+}
+
+int main()
+{
+  checkPieces();
+  checkRing();
+  checkDelay(1, 1000, 0.0f);
+  checkDelay(2, 1000, 0.0f);
+  checkDelay(1, 777, 0.5f);
+  checkDelay(2, 64, 0.9f);
+
+  if (failures)
+  {
+    printf("%d failed\n", failures);
+    return 1;
+  }
+  printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,219 @@
+/*
+  math_bench.cpp
+
+  Checks the functions in HiFiMath.h against libm and times both.
+  Builds on the host:
+
+    gcc -c -O2 -I../.. ../../HiFiMathTables.c ../../HiFiFftTable.c
+    g++ -O2 -I../.. math_bench.cpp ../../HiFiMath.cpp \
+        HiFiMathTables.o HiFiFftTable.o -o math_bench -lm
+    ./math_bench
+
+  Accuracy is measured against the double precision libm function over a
+  dense sweep of each input range, and is what HiFiMath.h quotes.  The
+  timings compare with the single precision libm calls a sketch would
+  otherwise make; on the host both have hardware floating point, so they
+  only show the relative cost.  The MathBenchmark example gives the
+  figures that matter, on the Due.
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "HiFiMath.h"
+
+#define TWO_PI      6.283185307179586
+#define Q16         65536.0
+#define Q24         16777216.0
+#define Q31         2147483648.0
+
+static uint64_t lcg = 1;
+
+static uint32_t random32()
+{
+  lcg = lcg * 6364136223846793005ULL + 1442695040888963407ULL;
+  return (uint32_t)(lcg >> 32);
+}
+
+static uint64_t random64()
+{
+  uint64_t x = ((uint64_t)random32() << 32) | random32();
+  // Spread the sizes as well as the values.
+  return x >> (random32() & 63);
+}
+
+static void report(const char *name, double worst, const char *unit)
+{
+  printf("  %-22s %10.3g %s\n", name, worst, unit);
+}
+
+static void checkAccuracy()
+{
+  double worst;
+
+  printf("worst error against libm (double):\n");
+
+  worst = 0;
+  for (uint64_t a = 0; a < (1ULL << 32); a += 997)
+  {
+    double t = TWO_PI * a / 4294967296.0;
+    worst = fmax(worst, fabs(hifi_sin_q31((uint32_t)a) / Q31 - sin(t)));
+    worst = fmax(worst, fabs(hifi_cos_q31((uint32_t)a) / Q31 - cos(t)));
+  }
+  report("hifi_sin/cos_q31", worst, "");
+
+  worst = 0;
+  for (uint64_t a = 0; a < (1ULL << 32) * 89 / 360; a += 997)
+  {
+    double exact = tan(TWO_PI * a / 4294967296.0);
+    double got = hifi_tan_q24((uint32_t)a) / Q24;
+    worst = fmax(worst, fabs(got - exact) / fmax(exact, 1.0));
+  }
+  report("hifi_tan_q24", worst, "(relative above 1), 0 to 89 degrees");
+
+  worst = 0;
+  for (int32_t x = 8 << 16; x < (16 << 16); x++)
+  {
+    double exact = exp2(x / Q16);
+    worst = fmax(worst, fabs(hifi_exp2_q16(x) / Q16 / exact - 1));
+  }
+  report("hifi_exp2_q16", worst, "relative, 8 <= x < 16");
+
+  worst = 0;
+  for (int32_t x = -(8 << 16); x <= 0; x++)
+  {
+    double exact = exp2(x / Q16);
+    worst = fmax(worst, fabs(hifi_exp2_q31(x) / Q31 / exact - 1));
+  }
+  report("hifi_exp2_q31", worst, "relative, -8 <= x <= 0");
+
+  worst = 0;
+  for (uint64_t x = 1; x < (1ULL << 32); x += 1 + (x >> 12))
+  {
+    worst = fmax(worst, fabs(hifi_log2_q24((uint32_t)x) / Q24 - log2((double)x)));
+  }
+  report("hifi_log2_q24", worst, "");
+
+  worst = 0;
+  for (int i = 0; i < 1000000; i++)
+  {
+    uint64_t x = random64() | 1;
+    worst = fmax(worst, fabs(hifi_log2_q24_u64(x) / Q24 - log2((double)x)));
+  }
+  report("hifi_log2_q24_u64", worst, "");
+
+  worst = 0;
+  for (int32_t db = -(60 << 16); db <= 0; db++)
+  {
+    double exact = pow(10.0, db / Q16 / 20);
+    worst = fmax(worst, fabs(hifi_db_to_q31(db) / Q31 / exact - 1));
+  }
+  report("hifi_db_to_q31", worst, "relative, -60 .. 0dB");
+
+  worst = 0;
+  for (uint64_t x = 1; x < (1ULL << 31); x += 1 + (x >> 12))
+  {
+    double exact = 20 * log10(x / Q31);
+    worst = fmax(worst, fabs(hifi_q31_to_db_q16((uint32_t)x) / Q16 - exact));
+  }
+  report("hifi_q31_to_db_q16", worst, "dB");
+
+  worst = 0;
+  for (int i = 0; i < 1000000; i++)
+  {
+    uint64_t x = (random64() >> 2) | 1;
+    double exact = 10 * log10(x / (Q31 * Q31));
+    worst = fmax(worst, fabs(hifi_power_to_db_q16(x) / Q16 - exact));
+  }
+  report("hifi_power_to_db_q16", worst, "dB");
+
+  uint32_t wrong = 0;
+  for (uint64_t x = 0; x < (1ULL << 32); x += 1 + (x >> 16))
+  {
+    uint64_t r = hifi_sqrt_u32((uint32_t)x);
+    wrong += (r * r > x || (r + 1) * (r + 1) <= x);
+  }
+  for (int i = 0; i < 1000000; i++)
+  {
+    uint64_t x = random64();
+    unsigned __int128 r = hifi_sqrt_u64(x);
+    wrong += (r * r > x || (r + 1) * (r + 1) <= x);
+  }
+  printf("  %-22s %10u wrong results\n", "hifi_sqrt_u32/u64", wrong);
+}
+
+///////////////////////////////////////////////////////////////////////////
+/// Timing
+///////////////////////////////////////////////////////////////////////////
+#define CALLS   4000000
+
+static volatile int64_t sink;
+static volatile float fsink;
+
+template <typename F>
+static double nsPerCall(F f)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < CALLS; i++)
+  {
+    f(i);
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / CALLS;
+}
+
+static void compare(const char *name, double fixed, const char *libm, double flt)
+{
+  printf("  %-22s %6.2f ns   %-14s %6.2f ns\n", name, fixed, libm, flt);
+}
+
+static void checkSpeed()
+{
+  printf("\ntime per call (host, relative only):\n");
+
+  compare("hifi_sin_q31",
+          nsPerCall([](uint32_t i) { sink = hifi_sin_q31(i * 2654435761U); }),
+          "sinf",
+          nsPerCall([](uint32_t i) { fsink = sinf(i * 1.4629e-9f); }));
+  compare("hifi_tan_q24",
+          nsPerCall([](uint32_t i) { sink = hifi_tan_q24((i * 2654435761U) >> 3); }),
+          "tanf",
+          nsPerCall([](uint32_t i) { fsink = tanf(i * 1.829e-10f); }));
+  compare("hifi_exp2_q16",
+          nsPerCall([](uint32_t i) { sink = hifi_exp2_q16(i & 0xFFFFF); }),
+          "exp2f",
+          nsPerCall([](uint32_t i) { fsink = exp2f((i & 0xFFFFF) * 1.5259e-5f); }));
+  compare("hifi_log2_q24",
+          nsPerCall([](uint32_t i) { sink = hifi_log2_q24(i + 1); }),
+          "log2f",
+          nsPerCall([](uint32_t i) { fsink = log2f((float)(i + 1)); }));
+  compare("hifi_db_to_q31",
+          nsPerCall([](uint32_t i) { sink = hifi_db_to_q31(-(int32_t)(i & 0x7FFFFF)); }),
+          "powf(10, x/20)",
+          nsPerCall([](uint32_t i) { fsink = powf(10.0f, -(float)(i & 0x7FFFFF) * 7.63e-7f); }));
+  compare("hifi_q31_to_db_q16",
+          nsPerCall([](uint32_t i) { sink = hifi_q31_to_db_q16(i * 2654435761U >> 1); }),
+          "20*log10f",
+          nsPerCall([](uint32_t i) { fsink = 20.0f * log10f((float)(i + 1) * 4.66e-10f); }));
+  compare("hifi_sqrt_u32",
+          nsPerCall([](uint32_t i) { sink = hifi_sqrt_u32(i * 2654435761U); }),
+          "sqrtf",
+          nsPerCall([](uint32_t i) { fsink = sqrtf((float)(i * 2654435761U)); }));
+  compare("hifi_sqrt_u64",
+          nsPerCall([](uint32_t i) { sink = hifi_sqrt_u64((uint64_t)i * 2654435761U * 977); }),
+          "sqrt",
+          nsPerCall([](uint32_t i) { sink = (int64_t)sqrt((double)((uint64_t)i * 2654435761U * 977)); }));
+}
+
+int main()
+{
+  checkAccuracy();
+  checkSpeed();
+  return 0;
+}
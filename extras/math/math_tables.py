@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+#
+# math_tables.py
+#
+# Writes HiFiMathTables.c: the lookup tables behind the fixed point
+# functions in HiFiMath.h.  Each table seeds a short polynomial or Newton
+# step; see HiFiMath.cpp for how they are used.  The sine and cosine share
+# the FFT's quarter wave table instead of having one of their own.
+#
+# Usage:  math_tables.py > ../../HiFiMathTables.c
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+
+import math
+import sys
+
+SEGMENTS = 64
+
+HEADER = '''/*
+  HiFiMathTables.c
+
+  Tables for the fixed point functions in HiFiMath.h:
+    - hifi_exp2_table: 2^(k/64) for k = 0..63, Q30,
+    - hifi_log2_table: log2(c_k) in Q24, with c_k = 1 + (k + 0.5)/64 the
+      centre of segment k of the mantissa,
+    - hifi_log2_recip: 1/c_k, Q31,
+    - hifi_sqrt_seed: sqrt((k + 0.5) * 2^26) for k = 16..63, the starting
+      point for the Newton steps.
+
+  Generated by extras/math/math_tables.py; don't edit by hand.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdint.h>
+#include "HiFiConfig.h"
+'''
+
+
+def table(out, ctype, name, values, per_line=6):
+    out.write('\nHIFI_RAMDATA const %s %s[%d] =\n{\n' % (ctype, name, len(values)))
+    for i in range(0, len(values), per_line):
+        out.write('  ' + ', '.join('%d' % v for v in values[i:i + per_line]) +
+                  (',\n' if i + per_line < len(values) else '\n'))
+    out.write('};\n')
+
+
+def main():
+    out = sys.stdout
+    out.write(HEADER)
+
+    table(out, 'int32_t', 'hifi_exp2_table',
+          [int(round(2 ** (k / SEGMENTS) * 2 ** 30)) for k in range(SEGMENTS)])
+
+    centres = [1 + (k + 0.5) / SEGMENTS for k in range(SEGMENTS)]
+    table(out, 'int32_t', 'hifi_log2_table',
+          [int(round(math.log2(c) * 2 ** 24)) for c in centres])
+    table(out, 'uint32_t', 'hifi_log2_recip',
+          [int(round(2 ** 31 / c)) for c in centres])
+
+    table(out, 'uint16_t', 'hifi_sqrt_seed',
+          [int(round(math.sqrt((k + 0.5) * 2 ** 26))) for k in range(16, 64)],
+          per_line=8)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,179 @@
+/*
+  resampler_check.cpp
+
+  Measures HiFiResampler on the host.  Builds with:
+
+    g++ -O2 -I../.. resampler_check.cpp ../../HiFiResampler.cpp \
+        -x c ../../HiFiResamplerTable.c -o resampler_check -lm
+    ./resampler_check
+
+  Two sets of figures:
+    - the filter itself, rebuilt from the table: passband ripple up to
+      20kHz and the worst response at or above 24.1kHz (where the first
+      image of a 20kHz input falls), out to 7.056MHz,
+    - the converter end to end: -1dBFS sines (16 bit) at 44.1kHz through
+      process() in uneven blocks, the 48kHz output fitted to a sine of the
+      same frequency.  Gain is the fitted amplitude against the input;
+      THD+N is everything left over, images and aliases included.
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include "HiFiResampler.h"
+
+#define INPUT_RATE    44100.0
+#define OUTPUT_RATE   48000.0
+#define FILTER_RATE   (INPUT_RATE * HIFI_RESAMPLER_UP)
+
+static std::vector<double> prototype()
+{
+  std::vector<double> h(HIFI_RESAMPLER_UP * HIFI_RESAMPLER_TAPS);
+
+  for (int p = 0; p < HIFI_RESAMPLER_UP; p++)
+  {
+    for (int k = 0; k < HIFI_RESAMPLER_TAPS; k++)
+    {
+      h[(HIFI_RESAMPLER_TAPS - 1 - k) * HIFI_RESAMPLER_UP + p] =
+        hifi_resampler_phases[p][k] / 32768.0 / HIFI_RESAMPLER_UP;
+    }
+  }
+  return h;
+}
+
+// Response of the prototype in dB at 'hz'.
+static double response(const std::vector<double> &h, double hz)
+{
+  double w = 2 * M_PI * hz / FILTER_RATE;
+  double stepRe = cos(w), stepIm = -sin(w);
+  double zRe = 1, zIm = 0, re = 0, im = 0;
+
+  for (size_t n = 0; n < h.size(); n++)
+  {
+    re += h[n] * zRe;
+    im += h[n] * zIm;
+    double t = zRe * stepRe - zIm * stepIm;
+    zIm = zRe * stepIm + zIm * stepRe;
+    zRe = t;
+  }
+  return 20 * log10(sqrt(re * re + im * im));
+}
+
+static void checkFilter()
+{
+  std::vector<double> h = prototype();
+  double low = 1e9, high = -1e9, worst = -1e9, worstHz = 0;
+
+  for (double hz = 0; hz <= 20000; hz += 10)
+  {
+    double db = response(h, hz);
+    low = (db < low) ? db : low;
+    high = (db > high) ? db : high;
+  }
+  for (double hz = 24100; hz <= FILTER_RATE / 2; hz += 50)
+  {
+    double db = response(h, hz);
+    if (db > worst)
+    {
+      worst = db;
+      worstHz = hz;
+    }
+  }
+  printf("filter: passband %+.4f .. %+.4f dB to 20kHz, "
+         "stopband %.1f dB (worst at %.0f Hz)\n", low, high, worst, worstHz);
+}
+
+// Run a sine through the converter; returns the gain in dB and sets the
+// THD+N in dB relative to the tone.
+static double checkTone(double hz, double &thdn)
+{
+  const int outFrames = 48000;
+  const int skip = 256;
+  double amplitude = pow(10.0, -1.0 / 20) * 32767;
+
+  HiFiResampler resampler;
+  resampler.begin(2);
+
+  std::vector<int32_t> out((outFrames + skip) * 2);
+  int32_t in[2 * 128];
+  uint32_t n = 0;
+  int produced = 0;
+
+  srand(1);
+  while (produced < outFrames + skip)
+  {
+    // Uneven blocks, as a file reader would deliver them.
+    uint16_t inFrames = 1 + rand() % 128;
+    uint16_t want = 1 + rand() % 96;
+    uint16_t used;
+
+    if (want > outFrames + skip - produced)
+    {
+      want = outFrames + skip - produced;
+    }
+    for (uint16_t i = 0; i < inFrames; i++)
+    {
+      int32_t s = (int32_t)lrint(amplitude * sin(2 * M_PI * hz * (n + i) / INPUT_RATE));
+      in[2 * i] = s * 65536;
+      in[2 * i + 1] = -s * 65536;
+    }
+    produced += resampler.process(in, inFrames, used, &out[2 * produced], want);
+    n += used;
+  }
+  resampler.end();
+
+  // Least squares fit of a sine and cosine at 'hz' to the left channel.
+  double w = 2 * M_PI * hz / OUTPUT_RATE;
+  double ss = 0, cc = 0, sc = 0, ys = 0, yc = 0, yy = 0;
+
+  for (int i = skip; i < outFrames + skip; i++)
+  {
+    double y = out[2 * i] / 65536.0;
+    double s = sin(w * i), c = cos(w * i);
+    ss += s * s;
+    cc += c * c;
+    sc += s * c;
+    ys += y * s;
+    yc += y * c;
+    yy += y * y;
+  }
+  double det = ss * cc - sc * sc;
+  double a = (ys * cc - yc * sc) / det;
+  double b = (yc * ss - ys * sc) / det;
+  double fitted = a * ys + b * yc;
+  double residual = yy - fitted;
+
+  thdn = 10 * log10((residual > 0 ? residual : 1e-30) / fitted);
+  return 20 * log10(sqrt(a * a + b * b) / amplitude);
+}
+
+int main()
+{
+  static const double tones[] =
+  {
+    20, 50, 100, 440, 1000, 3000, 6000, 10000, 14000, 17000, 19000, 20000
+  };
+  double low = 1e9, high = -1e9, worst = -1e9;
+
+  checkFilter();
+
+  for (size_t i = 0; i < sizeof(tones) / sizeof(tones[0]); i++)
+  {
+    double thdn;
+    double gain = checkTone(tones[i], thdn);
+
+    printf("%7.0f Hz  gain %+.4f dB  THD+N %6.1f dB\n", tones[i], gain, thdn);
+    low = (gain < low) ? gain : low;
+    high = (gain > high) ? gain : high;
+    worst = (thdn > worst) ? thdn : worst;
+  }
+  printf("converter: gain %+.4f .. %+.4f dB, worst THD+N %.1f dB\n",
+         low, high, worst);
+  return 0;
+}
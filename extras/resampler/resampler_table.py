@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+#
+# resampler_table.py
+#
+# Writes HiFiResamplerTable.c: the polyphase filter for the 44.1kHz to
+# 48kHz converter in HiFiResampler.h.
+#
+# The prototype is a Kaiser windowed sinc at 160 x 44.1kHz (7.056MHz),
+# 160 * 64 taps long, cut off at 22.05kHz, half way between the top of
+# the passband (20kHz) and the first image of it (24.1kHz).  It is split
+# into 160 phases of 64 taps, each phase stored oldest sample first so
+# the filter loop walks both the history and the coefficients upwards.
+# Coefficients are Q15 and scaled by 160 (the interpolation gain), so
+# each phase sums to unity.
+#
+# resampler_check.cpp measures the result; the figures in HiFiResampler.h
+# come from it.
+#
+# Usage:  resampler_table.py > ../../HiFiResamplerTable.c
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+
+import math
+import sys
+
+UP = 160
+DOWN = 147
+TAPS = 64
+INPUT_RATE = 44100.0
+CUTOFF = 22050.0
+BETA = 9.0
+COEF_BITS = 15
+
+HEADER = '''/*
+  HiFiResamplerTable.c
+
+  Polyphase filter for HiFiResampler: %d phases of %d taps, Q%d, each
+  phase stored oldest sample first.  Kaiser windowed sinc (beta %.1f)
+  at %d x 44.1kHz, cut off at %.0fHz.
+
+  Generated by extras/resampler/resampler_table.py; don't edit by hand.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdint.h>
+
+// Left in flash (no HIFI_RAMDATA): at 20K bytes it is too big to copy
+// and the filter reads it sequentially, which the flash prefetch handles.
+const int16_t hifi_resampler_phases[%d][%d] =
+{
+'''
+
+
+def bessel_i0(x):
+    total = term = 1.0
+    k = 1
+    while term > 1e-12 * total:
+        term *= (x / (2 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+
+def prototype():
+    length = UP * TAPS
+    centre = (length - 1) / 2.0
+    wc = 2 * math.pi * CUTOFF / (INPUT_RATE * UP)
+    norm = bessel_i0(BETA)
+    h = []
+    for n in range(length):
+        x = n - centre
+        window = bessel_i0(BETA * math.sqrt(max(0.0, 1 - (x / centre) ** 2))) / norm
+        sinc = math.sin(wc * x) / (wc * x) if x else 1.0
+        h.append(UP * wc / math.pi * sinc * window)
+    return h
+
+
+def main():
+    h = prototype()
+    # The centre tap of phase 0 is unity, one step short of it in Q15.
+    scale = (1 << COEF_BITS) - 1
+    out = sys.stdout
+
+    out.write(HEADER % (UP, TAPS, COEF_BITS, BETA, UP, CUTOFF, UP, TAPS))
+    for p in range(UP):
+        # Tap k of phase p multiplies the sample k steps back; store
+        # oldest first.
+        exact = [h[(TAPS - 1 - k) * UP + p] * scale for k in range(TAPS)]
+        taps = [int(round(v)) for v in exact]
+
+        # Rounding leaves each phase with a slightly different DC gain,
+        # which would modulate the signal at the phase rate and show up as
+        # images.  Nudge the taps that rounded furthest so every phase
+        # sums to exactly unity.
+        error = scale - sum(taps)
+        order = sorted(range(TAPS), key=lambda k: (exact[k] - taps[k]) *
+                       (1 if error > 0 else -1), reverse=True)
+        for k in order[:abs(error)]:
+            taps[k] += 1 if error > 0 else -1
+
+        out.write('  {\n')
+        for i in range(0, TAPS, 8):
+            out.write('    ' + ', '.join('%d' % t for t in taps[i:i + 8]) +
+                      (',\n' if i + 8 < TAPS else '\n'))
+        out.write('  },\n' if p + 1 < UP else '  }\n')
+    out.write('};\n')
+
+
+if __name__ == '__main__':
+    main()
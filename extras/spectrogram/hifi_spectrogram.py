@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+#
+# hifi_spectrogram.py
+#
+# Terminal viewer for the spectrum stream sent by HiFiSpectrogram (see the
+# SpectrogramStream example).  Each frame is drawn as one line of coloured
+# cells, lowest band on the left, so the terminal scrolls as a waterfall.
+#
+# Only the Python standard library is needed.  Usage:
+#
+#   hifi_spectrogram.py /dev/ttyACM0 [--baud 115200]
+#   hifi_spectrogram.py - < capture.bin
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+
+import argparse
+import os
+import shutil
+import struct
+import sys
+import termios
+
+SYNC = b'\xa5\x5a'
+PACKET_INFO = ord('I')
+PACKET_FRAME = ord('F')
+
+# Dark blue -> cyan -> yellow -> red -> white in the xterm 256 colour cube.
+PALETTE = [16, 17, 18, 19, 20, 21, 27, 33, 39, 45, 51, 50, 49, 48, 47, 46,
+           82, 118, 154, 190, 226, 220, 214, 208, 202, 196, 197, 198, 199,
+           200, 201, 207, 213, 219, 225, 231]
+
+
+def open_serial(path, baud):
+    fd = os.open(path, os.O_RDONLY | os.O_NOCTTY)
+    attrs = termios.tcgetattr(fd)
+    speed = getattr(termios, 'B%d' % baud)
+    # Raw 8N1
+    attrs[0] = 0
+    attrs[1] = 0
+    attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+    attrs[3] = 0
+    attrs[4] = speed
+    attrs[5] = speed
+    attrs[6][termios.VMIN] = 1
+    attrs[6][termios.VTIME] = 0
+    termios.tcsetattr(fd, termios.TCSANOW, attrs)
+    return os.fdopen(fd, 'rb', buffering=0)
+
+
+def packets(stream):
+    """Yield (type, payload) for every packet with a good checksum."""
+    buf = bytearray()
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            return
+        buf += chunk
+        while True:
+            start = buf.find(SYNC)
+            if start < 0:
+                del buf[:-1]
+                break
+            if len(buf) < start + 5:
+                del buf[:start]
+                break
+            ptype = buf[start + 2]
+            length = buf[start + 3]
+            end = start + 4 + length
+            if len(buf) < end + 1:
+                del buf[:start]
+                break
+            payload = bytes(buf[start + 4:end])
+            if (ptype + length + sum(payload)) & 0xFF == buf[end]:
+                yield ptype, payload
+                del buf[:end + 1]
+            else:
+                # False sync, look again one byte further on
+                del buf[:start + 1]
+
+
+def render(levels, width):
+    cells = []
+    bands = len(levels)
+    for col in range(width):
+        level = levels[col * bands // width]
+        colour = PALETTE[level * (len(PALETTE) - 1) // 255]
+        cells.append('\x1b[48;5;%dm ' % colour)
+    return ''.join(cells) + '\x1b[0m'
+
+
+def main():
+    parser = argparse.ArgumentParser(description="HiFiSpectrogram viewer")
+    parser.add_argument('device', help="serial device, or '-' for stdin")
+    parser.add_argument('--baud', type=int, default=115200)
+    args = parser.parse_args()
+
+    if args.device == '-':
+        stream = sys.stdin.buffer
+    else:
+        stream = open_serial(args.device, args.baud)
+
+    info = None
+    last_seq = None
+    lost = 0
+
+    for ptype, payload in packets(stream):
+        if ptype == PACKET_INFO and len(payload) >= 13:
+            rate, size, hop, bands, floor_db, ceil_db = \
+                struct.unpack('<IHHBhh', payload[:13])
+            if info != (rate, size, hop, bands, floor_db, ceil_db):
+                info = (rate, size, hop, bands, floor_db, ceil_db)
+                sys.stdout.write('%d Hz, %d point FFT, hop %d, %d bands of '
+                                 '%.0f Hz, %d..%d dBFS\n' %
+                                 (rate, size, hop, bands,
+                                  rate / 2.0 / bands, floor_db, ceil_db))
+        elif ptype == PACKET_FRAME and len(payload) > 1:
+            seq = payload[0]
+            if last_seq is not None and seq != (last_seq + 1) & 0xFF:
+                lost += (seq - last_seq - 1) & 0xFF
+            last_seq = seq
+            width = shutil.get_terminal_size((80, 24)).columns - 8
+            sys.stdout.write(render(payload[1:], max(width, 1)))
+            sys.stdout.write(' %5d\n' % lost if lost else '\n')
+            sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    try:
+        main()
+    except KeyboardInterrupt:
+        sys.stdout.write('\x1b[0m\n')
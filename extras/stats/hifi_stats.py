@@ -0,0 +1,303 @@
+#!/usr/bin/env python3
+#
+# hifi_stats.py
+#
+# Poller and decoder for the HiFiStats packet stream (see HiFiStats.h and
+# the StatsReporter example).  Every unit named on the command line is
+# sent a 'V' request each interval, all at once, and the replies are
+# collected as they arrive, so a slow or missing unit only costs its own
+# line.  The schema is fetched with an 'S' request the first time and
+# again whenever a unit's schema id changes.
+#
+# Counters are printed with their rate since the previous poll, gauges as
+# they are and histograms as their bin counts.  --csv prints one
+# "time,unit,name,value" row per number instead, for logging.
+#
+# Only the Python standard library is needed.  Usage:
+#
+#   hifi_stats.py /dev/ttyACM0 [/dev/ttyACM1 ...] [--interval 1] [--csv]
+#   hifi_stats.py - < capture.bin
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+
+import argparse
+import os
+import select
+import sys
+import termios
+import time
+
+SYNC = b'\xa5\x5a'
+PACKET_SCHEMA = ord('S')
+PACKET_VALUES = ord('V')
+
+COUNTER = 0
+GAUGE = 1
+HISTOGRAM = 2
+
+
+def open_serial(path, baud):
+    fd = os.open(path, os.O_RDWR | os.O_NOCTTY | os.O_NONBLOCK)
+    attrs = termios.tcgetattr(fd)
+    speed = getattr(termios, 'B%d' % baud)
+    # Raw 8N1
+    attrs[0] = 0
+    attrs[1] = 0
+    attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+    attrs[3] = 0
+    attrs[4] = speed
+    attrs[5] = speed
+    attrs[6][termios.VMIN] = 0
+    attrs[6][termios.VTIME] = 0
+    termios.tcsetattr(fd, termios.TCSANOW, attrs)
+    termios.tcflush(fd, termios.TCIOFLUSH)
+    return fd
+
+
+class Packets:
+    """Reassembles packets from arbitrary chunks of the byte stream."""
+
+    def __init__(self):
+        self.buf = bytearray()
+
+    def feed(self, chunk):
+        """Yield (type, payload) for every packet with a good checksum."""
+        buf = self.buf
+        buf += chunk
+        while True:
+            start = buf.find(SYNC)
+            if start < 0:
+                del buf[:-1]
+                return
+            if len(buf) < start + 6:
+                del buf[:start]
+                return
+            ptype = buf[start + 2]
+            length = buf[start + 3] | (buf[start + 4] << 8)
+            end = start + 5 + length
+            if len(buf) < end + 1:
+                del buf[:start]
+                return
+            payload = bytes(buf[start + 5:end])
+            total = ptype + buf[start + 3] + buf[start + 4] + sum(payload)
+            if total & 0xFF == buf[end]:
+                yield ptype, payload
+                del buf[:end + 1]
+            else:
+                # False sync, look again one byte further on
+                del buf[:start + 1]
+
+
+def varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if byte < 0x80:
+            return value, pos
+
+
+def signed(data, pos):
+    value, pos = varint(data, pos)
+    return (value >> 1) ^ -(value & 1), pos
+
+
+def parse_schema(payload):
+    """Return (schema id, [(type, name, bins, low, width), ...])."""
+    sid = payload[0] | (payload[1] << 8)
+    count = payload[2]
+    pos = 3
+    stats = []
+    for _ in range(count):
+        stype = payload[pos]
+        length = payload[pos + 1]
+        name = payload[pos + 2:pos + 2 + length].decode('ascii', 'replace')
+        pos += 2 + length
+        bins, low, width = 0, 0, 0
+        if stype == HISTOGRAM:
+            bins = payload[pos]
+            low, pos = signed(payload, pos + 1)
+            width, pos = varint(payload, pos)
+        stats.append((stype, name, bins, low, width))
+    return sid, stats
+
+
+def parse_values(payload, stats):
+    """Return (schema id, sequence, uptime ms, [value or [bins]])."""
+    sid = payload[0] | (payload[1] << 8)
+    seq = payload[2]
+    uptime, pos = varint(payload, 3)
+    values = []
+    for stype, _, bins, _, _ in stats:
+        if stype == COUNTER:
+            value, pos = varint(payload, pos)
+        elif stype == GAUGE:
+            value, pos = signed(payload, pos)
+        else:
+            value = []
+            for _ in range(bins):
+                count, pos = varint(payload, pos)
+                value.append(count)
+        values.append(value)
+    return sid, seq, uptime, values
+
+
+class Unit:
+    def __init__(self, name, fd=None):
+        self.name = name
+        self.fd = fd
+        self.packets = Packets()
+        self.schema_id = None
+        self.stats = []
+        self.last = None
+        self.lost = 0
+        self.last_seq = None
+        self.stale = False
+
+    def request(self, what):
+        try:
+            os.write(self.fd, what)
+        except OSError:
+            pass
+
+    def handle(self, ptype, payload, csv):
+        """Decode one packet; return True if it was a usable value packet."""
+        try:
+            if ptype == PACKET_SCHEMA:
+                self.schema_id, self.stats = parse_schema(payload)
+                self.last = None
+                return False
+            if ptype != PACKET_VALUES or self.schema_id is None:
+                return False
+            sid, seq, uptime, values = parse_values(payload, self.stats)
+        except IndexError:
+            return False
+        if sid != self.schema_id:
+            self.schema_id = None
+            self.stale = True
+            return False
+        if self.last_seq is not None and seq != (self.last_seq + 1) & 0xFF:
+            self.lost += (seq - self.last_seq - 1) & 0xFF
+        self.last_seq = seq
+        self.report(uptime, values, csv)
+        self.last = (uptime, values)
+        return True
+
+    def report(self, uptime, values, csv):
+        if csv:
+            now = '%.3f' % time.time()
+            for (stype, name, bins, low, width), value in \
+                    zip(self.stats, values):
+                if stype == HISTOGRAM:
+                    for i, count in enumerate(value):
+                        sys.stdout.write('%s,%s,%s[%d],%d\n' %
+                                         (now, self.name, name, i, count))
+                else:
+                    sys.stdout.write('%s,%s,%s,%d\n' %
+                                     (now, self.name, name, value))
+            return
+
+        fields = ['%s %10.3fs' % (self.name, uptime / 1000.0)]
+        dt = None
+        if self.last is not None and uptime > self.last[0]:
+            dt = (uptime - self.last[0]) / 1000.0
+        for i, ((stype, name, bins, low, width), value) in \
+                enumerate(zip(self.stats, values)):
+            if stype == COUNTER:
+                text = '%s=%d' % (name, value)
+                if dt:
+                    delta = (value - self.last[1][i]) & 0xFFFFFFFF
+                    text += ' (%.1f/s)' % (delta / dt)
+            elif stype == GAUGE:
+                text = '%s=%d' % (name, value)
+            else:
+                text = '%s[%d+%d*i]=%s' % (name, low, width,
+                                           ' '.join('%d' % c for c in value))
+            fields.append(text)
+        if self.lost:
+            fields.append('lost=%d' % self.lost)
+        sys.stdout.write('  '.join(fields) + '\n')
+
+
+def decode_stream(stream, csv):
+    unit = Unit('-')
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            return
+        for ptype, payload in unit.packets.feed(chunk):
+            unit.handle(ptype, payload, csv)
+        sys.stdout.flush()
+
+
+def poll(units, interval, timeout, csv):
+    by_fd = dict((u.fd, u) for u in units)
+    while True:
+        started = time.monotonic()
+        waiting = set()
+        for u in units:
+            u.stale = False
+            u.request(b'V' if u.schema_id is not None else b'SV')
+            waiting.add(u.fd)
+
+        deadline = started + timeout
+        while waiting:
+            left = deadline - time.monotonic()
+            if left <= 0:
+                break
+            ready, _, _ = select.select(list(waiting), [], [], left)
+            for fd in ready:
+                u = by_fd[fd]
+                try:
+                    chunk = os.read(fd, 4096)
+                except OSError:
+                    chunk = b''
+                for ptype, payload in u.packets.feed(chunk):
+                    if u.handle(ptype, payload, csv):
+                        waiting.discard(fd)
+                if u.stale:
+                    # Schema changed under us; ask again next round
+                    waiting.discard(fd)
+
+        for fd in waiting:
+            sys.stderr.write('%s: no reply\n' % by_fd[fd].name)
+        sys.stdout.flush()
+
+        pause = interval - (time.monotonic() - started)
+        if pause > 0:
+            time.sleep(pause)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="HiFiStats poller")
+    parser.add_argument('devices', nargs='+',
+                        help="serial devices, or '-' to decode stdin")
+    parser.add_argument('--baud', type=int, default=115200)
+    parser.add_argument('--interval', type=float, default=1.0,
+                        help="seconds between polls")
+    parser.add_argument('--timeout', type=float, default=0.5,
+                        help="seconds to wait for each round of replies")
+    parser.add_argument('--csv', action='store_true',
+                        help="print time,unit,name,value rows")
+    args = parser.parse_args()
+
+    if args.devices == ['-']:
+        decode_stream(sys.stdin.buffer, args.csv)
+        return
+
+    units = [Unit(os.path.basename(path), open_serial(path, args.baud))
+             for path in args.devices]
+    poll(units, args.interval, min(args.timeout, args.interval), args.csv)
+
+
+if __name__ == '__main__':
+    try:
+        main()
+    except KeyboardInterrupt:
+        pass
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+#
+# g711_tables.py
+#
+# Writes HiFiG711Tables.c: the mu-law and A-law expansion tables and the
+# segment lookup used by the encoders.  The tables follow the usual Sun
+# g711.c reference (the one behind most G.711 implementations), so the
+# library output matches it bit for bit.
+#
+# Usage:  g711_tables.py > ../../HiFiG711Tables.c
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+
+import sys
+
+HEADER = '''/*
+  HiFiG711Tables.c
+
+  Tables for the G.711 codecs in HiFiG711.h:
+    - hifi_ulaw_expand / hifi_alaw_expand: 16 bit linear value of each
+      code,
+    - hifi_g711_segment: bit length of the index (0 for 0), the segment
+      lookup for the encoders.
+
+  Generated by extras/telephony/g711_tables.py; don't edit by hand.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdint.h>
+#include "HiFiConfig.h"
+'''
+
+
+def ulaw_expand(code):
+    u = ~code & 0xFF
+    t = ((u & 0x0F) << 3) + 0x84
+    t <<= (u & 0x70) >> 4
+    return (0x84 - t) if (u & 0x80) else (t - 0x84)
+
+
+def alaw_expand(code):
+    a = code ^ 0x55
+    t = (a & 0x0F) << 4
+    seg = (a & 0x70) >> 4
+    if seg == 0:
+        t += 8
+    elif seg == 1:
+        t += 0x108
+    else:
+        t = (t + 0x108) << (seg - 1)
+    return t if (a & 0x80) else -t
+
+
+def emit(out, decl, values, per_line):
+    out.write('\n%s =\n{\n' % decl)
+    for i in range(0, len(values), per_line):
+        line = ', '.join(str(v) for v in values[i:i + per_line])
+        comma = ',' if i + per_line < len(values) else ''
+        out.write('  %s%s\n' % (line, comma))
+    out.write('};\n')
+
+
+def main():
+    out = sys.stdout
+    out.write(HEADER)
+    emit(out, 'HIFI_RAMDATA const int16_t hifi_ulaw_expand[256]',
+         [ulaw_expand(c) for c in range(256)], 8)
+    emit(out, 'HIFI_RAMDATA const int16_t hifi_alaw_expand[256]',
+         [alaw_expand(c) for c in range(256)], 8)
+    emit(out, 'HIFI_RAMDATA const uint8_t hifi_g711_segment[256]',
+         [i.bit_length() for i in range(256)], 16)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,169 @@
+/*
+  g7xx_check.cpp
+
+  Runs HiFiG711 and HiFiG722 over the vectors written by g7xx_vectors.py
+  and reports any difference.  Builds on the host:
+
+    g++ -O2 -I../.. g7xx_check.cpp ../../HiFiG711.cpp ../../HiFiG722.cpp \
+        -x c ../../HiFiG711Tables.c -o g7xx_check
+    ./g7xx_vectors.py vectors && ./g7xx_check vectors
+
+  The library is fed in 20ms blocks (320 samples) as a sketch would,
+  through the Q31 interface.
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "HiFiG711.h"
+#include "HiFiG722.h"
+
+#define BLOCK   320
+
+static std::vector<uint8_t> readFile(const std::string &path)
+{
+  std::vector<uint8_t> data;
+  FILE *f = fopen(path.c_str(), "rb");
+
+  if (!f)
+  {
+    fprintf(stderr, "can't open %s\n", path.c_str());
+    exit(2);
+  }
+
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+  {
+    data.insert(data.end(), buf, buf + n);
+  }
+  fclose(f);
+  return data;
+}
+
+static std::vector<int32_t> readPcm(const std::string &path)
+{
+  std::vector<uint8_t> raw = readFile(path);
+  std::vector<int32_t> q31(raw.size() / 2);
+
+  for (size_t i = 0; i < q31.size(); i++)
+  {
+    int16_t s = (int16_t)(raw[2 * i] | (raw[2 * i + 1] << 8));
+    q31[i] = (int32_t)s * 65536;
+  }
+  return q31;
+}
+
+static int compare(const char *what, const std::vector<uint8_t> &expect,
+                   const std::vector<uint8_t> &got)
+{
+  size_t errors = 0;
+  size_t first = 0;
+
+  for (size_t i = 0; i < expect.size() && i < got.size(); i++)
+  {
+    if (expect[i] != got[i] && errors++ == 0)
+    {
+      first = i;
+    }
+  }
+  errors += (expect.size() > got.size()) ? expect.size() - got.size() :
+                                           got.size() - expect.size();
+
+  printf("%-12s %6u values  ", what, (unsigned)expect.size());
+  if (errors)
+  {
+    printf("FAIL: %u differ, first at %u\n", (unsigned)errors, (unsigned)first);
+  }
+  else
+  {
+    printf("ok\n");
+  }
+  return errors ? 1 : 0;
+}
+
+static std::vector<uint8_t> toPcmBytes(const std::vector<int32_t> &q31)
+{
+  std::vector<uint8_t> raw(q31.size() * 2);
+
+  for (size_t i = 0; i < q31.size(); i++)
+  {
+    int16_t s = (int16_t)(q31[i] >> 16);
+    raw[2 * i] = s & 0xFF;
+    raw[2 * i + 1] = (s >> 8) & 0xFF;
+  }
+  return raw;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: g7xx_check <vector directory>\n");
+    return 2;
+  }
+
+  std::string dir = std::string(argv[1]) + "/";
+  std::vector<int32_t> input = readPcm(dir + "input.pcm");
+  size_t samples = input.size() - input.size() % BLOCK;
+  int failures = 0;
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// G.711
+  ///////////////////////////////////////////////////////////////////////////
+  const char *laws[2] = { "ulaw", "alaw" };
+
+  for (int l = 0; l < 2; l++)
+  {
+    HiFiG711 codec(l == 0 ? HIFI_G711_ULAW : HIFI_G711_ALAW);
+    std::vector<uint8_t> codes(samples);
+    std::vector<int32_t> decoded(samples);
+
+    for (size_t i = 0; i < samples; i += BLOCK)
+    {
+      codec.encode(&input[i], &codes[i], BLOCK);
+      codec.decode(&codes[i], &decoded[i], BLOCK);
+    }
+
+    std::vector<uint8_t> expect = readFile(dir + laws[l] + ".bin");
+    expect.resize(samples);
+    failures += compare((std::string(laws[l]) + " encode").c_str(),
+                        expect, codes);
+
+    expect = readFile(dir + laws[l] + ".pcm");
+    expect.resize(samples * 2);
+    failures += compare((std::string(laws[l]) + " decode").c_str(),
+                        expect, toPcmBytes(decoded));
+  }
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// G.722
+  ///////////////////////////////////////////////////////////////////////////
+  HiFiG722Encoder encoder;
+  HiFiG722Decoder decoder;
+  std::vector<uint8_t> codes(samples / 2);
+  std::vector<int32_t> decoded(samples);
+
+  for (size_t i = 0; i < samples; i += BLOCK)
+  {
+    encoder.encode(&input[i], &codes[i / 2], BLOCK);
+    decoder.decode(&codes[i / 2], &decoded[i], BLOCK / 2);
+  }
+
+  std::vector<uint8_t> expect = readFile(dir + "g722.bin");
+  expect.resize(samples / 2);
+  failures += compare("g722 encode", expect, codes);
+
+  expect = readFile(dir + "g722.pcm");
+  expect.resize(samples * 2);
+  failures += compare("g722 decode", expect, toPcmBytes(decoded));
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+#
+# g7xx_vectors.py
+#
+# Writes host test vectors for HiFiG711 and HiFiG722 into a directory:
+#
+#   input.pcm        16 bit little endian mono test signal (swept tone,
+#                    noise, silence and full scale clipping)
+#   ulaw.bin         G.711 mu-law codes for input.pcm
+#   ulaw.pcm         ... and what they decode to
+#   alaw.bin, alaw.pcm
+#   g722.bin         G.722 64K bit/s codes for input.pcm (taken as 16kHz)
+#   g722.pcm         ... and what they decode to
+#
+# G.711 comes from Python's audioop module (the Sun reference), G.722 from
+# a straight transcription of the ITU reference algorithm below, kept
+# separate from the library code.  g7xx_check.cpp runs the library over
+# the same input and compares.
+#
+# Needs Python 3.12 or older for audioop, which 3.13 removed; on 3.13 and
+# later install the audioop-lts package, which puts the module back.
+#
+# Usage:  g7xx_vectors.py <directory>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+
+import math
+import os
+import random
+import struct
+import sys
+import warnings
+
+with warnings.catch_warnings():
+    warnings.simplefilter('ignore', DeprecationWarning)
+    try:
+        import audioop
+    except ImportError:
+        sys.exit('g7xx_vectors.py needs audioop: use Python 3.12 or older, '
+                 'or pip install audioop-lts')
+
+RATE = 16000
+
+QMF = [3, -11, 12, 32, -210, 951, 3876, -805, 362, -156, 53, -11]
+Q6 = [0, 35, 72, 110, 150, 190, 233, 276, 323, 370, 422, 473, 530, 587,
+      650, 714, 786, 858, 940, 1023, 1121, 1219, 1339, 1458, 1612, 1765,
+      1980, 2195, 2557, 2919, 0, 0]
+ILN = [0, 63, 62, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18,
+       17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 0]
+ILP = [0, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46,
+       45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 0]
+QM6 = [-136, -136, -136, -136, -24808, -21904, -19008, -16704, -14984,
+       -13512, -12280, -11192, -10232, -9360, -8576, -7856, -7192, -6576,
+       -6000, -5456, -4944, -4464, -4008, -3576, -3168, -2776, -2400, -2032,
+       -1688, -1360, -1040, -728, 24808, 21904, 19008, 16704, 14984, 13512,
+       12280, 11192, 10232, 9360, 8576, 7856, 7192, 6576, 6000, 5456, 4944,
+       4464, 4008, 3576, 3168, 2776, 2400, 2032, 1688, 1360, 1040, 728, 432,
+       136, -432, -136]
+QM4 = [0, -20456, -12896, -8968, -6288, -4240, -2584, -1200, 20456, 12896,
+       8968, 6288, 4240, 2584, 1200, 0]
+QM2 = [-7408, -1616, 7408, 1616]
+WL = [-60, -30, 58, 172, 334, 538, 1198, 3042]
+RL42 = [0, 7, 6, 5, 4, 3, 2, 1, 7, 6, 5, 4, 3, 2, 1, 0]
+WH = [0, -214, 798]
+RH2 = [2, 1, 2, 1]
+ILB = [2048, 2093, 2139, 2186, 2233, 2282, 2332, 2383, 2435, 2489, 2543,
+       2599, 2656, 2714, 2774, 2834, 2896, 2960, 3025, 3091, 3158, 3228,
+       3298, 3371, 3444, 3520, 3597, 3676, 3756, 3838, 3922, 4008]
+IHN = [0, 1, 0]
+IHP = [0, 3, 2]
+
+
+def sat(x):
+    return max(-32768, min(32767, x))
+
+
+class Band:
+    def __init__(self, det):
+        self.s = self.sp = self.sz = self.nb = 0
+        self.det = det
+        self.r = [0] * 3
+        self.a = [0] * 3
+        self.ap = [0] * 3
+        self.p = [0] * 3
+        self.d = [0] * 7
+        self.b = [0] * 7
+        self.bp = [0] * 7
+
+    def scale(self, w, limit, base):
+        self.nb = max(0, min(limit, ((self.nb * 127) >> 7) + w))
+        shift = base - (self.nb >> 11)
+        v = ILB[(self.nb >> 6) & 31]
+        self.det = ((v << -shift) if shift < 0 else (v >> shift)) << 2
+
+    def adapt(self, d):
+        self.d[0] = d
+        self.r[0] = sat(self.s + d)
+        self.p[0] = sat(self.sz + d)
+
+        sg = [v >> 15 for v in self.p]
+        wd1 = sat(self.a[1] << 2)
+        wd2 = -wd1 if sg[0] == sg[1] else wd1
+        wd2 = min(wd2, 32767)
+        wd3 = (wd2 >> 7) + (128 if sg[0] == sg[2] else -128)
+        wd3 += (self.a[2] * 32512) >> 15
+        self.ap[2] = max(-12288, min(12288, wd3))
+
+        wd1 = 192 if sg[0] == sg[1] else -192
+        self.ap[1] = sat(wd1 + ((self.a[1] * 32640) >> 15))
+        wd3 = sat(15360 - self.ap[2])
+        self.ap[1] = max(-wd3, min(wd3, self.ap[1]))
+
+        step = 0 if d == 0 else 128
+        sgd = d >> 15
+        for i in range(1, 7):
+            wd2 = step if (self.d[i] >> 15) == sgd else -step
+            self.bp[i] = sat(wd2 + ((self.b[i] * 32640) >> 15))
+
+        for i in range(6, 0, -1):
+            self.d[i] = self.d[i - 1]
+            self.b[i] = self.bp[i]
+        for i in range(2, 0, -1):
+            self.r[i] = self.r[i - 1]
+            self.p[i] = self.p[i - 1]
+            self.a[i] = self.ap[i]
+
+        self.sp = sat(((self.a[1] * sat(2 * self.r[1])) >> 15) +
+                      ((self.a[2] * sat(2 * self.r[2])) >> 15))
+        self.sz = sat(sum((self.b[i] * sat(2 * self.d[i])) >> 15
+                          for i in range(1, 7)))
+        self.s = sat(self.sp + self.sz)
+
+
+def g722_encode(pcm):
+    low, high = Band(32), Band(8)
+    x = [0] * 24
+    out = bytearray()
+    for n in range(0, len(pcm) - 1, 2):
+        x = x[2:] + [pcm[n], pcm[n + 1]]
+        sum_odd = sum(x[2 * i] * QMF[i] for i in range(12))
+        sum_even = sum(x[2 * i + 1] * QMF[11 - i] for i in range(12))
+        xlow = (sum_even + sum_odd) >> 14
+        xhigh = (sum_even - sum_odd) >> 14
+
+        el = sat(xlow - low.s)
+        wd = el if el >= 0 else -(el + 1)
+        i = 1
+        while i < 30 and wd >= (Q6[i] * low.det) >> 12:
+            i += 1
+        ilow = ILN[i] if el < 0 else ILP[i]
+        dlow = (low.det * QM4[ilow >> 2]) >> 15
+        low.scale(WL[RL42[ilow >> 2]], 18432, 8)
+        low.adapt(dlow)
+
+        eh = sat(xhigh - high.s)
+        wd = eh if eh >= 0 else -(eh + 1)
+        mih = 2 if wd >= (564 * high.det) >> 12 else 1
+        ihigh = IHN[mih] if eh < 0 else IHP[mih]
+        dhigh = (high.det * QM2[ihigh]) >> 15
+        high.scale(WH[RH2[ihigh]], 22528, 10)
+        high.adapt(dhigh)
+
+        out.append((ihigh << 6) | ilow)
+    return bytes(out)
+
+
+def g722_decode(codes):
+    low, high = Band(32), Band(8)
+    x = [0] * 24
+    out = []
+    for code in codes:
+        ilow, ihigh = code & 0x3F, code >> 6
+
+        rlow = max(-16384, min(16383, low.s + ((low.det * QM6[ilow]) >> 15)))
+        dlow = (low.det * QM4[ilow >> 2]) >> 15
+        low.scale(WL[RL42[ilow >> 2]], 18432, 8)
+        low.adapt(dlow)
+
+        dhigh = (high.det * QM2[ihigh]) >> 15
+        rhigh = max(-16384, min(16383, high.s + dhigh))
+        high.scale(WH[RH2[ihigh]], 22528, 10)
+        high.adapt(dhigh)
+
+        x = x[2:] + [rlow + rhigh, rlow - rhigh]
+        out.append(sat(sum(x[2 * i + 1] * QMF[11 - i] for i in range(12)) >> 11))
+        out.append(sat(sum(x[2 * i] * QMF[i] for i in range(12)) >> 11))
+    return out
+
+
+def test_signal():
+    rng = random.Random(722)
+    pcm = []
+    # 2s log sweep 50Hz .. 7.5kHz at -6dBFS
+    f0, f1, secs = 50.0, 7500.0, 2.0
+    k = math.log(f1 / f0) / secs
+    for n in range(int(RATE * secs)):
+        t = n / RATE
+        phase = 2 * math.pi * f0 * (math.exp(k * t) - 1) / k
+        pcm.append(int(16383 * math.sin(phase)))
+    # 0.5s of noise, 0.25s of silence, 0.25s of clipped square wave
+    pcm += [rng.randint(-8000, 8000) for _ in range(RATE // 2)]
+    pcm += [0] * (RATE // 4)
+    pcm += [32767 if (n // 20) & 1 else -32768 for n in range(RATE // 4)]
+    return pcm
+
+
+def write_pcm(path, samples):
+    with open(path, 'wb') as f:
+        f.write(struct.pack('<%dh' % len(samples), *samples))
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit('usage: g7xx_vectors.py <directory>')
+    out = sys.argv[1]
+    os.makedirs(out, exist_ok=True)
+
+    pcm = test_signal()
+    raw = struct.pack('<%dh' % len(pcm), *pcm)
+    write_pcm(os.path.join(out, 'input.pcm'), pcm)
+
+    for law, enc, dec in (('ulaw', audioop.lin2ulaw, audioop.ulaw2lin),
+                          ('alaw', audioop.lin2alaw, audioop.alaw2lin)):
+        codes = enc(raw, 2)
+        with open(os.path.join(out, law + '.bin'), 'wb') as f:
+            f.write(codes)
+        with open(os.path.join(out, law + '.pcm'), 'wb') as f:
+            f.write(dec(codes, 2))
+
+    codes = g722_encode(pcm)
+    with open(os.path.join(out, 'g722.bin'), 'wb') as f:
+        f.write(codes)
+    write_pcm(os.path.join(out, 'g722.pcm'), g722_decode(codes))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,152 @@
+/*
+  wavetable_check.cpp
+
+  Measures HiFiWavetable on the host.  Builds with:
+
+    gcc -c -O2 -I../.. ../../HiFiWavetableTables.c -o tables.o
+    g++ -O2 -I../.. wavetable_check.cpp ../../HiFiWavetable.cpp tables.o \
+        -o wavetable_check -lm
+    ./wavetable_check
+
+  Each wave is played at full scale at pitches from 25Hz to 10kHz, 2^16
+  samples at 48kHz in 64 frame blocks.  Every pitch is an odd number of
+  bins of a 2^16 point DFT, so the harmonics land exactly on bins and
+  anything between them can only be aliasing (of the band-limited table
+  or of the interpolation).  The figure is the loudest such component
+  below 20kHz relative to the fundamental.  The morph between each pair
+  of waves is measured the same way half way between them.
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+*/
+
+#include <complex>
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+#include "HiFiWavetable.h"
+
+#define RATE        48000.0
+#define LOG2_SIZE   16
+#define SIZE        (1 << LOG2_SIZE)
+#define BLOCK       64
+
+typedef std::complex<double> cplx;
+
+static void fft(std::vector<cplx> &x)
+{
+  size_t n = x.size();
+
+  for (size_t i = 1, j = 0; i < n; i++)
+  {
+    size_t bit = n >> 1;
+    for (; j & bit; bit >>= 1)
+    {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j)
+    {
+      std::swap(x[i], x[j]);
+    }
+  }
+  for (size_t len = 2; len <= n; len <<= 1)
+  {
+    cplx w(cos(-2 * M_PI / len), sin(-2 * M_PI / len));
+    for (size_t i = 0; i < n; i += len)
+    {
+      cplx wk(1, 0);
+      for (size_t k = 0; k < len / 2; k++)
+      {
+        cplx a = x[i + k];
+        cplx b = x[i + k + len / 2] * wk;
+        x[i + k] = a + b;
+        x[i + k + len / 2] = a - b;
+        wk *= w;
+      }
+    }
+  }
+}
+
+// Worst alias below 20kHz in dB relative to the fundamental, for a wave
+// played at 'bin' cycles per SIZE samples.
+static double worstAlias(uint32_t morph, uint32_t bin, uint8_t &level)
+{
+  HiFiWavetable osc;
+  std::vector<int32_t> out(SIZE);
+  std::vector<cplx> x(SIZE);
+
+  osc.setMorph(morph);
+  osc.begin(48000);
+  osc.setIncrement(bin << (32 - LOG2_SIZE));
+  for (int i = 0; i < SIZE; i += BLOCK)
+  {
+    osc.render(&out[i], BLOCK);
+  }
+  level = osc.getLevel();
+
+  for (int i = 0; i < SIZE; i++)
+  {
+    x[i] = cplx(out[i] / 2147483648.0, 0);
+  }
+  fft(x);
+
+  double fundamental = std::abs(x[bin]);
+  double worst = 0;
+  uint32_t top = (uint32_t)(20000.0 / RATE * SIZE);
+
+  for (uint32_t k = 1; k <= top; k++)
+  {
+    if (k % bin != 0 && std::abs(x[k]) > worst)
+    {
+      worst = std::abs(x[k]);
+    }
+  }
+  return 20 * log10(worst / fundamental + 1e-30);
+}
+
+int main()
+{
+  static const char *names[] = { "sine", "triangle", "saw", "square" };
+
+  printf("%-18s %8s %6s %10s\n", "wave", "Hz", "level", "alias dB");
+  for (int w = 0; w < 2 * HIFI_WAVETABLE_WAVES - 1; w++)
+  {
+    uint32_t morph = (uint32_t)w << 15;
+    char name[32];
+    double worst = -1000;
+    double worstHz = 0;
+
+    if (w & 1)
+    {
+      snprintf(name, sizeof(name), "%s/%s", names[w / 2], names[w / 2 + 1]);
+    }
+    else
+    {
+      snprintf(name, sizeof(name), "%s", names[w / 2]);
+    }
+
+    // Odd bins, about 4 per octave from 25Hz up
+    for (double hz = 25; hz < 10000; hz *= 1.19)
+    {
+      uint32_t bin = (uint32_t)(hz / RATE * SIZE) | 1;
+      uint8_t level;
+      double alias = worstAlias(morph, bin, level);
+
+      if (alias > worst)
+      {
+        worst = alias;
+        worstHz = bin * RATE / SIZE;
+      }
+      if (w == 4)
+      {
+        printf("%-18s %8.1f %6d %10.1f\n", name, bin * RATE / SIZE, level,
+               alias);
+      }
+    }
+    printf("%-18s worst %7.1f dB at %.1f Hz\n", name, worst, worstHz);
+  }
+  return 0;
+}
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+#
+# wavetable_tables.py
+#
+# Writes HiFiWavetableTables.c: the band-limited mipmaps behind the
+# oscillator in HiFiWavetable.h.
+#
+# Each waveform (sine, triangle, saw, square, in morph order) is summed
+# from its Fourier series at 10 levels.  Level l keeps harmonics 1 .. H,
+# H = 512 >> l, and is played for fundamentals up to 0.5833 * fs / H, so
+# the top harmonic never goes past 28kHz at 48kHz and whatever folds back
+# lands above 20kHz.  A level's table holds 16 samples per cycle of its
+# top harmonic (1024 to 2048 samples, so only 4 at the lowest level) to
+# keep the images of linear interpolation down, plus a copy of the first
+# sample at the end so reads never wrap.  Levels that come out identical
+# (all of the sine's, the top few of the triangle's) share one table.
+#
+# All the waves have their fundamental in phase with the sine, so morphing
+# between neighbours doesn't cancel it, and every level of a wave is
+# scaled by the same factor (peak of the loudest level = 32767) so notes
+# don't change level across octave boundaries.
+#
+# wavetable_check.cpp measures the aliasing of the result.
+#
+# Usage:  wavetable_tables.py > ../../HiFiWavetableTables.c
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+
+import math
+import sys
+
+LEVELS = 10
+TOP_HARMONICS = 512
+MAX_HARMONIC_FRACTION = 28000.0 / 48000.0
+SAMPLES_PER_TOP_HARMONIC = 16
+MIN_LOG2_SIZE = 10
+MAX_LOG2_SIZE = 11
+
+WAVES = [
+    ('sine', lambda h: 1.0 if h == 1 else 0.0),
+    # Odd harmonics, 1/h^2, alternating sign so each peak lines up
+    ('triangle', lambda h: (0.0 if h % 2 == 0 else
+                            (1.0 if (h // 2) % 2 == 0 else -1.0) / h ** 2)),
+    ('saw', lambda h: 1.0 / h),
+    ('square', lambda h: 0.0 if h % 2 == 0 else 1.0 / h),
+]
+
+HEADER = '''/*
+  HiFiWavetableTables.c
+
+  Band-limited mipmaps for HiFiWavetable: %d waves (sine, triangle, saw,
+  square) at %d levels.  Level l keeps harmonics 1 .. %d >> l and is used
+  for phase increments up to hifi_wavetable_max_increment[l].  Each
+  table has 2^hifi_wavetable_log2_size[l] samples, Q15, plus a repeat of
+  the first.
+
+  Generated by extras/wavetable/wavetable_tables.py; don't edit by hand.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+  See the GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdint.h>
+#include "HiFiConfig.h"
+
+// Left in flash (no HIFI_RAMDATA): about 78K bytes in all, and each
+// voice only reads one or two small stretches of it per block.
+'''
+
+
+def log2_size(level):
+    harmonics = TOP_HARMONICS >> level
+    size = harmonics * SAMPLES_PER_TOP_HARMONIC
+    bits = int(math.log2(size))
+    return max(MIN_LOG2_SIZE, min(MAX_LOG2_SIZE, bits))
+
+
+def synthesise(amplitude, harmonics, size):
+    coefs = [(h, amplitude(h)) for h in range(1, harmonics + 1)]
+    coefs = [(h, a) for h, a in coefs if a]
+    return [sum(a * math.sin(2 * math.pi * h * n / size) for h, a in coefs)
+            for n in range(size)]
+
+
+def table(out, ctype, name, values, per_line=8, prefix=''):
+    out.write('\n%sconst %s %s[%d] =\n{\n' % (prefix, ctype, name,
+                                              len(values)))
+    for i in range(0, len(values), per_line):
+        out.write('  ' + ', '.join('%d' % v for v in values[i:i + per_line]) +
+                  (',\n' if i + per_line < len(values) else '\n'))
+    out.write('};\n')
+
+
+def main():
+    out = sys.stdout
+    out.write(HEADER % (len(WAVES), LEVELS, TOP_HARMONICS))
+
+    sizes = [log2_size(l) for l in range(LEVELS)]
+    increments = [int(MAX_HARMONIC_FRACTION * 2 ** 32 /
+                      (TOP_HARMONICS >> l)) for l in range(LEVELS)]
+    table(out, 'uint8_t', 'hifi_wavetable_log2_size', sizes, per_line=10)
+    table(out, 'uint32_t', 'hifi_wavetable_max_increment', increments,
+          per_line=5)
+
+    names = {}
+    unique = []
+    for name, amplitude in WAVES:
+        levels = [synthesise(amplitude, TOP_HARMONICS >> l, 1 << sizes[l])
+                  for l in range(LEVELS)]
+        scale = 32767.0 / max(max(abs(v) for v in level) for level in levels)
+        for l, level in enumerate(levels):
+            samples = [int(round(v * scale)) for v in level]
+            samples.append(samples[0])
+            # High levels of the sparser waves often come out the same
+            same = [n for n, s in unique if s == samples]
+            if same:
+                names[(name, l)] = same[0]
+                continue
+            names[(name, l)] = 'hifi_wavetable_%s_%d' % (name, l)
+            unique.append((names[(name, l)], samples))
+            table(out, 'int16_t', names[(name, l)], samples,
+                  prefix='static ')
+
+    out.write('\nconst int16_t *const hifi_wavetable[%d][%d] =\n{\n' %
+              (len(WAVES), LEVELS))
+    for w, (name, _) in enumerate(WAVES):
+        row = [names[(name, l)] for l in range(LEVELS)]
+        out.write('  {\n')
+        for i in range(0, LEVELS, 3):
+            out.write('    ' + ', '.join(row[i:i + 3]) +
+                      (',\n' if i + 3 < LEVELS else '\n'))
+        out.write('  },\n' if w + 1 < len(WAVES) else '  }\n')
+    out.write('};\n')
+
+
+if __name__ == '__main__':
+    main()